@@ -45,8 +45,9 @@ void DeviceSoapySDR::closeSoapySdr(SoapySDR::Device *device)
 
 SoapySDR::Device *DeviceSoapySDR::openopenSoapySDRFromSequence(uint32_t sequence, const QString& hardwareUserArguments)
 {
-    if (sequence > m_scanner.getNbDevices())
+    if (sequence >= m_scanner.getNbDevices())
     {
+        qWarning("DeviceSoapySDR::openopenSoapySDRFromSequence: no device #%u in %u scanned devices", sequence, m_scanner.getNbDevices());
         return 0;
     }
     else
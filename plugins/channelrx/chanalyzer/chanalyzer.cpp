@@ -81,6 +81,12 @@ void ChannelAnalyzer::feed(const SampleVector::const_iterator& begin, const Samp
     m_basebandSink->feed(begin, end);
 }
 
+bool ChannelAnalyzer::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void ChannelAnalyzer::start()
 {
     qDebug() << "ChannelAnalyzer::start";
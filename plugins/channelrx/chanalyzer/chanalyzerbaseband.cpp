@@ -30,8 +30,10 @@ ChannelAnalyzerBaseband::ChannelAnalyzerBaseband() :
     m_mutex(QMutex::Recursive)
 {
     qDebug("ChannelAnalyzerBaseband::ChannelAnalyzerBaseband");
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 ChannelAnalyzerBaseband::~ChannelAnalyzerBaseband()
@@ -45,6 +47,7 @@ void ChannelAnalyzerBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void ChannelAnalyzerBaseband::startWork()
@@ -57,6 +60,13 @@ void ChannelAnalyzerBaseband::startWork()
         &ChannelAnalyzerBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &ChannelAnalyzerBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -71,6 +81,12 @@ void ChannelAnalyzerBaseband::stopWork()
         this,
         &ChannelAnalyzerBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &ChannelAnalyzerBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -83,6 +99,10 @@ void ChannelAnalyzerBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
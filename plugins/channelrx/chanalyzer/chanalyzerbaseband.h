@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -59,6 +60,7 @@ public:
     ChannelAnalyzerBaseband();
     ~ChannelAnalyzerBaseband();
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     bool isRunning() const { return m_running; }
@@ -75,6 +77,7 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     ChannelAnalyzerSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
@@ -103,6 +103,12 @@ void ADSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVect
     m_basebandSink->feed(begin, end);
 }
 
+bool ADSBDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void ADSBDemod::start()
 {
     qDebug() << "ADSBDemod::start";
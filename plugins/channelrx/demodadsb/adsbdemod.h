@@ -69,6 +69,7 @@ public:
 
     using BasebandSampleSink::feed;
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool po);
+    virtual bool setSampleRingReader(SampleSinkRingReader *reader);
     virtual void start();
     virtual void stop();
     virtual bool handleMessage(const Message& cmd);
@@ -30,8 +30,10 @@ MESSAGE_CLASS_DEFINITION(ADSBDemodBaseband::MsgConfigureADSBDemodBaseband, Messa
 ADSBDemodBaseband::ADSBDemodBaseband() :
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(8000000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("ADSBDemodBaseband::ADSBDemodBaseband");
     QObject::connect(
@@ -41,6 +43,13 @@ ADSBDemodBaseband::ADSBDemodBaseband() :
         &ADSBDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &ADSBDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
 }
@@ -54,6 +63,7 @@ void ADSBDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void ADSBDemodBaseband::startWork()
@@ -75,6 +85,10 @@ void ADSBDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
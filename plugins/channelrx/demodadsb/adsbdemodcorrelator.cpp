@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "dsp/cpufeatures.h"
+
+#include "adsbdemodcorrelator.h"
+#include "adsb.h"
+
+#if defined(SDR_SIMD_X86)
+#include <immintrin.h>
+#elif defined(SDR_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+// Preamble chips set to one are 0, 2, 7 and 9
+static inline Real onesScalar(const Real *c, int spc, int j)
+{
+    return (c[j] + c[j + 2*spc]) + (c[j + 7*spc] + c[j + 9*spc]); // same order as the SIMD kernels
+}
+
+static void correlateScalar(const Real *c, const Real *w, int spc, int start, int end, Real threshold, std::vector<int>& candidates)
+{
+    for (int j = start; j < end; j++)
+    {
+        Real ones = onesScalar(c, spc, j);
+
+        if ((ones > threshold * (w[j] - ones)) && (ones != 0.0f)) {
+            candidates.push_back(j);
+        }
+    }
+}
+
+static inline void pushMask(unsigned int mask, int j, std::vector<int>& candidates)
+{
+    for (int k = 0; mask != 0; k++, mask >>= 1)
+    {
+        if (mask & 1) {
+            candidates.push_back(j + k);
+        }
+    }
+}
+
+#if defined(SDR_SIMD_X86)
+static SDR_SIMD_TARGET_SSE2 int correlateSSE2(const Real *c, const Real *w, int spc, int end, Real threshold, std::vector<int>& candidates)
+{
+    __m128 t = _mm_set1_ps(threshold);
+    __m128 zero = _mm_setzero_ps();
+    int j = 0;
+
+    for (; j + 4 <= end; j += 4)
+    {
+        __m128 ones = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(&c[j]), _mm_loadu_ps(&c[j + 2*spc])),
+                                 _mm_add_ps(_mm_loadu_ps(&c[j + 7*spc]), _mm_loadu_ps(&c[j + 9*spc])));
+        __m128 zeros = _mm_sub_ps(_mm_loadu_ps(&w[j]), ones);
+        __m128 match = _mm_and_ps(_mm_cmpgt_ps(ones, _mm_mul_ps(t, zeros)), _mm_cmpneq_ps(ones, zero));
+        unsigned int mask = _mm_movemask_ps(match);
+
+        if (mask) {
+            pushMask(mask, j, candidates);
+        }
+    }
+
+    return j;
+}
+
+static SDR_SIMD_TARGET_AVX2 int correlateAVX2(const Real *c, const Real *w, int spc, int end, Real threshold, std::vector<int>& candidates)
+{
+    __m256 t = _mm256_set1_ps(threshold);
+    __m256 zero = _mm256_setzero_ps();
+    int j = 0;
+
+    for (; j + 8 <= end; j += 8)
+    {
+        __m256 ones = _mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(&c[j]), _mm256_loadu_ps(&c[j + 2*spc])),
+                                    _mm256_add_ps(_mm256_loadu_ps(&c[j + 7*spc]), _mm256_loadu_ps(&c[j + 9*spc])));
+        __m256 zeros = _mm256_sub_ps(_mm256_loadu_ps(&w[j]), ones);
+        __m256 match = _mm256_and_ps(_mm256_cmp_ps(ones, _mm256_mul_ps(t, zeros), _CMP_GT_OQ), _mm256_cmp_ps(ones, zero, _CMP_NEQ_UQ));
+        unsigned int mask = _mm256_movemask_ps(match);
+
+        if (mask) {
+            pushMask(mask, j, candidates);
+        }
+    }
+
+    return j;
+}
+#elif defined(SDR_SIMD_NEON)
+static int correlateNEON(const Real *c, const Real *w, int spc, int end, Real threshold, std::vector<int>& candidates)
+{
+    float32x4_t t = vdupq_n_f32(threshold);
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    static const uint32_t bits[4] = {1, 2, 4, 8};
+    uint32x4_t weights = vld1q_u32(bits);
+    int j = 0;
+
+    for (; j + 4 <= end; j += 4)
+    {
+        float32x4_t ones = vaddq_f32(vaddq_f32(vld1q_f32(&c[j]), vld1q_f32(&c[j + 2*spc])),
+                                     vaddq_f32(vld1q_f32(&c[j + 7*spc]), vld1q_f32(&c[j + 9*spc])));
+        float32x4_t zeros = vsubq_f32(vld1q_f32(&w[j]), ones);
+        uint32x4_t match = vandq_u32(vcgtq_f32(ones, vmulq_f32(t, zeros)), vmvnq_u32(vceqq_f32(ones, zero)));
+        uint32x4_t m = vandq_u32(match, weights);
+        uint32x2_t s = vpadd_u32(vget_low_u32(m), vget_high_u32(m));
+        unsigned int mask = vget_lane_u32(vpadd_u32(s, s), 0);
+
+        if (mask) {
+            pushMask(mask, j, candidates);
+        }
+    }
+
+    return j;
+}
+#endif
+
+ADSBDemodCorrelator::ADSBDemodCorrelator() :
+    m_nbOffsets(0),
+    m_samplesPerChip(1)
+{
+}
+
+void ADSBDemodCorrelator::setSamples(const Real *samples, int nbOffsets, int samplesPerChip, int samplesPerFrame, bool fullPreamble)
+{
+    int nbSamples = nbOffsets + samplesPerFrame - 1;
+    int nbChipSums = nbSamples - samplesPerChip + 1;
+    int windowLength = (fullPreamble ? ADS_B_PREAMBLE_CHIPS : ADS_B_PREAMBLE_CHIPS - 4) * samplesPerChip;
+    m_nbOffsets = nbOffsets;
+    m_samplesPerChip = samplesPerChip;
+
+    // Prefix sums are local to the block and kept in double so that differences keep the precision of the samples
+    m_prefixSums.resize(nbSamples + 1);
+    m_prefixSums[0] = 0.0;
+
+    for (int i = 0; i < nbSamples; i++) {
+        m_prefixSums[i + 1] = m_prefixSums[i] + samples[i];
+    }
+
+    m_chipSums.resize(nbChipSums);
+    m_windowSums.resize(nbOffsets);
+    const double *p = m_prefixSums.data();
+
+    for (int j = 0; j < nbChipSums; j++) {
+        m_chipSums[j] = p[j + samplesPerChip] - p[j];
+    }
+
+    for (int j = 0; j < nbOffsets; j++) {
+        m_windowSums[j] = p[j + windowLength] - p[j];
+    }
+}
+
+Real ADSBDemodCorrelator::getOnes(int offset) const
+{
+    return onesScalar(m_chipSums.data(), m_samplesPerChip, offset);
+}
+
+void ADSBDemodCorrelator::correlate(Real threshold, std::vector<int>& candidates) const
+{
+    const Real *c = m_chipSums.data();
+    const Real *w = m_windowSums.data();
+    int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = correlateAVX2(c, w, m_samplesPerChip, m_nbOffsets, threshold, candidates);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = correlateSSE2(c, w, m_samplesPerChip, m_nbOffsets, threshold, candidates);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = correlateNEON(c, w, m_samplesPerChip, m_nbOffsets, threshold, candidates);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    correlateScalar(c, w, m_samplesPerChip, done, m_nbOffsets, threshold, candidates);
+}
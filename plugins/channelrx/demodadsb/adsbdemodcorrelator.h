@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_ADSBDEMODCORRELATOR_H
+#define INCLUDE_ADSBDEMODCORRELATOR_H
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+
+/**
+ * Preamble correlator over a contiguous block of magnitude squared samples. The energy
+ * of every chip and of every preamble window is derived from prefix sums so that each
+ * sample offset costs a few additions whatever the number of samples per chip. The
+ * threshold is then evaluated for all offsets with SIMD kernels.
+ */
+class ADSBDemodCorrelator
+{
+public:
+    ADSBDemodCorrelator();
+
+    /**
+     * Prepares chip sums for offsets [0, nbOffsets) of samples. samples must hold at least
+     * nbOffsets + samplesPerFrame - 1 values so that whole frames can be demodulated.
+     */
+    void setSamples(const Real *samples, int nbOffsets, int samplesPerChip, int samplesPerFrame, bool fullPreamble);
+    void correlate(Real threshold, std::vector<int>& candidates) const; //!< offsets where ones > threshold * zeros
+    Real getChipSum(int offset) const { return m_chipSums[offset]; }    //!< energy of the chip starting at offset
+    Real getOnes(int offset) const;
+    Real getZeros(int offset) const { return m_windowSums[offset] - getOnes(offset); }
+
+private:
+    int m_nbOffsets;
+    int m_samplesPerChip;
+    std::vector<double> m_prefixSums;
+    std::vector<Real> m_chipSums;
+    std::vector<Real> m_windowSums;    //!< energy of the whole correlated part of the preamble
+};
+
+#endif // INCLUDE_ADSBDEMODCORRELATOR_H
@@ -34,281 +34,400 @@
 
 MESSAGE_CLASS_DEFINITION(ADSBDemodSinkWorker::MsgConfigureADSBDemodSinkWorker, Message)
 
-void ADSBDemodSinkWorker::run()
+ADSBDemodSinkWorker::ADSBDemodSinkWorker(ADSBDemodSink *sink) :
+    m_sink(sink),
+    m_demodStats(),
+    m_correlationThresholdLinear(0.02f),
+    m_correlationScale(2.0f),
+    m_samplesPerBit(0),
+    m_samplesPerChip(0),
+    m_samplesPerFrame(0)
 {
-    int readBuffer = 0;
-
-    // Acquire first buffer
-    m_sink->m_bufferRead[readBuffer].acquire();
+    int nbThreads = QThread::idealThreadCount();
+    nbThreads = nbThreads < 1 ? 1 : nbThreads;
+    m_threadPool.setMaxThreadCount(nbThreads);
+    m_threadPool.setExpiryTimeout(-1); // keep the threads alive
 
-    // Start recording how much time is spent processing in this method
-    boost::chrono::steady_clock::time_point startPoint = boost::chrono::steady_clock::now();
+    for (int i = 0; i < nbThreads; i++) {
+        m_tasks.push_back(new DemodTask(this, &m_done));
+    }
+}
 
-    // Check for updated settings
-    handleInputMessages();
+ADSBDemodSinkWorker::~ADSBDemodSinkWorker()
+{
+    m_threadPool.waitForDone();
 
-    // samplesPerBit is only changed when the thread is stopped
-    int samplesPerBit = m_settings.m_samplesPerBit;
-    int samplesPerFrame = samplesPerBit*(ADS_B_PREAMBLE_BITS+ADS_B_ES_BITS);
-    int samplesPerChip = samplesPerBit/ADS_B_CHIPS_PER_BIT;
+    for (auto task : m_tasks) {
+        delete task;
+    }
+}
 
-    qDebug() << "ADSBDemodSinkWorker:: running with"
-         << " samplesPerFrame: " << samplesPerFrame
-         << " samplesPerChip: " << samplesPerChip
-         << " samplesPerBit: " << samplesPerBit
-         << " correlateFullPreamble: " << m_settings.m_correlateFullPreamble
-         << " correlationScale: " << m_correlationScale
-         << " correlationThreshold: " << m_settings.m_correlationThreshold;
+ADSBDemodSinkWorker::DemodTask::DemodTask(ADSBDemodSinkWorker *worker, QSemaphore *done) :
+    m_samples(nullptr),
+    m_startIdx(0),
+    m_endIdx(0),
+    m_worker(worker),
+    m_done(done)
+{
+    setAutoDelete(false);
+}
 
-    int readIdx = m_sink->m_samplesPerFrame - 1;
+void ADSBDemodSinkWorker::DemodTask::run()
+{
+    demod();
+    m_done->release();
+}
 
-    while (true)
+void ADSBDemodSinkWorker::DemodTask::demod()
+{
+    const ADSBDemodSettings& settings = m_worker->m_settings;
+    int samplesPerBit = m_worker->m_samplesPerBit;
+    int samplesPerChip = m_worker->m_samplesPerChip;
+    int samplesPerFrame = m_worker->m_samplesPerFrame;
+
+    m_detections.clear();
+    m_candidates.clear();
+
+    // Correlate received signal with expected preamble
+    // chip+ indexes are 0, 2, 7, 9
+    // correlating over first 6 bits gives a reduction in per-sample
+    // processing, but more than doubles the number of false matches
+    m_correlator.setSamples(&m_samples[m_startIdx], m_endIdx - m_startIdx, samplesPerChip, samplesPerFrame, settings.m_correlateFullPreamble);
+
+    // Use the ratio of ones power over zeros power, as we don't care how powerful the signal
+    // is, just whether there is a good correlation with the preamble. The absolute value varies
+    // too much with different radios, AGC settings and and the noise floor is not constant
+    // (E.g: it's quite possible to receive multiple frames simultaneously, so we don't
+    // want a maximum threshold for the zeros, as a weaker signal may transmit 1s in
+    // a stronger signals 0 chip position. Similarly a strong signal in an adjacent
+    // channel may casue AGC to reduce gain, reducing the ampltiude of an otherwise
+    // strong signal, as well as the noise floor)
+    // The threshold accounts for the different number of zeros and ones in the preamble
+    // If the sum of ones is exactly 0, it's probably no signal
+    m_correlator.correlate(m_worker->m_correlationThresholdLinear, m_candidates);
+
+    int nextIdx = 0;
+
+    for (int offset : m_candidates)
     {
-        int startIdx = readIdx;
-
-        // Correlate received signal with expected preamble
-        // chip+ indexes are 0, 2, 7, 9
-        // correlating over first 6 bits gives a reduction in per-sample
-        // processing, but more than doubles the number of false matches
-        Real preambleCorrelationOnes = 0.0;
-        Real preambleCorrelationZeros = 0.0;
-        if (m_settings.m_correlateFullPreamble)
+        // Don't try to re-demodulate the same frame
+        if (offset < nextIdx) {
+            continue;
+        }
+
+        Detection detection;
+        Real preambleCorrelationOnes = m_correlator.getOnes(offset);
+        Real preambleCorrelation = preambleCorrelationOnes / m_correlator.getZeros(offset); // without one/zero ratio correction
+        detection.m_startIdx = m_startIdx + offset;
+        detection.m_corrected = false;
+        detection.m_correlation = preambleCorrelation * m_worker->m_correlationScale;
+        detection.m_correlationOnes = preambleCorrelationOnes / samplesPerChip;
+
+        // Skip over preamble
+        int chipIdx = offset + samplesPerBit*ADS_B_PREAMBLE_BITS;
+
+        // Demodulate waveform to bytes
+        unsigned char *data = detection.m_data;
+        int byteIdx = 0;
+        int currentBit;
+        unsigned char currentByte = 0;
+        int df;
+
+        for (int bit = 0; bit < ADS_B_ES_BITS; bit++)
         {
-            for (int i = 0; i < samplesPerChip; i++)
+            // PPM (Pulse position modulation) - Each bit spreads to two chips, 1->10, 0->01
+            // Determine if bit is 1 or 0, by seeing which chip has largest combined energy over the sampling period
+            currentBit = m_correlator.getChipSum(chipIdx) > m_correlator.getChipSum(chipIdx + samplesPerChip);
+            chipIdx += samplesPerBit;
+            // Convert bit to bytes - MSB first
+            currentByte |= currentBit << (7-(bit & 0x7));
+            if ((bit & 0x7) == 0x7)
             {
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  0*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  1*samplesPerChip + i];
-
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  2*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  3*samplesPerChip + i];
+                data[byteIdx++] = currentByte;
+                currentByte = 0;
+                // Don't try to demodulate any further, if this isn't an ADS-B frame
+                // to help reduce processing overhead
+                if (!settings.m_demodModeS && (bit == 7))
+                {
+                    df = ((data[0] >> 3) & ADS_B_DF_MASK);
+                    if ((df != 17) && (df != 18))
+                        break;
+                }
+            }
+        }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  4*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  5*samplesPerChip + i];
+        // Is ADS-B?
+        df = ((data[0] >> 3) & ADS_B_DF_MASK);
+        if ((df == 17) || (df == 18))
+        {
+            m_crc.init();
+            unsigned int parity = (data[11] << 16) | (data[12] << 8) | data[13]; // Parity / CRC
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  6*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  7*samplesPerChip + i];
+            m_crc.calculate(data, ADS_B_ES_BYTES-3);
+            unsigned int syndrome = parity ^ m_crc.get();
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  8*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  9*samplesPerChip + i];
+            if (syndrome != 0)
+            {
+                // Try to correct a single bit error
+                int errorBit = getErrorBit(syndrome);
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 10*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 11*samplesPerChip + i];
+                if (errorBit >= 0)
+                {
+                    data[errorBit/8] ^= 0x80 >> (errorBit%8);
+                    detection.m_corrected = true;
+                    syndrome = 0;
+                }
+            }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 12*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 13*samplesPerChip + i];
+            if (syndrome == 0)
+            {
+                // Got a valid frame
+                detection.m_type = DetectionADSB;
+                // We could possibly allow a partial overlap here
+                nextIdx = offset + samplesPerFrame;
+            }
+            else
+            {
+                detection.m_type = DetectionCRCFail;
+            }
+        }
+        else if (settings.m_demodModeS)
+        {
+            int bytes;
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 14*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 15*samplesPerChip + i];
+            m_crc.init();
+            if ((df == 0) || (df == 4) || (df == 5) || (df == 11))
+                bytes = 56/8;
+            else if ((df == 16) || (df == 20) || (df == 21) || (df >= 24))
+                bytes = 112/8;
+            else
+                bytes = 0;
+            if (bytes > 0)
+            {
+                int parity = (data[bytes-3] << 16) | (data[bytes-2] << 8) | data[bytes-1];
+                m_crc.calculate(data, bytes-3);
+                int crc = m_crc.get();
+                // For DF11, the last 7 bits may have an address/interogration indentifier (II)
+                // XORed in, so we ignore those bits
+                if ((parity == crc) || ((df == 11) && (parity & 0xffff80) == (crc & 0xffff80)))
+                    detection.m_type = DetectionModeS;
+                else
+                    detection.m_type = DetectionCRCFail;
             }
+            else
+                detection.m_type = DetectionTypeFail;
         }
         else
+            detection.m_type = DetectionTypeFail;
+
+        m_detections.push_back(detection);
+    }
+}
+
+int ADSBDemodSinkWorker::getErrorBit(unsigned int syndrome)
+{
+    // The CRC has a zero initial value so it is linear and the syndrome only depends
+    // on the error pattern. DF bits are left out as DF has already been checked.
+    static const std::vector<unsigned int> syndromes = []() {
+        std::vector<unsigned int> syndromes(ADS_B_ES_BITS, 0);
+        crcadsb crc;
+
+        for (int bit = 5; bit < ADS_B_ES_BITS; bit++)
         {
-            for (int i = 0; i < samplesPerChip; i++)
-            {
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  0*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  1*samplesPerChip + i];
+            unsigned char data[ADS_B_ES_BYTES] = {0};
+            data[bit/8] = 0x80 >> (bit%8);
+            crc.init();
+            crc.calculate(data, ADS_B_ES_BYTES-3);
+            syndromes[bit] = ((data[11] << 16) | (data[12] << 8) | data[13]) ^ crc.get();
+        }
 
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  2*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  3*samplesPerChip + i];
+        return syndromes;
+    }();
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  4*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  5*samplesPerChip + i];
+    for (int bit = 5; bit < ADS_B_ES_BITS; bit++)
+    {
+        if (syndromes[bit] == syndrome) {
+            return bit;
+        }
+    }
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  6*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  7*samplesPerChip + i];
+    return -1;
+}
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx +  8*samplesPerChip + i];
-                preambleCorrelationOnes  += m_sink->m_sampleBuffer[readBuffer][startIdx +  9*samplesPerChip + i];
+int ADSBDemodSinkWorker::processBuffer(const Real *samples, int startIdx, int endIdx)
+{
+    // Slices should be long compared to a frame as frames are only skipped across slices at merge time
+    int nbOffsets = endIdx - startIdx;
 
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 10*samplesPerChip + i];
-                preambleCorrelationZeros += m_sink->m_sampleBuffer[readBuffer][startIdx + 11*samplesPerChip + i];
-            }
+    if (nbOffsets <= 0) {
+        return startIdx;
+    }
+
+    int nbTasks = nbOffsets / (16*m_samplesPerFrame);
+    nbTasks = nbTasks > (int) m_tasks.size() ? (int) m_tasks.size() : nbTasks < 1 ? 1 : nbTasks;
+    int sliceLength = nbOffsets / nbTasks;
+
+    for (int i = 0; i < nbTasks; i++)
+    {
+        DemodTask *task = m_tasks[i];
+        task->m_samples = samples;
+        task->m_startIdx = startIdx + i*sliceLength;
+        task->m_endIdx = i == nbTasks - 1 ? endIdx : startIdx + (i+1)*sliceLength;
+
+        if (i < nbTasks - 1) {
+            m_threadPool.start(task);
         }
+    }
 
-        // Use the ratio of ones power over zeros power, as we don't care how powerful the signal
-        // is, just whether there is a good correlation with the preamble. The absolute value varies
-        // too much with different radios, AGC settings and and the noise floor is not constant
-        // (E.g: it's quite possible to receive multiple frames simultaneously, so we don't
-        // want a maximum threshold for the zeros, as a weaker signal may transmit 1s in
-        // a stronger signals 0 chip position. Similarly a strong signal in an adjacent
-        // channel may casue AGC to reduce gain, reducing the ampltiude of an otherwise
-        // strong signal, as well as the noise floor)
-        // The threshold accounts for the different number of zeros and ones in the preamble
-        // If the sum of ones is exactly 0, it's probably no signal
+    m_tasks[nbTasks - 1]->demod(); // last slice in this thread
+    m_done.acquire(nbTasks - 1);
 
-        Real preambleCorrelation = preambleCorrelationOnes/preambleCorrelationZeros; // without one/zero ratio correction
+    int nextIdx = startIdx;
 
-        if ((preambleCorrelation > m_correlationThresholdLinear) && (preambleCorrelationOnes != 0.0f))
+    for (int i = 0; i < nbTasks; i++)
+    {
+        for (const auto& detection : m_tasks[i]->m_detections)
         {
-            m_demodStats.m_correlatorMatches++;
-            // Skip over preamble
-            startIdx += samplesPerBit*ADS_B_PREAMBLE_BITS;
+            // Within a frame found at the end of the previous slice
+            if (detection.m_startIdx < nextIdx) {
+                continue;
+            }
 
-            // Demodulate waveform to bytes
-            unsigned char data[ADS_B_ES_BYTES];
-            int byteIdx = 0;
-            int currentBit;
-            unsigned char currentByte = 0;
-            int df;
+            m_demodStats.m_correlatorMatches++;
 
-            for (int bit = 0; bit < ADS_B_ES_BITS; bit++)
+            switch (detection.m_type)
             {
-                // PPM (Pulse position modulation) - Each bit spreads to two chips, 1->10, 0->01
-                // Determine if bit is 1 or 0, by seeing which chip has largest combined energy over the sampling period
-                Real oneSum = 0.0f;
-                Real zeroSum = 0.0f;
-                for (int i = 0; i < samplesPerChip; i++)
-                {
-                    oneSum += m_sink->m_sampleBuffer[readBuffer][startIdx+i];
-                    zeroSum += m_sink->m_sampleBuffer[readBuffer][startIdx+samplesPerChip+i];
-                }
-                currentBit = oneSum > zeroSum;
-                startIdx += samplesPerBit;
-                // Convert bit to bytes - MSB first
-                currentByte |= currentBit << (7-(bit & 0x7));
-                if ((bit & 0x7) == 0x7)
-                {
-                    data[byteIdx++] = currentByte;
-                    currentByte = 0;
-                    // Don't try to demodulate any further, if this isn't an ADS-B frame
-                    // to help reduce processing overhead
-                    if (!m_settings.m_demodModeS && (bit == 7))
-                    {
-                        df = ((data[0] >> 3) & ADS_B_DF_MASK);
-                        if ((df != 17) && (df != 18))
-                            break;
-                    }
+            case DetectionADSB:
+                m_demodStats.m_adsbFrames++;
+                if (detection.m_corrected) {
+                    m_demodStats.m_correctedFrames++;
                 }
+                nextIdx = detection.m_startIdx + m_samplesPerFrame;
+                reportFrame(detection);
+                break;
+            case DetectionModeS:
+                m_demodStats.m_modesFrames++;
+                reportFrame(detection);
+                break;
+            case DetectionCRCFail:
+                m_demodStats.m_crcFails++;
+                break;
+            case DetectionTypeFail:
+            default:
+                m_demodStats.m_typeFails++;
+                break;
             }
+        }
+    }
 
-            // Is ADS-B?
-            df = ((data[0] >> 3) & ADS_B_DF_MASK);
-            if ((df == 17) || (df == 18))
-            {
-                m_crc.init();
-                unsigned int parity = (data[11] << 16) | (data[12] << 8) | data[13]; // Parity / CRC
+    return nextIdx > endIdx ? nextIdx : endIdx;
+}
 
-                m_crc.calculate(data, ADS_B_ES_BYTES-3);
-                if (parity == m_crc.get())
-                {
-                    // Got a valid frame
-                    m_demodStats.m_adsbFrames++;
-                    // Don't try to re-demodulate the same frame
-                    // We could possibly allow a partial overlap here
-                    readIdx += (ADS_B_ES_BITS+ADS_B_PREAMBLE_BITS)*ADS_B_CHIPS_PER_BIT*samplesPerChip - 1;
-                    // Pass to GUI
-                    if (m_sink->getMessageQueueToGUI())
-                    {
-                        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                            QByteArray((char*)data, sizeof(data)),
-                            preambleCorrelation * m_correlationScale,
-                            preambleCorrelationOnes / samplesPerChip);
-                        m_sink->getMessageQueueToGUI()->push(msg);
-                    }
-                    // Pass to worker to feed to other servers
-                    if (m_sink->getMessageQueueToWorker())
-                    {
-                        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                            QByteArray((char*)data, sizeof(data)),
-                            preambleCorrelation * m_correlationScale,
-                            preambleCorrelationOnes / samplesPerChip);
-                        m_sink->getMessageQueueToWorker()->push(msg);
-                    }
-                }
-                else
-                    m_demodStats.m_crcFails++;
-            }
-            else if (m_settings.m_demodModeS)
-            {
-                int bytes;
+void ADSBDemodSinkWorker::reportFrame(const Detection& detection)
+{
+    // Pass ADS-B frames to GUI
+    if ((detection.m_type == DetectionADSB) && m_sink->getMessageQueueToGUI())
+    {
+        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
+            QByteArray((char*)detection.m_data, sizeof(detection.m_data)),
+            detection.m_correlation,
+            detection.m_correlationOnes);
+        m_sink->getMessageQueueToGUI()->push(msg);
+    }
+    // Pass to worker to feed to other servers
+    if (m_sink->getMessageQueueToWorker())
+    {
+        ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
+            QByteArray((char*)detection.m_data, sizeof(detection.m_data)),
+            detection.m_correlation,
+            detection.m_correlationOnes);
+        m_sink->getMessageQueueToWorker()->push(msg);
+    }
+}
 
-                m_crc.init();
-                if ((df == 0) || (df == 4) || (df == 5) || (df == 11))
-                    bytes = 56/8;
-                else if ((df == 16) || (df == 20) || (df == 21) || (df >= 24))
-                    bytes = 112/8;
-                else
-                    bytes = 0;
-                if (bytes > 0)
-                {
-                    int parity = (data[bytes-3] << 16) | (data[bytes-2] << 8) | data[bytes-1];
-                    m_crc.calculate(data, bytes-3);
-                    int crc = m_crc.get();
-                    // For DF11, the last 7 bits may have an address/interogration indentifier (II)
-                    // XORed in, so we ignore those bits
-                    if ((parity == crc) || ((df == 11) && (parity & 0xffff80) == (crc & 0xffff80)))
-                    {
-                        m_demodStats.m_modesFrames++;
-                        // Pass to worker to feed to other servers
-                        if (m_sink->getMessageQueueToWorker())
-                        {
-                            ADSBDemodReport::MsgReportADSB *msg = ADSBDemodReport::MsgReportADSB::create(
-                                QByteArray((char*)data, sizeof(data)),
-                                preambleCorrelation * m_correlationScale,
-                                preambleCorrelationOnes / samplesPerChip);
-                            m_sink->getMessageQueueToWorker()->push(msg);
-                        }
-                    }
-                    else
-                        m_demodStats.m_crcFails++;
-                }
-                else
-                    m_demodStats.m_typeFails++;
-            }
-            else
-                m_demodStats.m_typeFails++;
-        }
-        readIdx++;
-        if (readIdx > m_sink->m_bufferSize - samplesPerFrame)
-        {
-            int nextBuffer = readBuffer+1;
-            if (nextBuffer >= m_sink->m_buffers)
-                nextBuffer = 0;
+void ADSBDemodSinkWorker::run()
+{
+    int readBuffer = 0;
 
-            // Update amount of time spent processing (don't include time spend in acquire)
-            boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - startPoint;
-            m_demodStats.m_demodTime += sec.count();
-            m_demodStats.m_feedTime = m_sink->m_feedTime;
+    // Acquire first buffer
+    m_sink->m_bufferRead[readBuffer].acquire();
 
-            // Send stats to GUI
-            if (m_sink->getMessageQueueToGUI())
-            {
-                ADSBDemodReport::MsgReportDemodStats *msg = ADSBDemodReport::MsgReportDemodStats::create(m_demodStats);
-                m_sink->getMessageQueueToGUI()->push(msg);
-            }
+    // Start recording how much time is spent processing in this method
+    boost::chrono::steady_clock::time_point startPoint = boost::chrono::steady_clock::now();
 
-            if (!isInterruptionRequested())
-            {
-                // Get next buffer
-                m_sink->m_bufferRead[nextBuffer].acquire();
+    // Check for updated settings
+    handleInputMessages();
 
-                // Check for updated settings
-                handleInputMessages();
+    // samplesPerBit is only changed when the thread is stopped
+    m_samplesPerBit = m_settings.m_samplesPerBit;
+    m_samplesPerFrame = m_samplesPerBit*(ADS_B_PREAMBLE_BITS+ADS_B_ES_BITS);
+    m_samplesPerChip = m_samplesPerBit/ADS_B_CHIPS_PER_BIT;
+    int samplesPerFrame = m_samplesPerFrame;
 
-                // Resume timing how long we are processing
-                startPoint = boost::chrono::steady_clock::now();
+    qDebug() << "ADSBDemodSinkWorker:: running with"
+         << " samplesPerFrame: " << samplesPerFrame
+         << " samplesPerChip: " << m_samplesPerChip
+         << " samplesPerBit: " << m_samplesPerBit
+         << " correlateFullPreamble: " << m_settings.m_correlateFullPreamble
+         << " correlationScale: " << m_correlationScale
+         << " correlationThreshold: " << m_settings.m_correlationThreshold
+         << " threads: " << m_tasks.size();
 
-                int samplesRemaining = m_sink->m_bufferSize - readIdx;
-                if (samplesRemaining > 0)
-                {
-                    // Copy remaining samples, to start of next buffer
-                    memcpy(&m_sink->m_sampleBuffer[nextBuffer][samplesPerFrame - 1 - samplesRemaining], &m_sink->m_sampleBuffer[readBuffer][readIdx], samplesRemaining*sizeof(Real));
-                    readIdx = samplesPerFrame - 1 - samplesRemaining;
-                }
-                else
-                {
-                    readIdx = samplesPerFrame - 1;
-                }
+    int readIdx = m_sink->m_samplesPerFrame - 1;
 
-                m_sink->m_bufferWrite[readBuffer].release();
+    while (true)
+    {
+        // Demodulate all preambles that fit entirely in the buffer. The returned index
+        // is past the last frame found so that it is not demodulated again.
+        readIdx = processBuffer(m_sink->m_sampleBuffer[readBuffer], readIdx, m_sink->m_bufferSize - samplesPerFrame + 1);
+
+        int nextBuffer = readBuffer+1;
+        if (nextBuffer >= m_sink->m_buffers)
+            nextBuffer = 0;
+
+        // Update amount of time spent processing (don't include time spend in acquire)
+        boost::chrono::duration<double> sec = boost::chrono::steady_clock::now() - startPoint;
+        m_demodStats.m_demodTime += sec.count();
+        m_demodStats.m_feedTime = m_sink->m_feedTime;
+
+        // Send stats to GUI
+        if (m_sink->getMessageQueueToGUI())
+        {
+            ADSBDemodReport::MsgReportDemodStats *msg = ADSBDemodReport::MsgReportDemodStats::create(m_demodStats);
+            m_sink->getMessageQueueToGUI()->push(msg);
+        }
+
+        if (!isInterruptionRequested())
+        {
+            // Get next buffer
+            m_sink->m_bufferRead[nextBuffer].acquire();
 
-                readBuffer = nextBuffer;
+            // Check for updated settings
+            handleInputMessages();
+
+            // Resume timing how long we are processing
+            startPoint = boost::chrono::steady_clock::now();
+
+            int samplesRemaining = m_sink->m_bufferSize - readIdx;
+            if (samplesRemaining > 0)
+            {
+                // Copy remaining samples, to start of next buffer
+                memcpy(&m_sink->m_sampleBuffer[nextBuffer][samplesPerFrame - 1 - samplesRemaining], &m_sink->m_sampleBuffer[readBuffer][readIdx], samplesRemaining*sizeof(Real));
+                readIdx = samplesPerFrame - 1 - samplesRemaining;
             }
             else
             {
-                // Use a break to avoid testing a condition in the main loop
-                break;
+                readIdx = samplesPerFrame - 1;
             }
+
+            m_sink->m_bufferWrite[readBuffer].release();
+
+            readBuffer = nextBuffer;
+        }
+        else
+        {
+            // Use a break to avoid testing a condition in the main loop
+            break;
         }
     }
 }
@@ -18,13 +18,20 @@
 #ifndef INCLUDE_ADSBDEMODSINKWORKER_H
 #define INCLUDE_ADSBDEMODSINKWORKER_H
 
+#include <vector>
+
 #include <QObject>
 #include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QSemaphore>
 
 #include "dsp/dsptypes.h"
 #include "util/crc.h"
 #include "util/messagequeue.h"
 #include "adsbdemodstats.h"
+#include "adsbdemodcorrelator.h"
+#include "adsb.h"
 
 class ADSBDemodSink;
 struct ADSBDemodSettings;
@@ -57,25 +64,69 @@ public:
         { }
     };
 
-    ADSBDemodSinkWorker(ADSBDemodSink *sink) :
-        m_sink(sink),
-        m_demodStats(),
-        m_correlationThresholdLinear(0.02f),
-        m_crc()
-    {
-    }
+    ADSBDemodSinkWorker(ADSBDemodSink *sink);
+    ~ADSBDemodSinkWorker();
     void run() override;
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
 
 private:
+    enum DetectionType
+    {
+        DetectionADSB,
+        DetectionModeS,
+        DetectionCRCFail,
+        DetectionTypeFail
+    };
+
+    struct Detection
+    {
+        int m_startIdx;                 //!< Index of the preamble in the sample buffer
+        DetectionType m_type;
+        bool m_corrected;               //!< A single bit error was corrected
+        Real m_correlation;
+        Real m_correlationOnes;
+        unsigned char m_data[ADS_B_ES_BYTES];
+    };
+
+    // Demodulates a slice of a sample buffer. Slices are processed in parallel and their
+    // detections merged in order afterwards, so each task has its own correlator and CRC
+    class DemodTask : public QRunnable
+    {
+    public:
+        DemodTask(ADSBDemodSinkWorker *worker, QSemaphore *done);
+        virtual void run();
+        void demod();
+
+        const Real *m_samples;
+        int m_startIdx;                 //!< First preamble index of the slice
+        int m_endIdx;                   //!< Past last preamble index of the slice
+        std::vector<Detection> m_detections;
+
+    private:
+        ADSBDemodSinkWorker *m_worker;
+        QSemaphore *m_done;
+        ADSBDemodCorrelator m_correlator;
+        std::vector<int> m_candidates;
+        crcadsb m_crc;                  //!< Have as member to avoid recomputing LUT
+    };
+
     void handleInputMessages();
+    int processBuffer(const Real *samples, int startIdx, int endIdx);
+    void reportFrame(const Detection& detection);
+    static int getErrorBit(unsigned int syndrome);
+
     MessageQueue m_inputMessageQueue;
     ADSBDemodSettings m_settings;
     ADSBDemodSink *m_sink;
     ADSBDemodStats m_demodStats;
     Real m_correlationThresholdLinear;
     Real m_correlationScale;
-    crcadsb m_crc;                      //!< Have as member to avoid recomputing LUT
+    int m_samplesPerBit;
+    int m_samplesPerChip;
+    int m_samplesPerFrame;
+    QThreadPool m_threadPool;
+    QSemaphore m_done;
+    std::vector<DemodTask*> m_tasks;
 };
 
 #endif // INCLUDE_ADSBDEMODSINKWORKER_H
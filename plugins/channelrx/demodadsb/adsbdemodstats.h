@@ -24,6 +24,7 @@ struct ADSBDemodStats {
 
     qint64 m_correlatorMatches; //!< Total number of correlator matches
     qint64 m_adsbFrames;        //!< How many ADS-B frames with correct CRCs
+    qint64 m_correctedFrames;   //!< How many of the ADS-B frames had a single bit error corrected
     qint64 m_modesFrames;       //!< How many non-ADS-B Mode-S frames with correct CRCs
     qint64 m_crcFails;          //!< How many frames we've demoded with incorrect CRCs
     qint64 m_typeFails;         //!< How many frames we've demoded with unknown type (DF) so we can't check CRC
@@ -33,6 +34,7 @@ struct ADSBDemodStats {
     ADSBDemodStats() :
     m_correlatorMatches(0),
     m_adsbFrames(0),
+    m_correctedFrames(0),
     m_modesFrames(0),
     m_crcFails(0),
     m_typeFails(0),
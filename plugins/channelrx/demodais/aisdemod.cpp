@@ -93,6 +93,12 @@ void AISDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool AISDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void AISDemod::start()
 {
     qDebug("AISDemod::start");
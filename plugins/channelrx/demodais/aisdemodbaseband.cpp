@@ -34,8 +34,10 @@ AISDemodBaseband::AISDemodBaseband(AISDemod *aisDemod) :
     qDebug("AISDemodBaseband::AISDemodBaseband");
 
     m_sink.setScopeSink(&m_scopeSink);
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 AISDemodBaseband::~AISDemodBaseband()
@@ -50,6 +52,7 @@ void AISDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void AISDemodBaseband::startWork()
@@ -62,6 +65,13 @@ void AISDemodBaseband::startWork()
         &AISDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &AISDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -76,6 +86,12 @@ void AISDemodBaseband::stopWork()
         this,
         &AISDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &AISDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -93,6 +109,10 @@ void AISDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
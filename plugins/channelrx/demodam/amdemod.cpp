@@ -92,6 +92,12 @@ void AMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector
     m_basebandSink->feed(begin, end);
 }
 
+bool AMDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void AMDemod::start()
 {
 	qDebug("AMDemod::start");
@@ -31,8 +31,10 @@ AMDemodBaseband::AMDemodBaseband() :
 {
     qDebug("AMDemodBaseband::AMDemodBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
@@ -51,6 +53,8 @@ void AMDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
+
     m_channelSampleRate = 0;
 }
 
@@ -64,6 +68,13 @@ void AMDemodBaseband::startWork()
         &AMDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &AMDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -78,6 +89,12 @@ void AMDemodBaseband::stopWork()
         this,
         &AMDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &AMDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -95,6 +112,10 @@ void AMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
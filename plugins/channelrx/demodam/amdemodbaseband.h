@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -60,6 +61,7 @@ public:
     AMDemodBaseband();
     ~AMDemodBaseband();
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
@@ -77,6 +79,7 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     int m_channelSampleRate;
     AMDemodSink m_sink;
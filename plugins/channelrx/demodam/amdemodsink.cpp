@@ -334,6 +334,7 @@ void AMDemodSink::applyAudioSampleRate(int sampleRate)
     m_bandpass.create(301, sampleRate, 300.0, m_settings.m_rfBandwidth / 2.0f);
     m_lowpass.create(301, sampleRate,  m_settings.m_rfBandwidth / 2.0f);
     m_audioFifo.setSize(sampleRate);
+    m_audioFifo.setSampleRate(sampleRate); // resampled by the audio device if it opened at another rate
     m_squelchDelayLine.resize(sampleRate/5);
     DSBFilter->create_dsb_filter((2.0f * m_settings.m_rfBandwidth) / (float) sampleRate);
     m_pllFilt.create(101, sampleRate, 200.0);
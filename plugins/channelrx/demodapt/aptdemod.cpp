@@ -108,6 +108,12 @@ void APTDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool APTDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void APTDemod::start()
 {
     startBasebandSink();
@@ -34,8 +34,10 @@ APTDemodBaseband::APTDemodBaseband(APTDemod *packetDemod) :
 {
     qDebug("APTDemodBaseband::APTDemodBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 APTDemodBaseband::~APTDemodBaseband()
@@ -50,6 +52,7 @@ void APTDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void APTDemodBaseband::startWork()
@@ -63,6 +66,13 @@ void APTDemodBaseband::startWork()
         &APTDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &APTDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     m_running = true;
 }
 
@@ -76,6 +86,12 @@ void APTDemodBaseband::stopWork()
         this,
         &APTDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &APTDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -88,6 +104,10 @@ void APTDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
@@ -23,6 +23,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -61,6 +62,7 @@ public:
     APTDemodBaseband(APTDemod *packetDemod);
     ~APTDemodBaseband();
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
@@ -75,6 +77,7 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     APTDemodSink m_sink;
     MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
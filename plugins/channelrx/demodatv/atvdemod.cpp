@@ -94,6 +94,12 @@ void ATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool ATVDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 bool ATVDemod::handleMessage(const Message& cmd)
 {
     if (MsgConfigureATVDemod::match(cmd))
@@ -31,8 +31,10 @@ ATVDemodBaseband::ATVDemodBaseband() :
 {
     qDebug("ATVDemodBaseband::ATVDemodBaseband");
     m_sink.setScopeSink(&m_scopeSink);
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 ATVDemodBaseband::~ATVDemodBaseband()
@@ -45,6 +47,7 @@ void ATVDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void ATVDemodBaseband::startWork()
@@ -57,6 +60,13 @@ void ATVDemodBaseband::startWork()
         &ATVDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &ATVDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
@@ -72,6 +82,12 @@ void ATVDemodBaseband::stopWork()
         this,
         &ATVDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &ATVDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -84,6 +100,10 @@ void ATVDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
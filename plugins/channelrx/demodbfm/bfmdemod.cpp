@@ -91,6 +91,12 @@ void BFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool BFMDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void BFMDemod::start()
 {
     qDebug() << "BFMDemod::start";
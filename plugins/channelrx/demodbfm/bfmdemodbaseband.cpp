@@ -32,8 +32,10 @@ BFMDemodBaseband::BFMDemodBaseband() :
     m_messageQueueToGUI(nullptr),
     m_spectrumVis(nullptr)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("BFMDemodBaseband::BFMDemodBaseband");
     QObject::connect(
@@ -43,6 +45,13 @@ BFMDemodBaseband::BFMDemodBaseband() :
         &BFMDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &BFMDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
@@ -61,6 +70,8 @@ void BFMDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
+
     m_channelSampleRate = 0;
 }
 
@@ -73,6 +84,10 @@ void BFMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
@@ -101,6 +101,12 @@ void ChirpChatDemod::feed(const SampleVector::const_iterator& begin, const Sampl
 	m_basebandSink->feed(begin, end);
 }
 
+bool ChirpChatDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void ChirpChatDemod::start()
 {
     qDebug() << "ChirpChatDemod::start";
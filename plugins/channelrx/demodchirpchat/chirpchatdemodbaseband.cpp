@@ -28,8 +28,10 @@ MESSAGE_CLASS_DEFINITION(ChirpChatDemodBaseband::MsgConfigureChirpChatDemodBaseb
 ChirpChatDemodBaseband::ChirpChatDemodBaseband() :
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("ChirpChatDemodBaseband::ChirpChatDemodBaseband");
     QObject::connect(
@@ -39,6 +41,13 @@ ChirpChatDemodBaseband::ChirpChatDemodBaseband() :
         &ChirpChatDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &ChirpChatDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
 }
@@ -52,6 +61,7 @@ void ChirpChatDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void ChirpChatDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -63,6 +73,10 @@ void ChirpChatDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
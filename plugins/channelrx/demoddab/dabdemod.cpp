@@ -103,6 +103,12 @@ void DABDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool DABDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void DABDemod::start()
 {
     qDebug("DABDemod::start");
@@ -34,8 +34,10 @@ DABDemodBaseband::DABDemodBaseband(DABDemod *packetDemod) :
 {
     qDebug("DABDemodBaseband::DABDemodBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(1000000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
@@ -53,6 +55,7 @@ void DABDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void DABDemodBaseband::startWork()
@@ -65,6 +68,13 @@ void DABDemodBaseband::startWork()
         &DABDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &DABDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -79,6 +89,12 @@ void DABDemodBaseband::stopWork()
         this,
         &DABDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &DABDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -96,6 +112,10 @@ void DABDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
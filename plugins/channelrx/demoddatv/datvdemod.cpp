@@ -71,6 +71,12 @@ void DATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVect
     m_basebandSink->feed(begin, end);
 }
 
+bool DATVDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void DATVDemod::start()
 {
 	qDebug("DATVDemod::start");
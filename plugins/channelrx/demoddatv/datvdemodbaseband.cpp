@@ -30,8 +30,10 @@ DATVDemodBaseband::DATVDemodBaseband() :
     m_mutex(QMutex::Recursive)
 {
     qDebug("DATVDemodBaseband::DATVDemodBaseband");
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 DATVDemodBaseband::~DATVDemodBaseband()
@@ -43,6 +45,7 @@ void DATVDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void DATVDemodBaseband::startWork()
@@ -55,6 +58,13 @@ void DATVDemodBaseband::startWork()
         &DATVDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &DATVDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -70,6 +80,12 @@ void DATVDemodBaseband::stopWork()
         this,
         &DATVDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &DATVDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -82,6 +98,10 @@ void DATVDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
@@ -492,13 +492,11 @@ void DATVDemodGUI::ldpcToolSelect()
 {
     qDebug("DATVDemodGUI::ldpcToolSelect");
     DatvDvbS2LdpcDialog ldpcDialog;
-    ldpcDialog.setFileName(m_settings.m_softLDPCToolPath);
     ldpcDialog.setMaxTrials(m_settings.m_softLDPCMaxTrials);
 
     if (ldpcDialog.exec() == QDialog::Accepted)
     {
         m_settings.m_softLDPCMaxTrials = ldpcDialog.getMaxTrials();
-        m_settings.m_softLDPCToolPath = ldpcDialog.getFileName();
         applySettings();
     }
 }
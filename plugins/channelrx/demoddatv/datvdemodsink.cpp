@@ -21,7 +21,7 @@
 
 #include <QDebug>
 #include <QObject>
-#include <QFileInfo>
+#include <QThread>
 #include <QMutexLocker>
 
 #include "audio/audiooutputdevice.h"
@@ -422,10 +422,6 @@ void DATVDemodSink::CleanUpDATVFramework()
     if (r_fecdecsoft != nullptr) {
         delete (leansdr::s2_fecdec_soft<leansdr::llr_t,leansdr::llr_sb>*) r_fecdecsoft;
     }
-
-    if (r_fecdechelper != nullptr) {
-        delete (leansdr::s2_fecdec_helper<leansdr::llr_t,leansdr::llr_sb>*) r_fecdechelper;
-    }
 #endif
 
     if (p_deframer != nullptr) {
@@ -538,7 +534,6 @@ void DATVDemodSink::ResetDATVFrameworkPointers()
     r_fecdec = nullptr;
 #ifdef LINUX
     r_fecdecsoft = nullptr;
-    r_fecdechelper = nullptr;
 #endif
     p_deframer = nullptr;
     r_scope_symbols_dvbs2 = nullptr;
@@ -808,6 +803,20 @@ void DATVDemodSink::InitDATVFramework()
         r_cnrGauge = new leansdr::datvgauge(m_objScheduler, *p_cnr, m_cnrLabel, m_cnrMeter);
     }
 
+    // DECODER THREADS
+    // Everything above stays in the calling thread (group 0) with the GUI runnables.
+    // Deconvolution and synchronization run in group 1 and deinterleaving
+    // to derandomization in group 2 when there are cores to spare.
+
+    bool decoderThreads = QThread::idealThreadCount() > 1;
+    leansdr::pipebuf<leansdr::eucl_ss> *p_symbolsIn = p_symbols;
+
+    if (decoderThreads)
+    {
+        p_symbolsIn = &leansdr::bridge(m_objScheduler, *p_symbols, 1, BUF_SYMBOLS);
+        m_objScheduler->set_group(1);
+    }
+
     // DECONVOLUTION AND SYNCHRONIZATION
 
     p_bytes = new leansdr::pipebuf<leansdr::u8>(m_objScheduler, "bytes", BUF_BYTES);
@@ -823,7 +832,7 @@ void DATVDemodSink::InitDATVFramework()
         }
 
         //To uncomment -> Linking Problem : undefined symbol: _ZN7leansdr21viterbi_dec_interfaceIhhiiE6updateEPiS2_
-        r = new leansdr::viterbi_sync(m_objScheduler, (*p_symbols), (*p_bytes), m_objDemodulator->cstln, m_objCfg.fec);
+        r = new leansdr::viterbi_sync(m_objScheduler, (*p_symbolsIn), (*p_bytes), m_objDemodulator->cstln, m_objCfg.fec);
 
         if (m_objCfg.fastlock) {
             r->resync_period = 1;
@@ -831,7 +840,7 @@ void DATVDemodSink::InitDATVFramework()
     }
     else
     {
-        r_deconv = make_deconvol_sync_simple(m_objScheduler, (*p_symbols), (*p_bytes), m_objCfg.fec);
+        r_deconv = make_deconvol_sync_simple(m_objScheduler, (*p_symbolsIn), (*p_bytes), m_objCfg.fec);
         r_deconv->fastlock = m_objCfg.fastlock;
     }
 
@@ -846,8 +855,16 @@ void DATVDemodSink::InitDATVFramework()
 
     // DEINTERLEAVING
 
+    leansdr::pipebuf<leansdr::u8> *p_mpegbytesIn = p_mpegbytes;
+
+    if (decoderThreads)
+    {
+        p_mpegbytesIn = &leansdr::bridge(m_objScheduler, *p_mpegbytes, 2, BUF_MPEGBYTES);
+        m_objScheduler->set_group(2);
+    }
+
     p_rspackets = new leansdr::pipebuf<leansdr::rspacket<leansdr::u8> >(m_objScheduler, "RS-enc packets", BUF_PACKETS);
-    r_deinter = new leansdr::deinterleaver<leansdr::u8>(m_objScheduler, *p_mpegbytes, *p_rspackets);
+    r_deinter = new leansdr::deinterleaver<leansdr::u8>(m_objScheduler, *p_mpegbytesIn, *p_rspackets);
 
     // REED-SOLOMON
 
@@ -874,10 +891,23 @@ void DATVDemodSink::InitDATVFramework()
     r_derand = new leansdr::derandomizer(m_objScheduler, *p_rtspackets, *p_tspackets);
 
     // OUTPUT
+    // The video player uses Qt objects of the calling thread (group 0)
+    leansdr::pipebuf<leansdr::tspacket> *p_tspacketsOut = p_tspackets;
+
+    if (decoderThreads)
+    {
+        p_tspacketsOut = &leansdr::bridge(m_objScheduler, *p_tspackets, 0, BUF_PACKETS);
+        m_objScheduler->set_group(0);
+    }
+
     if (m_settings.m_playerEnable) {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, m_objVideoStream, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspacketsOut, m_objVideoStream, &m_udpStream);
     } else {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, nullptr, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspacketsOut, nullptr, &m_udpStream);
+    }
+
+    if (decoderThreads) {
+        m_objScheduler->start();
     }
 
     m_blnDVBInitialized = true;
@@ -1118,6 +1148,20 @@ void DATVDemodSink::InitDATVS2Framework()
         r_cnrGauge = new leansdr::datvgauge(m_objScheduler, *p_cnr, m_cnrLabel, m_cnrMeter);
     }
 
+    // DECODER THREADS
+    // When there are cores to spare deinterleaving runs in group 1 and
+    // FEC decoding with deframing in group 2. Front end, GUI runnables
+    // and video player stay in the calling thread (group 0).
+
+    bool decoderThreads = QThread::idealThreadCount() > 1;
+    leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *p_slotsIn = (leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2;
+
+    if (decoderThreads)
+    {
+        p_slotsIn = &leansdr::bridge(m_objScheduler, *p_slotsIn, 1, BUF_SLOTS);
+        m_objScheduler->set_group(2);
+    }
+
     // Bit-flipping mode.
     // Deinterleave into hard bits.
 
@@ -1134,62 +1178,39 @@ void DATVDemodSink::InitDATVS2Framework()
     p_vbitcount= new leansdr::pipebuf<int>(m_objScheduler, "Bits processed", BUF_S2PACKETS);
     p_verrcount = new leansdr::pipebuf<int>(m_objScheduler, "Bits corrected", BUF_S2PACKETS);
 
-#ifdef LINUX
-    bool commandFileValid = false;
-
-    if (QFileInfo::exists(m_settings.m_softLDPCToolPath))
-    {
-        QFileInfo fileInfo = QFileInfo(m_settings.m_softLDPCToolPath);
-        commandFileValid = fileInfo.isExecutable();
+    if (decoderThreads) {
+        m_objScheduler->set_group(1);
     }
 
-    if (m_settings.m_softLDPC && commandFileValid)
+#ifdef LINUX
+    if (m_settings.m_softLDPC)
     {
-#if 0
-        // Doesn't work...
         // Soft LDPC decoder mode.
         // Deinterleave into soft bits.
         p_fecframes = new leansdr::pipebuf<leansdr::fecframe<leansdr::llr_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
         p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss, leansdr::llr_sb>(
             m_objScheduler,
-            *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
+            *p_slotsIn,
             *(leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > * ) p_fecframes
         );
+        leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > *p_fecframesIn = (leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > *) p_fecframes;
+
+        if (decoderThreads)
+        {
+            p_fecframesIn = &leansdr::bridge(m_objScheduler, *p_fecframesIn, 2, BUF_FRAMES);
+            m_objScheduler->set_group(2);
+        }
+
+        // Decode FEC-protected frames into plain BB frames in a pool of worker threads.
         r_fecdecsoft = new leansdr::s2_fecdec_soft<leansdr::llr_t,leansdr::llr_sb>(
-            m_objScheduler, *(leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > * ) p_fecframes,
+            m_objScheduler,
+            *p_fecframesIn,
             *(leansdr::pipebuf<leansdr::bbframe> *) p_bbframes,
-            m_modcodModulation < 0 ? 0 : m_modcodModulation,
-            true, 5,
+            m_settings.m_softLDPCMaxTrials,
+            std::max(1, QThread::idealThreadCount() - 1),
             p_vbitcount,
             p_verrcount
         );
-#else
-        // External LDPC decoder mode.
-        // Deinterleave into soft bits.
-        // TBD Latency
-        QByteArray ba = m_settings.m_softLDPCToolPath.toLocal8Bit();
-        const char *c_str2 = ba.data();
-        p_fecframes = new leansdr::pipebuf<leansdr::fecframe<leansdr::llr_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
-        p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss, leansdr::llr_sb>(
-            m_objScheduler,
-            *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
-            *(leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > *) p_fecframes
-        );
-        // Decode FEC-protected frames into plain BB frames.
-        r_fecdechelper = new leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb>(
-            m_objScheduler,
-            *(leansdr::pipebuf< leansdr::fecframe<leansdr::llr_sb> > *) p_fecframes,
-            *(leansdr::pipebuf<leansdr::bbframe> *) p_bbframes,
-            c_str2,
-            p_vbitcount,
-            p_verrcount)
-        ;
-        leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb> *fecdec = (leansdr::s2_fecdec_helper<leansdr::llr_t, leansdr::llr_sb> *) r_fecdechelper;
-        const int nhelpers = 6;
-        fecdec->nhelpers = nhelpers;
-        fecdec->must_buffer = false;
-        fecdec->max_trials = m_settings.m_softLDPCMaxTrials;
-#endif
     }
     else
     {
@@ -1198,12 +1219,20 @@ void DATVDemodSink::InitDATVS2Framework()
         p_fecframes = new leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
         p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss,leansdr::hard_sb>(
             m_objScheduler,
-            *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
+            *p_slotsIn,
             *(leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > * ) p_fecframes
         );
+        leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > *p_fecframesIn = (leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > *) p_fecframes;
+
+        if (decoderThreads)
+        {
+            p_fecframesIn = &leansdr::bridge(m_objScheduler, *p_fecframesIn, 2, BUF_FRAMES);
+            m_objScheduler->set_group(2);
+        }
+
         r_fecdec =  new leansdr::s2_fecdec<bool, leansdr::hard_sb>(
             m_objScheduler,
-            *(leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > * ) p_fecframes,
+            *p_fecframesIn,
             *(leansdr::pipebuf<leansdr::bbframe> *) p_bbframes,
             p_vbitcount,
             p_verrcount
@@ -1217,12 +1246,20 @@ void DATVDemodSink::InitDATVS2Framework()
     p_fecframes = new leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> >(m_objScheduler, "FEC frames", BUF_FRAMES);
     p_s2_deinterleaver = new leansdr::s2_deinterleaver<leansdr::llr_ss,leansdr::hard_sb>(
         m_objScheduler,
-        *(leansdr::pipebuf< leansdr::plslot<leansdr::llr_ss> > *) p_slots_dvbs2,
+        *p_slotsIn,
         *(leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > * ) p_fecframes
     );
+    leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > *p_fecframesIn = (leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > *) p_fecframes;
+
+    if (decoderThreads)
+    {
+        p_fecframesIn = &leansdr::bridge(m_objScheduler, *p_fecframesIn, 2, BUF_FRAMES);
+        m_objScheduler->set_group(2);
+    }
+
     r_fecdec =  new leansdr::s2_fecdec<bool, leansdr::hard_sb>(
         m_objScheduler,
-        *(leansdr::pipebuf< leansdr::fecframe<leansdr::hard_sb> > * ) p_fecframes,
+        *p_fecframesIn,
         *(leansdr::pipebuf<leansdr::bbframe> *) p_bbframes,
         p_vbitcount,
         p_verrcount
@@ -1242,10 +1279,22 @@ void DATVDemodSink::InitDATVS2Framework()
 */
 
     // OUTPUT
+    leansdr::pipebuf<leansdr::tspacket> *p_tspacketsOut = p_tspackets;
+
+    if (decoderThreads)
+    {
+        p_tspacketsOut = &leansdr::bridge(m_objScheduler, *p_tspackets, 0, BUF_S2PACKETS);
+        m_objScheduler->set_group(0);
+    }
+
     if (m_settings.m_playerEnable) {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, m_objVideoStream, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspacketsOut, m_objVideoStream, &m_udpStream);
     } else {
-        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspackets, nullptr, &m_udpStream);
+        r_videoplayer = new leansdr::datvvideoplayer<leansdr::tspacket>(m_objScheduler, *p_tspacketsOut, nullptr, &m_udpStream);
+    }
+
+    if (decoderThreads) {
+        m_objScheduler->start();
     }
 
     m_blnDVBInitialized = true;
@@ -16,8 +16,6 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include <QFileDialog>
-
 #include "datvdvbs2ldpcdialog.h"
 #include "datvdemodsettings.h"
 #include "ui_datvdvbs2ldpcdialog.h"
@@ -39,12 +37,6 @@ void DatvDvbS2LdpcDialog::accept()
     QDialog::accept();
 }
 
-void DatvDvbS2LdpcDialog::setFileName(const QString& fileName)
-{
-    m_fileName = fileName;
-    ui->ldpcToolText->setText(m_fileName);
-}
-
 void DatvDvbS2LdpcDialog::setMaxTrials(int maxTrials)
 {
     m_maxTrials = maxTrials < 1 ? 1 :
@@ -52,27 +44,6 @@ void DatvDvbS2LdpcDialog::setMaxTrials(int maxTrials)
     ui->maxTrials->setValue(m_maxTrials);
 }
 
-void DatvDvbS2LdpcDialog::on_showFileDialog_clicked(bool checked)
-{
-    (void) checked;
-
-    QFileDialog fileDialog(this, "Select LDPC tool");
-    fileDialog.setOption(QFileDialog::DontUseNativeDialog, true);
-    fileDialog.setFilter(QDir::Executable | QDir::Files);
-    fileDialog.selectFile(m_fileName);
-
-    if (fileDialog.exec() == QDialog::Accepted)
-    {
-        QStringList fileNames = fileDialog.selectedFiles();
-
-        if (fileNames.size() > 0)
-        {
-            m_fileName = fileNames[0];
-            ui->ldpcToolText->setText(m_fileName);
-        }
-    }
-}
-
 void DatvDvbS2LdpcDialog::on_maxTrials_valueChanged(int value)
 {
     m_maxTrials = value;
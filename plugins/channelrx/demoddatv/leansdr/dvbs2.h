@@ -57,6 +57,10 @@
 #ifdef LINUX
 #include <signal.h>
 #include <sys/wait.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "ldpctool/layered_decoder.h"
 #include "ldpctool/testbench.h"
 #include "ldpctool/algorithms.h"
@@ -3044,7 +3048,11 @@ struct s2_fecdec : runnable
 #ifdef LINUX
 
 // Soft LDPC decoder
-// Internally implemented LDPC tool. Replaces external LDPC decoder
+// In-process ldpctool decoder. Replaces the external LDPC decoder.
+// Frames are decoded by a pool of worker threads. Each worker takes up to
+// SIMD_WIDTH consecutive pending frames of the same code and decodes them in
+// the SIMD lanes of the layered decoder, then runs BCH and descrambling.
+// Frames are output in input order.
 
 template <typename SOFTBIT, typename SOFTBYTE>
 struct s2_fecdec_soft : runnable
@@ -3053,143 +3061,352 @@ struct s2_fecdec_soft : runnable
         scheduler *sch,
         pipebuf<fecframe<SOFTBYTE>> &_in,
         pipebuf<bbframe> &_out,
-        int _modcod,
-        bool _shortframes = true,
         int _max_trials = 25,
+        int _nworkers = 1,
         pipebuf<int> *_bitcount = nullptr,
         pipebuf<int> *_errcount = nullptr
     ) :
         runnable(sch, "S2 fecdec soft"),
         in(_in),
         out(_out),
-        modcod(_modcod < 0 ? 0 : _modcod > 31 ? 31 : _modcod),
-        shortframes(_shortframes ? 1 : 0),
         max_trials(_max_trials),
+        nworkers(_nworkers < 1 ? 1 : _nworkers),
         bitcount(opt_writer(_bitcount, 1)),
-        errcount(opt_writer(_errcount, 1))
+        errcount(opt_writer(_errcount, 1)),
+        jobs(2 * nworkers * ldpctool::SIMD_WIDTH),
+        rd(0),
+        wr(0),
+        count(0),
+        stop(false)
     {
-        const char *tabname = ldpctool::LDPCInterface::mc_tabnames[shortframes][modcod];
-        fprintf(stderr, "s2_fecdec_soft::s2_fecdec_soft: tabname: %s\n", tabname);
-
-        if (tabname)
-        {
-            ldpc = ldpctool::create_ldpc((char *)"S2", tabname[0], atoi(tabname + 1));
-            code = new ldpctool::code_type[ldpc->code_len()];
-            aligned_buffer = aligned_alloc(sizeof(ldpctool::simd_type), sizeof(ldpctool::simd_type) * ldpc->code_len());
-            simd = reinterpret_cast<ldpctool::simd_type *>(aligned_buffer);
+        if (sizeof(ldpctool::code_type) != sizeof(SOFTBYTE) / 8) {
+            fail("s2_fecdec_soft: unsupported soft byte type");
         }
-        else
-        {
-            ldpc = nullptr;
-            aligned_buffer = nullptr;
-            code = nullptr;
+
+        for (int i = 0; i < nworkers; ++i) {
+            workers.emplace_back(&s2_fecdec_soft::work, this);
         }
     }
 
     ~s2_fecdec_soft()
     {
-        if (ldpc) {
-            delete ldpc;
-        }
-        if (aligned_buffer) {
-            free(aligned_buffer);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
         }
-        if (code) {
-            delete[] code;
+
+        cond.notify_all();
+
+        for (auto& worker : workers) {
+            worker.join();
         }
     }
 
     void run()
     {
-        while (in.readable() >= 1 &&
-            out.writable() >= 1 &&
-            opt_writable(bitcount, 1) &&
-            opt_writable(errcount, 1))
+        // Output decoded frames in order
+        while (true)
         {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if ((count == 0) || (jobs[rd].state != job::DONE)) {
+                    break;
+                }
+            }
+
+            job& j = jobs[rd];
+
+            if ((j.kbch != 0) && !(opt_writable(bitcount, 1) && opt_writable(errcount, 1))) {
+                break;
+            }
+            if (!j.corrupted && (out.writable() < 1)) {
+                break;
+            }
+
+            if (j.kbch != 0)
+            {
+                // Report VER
+                opt_write(bitcount, j.kbch);
+                opt_write(errcount, (j.ncorr >= 0) ? j.ncorr : j.kbch);
+            }
+
+            if (!j.corrupted)
+            {
+                bbframe *pout = out.wr();
+                *pout = j.bb;
+                out.written(1);
+            }
+
+            if (sch->debug) {
+                fprintf(stderr, "%c", j.corrupted ? ':' : j.ncorr ? '.' : '_');
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            j.state = job::FREE;
+            rd = (rd + 1) % jobs.size();
+            --count;
+        }
+
+        // Queue new frames. Only this thread touches free slots.
+        int queued = 0;
+
+        while (in.readable() >= 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (count + queued == (int) jobs.size()) {
+                    break;
+                }
+            }
+
             fecframe<SOFTBYTE> *pin = in.rd();
-            const modcod_info *mcinfo = check_modcod(pin->pls.modcod);
-            const fec_info *fi = &fec_infos[pin->pls.sf][mcinfo->rate];
-            bool corrupted = false;
-            bool residual_errors;
+            job& j = jobs[(wr + queued) % jobs.size()];
+            j.frame.pls = pin->pls;
+            std::copy(pin->bytes, pin->bytes + pin->pls.framebits() / 8, j.frame.bytes);
+            in.read(1);
+            queued++;
+        }
 
-            if (ldpc)
+        if (queued != 0)
+        {
             {
-                decode.init(ldpc);
-                int count = decode(simd, simd + ldpc->data_len(), max_trials, 1);
+                std::lock_guard<std::mutex> lock(mutex);
 
-                if (count < 0) {
-                    fprintf(stderr, "s2_fecdec_soft::run: decoder failed at converging to a code word in %d trials\n", max_trials);
+                for (int i = 0; i < queued; ++i)
+                {
+                    jobs[wr].state = job::PENDING;
+                    wr = (wr + 1) % jobs.size();
                 }
 
-                for (int i = 0; i < ldpc->code_len(); ++i) {
-                    code[i] = reinterpret_cast<ldpctool::code_type *>(simd + i)[0];
+                count += queued;
+            }
+
+            cond.notify_all();
+        }
+    }
+
+private:
+    typedef ldpctool::NormalUpdate<ldpctool::simd_type> update_type;
+    typedef ldpctool::MinSumCAlgorithm<ldpctool::simd_type, update_type, ldpctool::FACTOR> algorithm_type;
+    typedef ldpctool::LDPCDecoder<ldpctool::simd_type, algorithm_type> decoder_type;
+
+    struct job
+    {
+        enum { FREE, PENDING, BUSY, DONE } state;
+        fecframe<SOFTBYTE> frame; // decoded in place
+        bbframe bb;
+        bool corrupted;
+        int ncorr;
+        int kbch; // 0 if the frame could not be decoded at all
+
+        job() : state(FREE), corrupted(true), ncorr(0), kbch(0) {}
+    };
+
+    // Per worker decoder state
+    struct worker_state
+    {
+        decoder_type *decoders[2][FEC_COUNT]; // [sf][rate]
+        ldpctool::simd_type *simd;
+        uint8_t bch_buf[64800 / 8]; // Temp storage for hardening before BCH
+        s2_bch_engines s2bch;
+        s2_bbscrambling bbscrambling;
+
+        worker_state()
+        {
+            for (int sf = 0; sf < 2; ++sf) {
+                for (int rate = 0; rate < FEC_COUNT; ++rate) {
+                    decoders[sf][rate] = nullptr;
                 }
+            }
 
-                SOFTBYTE *ldpc_buf = reinterpret_cast<SOFTBYTE*>(code);
-                uint8_t *hardbytes = softbytes_harden(ldpc_buf, fi->kldpc / 8, bch_buf);
+            simd = reinterpret_cast<ldpctool::simd_type *>(
+                aligned_alloc(sizeof(ldpctool::simd_type), sizeof(ldpctool::simd_type) * 64800));
+        }
 
-                // BCH decode
-                size_t cwbytes = fi->kldpc / 8;
-                // Decode with suitable BCH decoder for this MODCOD
-                bch_interface *bch = s2bch.bchs[pin->pls.sf][mcinfo->rate];
-                int ncorr = bch->decode(hardbytes, cwbytes);
+        ~worker_state()
+        {
+            for (int sf = 0; sf < 2; ++sf) {
+                for (int rate = 0; rate < FEC_COUNT; ++rate) {
+                    delete decoders[sf][rate];
+                }
+            }
 
-                if (sch->debug2) {
-                    fprintf(stderr, "BCHCORR = %d\n", ncorr);
+            free(simd);
+        }
+
+        decoder_type *get_decoder(const s2_pls& pls)
+        {
+            const modcod_info *mcinfo = check_modcod(pls.modcod);
+            decoder_type *& decoder = decoders[pls.sf][mcinfo->rate];
+
+            if (!decoder)
+            {
+                const char *tabname = ldpctool::LDPCInterface::mc_tabnames[pls.sf][pls.modcod];
+
+                if (!tabname) {
+                    return nullptr;
                 }
 
-                corrupted = (ncorr < 0);
-                residual_errors = (ncorr != 0);
-                // Report VER
-                opt_write(bitcount, fi->Kbch);
-                opt_write(errcount, (ncorr >= 0) ? ncorr : fi->Kbch);
-                int bbsize = fi->Kbch / 8;
+                ldpctool::LDPCInterface *ldpc = ldpctool::create_ldpc((char *)"S2", tabname[0], atoi(tabname + 1));
 
-                if (!corrupted)
-                {
-                    // Descramble and output
-                    bbframe *pout = out.wr();
-                    pout->pls = pin->pls;
-                    bbscrambling.transform(hardbytes, bbsize, pout->bytes);
-                    out.written(1);
+                if (!ldpc) {
+                    return nullptr;
                 }
 
-                if (sch->debug) {
-                    fprintf(stderr, "%c", corrupted ? ':' : residual_errors ? '.' : '_');
+                decoder = new decoder_type();
+                decoder->init(ldpc);
+                delete ldpc;
+            }
+
+            return decoder;
+        }
+    };
+
+    void work()
+    {
+        worker_state ws;
+        job *batch[ldpctool::SIMD_WIDTH];
+
+        while (true)
+        {
+            int blocks = 0;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cond.wait(lock, [this, &batch, &blocks]() {
+                    return stop || take_batch(batch, blocks);
+                });
+
+                if (stop) {
+                    return;
                 }
-            } // ldpc engine allocated
+            }
 
-            in.read(1);
+            decode_batch(ws, batch, blocks);
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            for (int n = 0; n < blocks; ++n) {
+                batch[n]->state = job::DONE;
+            }
         }
     }
 
-private:
-    pipereader<fecframe<SOFTBYTE>> in;
-    pipewriter<bbframe> out;
-    int modcod;
-    int shortframes;
-    int max_trials;
-    pipewriter<int> *bitcount, *errcount;
+    // Called with the mutex held. Takes the first pending frame and the
+    // following consecutive pending frames that use the same code.
+    bool take_batch(job **batch, int& blocks)
+    {
+        blocks = 0;
+        int sf = 0, rate = 0;
 
-	typedef ldpctool::NormalUpdate<ldpctool::simd_type> update_type;
-	//typedef SelfCorrectedUpdate<simd_type> update_type;
+        for (int k = 0; (k < count) && (blocks < ldpctool::SIMD_WIDTH); ++k)
+        {
+            job& j = jobs[(rd + k) % jobs.size()];
 
-	//typedef MinSumAlgorithm<simd_type, update_type> algorithm_type;
-	//typedef OffsetMinSumAlgorithm<simd_type, update_type, FACTOR> algorithm_type;
-	typedef ldpctool::MinSumCAlgorithm<ldpctool::simd_type, update_type, ldpctool::FACTOR> algorithm_type;
-	//typedef LogDomainSPA<simd_type, update_type> algorithm_type;
-	//typedef LambdaMinAlgorithm<simd_type, update_type, 3> algorithm_type;
-	//typedef SumProductAlgorithm<simd_type, update_type> algorithm_type;
+            if (j.state != job::PENDING)
+            {
+                if (blocks != 0) {
+                    break;
+                }
 
-	ldpctool::LDPCDecoder<ldpctool::simd_type, algorithm_type> decode;
+                continue;
+            }
 
-    ldpctool::LDPCInterface *ldpc;
-    ldpctool::code_type *code;
-    void *aligned_buffer;
-    ldpctool::simd_type *simd;
-    uint8_t bch_buf[64800 / 8]; // Temp storage for hardening before BCH
-    s2_bch_engines s2bch;
-    s2_bbscrambling bbscrambling;
+            int jrate = check_modcod(j.frame.pls.modcod)->rate;
+
+            if (blocks == 0)
+            {
+                sf = j.frame.pls.sf;
+                rate = jrate;
+            }
+            else if ((j.frame.pls.sf != sf) || (jrate != rate))
+            {
+                break;
+            }
+
+            j.state = job::BUSY;
+            batch[blocks++] = &j;
+        }
+
+        return blocks != 0;
+    }
+
+    void decode_batch(worker_state& ws, job **batch, int blocks)
+    {
+        const s2_pls& pls = batch[0]->frame.pls;
+        decoder_type *decoder = ws.get_decoder(pls);
+
+        if (!decoder)
+        {
+            for (int n = 0; n < blocks; ++n)
+            {
+                batch[n]->corrupted = true;
+                batch[n]->kbch = 0;
+            }
+
+            return;
+        }
+
+        const modcod_info *mcinfo = check_modcod(pls.modcod);
+        const fec_info *fi = &fec_infos[pls.sf][mcinfo->rate];
+        int codeLen = pls.framebits();
+
+        for (int n = 0; n < blocks; ++n)
+        {
+            const ldpctool::code_type *code = reinterpret_cast<const ldpctool::code_type *>(batch[n]->frame.bytes);
+
+            for (int i = 0; i < codeLen; ++i) {
+                reinterpret_cast<ldpctool::code_type *>(ws.simd + i)[n] = code[i];
+            }
+        }
+
+        int trials = (*decoder)(ws.simd, ws.simd + fi->kldpc, max_trials, blocks);
+
+        if ((trials < 0) && sch->debug) {
+            fprintf(stderr, "s2_fecdec_soft: decoder failed at converging to a code word in %d trials\n", max_trials);
+        }
+
+        for (int n = 0; n < blocks; ++n)
+        {
+            job& j = *batch[n];
+            ldpctool::code_type *code = reinterpret_cast<ldpctool::code_type *>(j.frame.bytes);
+
+            for (int i = 0; i < codeLen; ++i) {
+                code[i] = reinterpret_cast<ldpctool::code_type *>(ws.simd + i)[n];
+            }
+
+            // BCH decode with suitable BCH decoder for this MODCOD
+            uint8_t *hardbytes = softbytes_harden(j.frame.bytes, fi->kldpc / 8, ws.bch_buf);
+            size_t cwbytes = fi->kldpc / 8;
+            bch_interface *bch = ws.s2bch.bchs[j.frame.pls.sf][mcinfo->rate];
+            j.ncorr = bch->decode(hardbytes, cwbytes);
+            j.corrupted = (j.ncorr < 0);
+            j.kbch = fi->Kbch;
+
+            if (!j.corrupted)
+            {
+                // Descramble
+                j.bb.pls = j.frame.pls;
+                ws.bbscrambling.transform(hardbytes, fi->Kbch / 8, j.bb.bytes);
+            }
+        }
+    }
+
+    pipereader<fecframe<SOFTBYTE>> in;
+    pipewriter<bbframe> out;
+    int max_trials;
+    int nworkers;
+    pipewriter<int> *bitcount, *errcount;
+    std::vector<job> jobs; // ring of frames in input order
+    int rd;                // next frame to output
+    int wr;                // next free slot
+    int count;             // frames in the ring
+    bool stop;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<std::thread> workers;
 }; // s2_fecdec_soft
 
 // External LDPC decoder
@@ -19,6 +19,11 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include <math.h>
 #include <stdint.h>
@@ -45,10 +50,13 @@ void fail(const char *s);
 // [pipereader] is a client-side hook reading from a [pipebuf].
 // [runnable] is anything that moves data between [pipebufs].
 // [scheduler] is a global context which invokes [runnables] until fixpoint.
+// [pipebridge] forwards a [pipebuf] to another thread group of the [scheduler].
 
 static const int MAX_PIPES = 64;
 static const int MAX_RUNNABLES = 64;
 static const int MAX_READERS = 8;
+static const int MAX_GROUPS = 8;
+static const int MAX_BRIDGES = 8;
 
 struct pipebuf_common
 {
@@ -103,23 +111,56 @@ struct window_placement
     int x, y, w, h;
 };
 
+struct pipebridge_common
+{
+    virtual ~pipebridge_common() {
+    }
+};
+
+// Runnables and pipes belong to the thread group that is current when
+// they are created (see set_group). Group 0 is run by the caller of step()
+// or run(). After start() each other group is run to fixpoint by its own
+// thread. Pipes are only ever accessed from the thread of their group:
+// data crosses groups through a [pipebridge] only.
+
 struct scheduler
 {
     pipebuf_common *pipes[MAX_PIPES];
+    int pipe_groups[MAX_PIPES];
     int npipes;
     runnable_common *runnables[MAX_RUNNABLES];
+    int runnable_groups[MAX_RUNNABLES];
     int nrunnables;
+    pipebridge_common *bridges[MAX_BRIDGES];
+    int nbridges;
+    int current_group;
     window_placement *windows;
     bool verbose, debug, debug2;
 
     scheduler() :
         npipes(0),
         nrunnables(0),
+        nbridges(0),
+        current_group(0),
         windows(nullptr),
         verbose(false),
         debug(false),
-        debug2(false)
+        debug2(false),
+        started(false),
+        stopping(false)
     {
+        for (int g = 0; g < MAX_GROUPS; ++g) {
+            workers[g] = nullptr;
+        }
+    }
+
+    ~scheduler()
+    {
+        stop();
+
+        for (int i = 0; i < nbridges; ++i) {
+            delete bridges[i];
+        }
     }
 
     void add_pipe(pipebuf_common *p)
@@ -128,6 +169,7 @@ struct scheduler
             fail("MAX_PIPES");
         }
 
+        pipe_groups[npipes] = current_group;
         pipes[npipes++] = p;
     }
 
@@ -137,11 +179,51 @@ struct scheduler
             fail("MAX_RUNNABLES");
         }
 
+        runnable_groups[nrunnables] = current_group;
         runnables[nrunnables++] = r;
     }
 
+    // Takes ownership of the bridge
+    void add_bridge(pipebridge_common *b)
+    {
+        if (nbridges == MAX_BRIDGES) {
+            fail("MAX_BRIDGES");
+        }
+
+        bridges[nbridges++] = b;
+    }
+
+    // Thread group of the pipes and runnables created next
+    void set_group(int g)
+    {
+        if (g < 0 || g >= MAX_GROUPS) {
+            fail("MAX_GROUPS");
+        }
+
+        current_group = g;
+    }
+
+    int group_of(const pipebuf_common *p) const
+    {
+        for (int i = 0; i < npipes; ++i)
+        {
+            if (pipes[i] == p) {
+                return pipe_groups[i];
+            }
+        }
+
+        return 0;
+    }
+
+    // Once started only the runnables of group 0 are run here.
     void step()
     {
+        if (started)
+        {
+            step_group(0);
+            return;
+        }
+
         for (int i = 0; i < nrunnables; ++i) {
             runnables[i]->run();
         }
@@ -154,7 +236,7 @@ struct scheduler
         while (1)
         {
             step();
-            unsigned long long h = hash();
+            unsigned long long h = started ? hash_group(0) : hash();
 
             if (h == prev_hash) {
                 break;
@@ -164,8 +246,79 @@ struct scheduler
         }
     }
 
+    // Start one thread for each group other than 0 that has runnables.
+    void start()
+    {
+        if (started) {
+            return;
+        }
+
+        stopping = false;
+
+        for (int g = 1; g < MAX_GROUPS; ++g)
+        {
+            bool used = false;
+
+            for (int i = 0; i < nrunnables; ++i) {
+                used = used || (runnable_groups[i] == g);
+            }
+
+            if (used)
+            {
+                workers[g] = new worker;
+                workers[g]->thread = std::thread(&scheduler::worker_loop, this, g);
+            }
+        }
+
+        started = true;
+    }
+
+    // Join the group threads. Called before runnables are shut down.
+    void stop()
+    {
+        if (!started) {
+            return;
+        }
+
+        stopping = true;
+
+        for (int g = 1; g < MAX_GROUPS; ++g)
+        {
+            if (workers[g]) {
+                wake(g);
+            }
+        }
+
+        for (int g = 1; g < MAX_GROUPS; ++g)
+        {
+            if (workers[g])
+            {
+                workers[g]->thread.join();
+                delete workers[g];
+                workers[g] = nullptr;
+            }
+        }
+
+        started = false;
+    }
+
+    // Signal group g that one of its bridges has data or room.
+    void wake(int g)
+    {
+        worker *w = workers[g];
+
+        if (!w || w->wakeup.exchange(true)) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(w->mutex);
+        w->cond.notify_one();
+    }
+
     void shutdown()
     {
+        stop();
+
         for (int i = 0; i < nrunnables; ++i) {
             runnables[i]->shutdown();
         }
@@ -194,6 +347,74 @@ struct scheduler
         fprintf(stderr, "Total buffer memory: %ld KiB\n",
                 (unsigned long)total_bufs / 1024);
     }
+
+  private:
+    struct worker
+    {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::atomic<bool> wakeup;
+
+        worker() : wakeup(false) {
+        }
+    };
+
+    worker *workers[MAX_GROUPS];
+    bool started;
+    std::atomic<bool> stopping;
+
+    void step_group(int g)
+    {
+        for (int i = 0; i < nrunnables; ++i)
+        {
+            if (runnable_groups[i] == g) {
+                runnables[i]->run();
+            }
+        }
+    }
+
+    unsigned long long hash_group(int g)
+    {
+        unsigned long long h = 0;
+
+        for (int i = 0; i < npipes; ++i)
+        {
+            if (pipe_groups[i] == g) {
+                h += (1 + i) * pipes[i]->hash();
+            }
+        }
+
+        return h;
+    }
+
+    void worker_loop(int g)
+    {
+        worker *w = workers[g];
+        unsigned long long prev_hash = 0;
+
+        while (!stopping)
+        {
+            while (!stopping)
+            {
+                step_group(g);
+                unsigned long long h = hash_group(g);
+
+                if (h == prev_hash) {
+                    break;
+                }
+
+                prev_hash = h;
+            }
+
+            // The timeout only covers runnables without bridged inputs.
+            std::unique_lock<std::mutex> lock(w->mutex);
+            w->cond.wait_for(lock, std::chrono::milliseconds(10), [w, this]() {
+                return w->wakeup.load() || stopping.load();
+            });
+            w->wakeup = false;
+        }
+    }
 };
 
 struct runnable : runnable_common
@@ -423,6 +644,166 @@ struct pipereader
     }
 };
 
+// Bounded single producer single consumer queue.
+// Counters only grow; the producer owns [head], the consumer owns [tail].
+
+template <typename T>
+struct spsc_queue
+{
+    spsc_queue(unsigned long _size) :
+        size(_size),
+        head(0),
+        tail(0)
+    {
+        buf = new T[size];
+    }
+
+    ~spsc_queue()
+    {
+        delete[] buf;
+    }
+
+    // Producer side
+    unsigned long writable() const {
+        return size - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire));
+    }
+
+    void push(const T *src, unsigned long n)
+    {
+        unsigned long h = head.load(std::memory_order_relaxed);
+        unsigned long pos = h % size;
+        unsigned long n1 = std::min(n, size - pos);
+        std::copy(src, src + n1, buf + pos);
+        std::copy(src + n1, src + n, buf);
+        head.store(h + n, std::memory_order_release);
+    }
+
+    // Consumer side
+    unsigned long readable() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+    }
+
+    void pop(T *dst, unsigned long n)
+    {
+        unsigned long t = tail.load(std::memory_order_relaxed);
+        unsigned long pos = t % size;
+        unsigned long n1 = std::min(n, size - pos);
+        std::copy(buf + pos, buf + pos + n1, dst);
+        std::copy(buf, buf + (n - n1), dst + n1);
+        tail.store(t + n, std::memory_order_release);
+    }
+
+  private:
+    T *buf;
+    unsigned long size;
+    std::atomic<unsigned long> head, tail;
+};
+
+// Copies everything written to a pipe of one thread group into
+// a new pipe [out] of another group. The sender runs in the group of
+// the input pipe, the receiver in the group of the output pipe.
+// Owned by the scheduler.
+
+template <typename T>
+struct pipebridge : pipebridge_common
+{
+    pipebuf<T> *out;
+
+    pipebridge(
+        scheduler *sch,
+        pipebuf<T> &in,
+        int group,
+        unsigned long size
+    ) :
+        queue(size)
+    {
+        int ingroup = sch->group_of(&in);
+        int g = sch->current_group;
+        sch->set_group(group);
+        out = new pipebuf<T>(sch, in.name, size);
+        receiver = new bridge_receiver(sch, queue, *out, ingroup);
+        sch->set_group(ingroup);
+        sender = new bridge_sender(sch, in, queue, group);
+        sch->set_group(g);
+        sch->add_bridge(this);
+    }
+
+    ~pipebridge()
+    {
+        delete sender;
+        delete receiver;
+        delete out;
+    }
+
+  private:
+    struct bridge_sender : runnable
+    {
+        bridge_sender(scheduler *sch, pipebuf<T> &_in, spsc_queue<T> &_queue, int _peer) :
+            runnable(sch, "bridge sender"),
+            in(_in),
+            queue(_queue),
+            peer(_peer)
+        {
+        }
+
+        void run()
+        {
+            unsigned long n = std::min((unsigned long) in.readable(), queue.writable());
+
+            if (n == 0) {
+                return;
+            }
+
+            queue.push(in.rd(), n);
+            in.read(n);
+            sch->wake(peer);
+        }
+
+        pipereader<T> in;
+        spsc_queue<T> &queue;
+        int peer;
+    };
+
+    struct bridge_receiver : runnable
+    {
+        bridge_receiver(scheduler *sch, spsc_queue<T> &_queue, pipebuf<T> &_out, int _peer) :
+            runnable(sch, "bridge receiver"),
+            queue(_queue),
+            out(_out),
+            peer(_peer)
+        {
+        }
+
+        void run()
+        {
+            unsigned long n = std::min(queue.readable(), (unsigned long) out.writable());
+
+            if (n == 0) {
+                return;
+            }
+
+            queue.pop(out.wr(), n);
+            out.written(n);
+            sch->wake(peer); // room for the sender
+        }
+
+        spsc_queue<T> &queue;
+        pipewriter<T> out;
+        int peer;
+    };
+
+    spsc_queue<T> queue;
+    bridge_sender *sender;
+    bridge_receiver *receiver;
+};
+
+// Returns the copy of [in] in thread group [group].
+template <typename T>
+pipebuf<T> &bridge(scheduler *sch, pipebuf<T> &in, int group, unsigned long size)
+{
+    return *(new pipebridge<T>(sch, in, group, size))->out;
+}
+
 // Math functions for templates
 
 template <typename T>
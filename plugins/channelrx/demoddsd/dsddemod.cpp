@@ -93,6 +93,12 @@ void DSDDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool DSDDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void DSDDemod::start()
 {
     qDebug() << "DSDDemod::start";
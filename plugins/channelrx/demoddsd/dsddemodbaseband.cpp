@@ -29,8 +29,10 @@ DSDDemodBaseband::DSDDemodBaseband() :
     m_mutex(QMutex::Recursive)
 {
     qDebug("DSDDemodBaseband::DSDDemodBaseband");
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     QObject::connect(
         &m_sampleFifo,
@@ -39,6 +41,13 @@ DSDDemodBaseband::DSDDemodBaseband() :
         &DSDDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &DSDDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo1(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
@@ -60,6 +69,8 @@ void DSDDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
+
     m_channelSampleRate = 0;
 }
 
@@ -77,6 +88,10 @@ void DSDDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
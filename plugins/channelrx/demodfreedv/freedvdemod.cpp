@@ -84,6 +84,12 @@ void FreeDVDemod::feed(const SampleVector::const_iterator& begin, const SampleVe
     m_basebandSink->feed(begin, end);
 }
 
+bool FreeDVDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void FreeDVDemod::start()
 {
     qDebug() << "FreeDVDemod::start";
@@ -31,8 +31,10 @@ FreeDVDemodBaseband::FreeDVDemodBaseband() :
     m_messageQueueToGUI(nullptr)
 {
     qDebug("FreeDVDemodBaseband::FreeDVDemodBaseband");
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     QObject::connect(
         &m_sampleFifo,
@@ -41,6 +43,13 @@ FreeDVDemodBaseband::FreeDVDemodBaseband() :
         &FreeDVDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &FreeDVDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
@@ -58,6 +67,7 @@ void FreeDVDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void FreeDVDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -69,7 +79,9 @@ void FreeDVDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
-    while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    bool ringRead = m_sampleRingInput.read(m_inputMessageQueue);
+
+    while (!ringRead && (m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
 		SampleVector::iterator part1end;
@@ -51,7 +51,9 @@ const int NFMDemod::m_udpBlockSize = 512;
 NFMDemod::NFMDemod(DeviceAPI *devieAPI) :
         ChannelAPI(m_channelIdURI, ChannelAPI::StreamSingleSink),
         m_deviceAPI(devieAPI),
-        m_basebandSampleRate(0)
+        m_basebandSampleRate(0),
+        m_subbandRequestFrequencyOffset(0),
+        m_subbandRequestBandwidth(0)
 {
     qDebug("NFMDemod::NFMDemod");
 	setObjectName(m_channelId);
@@ -92,6 +94,25 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool NFMDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
+bool NFMDemod::getSubbandRequest(qint64& frequencyOffset, int& bandwidth)
+{
+    QMutexLocker mutexLocker(&m_subbandRequestMutex);
+    frequencyOffset = m_subbandRequestFrequencyOffset;
+    bandwidth = m_subbandRequestBandwidth;
+    return true;
+}
+
+void NFMDemod::setSubband(int sampleRate, qint64 frequencyOffset)
+{
+    m_basebandSink->setSubband(sampleRate, frequencyOffset);
+}
+
 void NFMDemod::start()
 {
     qDebug() << "NFMDemod::start";
@@ -253,6 +274,15 @@ void NFMDemod::applySettings(const NFMDemodSettings& settings, bool force)
         sendChannelSettings(messageQueues, reverseAPIKeys, settings, force);
     }
 
+    if ((m_settings.m_inputFrequencyOffset != settings.m_inputFrequencyOffset) ||
+        (m_settings.m_rfBandwidth != settings.m_rfBandwidth) || force)
+    {
+        QMutexLocker mutexLocker(&m_subbandRequestMutex);
+        m_subbandRequestFrequencyOffset = settings.m_inputFrequencyOffset;
+        m_subbandRequestBandwidth = (int) settings.m_rfBandwidth; // the demodulator filters the channel to this width
+        setSubbandRequestChanged();
+    }
+
     m_settings = settings;
 }
 
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include <QNetworkRequest>
+#include <QMutex>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelapi.h"
@@ -67,6 +68,9 @@ public:
 
     using BasebandSampleSink::feed;
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool po);
+    virtual bool setSampleRingReader(SampleSinkRingReader *reader);
+    virtual bool getSubbandRequest(qint64& frequencyOffset, int& bandwidth);
+    virtual void setSubband(int sampleRate, qint64 frequencyOffset);
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
@@ -131,6 +135,9 @@ private:
     NFMDemodBaseband* m_basebandSink;
 	NFMDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
+    QMutex m_subbandRequestMutex;
+    qint64 m_subbandRequestFrequencyOffset; //!< snapshot of settings read by the device engine thread
+    int m_subbandRequestBandwidth;
 
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
@@ -26,10 +26,15 @@
 MESSAGE_CLASS_DEFINITION(NFMDemodBaseband::MsgConfigureNFMDemodBaseband, Message)
 
 NFMDemodBaseband::NFMDemodBaseband() :
+    m_basebandSampleRate(0),
+    m_subbandSampleRate(0),
+    m_subbandFrequencyOffset(0),
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("NFMDemodBaseband::NFMDemodBaseband");
     QObject::connect(
@@ -39,11 +44,20 @@ NFMDemodBaseband::NFMDemodBaseband() :
         &NFMDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &NFMDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
     m_channelSampleRate = 0;
 
+    m_inputMessageDispatcher.add<MsgConfigureNFMDemodBaseband>(&NFMDemodBaseband::handleConfigure);
+    m_inputMessageDispatcher.add<DSPSignalNotification>(&NFMDemodBaseband::handleSignalNotification);
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
 }
 
@@ -57,6 +71,8 @@ void NFMDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
+
     m_channelSampleRate = 0;
 }
 
@@ -65,6 +81,33 @@ void NFMDemodBaseband::setChannel(ChannelAPI *channel)
     m_sink.setChannel(channel);
 }
 
+void NFMDemodBaseband::setSubband(int sampleRate, qint64 frequencyOffset)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    qDebug("NFMDemodBaseband::setSubband: sampleRate: %d frequencyOffset: %lld", sampleRate, frequencyOffset);
+    m_subbandSampleRate = sampleRate;
+    m_subbandFrequencyOffset = sampleRate == 0 ? 0 : frequencyOffset;
+    m_sampleFifo.reset();
+
+    if (m_basebandSampleRate != 0) {
+        m_channelizer->setBasebandSampleRate(m_subbandSampleRate == 0 ? m_basebandSampleRate : m_subbandSampleRate);
+    }
+
+    applyChannelization(m_sink.getAudioSampleRate());
+}
+
+void NFMDemodBaseband::applyChannelization(int audioSampleRate)
+{
+    m_channelizer->setChannelization(audioSampleRate, m_settings.m_inputFrequencyOffset - m_subbandFrequencyOffset);
+    m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+
+    if (m_channelSampleRate != m_channelizer->getChannelSampleRate())
+    {
+        m_sink.applyAudioSampleRate(m_sink.getAudioSampleRate()); // reapply when channel sample rate changes
+        m_channelSampleRate = m_channelizer->getChannelSampleRate();
+    }
+}
+
 void NFMDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
@@ -74,6 +117,10 @@ void NFMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
@@ -111,44 +158,44 @@ void NFMDemodBaseband::handleInputMessages()
 
 bool NFMDemodBaseband::handleMessage(const Message& cmd)
 {
-    if (MsgConfigureNFMDemodBaseband::match(cmd))
-    {
-        QMutexLocker mutexLocker(&m_mutex);
-        MsgConfigureNFMDemodBaseband& cfg = (MsgConfigureNFMDemodBaseband&) cmd;
-        qDebug() << "NFMDemodBaseband::handleMessage: MsgConfigureNFMDemodBaseband";
+    return m_inputMessageDispatcher.dispatch(this, cmd);
+}
 
-        applySettings(cfg.getSettings(), cfg.getForce());
+bool NFMDemodBaseband::handleConfigure(const Message& cmd)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    MsgConfigureNFMDemodBaseband& cfg = (MsgConfigureNFMDemodBaseband&) cmd;
+    qDebug() << "NFMDemodBaseband::handleMessage: MsgConfigureNFMDemodBaseband";
 
-        return true;
-    }
-    else if (DSPSignalNotification::match(cmd))
-    {
-        QMutexLocker mutexLocker(&m_mutex);
-        DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
-        qDebug() << "NFMDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
-        m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
-        m_channelizer->setBasebandSampleRate(notif.getSampleRate());
-        m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+    applySettings(cfg.getSettings(), cfg.getForce());
 
-        if (m_channelSampleRate != m_channelizer->getChannelSampleRate())
-        {
-            m_sink.applyAudioSampleRate(m_sink.getAudioSampleRate()); // reapply when channel sample rate changes
-            m_channelSampleRate = m_channelizer->getChannelSampleRate();
-        }
+    return true;
+}
 
-		return true;
-    }
-    else
+bool NFMDemodBaseband::handleSignalNotification(const Message& cmd)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
+    qDebug() << "NFMDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
+    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+    m_basebandSampleRate = notif.getSampleRate();
+    m_channelizer->setBasebandSampleRate(m_subbandSampleRate == 0 ? m_basebandSampleRate : m_subbandSampleRate);
+    m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+
+    if (m_channelSampleRate != m_channelizer->getChannelSampleRate())
     {
-        return false;
+        m_sink.applyAudioSampleRate(m_sink.getAudioSampleRate()); // reapply when channel sample rate changes
+        m_channelSampleRate = m_channelizer->getChannelSampleRate();
     }
+
+    return true;
 }
 
 void NFMDemodBaseband::applySettings(const NFMDemodSettings& settings, bool force)
 {
     if ((settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset) || force)
     {
-        m_channelizer->setChannelization(m_sink.getAudioSampleRate(), settings.m_inputFrequencyOffset);
+        m_channelizer->setChannelization(m_sink.getAudioSampleRate(), settings.m_inputFrequencyOffset - m_subbandFrequencyOffset);
         m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
 
         if (m_channelSampleRate != m_channelizer->getChannelSampleRate())
@@ -169,7 +216,7 @@ void NFMDemodBaseband::applySettings(const NFMDemodSettings& settings, bool forc
 
         if (m_sink.getAudioSampleRate() != audioSampleRate)
         {
-            m_channelizer->setChannelization(audioSampleRate, settings.m_inputFrequencyOffset);
+            m_channelizer->setChannelization(audioSampleRate, settings.m_inputFrequencyOffset - m_subbandFrequencyOffset);
             m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
             m_sink.applyAudioSampleRate(audioSampleRate);
         }
@@ -188,6 +235,8 @@ int NFMDemodBaseband::getChannelSampleRate() const
 
 void NFMDemodBaseband::setBasebandSampleRate(int sampleRate)
 {
-    m_channelizer->setBasebandSampleRate(sampleRate);
+    QMutexLocker mutexLocker(&m_mutex);
+    m_basebandSampleRate = sampleRate;
+    m_channelizer->setBasebandSampleRate(m_subbandSampleRate == 0 ? m_basebandSampleRate : m_subbandSampleRate);
     m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
 }
@@ -22,8 +22,10 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "util/messagedispatcher.h"
 
 #include "nfmdemodsink.h"
 
@@ -70,18 +72,28 @@ public:
     int getAudioSampleRate() const { return m_sink.getAudioSampleRate(); }
     void setBasebandSampleRate(int sampleRate);
     void setChannel(ChannelAPI *channel);
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
+    void setSubband(int sampleRate, qint64 frequencyOffset);
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     int m_channelSampleRate;
+    int m_basebandSampleRate;
+    int m_subbandSampleRate;          //!< when not zero samples fed are those of a polyphase channelizer sub-band
+    qint64 m_subbandFrequencyOffset;  //!< center of the sub-band relative to the baseband center
     NFMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     NFMDemodSettings m_settings;
     QMutex m_mutex;
+    MessageDispatcher<NFMDemodBaseband> m_inputMessageDispatcher;
 
     bool handleMessage(const Message& cmd);
+    bool handleConfigure(const Message& cmd);
+    bool handleSignalNotification(const Message& cmd);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
+    void applyChannelization(int audioSampleRate);
 
 private slots:
     void handleInputMessages();
@@ -78,35 +78,40 @@ NFMDemodSink::NFMDemodSink() :
 
 void NFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    int nbIn = end - begin;
+    m_rfInput.resize(nbIn);
+    m_rfOutput.resize(nbIn + FFT_FILTER_LENGTH/2); // room for the samples pending in the filter
+
+    for (int i = 0; i < nbIn; i++)
     {
-        Complex c(it->real(), it->imag());
-        c *= m_nco.nextIQ();
+        Complex c(begin[i].real(), begin[i].imag());
+        m_rfInput[i] = c * m_nco.nextIQ();
+    }
 
-        Complex ci;
-        fftfilt::cmplx *rf;
-        int rf_out = m_rfFilter.runFilt(c, &rf); // filter RF before demod
-        for (int i = 0 ; i < rf_out; i++)
+    Complex ci;
+    fftfilt::cmplx *rf = m_rfOutput.data();
+    int rf_out = m_rfFilter.runFilt(m_rfInput.data(), nbIn, rf); // filter RF before demod
+
+    for (int i = 0 ; i < rf_out; i++)
+    {
+        if (m_interpolatorDistance == 1.0f)
         {
-            if (m_interpolatorDistance == 1.0f)
-            {
-                processOneSample(rf[i]);
-            }
-            else if (m_interpolatorDistance < 1.0f) // interpolate
+            processOneSample(rf[i]);
+        }
+        else if (m_interpolatorDistance < 1.0f) // interpolate
+        {
+            while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, rf[i], &ci))
             {
-                while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, rf[i], &ci))
-                {
-                    processOneSample(ci);
-                    m_interpolatorDistanceRemain += m_interpolatorDistance;
-                }
+                processOneSample(ci);
+                m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
-            else // decimate
+        }
+        else // decimate
+        {
+            if (m_interpolator.decimate(&m_interpolatorDistanceRemain, rf[i], &ci))
             {
-                if (m_interpolator.decimate(&m_interpolatorDistanceRemain, rf[i], &ci))
-                {
-                    processOneSample(ci);
-                    m_interpolatorDistanceRemain += m_interpolatorDistance;
-                }
+                processOneSample(ci);
+                m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
         }
     }
@@ -409,6 +414,7 @@ void NFMDemodSink::applyAudioSampleRate(unsigned int sampleRate)
     m_afSquelch.setThreshold(m_squelchLevel);
     m_phaseDiscri.setFMScaling(Real(sampleRate) / (2.0f * m_settings.m_fmDeviation));
     m_audioFifo.setSize(sampleRate);
+    m_audioFifo.setSampleRate(sampleRate); // resampled by the audio device if it opened at another rate
     m_squelchDelayLine.resize(sampleRate/2);
     m_interpolatorDistance = Real(m_channelSampleRate) / Real(sampleRate);
     m_interpolatorDistanceRemain = m_interpolatorDistance;
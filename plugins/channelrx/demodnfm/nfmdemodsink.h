@@ -18,6 +18,8 @@
 #ifndef INCLUDE_NFMDEMODSINK_H
 #define INCLUDE_NFMDEMODSINK_H
 
+#include <vector>
+
 #include <QVector>
 
 #include "dsp/channelsamplesink.h"
@@ -110,6 +112,8 @@ private:
     NCO m_nco;
     Interpolator m_interpolator;
     fftfilt m_rfFilter;
+    std::vector<fftfilt::cmplx> m_rfInput;  //!< mixed down samples of the current feed
+    std::vector<fftfilt::cmplx> m_rfOutput; //!< RF filtered samples of the current feed
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
     Lowpass<Real> m_ctcssLowpass;
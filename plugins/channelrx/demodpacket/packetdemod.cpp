@@ -93,6 +93,12 @@ void PacketDemod::feed(const SampleVector::const_iterator& begin, const SampleVe
     m_basebandSink->feed(begin, end);
 }
 
+bool PacketDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void PacketDemod::start()
 {
     qDebug("PacketDemod::start");
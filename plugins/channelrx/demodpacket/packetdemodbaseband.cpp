@@ -33,8 +33,10 @@ PacketDemodBaseband::PacketDemodBaseband(PacketDemod *packetDemod) :
 {
     qDebug("PacketDemodBaseband::PacketDemodBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 PacketDemodBaseband::~PacketDemodBaseband()
@@ -49,6 +51,7 @@ void PacketDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void PacketDemodBaseband::startWork()
@@ -61,6 +64,13 @@ void PacketDemodBaseband::startWork()
         &PacketDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &PacketDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -75,6 +85,12 @@ void PacketDemodBaseband::stopWork()
         this,
         &PacketDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &PacketDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -92,6 +108,10 @@ void PacketDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
@@ -42,7 +42,9 @@ const char * const PagerDemod::m_channelId = "PagerDemod";
 PagerDemod::PagerDemod(DeviceAPI *deviceAPI) :
         ChannelAPI(m_channelIdURI, ChannelAPI::StreamSingleSink),
         m_deviceAPI(deviceAPI),
-        m_basebandSampleRate(0)
+        m_basebandSampleRate(0),
+        m_subbandRequestFrequencyOffset(0),
+        m_subbandRequestBandwidth(0)
 {
     setObjectName(m_channelId);
 
@@ -87,6 +89,25 @@ void PagerDemod::feed(const SampleVector::const_iterator& begin, const SampleVec
     m_basebandSink->feed(begin, end);
 }
 
+bool PagerDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
+bool PagerDemod::getSubbandRequest(qint64& frequencyOffset, int& bandwidth)
+{
+    QMutexLocker mutexLocker(&m_subbandRequestMutex);
+    frequencyOffset = m_subbandRequestFrequencyOffset;
+    bandwidth = m_subbandRequestBandwidth;
+    return true;
+}
+
+void PagerDemod::setSubband(int sampleRate, qint64 frequencyOffset)
+{
+    m_basebandSink->setSubband(sampleRate, frequencyOffset);
+}
+
 void PagerDemod::start()
 {
     qDebug("PagerDemod::start");
@@ -235,6 +256,15 @@ void PagerDemod::applySettings(const PagerDemodSettings& settings, bool force)
         webapiReverseSendSettings(reverseAPIKeys, settings, fullUpdate || force);
     }
 
+    if ((m_settings.m_inputFrequencyOffset != settings.m_inputFrequencyOffset) ||
+        (m_settings.m_rfBandwidth != settings.m_rfBandwidth) || force)
+    {
+        QMutexLocker mutexLocker(&m_subbandRequestMutex);
+        m_subbandRequestFrequencyOffset = settings.m_inputFrequencyOffset;
+        m_subbandRequestBandwidth = (int) settings.m_rfBandwidth; // the sink filters the channel to this width
+        setSubbandRequestChanged();
+    }
+
     m_settings = settings;
 }
 
@@ -25,6 +25,7 @@
 #include <QUdpSocket>
 #include <QThread>
 #include <QDateTime>
+#include <QMutex>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelapi.h"
@@ -110,6 +111,9 @@ public:
 
     using BasebandSampleSink::feed;
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool po);
+    virtual bool setSampleRingReader(SampleSinkRingReader *reader);
+    virtual bool getSubbandRequest(qint64& frequencyOffset, int& bandwidth);
+    virtual void setSubband(int sampleRate, qint64 frequencyOffset);
     virtual void start();
     virtual void stop();
     virtual bool handleMessage(const Message& cmd);
@@ -173,6 +177,9 @@ private:
     PagerDemodBaseband* m_basebandSink;
     PagerDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
+    QMutex m_subbandRequestMutex;
+    qint64 m_subbandRequestFrequencyOffset; //!< snapshot of settings read by the device engine thread
+    int m_subbandRequestBandwidth;
     qint64 m_centerFrequency;
     QUdpSocket m_udpSocket;
 
@@ -27,6 +27,9 @@
 MESSAGE_CLASS_DEFINITION(PagerDemodBaseband::MsgConfigurePagerDemodBaseband, Message)
 
 PagerDemodBaseband::PagerDemodBaseband(PagerDemod *pagerDemod) :
+    m_basebandSampleRate(0),
+    m_subbandSampleRate(0),
+    m_subbandFrequencyOffset(0),
     m_sink(pagerDemod),
     m_running(false),
     m_mutex(QMutex::Recursive)
@@ -34,8 +37,10 @@ PagerDemodBaseband::PagerDemodBaseband(PagerDemod *pagerDemod) :
     qDebug("PagerDemodBaseband::PagerDemodBaseband");
 
     m_sink.setScopeSink(&m_scopeSink);
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 PagerDemodBaseband::~PagerDemodBaseband()
@@ -50,6 +55,7 @@ void PagerDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void PagerDemodBaseband::startWork()
@@ -62,6 +68,13 @@ void PagerDemodBaseband::startWork()
         &PagerDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &PagerDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -76,6 +89,12 @@ void PagerDemodBaseband::stopWork()
         this,
         &PagerDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &PagerDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -84,6 +103,22 @@ void PagerDemodBaseband::setChannel(ChannelAPI *channel)
     m_sink.setChannel(channel);
 }
 
+void PagerDemodBaseband::setSubband(int sampleRate, qint64 frequencyOffset)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    qDebug("PagerDemodBaseband::setSubband: sampleRate: %d frequencyOffset: %lld", sampleRate, frequencyOffset);
+    m_subbandSampleRate = sampleRate;
+    m_subbandFrequencyOffset = sampleRate == 0 ? 0 : frequencyOffset;
+    m_sampleFifo.reset();
+
+    if (m_basebandSampleRate != 0) {
+        m_channelizer->setBasebandSampleRate(m_subbandSampleRate == 0 ? m_basebandSampleRate : m_subbandSampleRate);
+    }
+
+    m_channelizer->setChannelization(PagerDemodSettings::m_channelSampleRate, m_settings.m_inputFrequencyOffset - m_subbandFrequencyOffset);
+    m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+}
+
 void PagerDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
@@ -93,6 +128,10 @@ void PagerDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
@@ -160,7 +199,7 @@ void PagerDemodBaseband::applySettings(const PagerDemodSettings& settings, bool
 {
     if ((settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset) || force)
     {
-        m_channelizer->setChannelization(PagerDemodSettings::m_channelSampleRate, settings.m_inputFrequencyOffset);
+        m_channelizer->setChannelization(PagerDemodSettings::m_channelSampleRate, settings.m_inputFrequencyOffset - m_subbandFrequencyOffset);
         m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
     }
 
@@ -171,6 +210,8 @@ void PagerDemodBaseband::applySettings(const PagerDemodSettings& settings, bool
 
 void PagerDemodBaseband::setBasebandSampleRate(int sampleRate)
 {
-    m_channelizer->setBasebandSampleRate(sampleRate);
+    QMutexLocker mutexLocker(&m_mutex);
+    m_basebandSampleRate = sampleRate;
+    m_channelizer->setBasebandSampleRate(m_subbandSampleRate == 0 ? m_basebandSampleRate : m_subbandSampleRate);
     m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
 }
@@ -23,6 +23,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "dsp/scopevis.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
@@ -64,6 +65,7 @@ public:
     PagerDemodBaseband(PagerDemod *pagerDemod);
     ~PagerDemodBaseband();
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
@@ -75,12 +77,17 @@ public:
     void setBasebandSampleRate(int sampleRate);
     ScopeVis *getScopeSink() { return &m_scopeSink; }
     void setChannel(ChannelAPI *channel);
+    void setSubband(int sampleRate, qint64 frequencyOffset);
     double getMagSq() const { return m_sink.getMagSq(); }
     bool isRunning() const { return m_running; }
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
+    int m_basebandSampleRate;
+    int m_subbandSampleRate;          //!< when not zero samples fed are those of a polyphase channelizer sub-band
+    qint64 m_subbandFrequencyOffset;  //!< center of the sub-band relative to the baseband center
     PagerDemodSink m_sink;
     MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     PagerDemodSettings m_settings;
@@ -92,6 +92,12 @@ void SSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool SSBDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void SSBDemod::start()
 {
     qDebug() << "SSBDemod::start";
@@ -31,8 +31,10 @@ SSBDemodBaseband::SSBDemodBaseband() :
     m_spectrumVis(nullptr),
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("SSBDemodBaseband::SSBDemodBaseband");
     QObject::connect(
@@ -42,6 +44,13 @@ SSBDemodBaseband::SSBDemodBaseband() :
         &SSBDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &SSBDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate();
@@ -62,6 +71,8 @@ void SSBDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
+
     m_channelSampleRate = 0;
 }
 
@@ -79,6 +90,10 @@ void SSBDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
@@ -93,6 +93,7 @@ SSBDemodSink::~SSBDemodSink()
 void SSBDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     Complex ci;
+    m_filterInput.clear();
 
 	for(SampleVector::const_iterator it = begin; it < end; ++it)
 	{
@@ -103,7 +104,7 @@ void SSBDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
         {
             while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
             {
-                processOneSample(ci);
+                m_filterInput.push_back(ci);
                 m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
         }
@@ -111,26 +112,31 @@ void SSBDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
         {
             if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
             {
-                processOneSample(ci);
+                m_filterInput.push_back(ci);
                 m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
         }
     }
-}
 
-void SSBDemodSink::processOneSample(Complex &ci)
-{
-	fftfilt::cmplx *sideband;
-	int n_out = 0;
-	int decim = 1<<(m_spanLog2 - 1);
-	unsigned char decim_mask = decim - 1; // counter LSB bit mask for decimation by 2^(m_scaleLog2 - 1)
+    // filter the whole feed at once: output size is at most input size plus half the FFT length (m_ssbFftLen for DSB)
+    int nbIn = m_filterInput.size();
+    int n_out;
+    m_filterOutput.resize(nbIn + m_ssbFftLen);
 
     if (m_dsb) {
-        n_out = DSBFilter->runDSB(ci, &sideband);
+        n_out = DSBFilter->runDSB(m_filterInput.data(), nbIn, m_filterOutput.data());
     } else {
-        n_out = SSBFilter->runSSB(ci, &sideband, m_usb);
+        n_out = SSBFilter->runSSB(m_filterInput.data(), nbIn, m_filterOutput.data(), m_usb);
     }
 
+    processSideband(m_filterOutput.data(), n_out);
+}
+
+void SSBDemodSink::processSideband(const fftfilt::cmplx *sideband, int n_out)
+{
+	int decim = 1<<(m_spanLog2 - 1);
+	unsigned char decim_mask = decim - 1; // counter LSB bit mask for decimation by 2^(m_scaleLog2 - 1)
+
     for (int i = 0; i < n_out; i++)
     {
         // Downsample by 2^(m_scaleLog2 - 1) for SSB band spectrum display
@@ -18,6 +18,8 @@
 #ifndef INCLUDE_SSBDEMODSINK_H
 #define INCLUDE_SSBDEMODSINK_H
 
+#include <vector>
+
 #include <QVector>
 
 #include "dsp/channelsamplesink.h"
@@ -115,6 +117,8 @@ private:
     Real m_interpolatorDistanceRemain;
 	fftfilt* SSBFilter;
 	fftfilt* DSBFilter;
+    std::vector<fftfilt::cmplx> m_filterInput;  //!< channel samples of the current feed
+    std::vector<fftfilt::cmplx> m_filterOutput; //!< sideband samples of the current feed
 
 	BasebandSampleSink* m_spectrumSink;
 	SampleVector m_sampleBuffer;
@@ -130,7 +134,7 @@ private:
 	static const int m_ssbFftLen;
 	static const int m_agcTarget;
 
-    void processOneSample(Complex &ci);
+    void processSideband(const fftfilt::cmplx *sideband, int n_out);
 };
 
 #endif // INCLUDE_SSBDEMODSINK_H
@@ -28,6 +28,7 @@
 MESSAGE_CLASS_DEFINITION(VORDemodBaseband::MsgConfigureVORDemodBaseband, Message)
 
 VORDemodBaseband::VORDemodBaseband() :
+    m_channelizersFeed(m_channelizers),
     m_running(false),
     m_mutex(QMutex::Recursive),
     m_messageQueueToGUI(nullptr),
@@ -35,7 +36,9 @@ VORDemodBaseband::VORDemodBaseband() :
 {
     qDebug("VORDemodBaseband::VORDemodBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_sampleRingInput.setSink(&m_channelizersFeed);
 
     // FIXME: If we remove this audio stops working when this demod is closed
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(&m_audioFifoBug, getInputMessageQueue());
@@ -65,6 +68,7 @@ void VORDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void VORDemodBaseband::startWork()
@@ -77,6 +81,13 @@ void VORDemodBaseband::startWork()
         &VORDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &VORDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -91,6 +102,12 @@ void VORDemodBaseband::stopWork()
         this,
         &VORDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &VORDemodBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -103,6 +120,10 @@ void VORDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
@@ -128,6 +149,13 @@ void VORDemodBaseband::handleData()
     }
 }
 
+void VORDemodBaseband::ChannelizersFeed::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    for (int i = 0; i < m_channelizers.size(); i++) {
+        m_channelizers[i]->feed(begin, end);
+    }
+}
+
 void VORDemodBaseband::handleInputMessages()
 {
     Message* message;
@@ -23,6 +23,8 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
+#include "dsp/channelsamplesink.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -60,6 +62,7 @@ public:
     VORDemodBaseband();
     ~VORDemodBaseband();
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
@@ -112,8 +115,19 @@ public:
     bool isRunning() const { return m_running; }
 
 private:
+    class ChannelizersFeed : public ChannelSampleSink //!< Feeds the shared ring samples to every channelizer
+    {
+    public:
+        ChannelizersFeed(QList<DownChannelizer *>& channelizers) : m_channelizers(channelizers) {}
+        virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    private:
+        QList<DownChannelizer *>& m_channelizers;
+    };
+
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     QList<DownChannelizer *> m_channelizers;
+    ChannelizersFeed m_channelizersFeed;
     QList<VORDemodSink *> m_sinks;
     AudioFifo m_audioFifoBug; // FIXME: Removing this results in audio stopping when demod is closed
     MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
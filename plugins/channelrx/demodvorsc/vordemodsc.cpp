@@ -92,6 +92,12 @@ void VORDemodSC::feed(const SampleVector::const_iterator& begin, const SampleVec
     m_basebandSink->feed(begin, end);
 }
 
+bool VORDemodSC::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void VORDemodSC::start()
 {
     qDebug("VORDemodSC::start");
@@ -94,6 +94,12 @@ void WFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool WFMDemod::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void WFMDemod::start()
 {
     qDebug() << "WFMDemod::start";
@@ -102,6 +102,12 @@ void FileSink::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+bool FileSink::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void FileSink::start()
 {
 	qDebug("FileSink::start");
@@ -544,6 +550,10 @@ void FileSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     response.getFileSinkReport()->setRecording(m_basebandSink->isRecording() ? 1 : 0);
     response.getFileSinkReport()->setRecordCaptures(getNbTracks());
     response.getFileSinkReport()->setChannelSampleRate(m_basebandSink->getChannelSampleRate());
+    AsyncFileWriter::Statistics writeStatistics = m_basebandSink->getWriteStatistics();
+    response.getFileSinkReport()->setRecordDroppedBytes(writeStatistics.m_droppedBytes);
+    response.getFileSinkReport()->setRecordWriteLatencyAvgUs(writeStatistics.m_latencyAverageUs);
+    response.getFileSinkReport()->setRecordWriteLatencyMaxUs(writeStatistics.m_latencyMaxUs);
 }
 
 void FileSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const FileSinkSettings& settings, bool force)
@@ -120,6 +120,7 @@ void FileSinkSink::stopRecording()
             m_msgQueueToGUI->push(msg);
         }
 
+        updateWriteStatistics();
         m_record = false;
     }
 }
@@ -193,6 +194,10 @@ void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleV
         }
     }
 
+    if (m_record) {
+        updateWriteStatistics();
+    }
+
     if (m_spectrumSink) {
 		m_spectrumSink->feed(beginw, endw, false);
 	}
@@ -350,3 +355,17 @@ void FileSinkSink::squelchRecording(bool squelchOpen)
 
     m_squelchOpen = squelchOpen;
 }
+
+void FileSinkSink::updateWriteStatistics()
+{
+    AsyncFileWriter::Statistics statistics;
+    m_fileSink->getWriteStatistics(statistics);
+    QMutexLocker mutexLocker(&m_writeStatisticsMutex);
+    m_writeStatistics = statistics;
+}
+
+AsyncFileWriter::Statistics FileSinkSink::getWriteStatistics() const
+{
+    QMutexLocker mutexLocker(&m_writeStatisticsMutex);
+    return m_writeStatistics;
+}
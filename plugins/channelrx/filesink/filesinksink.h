@@ -18,6 +18,8 @@
 #ifndef INCLUDE_FILESINKSINK_H_
 #define INCLUDE_FILESINKSINK_H_
 
+#include <QMutex>
+
 #include "dsp/channelsamplesink.h"
 #include "dsp/filerecordinterface.h"
 #include "dsp/decimatorc.h"
@@ -52,6 +54,7 @@ public:
     uint64_t getMsCount() const { return m_msCount; }
     uint64_t getByteCount() const { return m_byteCount; }
     unsigned int getNbTracks() const { return m_nbCaptures; }
+    AsyncFileWriter::Statistics getWriteStatistics() const; //!< copy safe to take from any thread
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_msgQueueToGUI = messageQueue; }
     void squelchRecording(bool squelchOpen);
     int getSampleRate() const { return m_sinkSampleRate; }
@@ -82,6 +85,10 @@ private:
     uint64_t m_msCount;
     uint64_t m_byteCount;
     int m_bytesPerSample;
+    AsyncFileWriter::Statistics m_writeStatistics; //!< copy of the record statistics updated after each write
+    mutable QMutex m_writeStatisticsMutex;
+
+    void updateWriteStatistics();
 };
 
 #endif // INCLUDE_FILESINKSINK_H_
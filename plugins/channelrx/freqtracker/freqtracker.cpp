@@ -96,6 +96,12 @@ void FreqTracker::feed(const SampleVector::const_iterator& begin, const SampleVe
     m_basebandSink->feed(begin, end);
 }
 
+bool FreqTracker::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void FreqTracker::start()
 {
 	qDebug("FreqTracker::start");
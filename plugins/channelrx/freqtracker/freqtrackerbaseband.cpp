@@ -29,8 +29,10 @@ MESSAGE_CLASS_DEFINITION(FreqTrackerBaseband::MsgConfigureFreqTrackerBaseband, M
 FreqTrackerBaseband::FreqTrackerBaseband() :
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("FreqTrackerBaseband::FreqTrackerBaseband");
     QObject::connect(
@@ -40,6 +42,13 @@ FreqTrackerBaseband::FreqTrackerBaseband() :
         &FreqTrackerBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &FreqTrackerBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
 }
@@ -53,6 +62,7 @@ void FreqTrackerBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void FreqTrackerBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -64,6 +74,10 @@ void FreqTrackerBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
@@ -88,6 +88,12 @@ void LocalSink::feed(const SampleVector::const_iterator& begin, const SampleVect
     m_basebandSink->feed(begin, end);
 }
 
+bool LocalSink::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void LocalSink::start()
 {
 	qDebug("LocalSink::start");
@@ -98,6 +98,12 @@ void NoiseFigure::feed(const SampleVector::const_iterator& begin, const SampleVe
     m_basebandSink->feed(begin, end);
 }
 
+bool NoiseFigure::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void NoiseFigure::start()
 {
     qDebug("NoiseFigure::start");
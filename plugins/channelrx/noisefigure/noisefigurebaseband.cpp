@@ -33,8 +33,10 @@ NoiseFigureBaseband::NoiseFigureBaseband(NoiseFigure *aisDemod) :
 {
     qDebug("NoiseFigureBaseband::NoiseFigureBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 NoiseFigureBaseband::~NoiseFigureBaseband()
@@ -49,6 +51,7 @@ void NoiseFigureBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void NoiseFigureBaseband::startWork()
@@ -61,6 +64,13 @@ void NoiseFigureBaseband::startWork()
         &NoiseFigureBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &NoiseFigureBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -75,6 +85,12 @@ void NoiseFigureBaseband::stopWork()
         this,
         &NoiseFigureBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &NoiseFigureBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -92,6 +108,10 @@ void NoiseFigureBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
@@ -23,6 +23,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "dsp/scopevis.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
@@ -63,6 +64,7 @@ public:
     NoiseFigureBaseband(NoiseFigure *aisDemod);
     ~NoiseFigureBaseband();
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
@@ -79,6 +81,7 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     NoiseFigureSink m_sink;
     MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
@@ -124,6 +124,12 @@ void RadioAstronomy::feed(const SampleVector::const_iterator& begin, const Sampl
     m_basebandSink->feed(begin, end);
 }
 
+bool RadioAstronomy::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void RadioAstronomy::start()
 {
     qDebug("RadioAstronomy::start");
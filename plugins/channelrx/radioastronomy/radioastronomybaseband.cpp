@@ -34,8 +34,10 @@ RadioAstronomyBaseband::RadioAstronomyBaseband(RadioAstronomy *aisDemod) :
 {
     qDebug("RadioAstronomyBaseband::RadioAstronomyBaseband");
 
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 RadioAstronomyBaseband::~RadioAstronomyBaseband()
@@ -50,6 +52,7 @@ void RadioAstronomyBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void RadioAstronomyBaseband::startWork()
@@ -62,6 +65,13 @@ void RadioAstronomyBaseband::startWork()
         &RadioAstronomyBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &RadioAstronomyBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -76,6 +86,12 @@ void RadioAstronomyBaseband::stopWork()
         this,
         &RadioAstronomyBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &RadioAstronomyBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -93,6 +109,10 @@ void RadioAstronomyBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
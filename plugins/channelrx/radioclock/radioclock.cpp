@@ -94,6 +94,12 @@ void RadioClock::feed(const SampleVector::const_iterator& begin, const SampleVec
     m_basebandSink->feed(begin, end);
 }
 
+bool RadioClock::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void RadioClock::start()
 {
     qDebug("RadioClock::start");
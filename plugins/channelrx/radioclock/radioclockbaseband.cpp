@@ -35,8 +35,10 @@ RadioClockBaseband::RadioClockBaseband(RadioClock *radioClock) :
     qDebug("RadioClockBaseband::RadioClockBaseband");
 
     m_sink.setScopeSink(&m_scopeSink);
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 }
 
 RadioClockBaseband::~RadioClockBaseband()
@@ -51,6 +53,7 @@ void RadioClockBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void RadioClockBaseband::startWork()
@@ -63,6 +66,13 @@ void RadioClockBaseband::startWork()
         &RadioClockBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &RadioClockBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -77,6 +87,12 @@ void RadioClockBaseband::stopWork()
         this,
         &RadioClockBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &RadioClockBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -94,6 +110,10 @@ void RadioClockBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
         SampleVector::iterator part1begin;
@@ -34,6 +34,7 @@
 #include "dsp/dspcommands.h"
 #include "dsp/hbfilterchainconverter.h"
 #include "dsp/devicesamplemimo.h"
+#include "channel/remotesamplecodec.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "device/deviceapi.h"
 #include "feature/feature.h"
@@ -88,6 +89,12 @@ void RemoteSink::feed(const SampleVector::const_iterator& begin, const SampleVec
     m_basebandSink->feed(begin, end);
 }
 
+bool RemoteSink::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void RemoteSink::start()
 {
     qDebug("RemoteSink::start: m_basebandSampleRate: %d", m_basebandSampleRate);
@@ -173,6 +180,9 @@ void RemoteSink::applySettings(const RemoteSinkSettings& settings, bool force)
     qDebug() << "RemoteSink::applySettings:"
             << " m_nbFECBlocks: " << settings.m_nbFECBlocks
             << " m_txDelay: " << settings.m_txDelay
+            << " m_nbBlocksPerDatagram: " << settings.m_nbBlocksPerDatagram
+            << " m_compression: " << settings.m_compression
+            << " m_compressionLossBits: " << settings.m_compressionLossBits
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
             << " m_streamIndex: " << settings.m_streamIndex
@@ -187,6 +197,15 @@ void RemoteSink::applySettings(const RemoteSinkSettings& settings, bool force)
     if ((m_settings.m_txDelay != settings.m_txDelay) || force) {
         reverseAPIKeys.append("txDelay");
     }
+    if ((m_settings.m_nbBlocksPerDatagram != settings.m_nbBlocksPerDatagram) || force) {
+        reverseAPIKeys.append("nbBlocksPerDatagram");
+    }
+    if ((m_settings.m_compression != settings.m_compression) || force) {
+        reverseAPIKeys.append("compression");
+    }
+    if ((m_settings.m_compressionLossBits != settings.m_compressionLossBits) || force) {
+        reverseAPIKeys.append("compressionLossBits");
+    }
     if ((m_settings.m_dataAddress != settings.m_dataAddress) || force) {
         reverseAPIKeys.append("dataAddress");
     }
@@ -332,6 +351,24 @@ void RemoteSink::webapiUpdateChannelSettings(
         }
     }
 
+    if (channelSettingsKeys.contains("nbBlocksPerDatagram"))
+    {
+        int nbBlocksPerDatagram = response.getRemoteSinkSettings()->getNbBlocksPerDatagram();
+        settings.m_nbBlocksPerDatagram = nbBlocksPerDatagram < 1 ?
+            1 : nbBlocksPerDatagram > RemoteMaxBlocksPerDatagram ? RemoteMaxBlocksPerDatagram : nbBlocksPerDatagram;
+    }
+
+    if (channelSettingsKeys.contains("compression")) {
+        settings.m_compression = response.getRemoteSinkSettings()->getCompression() != 0;
+    }
+
+    if (channelSettingsKeys.contains("compressionLossBits"))
+    {
+        int compressionLossBits = response.getRemoteSinkSettings()->getCompressionLossBits();
+        settings.m_compressionLossBits = compressionLossBits < 0 ?
+            0 : compressionLossBits > RemoteSampleCodec::m_maxLossBits ? RemoteSampleCodec::m_maxLossBits : compressionLossBits;
+    }
+
     if (channelSettingsKeys.contains("dataAddress")) {
         settings.m_dataAddress = *response.getRemoteSinkSettings()->getDataAddress();
     }
@@ -388,6 +425,9 @@ void RemoteSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& re
 {
     response.getRemoteSinkSettings()->setNbFecBlocks(settings.m_nbFECBlocks);
     response.getRemoteSinkSettings()->setTxDelay(settings.m_txDelay);
+    response.getRemoteSinkSettings()->setNbBlocksPerDatagram(settings.m_nbBlocksPerDatagram);
+    response.getRemoteSinkSettings()->setCompression(settings.m_compression ? 1 : 0);
+    response.getRemoteSinkSettings()->setCompressionLossBits(settings.m_compressionLossBits);
 
     if (response.getRemoteSinkSettings()->getDataAddress()) {
         *response.getRemoteSinkSettings()->getDataAddress() = settings.m_dataAddress;
@@ -490,6 +530,15 @@ void RemoteSink::webapiFormatChannelSettings(
     {
         swgRemoteSinkSettings->setTxDelay(settings.m_txDelay);
     }
+    if (channelSettingsKeys.contains("nbBlocksPerDatagram") || force) {
+        swgRemoteSinkSettings->setNbBlocksPerDatagram(settings.m_nbBlocksPerDatagram);
+    }
+    if (channelSettingsKeys.contains("compression") || force) {
+        swgRemoteSinkSettings->setCompression(settings.m_compression ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("compressionLossBits") || force) {
+        swgRemoteSinkSettings->setCompressionLossBits(settings.m_compressionLossBits);
+    }
     if (channelSettingsKeys.contains("dataAddress") || force) {
         swgRemoteSinkSettings->setDataAddress(new QString(settings.m_dataAddress));
     }
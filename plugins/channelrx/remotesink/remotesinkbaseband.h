@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -61,6 +62,7 @@ public:
     ~RemoteSinkBaseband();
 
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
 	void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     void startSender() { m_sink.startSender(); }
     void stopSender() { m_sink.stopSender(); }
@@ -71,6 +73,7 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     int m_basebandSampleRate;
     RemoteSinkSink m_sink;
@@ -169,6 +169,11 @@ void RemoteSinkGUI::displaySettings()
     ui->nominalNbBlocksText->setText(tr("%1/%2").arg(s).arg(s1));
     ui->txDelayText->setText(tr("%1%").arg(m_settings.m_txDelay));
     ui->txDelay->setValue(m_settings.m_txDelay);
+    ui->nbBlocksPerDatagram->setValue(m_settings.m_nbBlocksPerDatagram);
+    ui->datagramSizeText->setText(tr("%1").arg(m_settings.m_nbBlocksPerDatagram * RemoteUdpSize));
+    ui->compression->setChecked(m_settings.m_compression);
+    ui->compressionLossBits->setValue(m_settings.m_compressionLossBits);
+    ui->compressionLossBitsText->setText(tr("%1").arg(m_settings.m_compressionLossBits));
     updateTxDelayTime();
     applyDecimation();
     displayStreamIndex();
@@ -341,6 +346,26 @@ void RemoteSinkGUI::on_nbFECBlocks_valueChanged(int value)
     applySettings();
 }
 
+void RemoteSinkGUI::on_nbBlocksPerDatagram_valueChanged(int value)
+{
+    m_settings.m_nbBlocksPerDatagram = value;
+    ui->datagramSizeText->setText(tr("%1").arg(value * RemoteUdpSize));
+    applySettings();
+}
+
+void RemoteSinkGUI::on_compression_toggled(bool checked)
+{
+    m_settings.m_compression = checked;
+    applySettings();
+}
+
+void RemoteSinkGUI::on_compressionLossBits_valueChanged(int value)
+{
+    m_settings.m_compressionLossBits = value;
+    ui->compressionLossBitsText->setText(tr("%1").arg(value));
+    applySettings();
+}
+
 void RemoteSinkGUI::updateTxDelayTime()
 {
     double txDelayRatio = m_settings.m_txDelay / 100.0;
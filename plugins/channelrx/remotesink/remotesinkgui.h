@@ -90,6 +90,9 @@ private slots:
     void on_dataApplyButton_clicked(bool checked);
     void on_nbFECBlocks_valueChanged(int value);
     void on_txDelay_valueChanged(int value);
+    void on_nbBlocksPerDatagram_valueChanged(int value);
+    void on_compression_toggled(bool checked);
+    void on_compressionLossBits_valueChanged(int value);
     void onWidgetRolled(QWidget* widget, bool rollDown);
     void onMenuDialogCalled(const QPoint& p);
     void tick();
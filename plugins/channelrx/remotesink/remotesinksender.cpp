@@ -24,14 +24,127 @@
 
 #include <thread>
 #include <chrono>
+#include <algorithm>
 
 #include <QUdpSocket>
+#include <QThread>
 
 #include "cm256cc/cm256.h"
 
 #include "channel/remotedatablock.h"
+#include "channel/remotesamplecodec.h"
+#include "util/udpbatch.h"
 #include "remotesinksender.h"
 
+const int RemoteSinkSender::m_maxNbEncoders = 4;
+const int RemoteSinkSender::m_minBatchDelayUs = 100;
+
+RemoteSinkSender::EncodeTask::EncodeTask(CM256 *cm256) :
+    m_cm256(cm256),
+    m_dataBlock(nullptr)
+{
+    setAutoDelete(false);
+}
+
+void RemoteSinkSender::EncodeTask::start(QThreadPool& threadPool, RemoteDataBlock *dataBlock)
+{
+    m_dataBlock = dataBlock;
+    threadPool.start(this);
+}
+
+void RemoteSinkSender::EncodeTask::run()
+{
+    encode(m_dataBlock);
+    m_done.release();
+}
+
+void RemoteSinkSender::EncodeTask::encode(RemoteDataBlock *dataBlock)
+{
+    int nbBlocksFEC = dataBlock->m_txControlBlock.m_nbBlocksFEC;
+    int nbOriginalBlocks = dataBlock->m_txControlBlock.m_compression ? compress(dataBlock) : RemoteNbOrginalBlocks;
+    dataBlock->m_txControlBlock.m_nbOriginalBlocks = nbOriginalBlocks;
+
+    if ((nbBlocksFEC == 0) || !m_cm256) { // Do not FEC encode
+        return;
+    }
+
+    CM256::cm256_encoder_params cm256Params;  //!< Main interface with CM256 encoder
+    uint16_t frameIndex = dataBlock->m_txControlBlock.m_frameIndex;
+    RemoteSuperBlock *txBlockx = dataBlock->m_superBlocks;
+
+    cm256Params.BlockBytes = sizeof(RemoteProtectedBlock);
+    cm256Params.OriginalCount = nbOriginalBlocks;
+    cm256Params.RecoveryCount = nbBlocksFEC;
+
+    // Fill pointers to data
+    for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; ++i)
+    {
+        if (i >= cm256Params.OriginalCount) {
+            memset((void *) &txBlockx[i].m_protectedBlock, 0, sizeof(RemoteProtectedBlock));
+        }
+
+        txBlockx[i].m_header.m_frameIndex = frameIndex;
+        txBlockx[i].m_header.m_blockIndex = i;
+        txBlockx[i].m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+        txBlockx[i].m_header.m_sampleBits = SDR_RX_SAMP_SZ;
+        txBlockx[i].m_header.m_nbOriginalBlocks = nbOriginalBlocks < RemoteNbOrginalBlocks ? nbOriginalBlocks : 0;
+        m_descriptorBlocks[i].Block = (void *) &(txBlockx[i].m_protectedBlock);
+        m_descriptorBlocks[i].Index = txBlockx[i].m_header.m_blockIndex;
+    }
+
+    // Encode FEC blocks. The CM256 tables are read only after initialization so that tasks share them.
+    if (m_cm256->cm256_encode(cm256Params, m_descriptorBlocks, m_fecBlocks))
+    {
+        qWarning("RemoteSinkSender::EncodeTask::encode: CM256 encode failed. No transmission.");
+        // TODO: send without FEC changing meta data to set indication of no FEC
+    }
+
+    // Merge FEC with data to transmit
+    for (int i = 0; i < cm256Params.RecoveryCount; i++)
+    {
+        txBlockx[i + cm256Params.OriginalCount].m_protectedBlock = m_fecBlocks[i];
+    }
+}
+
+int RemoteSinkSender::EncodeTask::compress(RemoteDataBlock *dataBlock)
+{
+    RemoteSuperBlock *txBlockx = dataBlock->m_superBlocks;
+
+    for (int i = 1; i < RemoteNbOrginalBlocks; i++) {
+        memcpy(&m_samples[(i - 1) * RemoteNbBytesPerBlock], txBlockx[i].m_protectedBlock.buf, RemoteNbBytesPerBlock);
+    }
+
+    int size = RemoteSampleCodec::compress(
+        m_samples,
+        sizeof(m_samples),
+        SDR_RX_SAMP_SZ <= 16 ? 2 : 4,
+        dataBlock->m_txControlBlock.m_compressionLossBits,
+        m_compressed,
+        sizeof(m_compressed)
+    );
+
+    if (size < 0) { // not compressible: send raw samples
+        return RemoteNbOrginalBlocks;
+    }
+
+    int nbDataBlocks = (size + RemoteNbBytesPerBlock - 1) / RemoteNbBytesPerBlock;
+
+    for (int i = 1; i <= nbDataBlocks; i++)
+    {
+        int offset = (i - 1) * RemoteNbBytesPerBlock;
+        int blockSize = std::min(size - offset, RemoteNbBytesPerBlock);
+        memcpy(txBlockx[i].m_protectedBlock.buf, &m_compressed[offset], blockSize);
+        std::fill(txBlockx[i].m_protectedBlock.buf + blockSize, txBlockx[i].m_protectedBlock.buf + RemoteNbBytesPerBlock, 0);
+    }
+
+    // In case the frame is not FEC encoded block headers must be updated here
+    for (int i = 0; i <= nbDataBlocks; i++) {
+        txBlockx[i].m_header.m_nbOriginalBlocks = nbDataBlocks + 1;
+    }
+
+    return nbDataBlocks + 1;
+}
+
 RemoteSinkSender::RemoteSinkSender() :
     m_fifo(20, this),
     m_address(QHostAddress::LocalHost),
@@ -41,6 +154,14 @@ RemoteSinkSender::RemoteSinkSender() :
     m_cm256p = m_cm256.isInitialized() ? &m_cm256 : nullptr;
     m_socket = new QUdpSocket(this);
 
+    int nbEncoders = std::max(1, std::min(QThread::idealThreadCount() - 1, m_maxNbEncoders));
+    m_threadPool.setMaxThreadCount(nbEncoders);
+    m_threadPool.setExpiryTimeout(-1);
+
+    for (int i = 0; i < nbEncoders; i++) {
+        m_encodeTasks.push_back(new EncodeTask(m_cm256p));
+    }
+
     QObject::connect(
         &m_fifo,
         &RemoteSinkFifo::dataBlockServed,
@@ -53,6 +174,12 @@ RemoteSinkSender::RemoteSinkSender() :
 RemoteSinkSender::~RemoteSinkSender()
 {
     qDebug("RemoteSinkSender::~RemoteSinkSender");
+    m_threadPool.waitForDone();
+
+    for (auto task : m_encodeTasks) {
+        delete task;
+    }
+
     delete m_socket;
 }
 
@@ -65,85 +192,80 @@ void RemoteSinkSender::handleData()
 {
     RemoteDataBlock *dataBlock;
     unsigned int remainder = m_fifo.getRemainder();
+    m_dataBlocks.clear();
 
     while (remainder != 0)
     {
         remainder = m_fifo.readDataBlock(&dataBlock);
 
         if (dataBlock) {
-            sendDataBlock(dataBlock);
+            m_dataBlocks.push_back(dataBlock);
         }
     }
+
+    if (m_dataBlocks.size() == 1) // nothing to overlap with
+    {
+        m_encodeTasks[0]->encode(m_dataBlocks[0]);
+        sendDataBlock(m_dataBlocks[0]);
+        return;
+    }
+
+    // Keep up to one data block per encoder in flight ahead of the one being transmitted
+    unsigned int nbEncoders = m_encodeTasks.size();
+    unsigned int nbStarted = 0;
+
+    for (unsigned int i = 0; i < m_dataBlocks.size(); i++)
+    {
+        for (; (nbStarted < m_dataBlocks.size()) && (nbStarted < i + nbEncoders); nbStarted++) {
+            m_encodeTasks[nbStarted % nbEncoders]->start(m_threadPool, m_dataBlocks[nbStarted]);
+        }
+
+        m_encodeTasks[i % nbEncoders]->wait();
+        sendDataBlock(m_dataBlocks[i]);
+    }
 }
 
 void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
 {
-	CM256::cm256_encoder_params cm256Params;  //!< Main interface with CM256 encoder
-	CM256::cm256_block descriptorBlocks[256]; //!< Pointers to data for CM256 encoder
-	RemoteProtectedBlock fecBlocks[256];   //!< FEC data
-
-    uint16_t frameIndex = dataBlock->m_txControlBlock.m_frameIndex;
+    UDPBatch::Datagram datagrams[256];
     int nbBlocksFEC = dataBlock->m_txControlBlock.m_nbBlocksFEC;
     int txDelay = dataBlock->m_txControlBlock.m_txDelay;
+    int nbBlocksPerDatagram = dataBlock->m_txControlBlock.m_nbBlocksPerDatagram;
     m_address.setAddress(dataBlock->m_txControlBlock.m_dataAddress);
     uint16_t dataPort = dataBlock->m_txControlBlock.m_dataPort;
     RemoteSuperBlock *txBlockx = dataBlock->m_superBlocks;
+    int nbBlocks = dataBlock->m_txControlBlock.m_nbOriginalBlocks + (m_cm256p ? nbBlocksFEC : 0);
 
-    if ((nbBlocksFEC == 0) || !m_cm256p) // Do not FEC encode
+    if (!m_socket)
     {
-        if (m_socket)
-        {
-            for (int i = 0; i < RemoteNbOrginalBlocks; i++)
-            {
-                // send block via UDP
-                m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
-                std::this_thread::sleep_for(std::chrono::microseconds(txDelay));
-            }
-        }
+        dataBlock->m_txControlBlock.m_processed = true;
+        return;
     }
-    else
-    {
-        cm256Params.BlockBytes = sizeof(RemoteProtectedBlock);
-        cm256Params.OriginalCount = RemoteNbOrginalBlocks;
-        cm256Params.RecoveryCount = nbBlocksFEC;
 
-        // Fill pointers to data
-        for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; ++i)
-        {
-            if (i >= cm256Params.OriginalCount) {
-                memset((void *) &txBlockx[i].m_protectedBlock, 0, sizeof(RemoteProtectedBlock));
-            }
-
-            txBlockx[i].m_header.m_frameIndex = frameIndex;
-            txBlockx[i].m_header.m_blockIndex = i;
-            txBlockx[i].m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
-            txBlockx[i].m_header.m_sampleBits = SDR_RX_SAMP_SZ;
-            descriptorBlocks[i].Block = (void *) &(txBlockx[i].m_protectedBlock);
-            descriptorBlocks[i].Index = txBlockx[i].m_header.m_blockIndex;
-        }
+    // Consecutive super blocks are contiguous so a datagram of several blocks is sent in place
+    int nbDatagrams = 0;
 
-        // Encode FEC blocks
-        if (m_cm256p->cm256_encode(cm256Params, descriptorBlocks, fecBlocks))
-        {
-            qWarning("RemoteSinkSender::handleDataBlock: CM256 encode failed. No transmission.");
-            // TODO: send without FEC changing meta data to set indication of no FEC
-        }
+    for (int i = 0; i < nbBlocks; i += nbBlocksPerDatagram, nbDatagrams++)
+    {
+        datagrams[nbDatagrams].m_data = (const char*) &txBlockx[i];
+        datagrams[nbDatagrams].m_size = std::min(nbBlocksPerDatagram, nbBlocks - i) * RemoteUdpSize;
+    }
 
-        // Merge FEC with data to transmit
-        for (int i = 0; i < cm256Params.RecoveryCount; i++)
-        {
-            txBlockx[i + cm256Params.OriginalCount].m_protectedBlock = fecBlocks[i];
-        }
+    // The delay applies per block. Datagrams are sent in batches so that the sleep time is long enough to be accurate
+    int nbBlocksPerBatch = txDelay > 0 ? std::max(1, m_minBatchDelayUs / txDelay) : nbBlocks;
+    int nbDatagramsPerBatch = std::min((nbBlocksPerBatch + nbBlocksPerDatagram - 1) / nbBlocksPerDatagram, (int) UDPBatch::m_maxBatchSize);
+    auto deadline = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < nbDatagrams; i += nbDatagramsPerBatch)
+    {
+        int batchSize = std::min(nbDatagramsPerBatch, nbDatagrams - i);
+        UDPBatch::send(*m_socket, &datagrams[i], batchSize, m_address, dataPort);
 
-        // Transmit all blocks
-        if (m_socket)
+        if (txDelay > 0)
         {
-            for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; i++)
-            {
-                // send block via UDP
-                m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
-                std::this_thread::sleep_for(std::chrono::microseconds(txDelay));
-            }
+            int batchBlocks = std::min(batchSize * nbBlocksPerDatagram, nbBlocks - i * nbBlocksPerDatagram);
+            deadline += std::chrono::microseconds(txDelay * batchBlocks);
+            std::this_thread::sleep_until(deadline);
         }
     }
 
@@ -24,10 +24,15 @@
 #ifndef PLUGINS_CHANNELRX_REMOTESINK_REMOTESINKSENDER_H_
 #define PLUGINS_CHANNELRX_REMOTESINK_REMOTESINKSENDER_H_
 
+#include <vector>
+
 #include <QObject>
 #include <QMutex>
 #include <QWaitCondition>
 #include <QHostAddress>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QSemaphore>
 
 #include "cm256cc/cm256.h"
 
@@ -50,13 +55,44 @@ public:
     RemoteDataBlock *getDataBlock();
 
 private:
+    /**
+     * Compresses and FEC encodes one data block. When several data blocks are waiting they
+     * are encoded in parallel on the thread pool while the previous ones are being transmitted.
+     */
+    class EncodeTask : public QRunnable
+    {
+    public:
+        EncodeTask(CM256 *cm256);
+        virtual void run();
+        void encode(RemoteDataBlock *dataBlock);
+        void start(QThreadPool& threadPool, RemoteDataBlock *dataBlock);
+        void wait() { m_done.acquire(); }
+
+    private:
+        CM256 *m_cm256;
+        RemoteDataBlock *m_dataBlock;
+        QSemaphore m_done;
+        CM256::cm256_block m_descriptorBlocks[256]; //!< Pointers to data for CM256 encoder
+        RemoteProtectedBlock m_fecBlocks[256];      //!< FEC data
+        uint8_t m_samples[(RemoteNbOrginalBlocks - 1) * RemoteNbBytesPerBlock];    //!< Raw samples of the frame
+        uint8_t m_compressed[(RemoteNbOrginalBlocks - 2) * RemoteNbBytesPerBlock]; //!< Compressed samples must save at least one block
+
+        int compress(RemoteDataBlock *dataBlock);
+    };
+
     RemoteSinkFifo m_fifo;
     CM256 m_cm256;
     CM256 *m_cm256p;
+    QThreadPool m_threadPool;
+    std::vector<EncodeTask*> m_encodeTasks;
+    std::vector<RemoteDataBlock*> m_dataBlocks; //!< data blocks read from FIFO in one go
 
     QHostAddress m_address;
     QUdpSocket *m_socket;
 
+    static const int m_maxNbEncoders;
+    static const int m_minBatchDelayUs; //!< datagrams are sent in batches lasting at least this time
+
     void sendDataBlock(RemoteDataBlock *dataBlock);
 
 private slots:
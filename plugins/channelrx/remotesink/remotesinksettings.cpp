@@ -27,6 +27,8 @@
 
 #include "util/simpleserializer.h"
 #include "settings/serializable.h"
+#include "channel/remotedatablock.h"
+#include "channel/remotesamplecodec.h"
 
 
 RemoteSinkSettings::RemoteSinkSettings()
@@ -38,6 +40,9 @@ void RemoteSinkSettings::resetToDefaults()
 {
     m_nbFECBlocks = 0;
     m_txDelay = 35;
+    m_nbBlocksPerDatagram = 1;
+    m_compression = false;
+    m_compressionLossBits = 0;
     m_dataAddress = "127.0.0.1";
     m_dataPort = 9090;
     m_rgbColor = QColor(140, 4, 4).rgb();
@@ -70,6 +75,9 @@ QByteArray RemoteSinkSettings::serialize() const
     s.writeU32(12, m_log2Decim);
     s.writeU32(13, m_filterChainHash);
     s.writeS32(14, m_streamIndex);
+    s.writeU32(15, m_nbBlocksPerDatagram);
+    s.writeBool(16, m_compression);
+    s.writeU32(17, m_compressionLossBits);
 
     return s.final();
 }
@@ -127,6 +135,11 @@ bool RemoteSinkSettings::deserialize(const QByteArray& data)
         m_log2Decim = tmp > 6 ? 6 : tmp;
         d.readU32(13, &m_filterChainHash, 0);
         d.readS32(14, &m_streamIndex, 0);
+        d.readU32(15, &tmp, 1);
+        m_nbBlocksPerDatagram = tmp < 1 ? 1 : tmp > RemoteMaxBlocksPerDatagram ? RemoteMaxBlocksPerDatagram : tmp;
+        d.readBool(16, &m_compression, false);
+        d.readU32(17, &tmp, 0);
+        m_compressionLossBits = tmp > RemoteSampleCodec::m_maxLossBits ? RemoteSampleCodec::m_maxLossBits : tmp;
 
         return true;
     }
@@ -33,6 +33,9 @@ struct RemoteSinkSettings
 {
     uint16_t m_nbFECBlocks;
     uint32_t m_txDelay;
+    uint32_t m_nbBlocksPerDatagram; //!< FEC blocks packed in one UDP datagram (> 1 for jumbo frames)
+    bool     m_compression;         //!< Compress samples
+    uint32_t m_compressionLossBits; //!< Number of LSBs rounded off before compression (0 for lossless)
     QString  m_dataAddress;
     uint16_t m_dataPort;
     quint32 m_rgbColor;
@@ -37,6 +37,9 @@ RemoteSinkSink::RemoteSinkSink() :
         m_basebandSampleRate(48000),
         m_nbBlocksFEC(0),
         m_txDelay(35),
+        m_nbBlocksPerDatagram(1),
+        m_compression(false),
+        m_compressionLossBits(0),
         m_dataAddress("127.0.0.1"),
         m_dataPort(9090)
 {
@@ -172,6 +175,7 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
             m_superBlock.m_header.m_blockIndex = m_txBlockIndex;
             m_superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             m_superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
+            m_superBlock.m_header.m_nbOriginalBlocks = 0; // raw until compressed by the sender
             m_dataBlock->m_superBlocks[m_txBlockIndex] = m_superBlock;
 
             if (m_txBlockIndex == RemoteNbOrginalBlocks - 1) // frame complete
@@ -181,6 +185,9 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
                 m_dataBlock->m_txControlBlock.m_complete = true;
                 m_dataBlock->m_txControlBlock.m_nbBlocksFEC = m_nbBlocksFEC;
                 m_dataBlock->m_txControlBlock.m_txDelay = m_txDelay;
+                m_dataBlock->m_txControlBlock.m_nbBlocksPerDatagram = m_nbBlocksPerDatagram;
+                m_dataBlock->m_txControlBlock.m_compression = m_compression;
+                m_dataBlock->m_txControlBlock.m_compressionLossBits = m_compressionLossBits;
                 m_dataBlock->m_txControlBlock.m_dataAddress = m_dataAddress;
                 m_dataBlock->m_txControlBlock.m_dataPort = m_dataPort;
 
@@ -202,6 +209,9 @@ void RemoteSinkSink::applySettings(const RemoteSinkSettings& settings, bool forc
     qDebug() << "RemoteSinkSink::applySettings:"
             << " m_nbFECBlocks: " << settings.m_nbFECBlocks
             << " m_txDelay: " << settings.m_txDelay
+            << " m_nbBlocksPerDatagram: " << settings.m_nbBlocksPerDatagram
+            << " m_compression: " << settings.m_compression
+            << " m_compressionLossBits: " << settings.m_compressionLossBits
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
             << " m_streamIndex: " << settings.m_streamIndex
@@ -215,6 +225,18 @@ void RemoteSinkSink::applySettings(const RemoteSinkSettings& settings, bool forc
         m_dataPort = settings.m_dataPort;
     }
 
+    if ((m_settings.m_nbBlocksPerDatagram != settings.m_nbBlocksPerDatagram) || force) {
+        m_nbBlocksPerDatagram = settings.m_nbBlocksPerDatagram;
+    }
+
+    if ((m_settings.m_compression != settings.m_compression) || force) {
+        m_compression = settings.m_compression;
+    }
+
+    if ((m_settings.m_compressionLossBits != settings.m_compressionLossBits) || force) {
+        m_compressionLossBits = settings.m_compressionLossBits;
+    }
+
     if ((m_settings.m_log2Decim != settings.m_log2Decim)
      || (m_settings.m_filterChainHash != settings.m_filterChainHash)
      || (m_settings.m_nbFECBlocks != settings.m_nbFECBlocks)
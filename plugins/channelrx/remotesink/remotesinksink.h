@@ -62,6 +62,9 @@ private:
     uint32_t m_basebandSampleRate;
     int m_nbBlocksFEC;
     int m_txDelay;
+    int m_nbBlocksPerDatagram;
+    bool m_compression;
+    int m_compressionLossBits;
     QString m_dataAddress;
     uint16_t m_dataPort;
 
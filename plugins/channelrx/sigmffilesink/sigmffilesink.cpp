@@ -102,6 +102,12 @@ void SigMFFileSink::feed(const SampleVector::const_iterator& begin, const Sample
     m_basebandSink->feed(begin, end);
 }
 
+bool SigMFFileSink::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void SigMFFileSink::start()
 {
 	qDebug("SigMFFileSink::start");
@@ -544,6 +550,11 @@ void SigMFFileSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& res
     response.getSigMfFileSinkReport()->setRecording(m_basebandSink->isRecording() ? 1 : 0);
     response.getSigMfFileSinkReport()->setRecordCaptures(getNbTracks());
     response.getSigMfFileSinkReport()->setChannelSampleRate(m_basebandSink->getChannelSampleRate());
+    AsyncFileWriter::Statistics writeStatistics;
+    m_basebandSink->getWriteStatistics(writeStatistics);
+    response.getSigMfFileSinkReport()->setRecordDroppedBytes(writeStatistics.m_droppedBytes);
+    response.getSigMfFileSinkReport()->setRecordWriteLatencyAvgUs(writeStatistics.m_latencyAverageUs);
+    response.getSigMfFileSinkReport()->setRecordWriteLatencyMaxUs(writeStatistics.m_latencyMaxUs);
 }
 
 void SigMFFileSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const SigMFFileSinkSettings& settings, bool force)
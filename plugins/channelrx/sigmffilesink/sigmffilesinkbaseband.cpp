@@ -36,8 +36,10 @@ SigMFFileSinkBaseband::SigMFFileSinkBaseband() :
     m_running(false),
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setMode(SampleSinkFifo::ModeSPSC);
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
+    m_sampleRingInput.setSink(m_channelizer);
 
     qDebug("SigMFFileSinkBaseband::SigMFFileSinkBaseband");
     connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
@@ -55,6 +57,7 @@ void SigMFFileSinkBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleRingInput.reset();
 }
 
 void SigMFFileSinkBaseband::startWork()
@@ -67,6 +70,13 @@ void SigMFFileSinkBaseband::startWork()
         &SigMFFileSinkBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &SigMFFileSinkBaseband::handleData,
+        Qt::QueuedConnection
+    );
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -82,6 +92,12 @@ void SigMFFileSinkBaseband::stopWork()
         this,
         &SigMFFileSinkBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleRingInput,
+        &SampleSinkRingInput::dataReady,
+        this,
+        &SigMFFileSinkBaseband::handleData
+    );
     m_running = false;
 }
 
@@ -94,6 +110,10 @@ void SigMFFileSinkBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
+    if (m_sampleRingInput.read(m_inputMessageQueue)) {
+        return;
+    }
+
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
 		SampleVector::iterator part1begin;
@@ -23,6 +23,7 @@
 #include <QTimer>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -83,6 +84,7 @@ public:
     ~SigMFFileSinkBaseband();
 
     void reset();
+    void setSampleRingReader(SampleSinkRingReader *reader) { m_sampleRingInput.setReader(reader); }
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
@@ -94,6 +96,7 @@ public:
     uint64_t getMsCount() const { return m_sink.getMsCount(); }
     uint64_t getByteCount() const { return m_sink.getByteCount(); }
     unsigned int getNbTracks() const { return m_sink.getNbTracks(); }
+    void getWriteStatistics(AsyncFileWriter::Statistics& statistics) const { m_sink.getWriteStatistics(statistics); }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; m_sink.setMessageQueueToGUI(messageQueue); }
     void setDeviceHwId(const QString& hwId) { m_sink.setDeviceHwId(hwId); }
     void setDeviceUId(int uid) { m_sink.setDeviceUId(uid); }
@@ -104,6 +107,7 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkRingInput m_sampleRingInput;
     DownChannelizer *m_channelizer;
     SigMFFileSinkSink m_sink;
     SpectrumVis *m_spectrumSink;
@@ -52,6 +52,7 @@ public:
     uint64_t getMsCount() const { return m_msCount; }
     uint64_t getByteCount() const { return m_byteCount; }
     unsigned int getNbTracks() const { return m_fileSink.getNbCaptures(); }
+    void getWriteStatistics(AsyncFileWriter::Statistics& statistics) const { m_fileSink.getWriteStatistics(statistics); }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_msgQueueToGUI = messageQueue; }
     void squelchRecording(bool squelchOpen);
     int getSampleRate() const { return m_sinkSampleRate; }
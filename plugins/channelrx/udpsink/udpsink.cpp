@@ -87,6 +87,12 @@ void UDPSink::feed(const SampleVector::const_iterator& begin, const SampleVector
     m_basebandSink->feed(begin, end);
 }
 
+bool UDPSink::setSampleRingReader(SampleSinkRingReader *reader)
+{
+    m_basebandSink->setSampleRingReader(reader);
+    return true;
+}
+
 void UDPSink::start()
 {
     qDebug() << "UDPSink::start";
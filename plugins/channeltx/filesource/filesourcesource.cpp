@@ -66,7 +66,7 @@ void FileSourceSource::pull(SampleVector::iterator begin, unsigned int nbSamples
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            FileSourceSource::pullOne(s);
         }
     );
 }
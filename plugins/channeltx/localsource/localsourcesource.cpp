@@ -33,7 +33,7 @@ void LocalSourceSource::pull(SampleVector::iterator begin, unsigned int nbSample
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            LocalSourceSource::pullOne(s);
         }
     );
 }
@@ -67,7 +67,7 @@ void IEEE_802_15_4_ModSource::pull(SampleVector::iterator begin, unsigned int nb
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            IEEE_802_15_4_ModSource::pullOne(s);
         }
     );
 }
@@ -64,7 +64,7 @@ void AISModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            AISModSource::pullOne(s);
         }
     );
 }
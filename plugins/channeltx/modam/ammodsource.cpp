@@ -59,13 +59,15 @@ AMModSource::~AMModSource()
 
 void AMModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    if (m_settings.m_channelMute)
+    {
+        std::fill(begin, begin + nbSamples, Sample(0, 0));
+        return;
+    }
+
+    for (SampleVector::iterator it = begin; it != begin + nbSamples; ++it) {
+        modulateChannelSample(*it);
+    }
 }
 
 void AMModSource::pullOne(Sample& sample)
@@ -77,6 +79,11 @@ void AMModSource::pullOne(Sample& sample)
 		return;
 	}
 
+    modulateChannelSample(sample);
+}
+
+void AMModSource::modulateChannelSample(Sample& sample)
+{
 	Complex ci;
 
     if (m_interpolatorDistance > 1.0f) // decimate
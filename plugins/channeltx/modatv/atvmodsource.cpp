@@ -170,7 +170,7 @@ void ATVModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            ATVModSource::pullOne(s);
         }
     );
 }
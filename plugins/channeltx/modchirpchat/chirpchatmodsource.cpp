@@ -106,7 +106,7 @@ void ChirpChatModSource::pull(SampleVector::iterator begin, unsigned int nbSampl
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            ChirpChatModSource::pullOne(s);
         }
     );
 }
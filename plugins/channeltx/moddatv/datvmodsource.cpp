@@ -252,7 +252,7 @@ void DATVModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            DATVModSource::pullOne(s);
         }
     );
 }
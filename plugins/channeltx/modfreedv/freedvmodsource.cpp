@@ -83,16 +83,17 @@ FreeDVModSource::~FreeDVModSource()
 void FreeDVModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
     QMutexLocker mlock(&m_mutex);
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    for (SampleVector::iterator it = begin; it != begin + nbSamples; ++it) {
+        modulateChannelSample(*it);
+    }
 }
 
 void FreeDVModSource::pullOne(Sample& sample)
+{
+    modulateChannelSample(sample);
+}
+
+void FreeDVModSource::modulateChannelSample(Sample& sample)
 {
 	Complex ci;
 
@@ -140,6 +140,7 @@ private:
     void calculateLevel(Complex& sample);
     void calculateLevel(qint16& sample);
     void modulateSample();
+    void modulateChannelSample(Sample& sample); //!< one sample at channel rate
 
 private slots:
     void handleAudio();
@@ -63,13 +63,15 @@ NFMModSource::~NFMModSource()
 
 void NFMModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    if (m_settings.m_channelMute)
+    {
+        std::fill(begin, begin + nbSamples, Sample(0, 0));
+        return;
+    }
+
+    for (SampleVector::iterator it = begin; it != begin + nbSamples; ++it) {
+        modulateChannelSample(*it);
+    }
 }
 
 void NFMModSource::pullOne(Sample& sample)
@@ -81,6 +83,11 @@ void NFMModSource::pullOne(Sample& sample)
 		return;
 	}
 
+    modulateChannelSample(sample);
+}
+
+void NFMModSource::modulateChannelSample(Sample& sample)
+{
 	Complex ci;
 
     if (m_interpolatorDistance > 1.0f) // decimate
@@ -135,6 +135,7 @@ private:
     void pushFeedback(Real sample);
     void calculateLevel(Real& sample);
     void modulateSample();
+    void modulateChannelSample(Sample& sample); //!< one sample at channel rate (not muted)
 
 private slots:
     void handleAudio();
@@ -68,7 +68,7 @@ void PacketModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            PacketModSource::pullOne(s);
         }
     );
 }
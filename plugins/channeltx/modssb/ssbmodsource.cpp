@@ -93,16 +93,17 @@ SSBModSource::~SSBModSource()
 
 void SSBModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    for (SampleVector::iterator it = begin; it != begin + nbSamples; ++it) {
+        modulateChannelSample(*it);
+    }
 }
 
 void SSBModSource::pullOne(Sample& sample)
+{
+    modulateChannelSample(sample);
+}
+
+void SSBModSource::modulateChannelSample(Sample& sample)
 {
 	Complex ci;
 
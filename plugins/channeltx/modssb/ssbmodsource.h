@@ -145,6 +145,7 @@ private:
     void pushFeedback(Complex sample);
     void calculateLevel(Complex& sample);
     void modulateSample();
+    void modulateChannelSample(Sample& sample); //!< one sample at channel rate
 
 private slots:
     void handleAudio();
@@ -65,13 +65,15 @@ WFMModSource::~WFMModSource()
 
 void WFMModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    if (m_settings.m_channelMute)
+    {
+        std::fill(begin, begin + nbSamples, Sample(0, 0));
+        return;
+    }
+
+    for (SampleVector::iterator it = begin; it != begin + nbSamples; ++it) {
+        modulateChannelSample(*it);
+    }
 }
 
 void WFMModSource::pullOne(Sample& sample)
@@ -83,6 +85,11 @@ void WFMModSource::pullOne(Sample& sample)
 		return;
 	}
 
+    modulateChannelSample(sample);
+}
+
+void WFMModSource::modulateChannelSample(Sample& sample)
+{
 	Complex ci, ri;
     fftfilt::cmplx *rf;
     int rf_out;
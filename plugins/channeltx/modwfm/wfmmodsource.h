@@ -132,6 +132,7 @@ private:
     void pushFeedback(Complex sample);
     void calculateLevel(const Real& sample);
     void modulateAudio();
+    void modulateChannelSample(Sample& sample); //!< one sample at channel rate (not muted)
 
 private slots:
     void handleAudio();
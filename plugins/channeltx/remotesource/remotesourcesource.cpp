@@ -43,7 +43,7 @@ void RemoteSourceSource::pull(SampleVector::iterator begin, unsigned int nbSampl
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            RemoteSourceSource::pullOne(s);
         }
     );
 }
@@ -75,7 +75,7 @@ void UDPSourceSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
         begin,
         begin + nbSamples,
         [this](Sample& s) {
-            pullOne(s);
+            UDPSourceSource::pullOne(s);
         }
     );
 }
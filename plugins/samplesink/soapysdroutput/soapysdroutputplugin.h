@@ -37,6 +37,7 @@ public:
     void initPlugin(PluginAPI* pluginAPI);
 
 	virtual void enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices);
+	virtual bool canRestoreEnumeration() const { return false; } // devices are opened by their index in the SoapySDR scan
 	virtual SamplingDevices enumSampleSinks(const OriginDevices& originDevices);
 
     virtual DeviceGUI* createSampleSinkPluginInstanceGUI(
@@ -53,6 +53,7 @@ MESSAGE_CLASS_DEFINITION(FileInput::MsgReportHeaderCRC, Message)
 FileInput::FileInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
 	m_settings(),
+	m_dataOffset(0),
 	m_fileInputWorker(nullptr),
 	m_deviceDescription(),
 	m_sampleRate(48000),
@@ -89,22 +90,23 @@ void FileInput::openFileStream()
 {
 	//stopInput();
 
-	if (m_ifstream.is_open()) {
-		m_ifstream.close();
-	}
+	m_sampleFile.close();
 
+    // the header is parsed with a stream and the samples are read through a file mapping
+    std::ifstream headerStream;
 #ifdef Q_OS_WIN
-	m_ifstream.open(m_settings.m_fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
+	headerStream.open(m_settings.m_fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
 #else
-	m_ifstream.open(m_settings.m_fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
+	headerStream.open(m_settings.m_fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
 #endif
-	quint64 fileSize = m_ifstream.tellg();
+	quint64 fileSize = headerStream.tellg();
 
 	if (m_settings.m_fileName.endsWith(".wav"))
     {
         WavFileRecord::Header header;
-        m_ifstream.seekg(0, std::ios_base::beg);
-        bool headerOK = WavFileRecord::readHeader(m_ifstream, header);
+        headerStream.seekg(0, std::ios_base::beg);
+        bool headerOK = WavFileRecord::readHeader(headerStream, header);
+        m_dataOffset = headerStream.tellg();
         m_sampleRate = header.m_sampleRate;
         if (header.m_auxiHeader.m_size > 0)
         {
@@ -125,7 +127,7 @@ void FileInput::openFileStream()
 
         if (headerOK && (m_sampleRate > 0) && (m_sampleSize > 0))
         {
-            m_recordLengthMuSec = ((fileSize - m_ifstream.tellg()) * 1000000UL) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
+            m_recordLengthMuSec = ((fileSize - m_dataOffset) * 1000000UL) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
         }
         else
         {
@@ -142,8 +144,9 @@ void FileInput::openFileStream()
     else if (fileSize > sizeof(FileRecord::Header))
 	{
 	    FileRecord::Header header;
-	    m_ifstream.seekg(0,std::ios_base::beg);
-		bool crcOK = FileRecord::readHeader(m_ifstream, header);
+	    headerStream.seekg(0,std::ios_base::beg);
+		bool crcOK = FileRecord::readHeader(headerStream, header);
+		m_dataOffset = sizeof(FileRecord::Header);
 		m_sampleRate = header.sampleRate;
 		m_centerFrequency = header.centerFrequency;
 		m_startingTimeStamp = header.startTimeStamp;
@@ -174,6 +177,7 @@ void FileInput::openFileStream()
 	}
 	else
 	{
+		m_dataOffset = 0;
 		m_recordLengthMuSec = 0;
 	}
 
@@ -196,8 +200,8 @@ void FileInput::openFileStream()
 	    getMessageQueueToGUI()->push(report);
 	}
 
-	if (m_recordLengthMuSec == 0) {
-	    m_ifstream.close();
+	if ((m_recordLengthMuSec != 0) && m_sampleFile.open(m_settings.m_fileName)) {
+	    m_sampleFile.seek(m_dataOffset);
 	}
 }
 
@@ -205,14 +209,13 @@ void FileInput::seekFileStream(int seekMillis)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
-	if ((m_ifstream.is_open()) && m_fileInputWorker && !m_fileInputWorker->isRunning())
+	if ((m_sampleFile.isOpen()) && m_fileInputWorker && !m_fileInputWorker->isRunning())
 	{
         quint64 seekPoint = ((m_recordLengthMuSec * seekMillis) / 1000) * m_sampleRate;
         seekPoint /= 1000000UL;
 		m_fileInputWorker->setSamplesCount(seekPoint);
-        seekPoint *= (m_sampleSize == 24 ? 8 : 4); // + sizeof(FileRecord::Header)
-		m_ifstream.clear();
-		m_ifstream.seekg(seekPoint + sizeof(FileRecord::Header), std::ios::beg);
+        seekPoint *= (m_sampleSize == 24 ? 8 : 4);
+		m_sampleFile.seek(seekPoint + m_dataOffset);
 	}
 }
 
@@ -224,7 +227,7 @@ void FileInput::init()
 
 bool FileInput::start()
 {
-    if (!m_ifstream.is_open())
+    if (!m_sampleFile.isOpen())
     {
         qWarning("FileInput::start: file not open. not starting");
         return false;
@@ -233,11 +236,7 @@ bool FileInput::start()
 	QMutexLocker mutexLocker(&m_mutex);
 	qDebug() << "FileInput::start";
 
-	if (m_ifstream.tellg() != (std::streampos)0)
-    {
-		m_ifstream.clear();
-		m_ifstream.seekg(sizeof(FileRecord::Header), std::ios::beg);
-	}
+	m_sampleFile.seek(m_dataOffset);
 
 	if (!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample)))
     {
@@ -245,7 +244,7 @@ bool FileInput::start()
 		return false;
 	}
 
-	m_fileInputWorker = new FileInputWorker(&m_ifstream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+	m_fileInputWorker = new FileInputWorker(&m_sampleFile, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
 	m_fileInputWorker->moveToThread(&m_fileInputWorkerThread);
 	m_fileInputWorker->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
 	startWorker();
@@ -30,6 +30,7 @@
 #include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
+#include "util/mappedfilereader.h"
 #include "fileinputsettings.h"
 
 class QNetworkAccessManager;
@@ -332,7 +333,8 @@ public:
 	DeviceAPI *m_deviceAPI;
 	QMutex m_mutex;
 	FileInputSettings m_settings;
-	std::ifstream m_ifstream;
+	MappedFileReader m_sampleFile;
+	quint64 m_dataOffset; //!< start of the samples after the file header
 	FileInputWorker* m_fileInputWorker;
 	QThread m_fileInputWorkerThread;
 	QString m_deviceDescription;
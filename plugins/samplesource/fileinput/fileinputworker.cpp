@@ -23,20 +23,18 @@
 #include "fileinputworker.h"
 #include "dsp/samplesinkfifo.h"
 #include "util/messagequeue.h"
+#include "util/mappedfilereader.h"
 
 MESSAGE_CLASS_DEFINITION(FileInputWorker::MsgReportEOF, Message)
 
-FileInputWorker::FileInputWorker(std::ifstream *samplesStream,
+FileInputWorker::FileInputWorker(MappedFileReader *samplesFile,
         SampleSinkFifo* sampleFifo,
         const QTimer& timer,
         MessageQueue *fileInputMessageQueue,
         QObject* parent) :
 	QObject(parent),
 	m_running(false),
-	m_ifstream(samplesStream),
-	m_fileBuf(nullptr),
-	m_convertBuf(nullptr),
-	m_bufsize(0),
+	m_samplesFile(samplesFile),
 	m_chunksize(0),
 	m_sampleFifo(sampleFifo),
 	m_samplesCount(0),
@@ -55,21 +53,13 @@ FileInputWorker::~FileInputWorker()
 	if (m_running) {
 		stopWork();
 	}
-
-	if (m_fileBuf) {
-		free(m_fileBuf);
-	}
-
-	if (m_convertBuf) {
-		free(m_convertBuf);
-	}
 }
 
 void FileInputWorker::startWork()
 {
 	qDebug() << "FileInputThread::startWork: ";
 
-    if (m_ifstream->is_open())
+    if (m_samplesFile->isOpen())
     {
         qDebug() << "FileInputThread::startWork: file stream open, starting...";
         m_elapsedTimer.start();
@@ -106,58 +96,12 @@ void FileInputWorker::setSampleRateAndSize(int samplerate, quint32 samplesize)
 		m_samplerate = samplerate;
 		m_samplesize = samplesize;
 		m_samplebytes = m_samplesize > 16 ? sizeof(int32_t) : sizeof(int16_t);
-        m_chunksize = (m_samplerate * 2 * m_samplebytes * m_throttlems) / 1000;
-
-        setBuffers(m_chunksize);
+        m_chunksize = 2 * m_samplebytes * ((m_samplerate * m_throttlems) / 1000);
 	}
 
 	//m_samplerate = samplerate;
 }
 
-void FileInputWorker::setBuffers(std::size_t chunksize)
-{
-    if (chunksize > m_bufsize)
-    {
-        m_bufsize = chunksize;
-        int nbSamples = m_bufsize/(2 * m_samplebytes);
-
-        if (!m_fileBuf)
-        {
-            qDebug() << "FileInputThread::setBuffers: Allocate file buffer";
-            m_fileBuf = (quint8*) malloc(m_bufsize);
-        }
-        else
-        {
-            qDebug() << "FileInputThread::setBuffers: Re-allocate file buffer";
-            quint8 *buf = m_fileBuf;
-            m_fileBuf = (quint8*) realloc((void*) m_fileBuf, m_bufsize);
-
-            if (!m_fileBuf) {
-                free(buf);
-            }
-        }
-
-        if (!m_convertBuf)
-        {
-            qDebug() << "FileInputThread::setBuffers: Allocate conversion buffer";
-            m_convertBuf = (quint8*) malloc(nbSamples*sizeof(Sample));
-        }
-        else
-        {
-            qDebug() << "FileInputThread::setBuffers: Re-allocate conversion buffer";
-            quint8 *buf = m_convertBuf;
-            m_convertBuf = (quint8*) realloc((void*) m_convertBuf, nbSamples*sizeof(Sample));
-
-            if (!m_convertBuf) {
-                free(buf);
-            }
-        }
-
-        qDebug() << "FileInputThread::setBuffers: size: " << m_bufsize
-                << " #samples: " << nbSamples;
-    }
-}
-
 void FileInputWorker::tick()
 {
 	if (m_running)
@@ -169,21 +113,21 @@ void FileInputWorker::tick()
             m_throttlems = throttlems;
             m_chunksize = 2 * m_samplebytes * ((m_samplerate * (m_throttlems+(m_throttleToggle ? 1 : 0))) / 1000);
             m_throttleToggle = !m_throttleToggle;
-            setBuffers(m_chunksize);
         }
 
-		// read samples directly feeding the SampleFifo (no callback)
-		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+		// samples are taken from the file mapping directly feeding the SampleFifo (no callback)
+        quint64 nbBytes;
+        const quint8 *buf = m_samplesFile->read(m_chunksize, nbBytes);
 
-        if (m_ifstream->eof())
+        if (nbBytes < (quint64) m_chunksize)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount());
+        	writeToSampleFifo(buf, (qint32) nbBytes);
         	MsgReportEOF *message = MsgReportEOF::create();
         	m_fileInputMessageQueue->push(message);
         }
         else
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
+        	writeToSampleFifo(buf, (qint32) m_chunksize);
     		m_samplesCount += m_chunksize / (2 * m_samplebytes);
         }
 	}
@@ -191,46 +135,51 @@ void FileInputWorker::tick()
 
 void FileInputWorker::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
 {
+    if ((nbBytes <= 0) || ((m_samplesize != 16) && (m_samplesize != 24))) {
+        return;
+    }
+
+	if (m_samplesize == SDR_RX_SAMP_SZ)
+	{
+		m_sampleFifo->write(buf, nbBytes);
+		return;
+	}
+
+    // sample size conversion done in place in the FIFO
+    SampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+    int nbSamples = nbBytes / (2 * m_samplebytes);
+    unsigned int count = m_sampleFifo->writeBegin(nbSamples, &part1Begin, &part1End, &part2Begin, &part2End);
+
 	if (m_samplesize == 16)
 	{
-		if (SDR_RX_SAMP_SZ == 16)
-		{
-			m_sampleFifo->write(buf, nbBytes);
-		}
-		else if (SDR_RX_SAMP_SZ == 24)
-		{
-			FixReal *convertBuf = (FixReal *) m_convertBuf;
-			const int16_t *fileBuf = (int16_t *) buf;
-			int nbSamples = nbBytes / (2 * m_samplebytes);
-
-			for (int is = 0; is < nbSamples; is++)
-			{
-				convertBuf[2*is]   = fileBuf[2*is] << 8;
-				convertBuf[2*is+1] = fileBuf[2*is+1] << 8;
-			}
-
-			m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-		}
+        const int16_t *fileBuf = convert((const int16_t *) buf, part1Begin, part1End);
+        convert(fileBuf, part2Begin, part2End);
 	}
-	else if (m_samplesize == 24)
+	else
 	{
-		if (SDR_RX_SAMP_SZ == 24)
-		{
-			m_sampleFifo->write(buf, nbBytes);
-		}
-		else if (SDR_RX_SAMP_SZ == 16)
-		{
-			FixReal *convertBuf = (FixReal *) m_convertBuf;
-			const int32_t *fileBuf = (int32_t *) buf;
-			int nbSamples = nbBytes / (2 * m_samplebytes);
-
-			for (int is = 0; is < nbSamples; is++)
-			{
-				convertBuf[2*is]   = fileBuf[2*is] >> 8;
-				convertBuf[2*is+1] = fileBuf[2*is+1] >> 8;
-			}
-
-			m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-		}
+        const int32_t *fileBuf = convert((const int32_t *) buf, part1Begin, part1End);
+        convert(fileBuf, part2Begin, part2End);
 	}
+
+    m_sampleFifo->writeCommit(count);
+}
+
+template<typename T>
+const T *FileInputWorker::convert(const T *buf, SampleVector::iterator begin, SampleVector::iterator end)
+{
+    for (SampleVector::iterator it = begin; it != end; ++it, buf += 2)
+    {
+        if (sizeof(T) < sizeof(FixReal)) // 16 bit file to 24 bit samples
+        {
+            it->setReal(buf[0] << 8);
+            it->setImag(buf[1] << 8);
+        }
+        else // 24 bit file to 16 bit samples
+        {
+            it->setReal(buf[0] >> 8);
+            it->setImag(buf[1] >> 8);
+        }
+    }
+
+    return buf;
 }
@@ -20,17 +20,16 @@
 
 #include <QTimer>
 #include <QElapsedTimer>
-#include <iostream>
-#include <fstream>
 #include <cstdlib>
 
-#include "dsp/inthalfbandfilter.h"
+#include "dsp/dsptypes.h"
 #include "util/message.h"
 
 #define FILESOURCE_THROTTLE_MS 50
 
 class SampleSinkFifo;
 class MessageQueue;
+class MappedFileReader;
 
 class FileInputWorker : public QObject {
 	Q_OBJECT
@@ -50,7 +49,7 @@ public:
         { }
     };
 
-	FileInputWorker(std::ifstream *samplesStream,
+	FileInputWorker(MappedFileReader *samplesFile,
 	        SampleSinkFifo* sampleFifo,
 	        const QTimer& timer,
 	        MessageQueue *fileInputMessageQueue,
@@ -60,7 +59,6 @@ public:
 	void startWork();
 	void stopWork();
 	void setSampleRateAndSize(int samplerate, quint32 samplesize);
-    void setBuffers(std::size_t chunksize);
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
     void setSamplesCount(quint64 samplesCount) { m_samplesCount = samplesCount; }
@@ -68,10 +66,7 @@ public:
 private:
 	volatile bool m_running;
 
-	std::ifstream* m_ifstream;
-	quint8  *m_fileBuf;
-	quint8  *m_convertBuf;
-	std::size_t m_bufsize;
+	MappedFileReader* m_samplesFile;
     qint64 m_chunksize;
 	SampleSinkFifo* m_sampleFifo;
     quint64 m_samplesCount;
@@ -87,6 +82,8 @@ private:
 
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
+    template<typename T>
+    static const T *convert(const T *buf, SampleVector::iterator begin, SampleVector::iterator end);
 
 private slots:
 	void tick();
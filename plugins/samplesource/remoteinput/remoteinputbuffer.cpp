@@ -16,11 +16,14 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QDebug>
+#include <QThread>
+#include <QMutexLocker>
 #include <cstring>
 #include <cmath>
 #include <algorithm>
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
+#include "channel/remotesamplecodec.h"
 #include "remoteinputbuffer.h"
 
 
@@ -42,16 +45,17 @@ RemoteInputBuffer::RemoteInputBuffer() :
         m_nbReads(0),
         m_nbWrites(0),
         m_balCorrection(0),
-	    m_balCorrLimit(0)
+	    m_balCorrLimit(0),
+        m_pendingMetaSlot(-1)
 {
+    m_threadPool.setMaxThreadCount(std::max(1, std::min(QThread::idealThreadCount() - 1, 4)));
+
 	m_currentMeta.init();
     setNbDecoderSlots(16);
     m_decoderIndexHead = m_nbDecoderSlots/2;
 	m_tvOut_sec = 0;
 	m_tvOut_usec = 0;
 	m_readNbBytes = 1;
-    m_paramsCM256.BlockBytes = sizeof(RemoteProtectedBlock); // never changes
-    m_paramsCM256.OriginalCount = RemoteNbOrginalBlocks;  // never changes
 
     if (!m_cm256.isInitialized()) {
         m_cm256_OK = false;
@@ -66,6 +70,8 @@ RemoteInputBuffer::RemoteInputBuffer() :
 
 RemoteInputBuffer::~RemoteInputBuffer()
 {
+    m_threadPool.waitForDone();
+
 	if (m_readBuffer) {
 		delete[] m_readBuffer;
 	}
@@ -79,6 +85,9 @@ RemoteInputBuffer::~RemoteInputBuffer()
 
 void RemoteInputBuffer::setNbDecoderSlots(int nbDecoderSlots)
 {
+    m_threadPool.waitForDone();
+    m_decoding.assign(nbDecoderSlots, false);
+    m_pendingMetaSlot = -1;
     m_nbDecoderSlots = nbDecoderSlots;
     m_framesSize = m_nbDecoderSlots * (RemoteNbOrginalBlocks - 1) * RemoteNbBytesPerBlock;
   	m_framesNbBytes = m_nbDecoderSlots * sizeof(BufferFrame);
@@ -109,6 +118,7 @@ void RemoteInputBuffer::initDecodeAllSlots()
         m_decoderSlots[i].m_blockCount = 0;
         m_decoderSlots[i].m_originalCount = 0;
         m_decoderSlots[i].m_recoveryCount = 0;
+        m_decoderSlots[i].m_nbOriginalBlocks = RemoteNbOrginalBlocks;
         m_decoderSlots[i].m_decoded = false;
         m_decoderSlots[i].m_metaRetrieved = false;
         resetOriginalBlocks(i);
@@ -118,10 +128,17 @@ void RemoteInputBuffer::initDecodeAllSlots()
 
 void RemoteInputBuffer::initDecodeSlot(int slotIndex)
 {
-    // collect stats before voiding the slot
+    if (slotIndex == m_pendingMetaSlot) {
+        checkPendingMeta(true);
+    }
+
+    waitDecoded(slotIndex);
+
+    // collect stats before voiding the slot. Compressed frames need less blocks: stats are relative to a full frame.
 
-    m_curNbBlocks = m_decoderSlots[slotIndex].m_blockCount;
-    m_curOriginalBlocks = m_decoderSlots[slotIndex].m_originalCount;
+    int nbSavedBlocks = RemoteNbOrginalBlocks - m_decoderSlots[slotIndex].m_nbOriginalBlocks;
+    m_curNbBlocks = m_decoderSlots[slotIndex].m_blockCount + nbSavedBlocks;
+    m_curOriginalBlocks = m_decoderSlots[slotIndex].m_originalCount + nbSavedBlocks;
     m_curNbRecovery = m_decoderSlots[slotIndex].m_recoveryCount;
     m_avgNbBlocks(m_curNbBlocks);
     m_avgOrigBlocks(m_curOriginalBlocks);
@@ -149,6 +166,7 @@ void RemoteInputBuffer::initDecodeSlot(int slotIndex)
     m_decoderSlots[slotIndex].m_metaRetrieved = false;
 
     resetOriginalBlocks(slotIndex);
+    m_decoderSlots[slotIndex].m_nbOriginalBlocks = RemoteNbOrginalBlocks;
     memset((void *) m_decoderSlots[slotIndex].m_recoveryBlocks, 0, RemoteNbOrginalBlocks * sizeof(RemoteProtectedBlock));
 }
 
@@ -227,6 +245,8 @@ void RemoteInputBuffer::writeData(char *array)
     int frameIndex = superBlock->m_header.m_frameIndex;
     int decoderIndex = frameIndex % m_nbDecoderSlots;
 
+    checkPendingMeta(false);
+
     // frame break
 
     if (m_frameHead == -1) // initial state
@@ -248,7 +268,16 @@ void RemoteInputBuffer::writeData(char *array)
 
     // Block processing
 
-    if (m_decoderSlots[decoderIndex].m_blockCount < RemoteNbOrginalBlocks) // not enough blocks to decode -> store data
+    if (m_decoderSlots[decoderIndex].m_blockCount == 0) // first block received tells if the frame is compressed
+    {
+        int nbOriginalBlocks = superBlock->m_header.m_nbOriginalBlocks;
+        m_decoderSlots[decoderIndex].m_nbOriginalBlocks = (nbOriginalBlocks > 1) && (nbOriginalBlocks < RemoteNbOrginalBlocks) ?
+            nbOriginalBlocks : RemoteNbOrginalBlocks;
+    }
+
+    int nbOriginalBlocks = m_decoderSlots[decoderIndex].m_nbOriginalBlocks;
+
+    if (m_decoderSlots[decoderIndex].m_blockCount < nbOriginalBlocks) // not enough blocks to decode -> store data
     {
         int blockIndex = superBlock->m_header.m_blockIndex;
         int blockCount = m_decoderSlots[decoderIndex].m_blockCount;
@@ -260,7 +289,7 @@ void RemoteInputBuffer::writeData(char *array)
             m_decoderSlots[decoderIndex].m_metaRetrieved = true;
         }
 
-        if (blockIndex < RemoteNbOrginalBlocks) // original data
+        if (blockIndex < nbOriginalBlocks) // original data
         {
             m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[blockCount].Block = (void *) storeOriginalBlock(decoderIndex, blockIndex, superBlock->m_protectedBlock);
             m_decoderSlots[decoderIndex].m_originalCount++;
@@ -275,89 +304,174 @@ void RemoteInputBuffer::writeData(char *array)
 
     m_decoderSlots[decoderIndex].m_blockCount++;
 
-    if (m_decoderSlots[decoderIndex].m_blockCount == RemoteNbOrginalBlocks) // ready to decode
+    if (m_decoderSlots[decoderIndex].m_blockCount == nbOriginalBlocks) // ready to decode
     {
         m_decoderSlots[decoderIndex].m_decoded = true;
+        bool metaRetrieved = m_decoderSlots[decoderIndex].m_metaRetrieved; // the slot belongs to the decoder once started
 
-        if (m_cm256_OK && (m_decoderSlots[decoderIndex].m_recoveryCount > 0)) // recovery data used => need to decode FEC
+        if ((m_cm256_OK && (m_decoderSlots[decoderIndex].m_recoveryCount > 0)) || isCompressed(decoderIndex)) // need to decode FEC or decompress
         {
-            m_paramsCM256.BlockBytes = sizeof(RemoteProtectedBlock); // never changes
-            m_paramsCM256.OriginalCount = RemoteNbOrginalBlocks;  // never changes
+            int recoveryCount = metaRetrieved ? m_currentMeta.m_nbFECBlocks : m_decoderSlots[decoderIndex].m_recoveryCount;
 
-            if (m_decoderSlots[decoderIndex].m_metaRetrieved) {
-                m_paramsCM256.RecoveryCount = m_currentMeta.m_nbFECBlocks;
-            } else {
-                m_paramsCM256.RecoveryCount = m_decoderSlots[decoderIndex].m_recoveryCount;
-            }
-
-            if (m_cm256.cm256_decode(m_paramsCM256, m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks)) // CM256 decode
+            if (!metaRetrieved) // meta data may come out of decoding
             {
-                qDebug() << "RemoteInputBuffer::writeData: decode CM256 error:"
-                        << " decoderIndex: " << decoderIndex
-                        << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
-                        << " m_originalCount: " << m_decoderSlots[decoderIndex].m_originalCount
-                        << " m_recoveryCount: " << m_decoderSlots[decoderIndex].m_recoveryCount;
+                checkPendingMeta(true);
+                m_pendingMetaSlot = decoderIndex;
             }
-            else
-            {
-                qDebug() << "RemoteInputBuffer::writeData: decode CM256 success:"
-                        << " decoderIndex: " << decoderIndex
-                        << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
-                        << " m_originalCount: " << m_decoderSlots[decoderIndex].m_originalCount
-                        << " m_recoveryCount: " << m_decoderSlots[decoderIndex].m_recoveryCount;
 
-                for (int ir = 0; ir < m_decoderSlots[decoderIndex].m_recoveryCount; ir++) // restore missing blocks
-                {
-                    int recoveryIndex = RemoteNbOrginalBlocks - m_decoderSlots[decoderIndex].m_recoveryCount + ir;
-                    int blockIndex = m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[recoveryIndex].Index;
-                    RemoteProtectedBlock *recoveredBlock = (RemoteProtectedBlock *) m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[recoveryIndex].Block;
-
-                    if (blockIndex == 0) // first block with meta
-                    {
-                        RemoteMetaDataFEC *metaData = (RemoteMetaDataFEC *) recoveredBlock;
-
-                        boost::crc_32_type crc32;
-                        crc32.process_bytes(metaData, sizeof(RemoteMetaDataFEC)-4);
-
-                        if (crc32.checksum() == metaData->m_crc32)
-                        {
-                            m_decoderSlots[decoderIndex].m_metaRetrieved = true;
-                            printMeta("RemoteInputBuffer::writeData: recovered meta", metaData);
-                        }
-                        else
-                        {
-                            qDebug() << "RemoteInputBuffer::writeData: recovered meta: invalid CRC32";
-                        }
-                    }
-
-                    storeOriginalBlock(decoderIndex, blockIndex, *recoveredBlock);
-
-                    qDebug() << "RemoteInputBuffer::writeData: recovered block #" << blockIndex;
-                } // restore missing blocks
-            } // CM256 decode
+            m_decodeMutex.lock();
+            m_decoding[decoderIndex] = true;
+            m_decodeMutex.unlock();
+            m_threadPool.start(new DecodeTask(this, decoderIndex, recoveryCount));
         } // recovery
 
-        if (m_decoderSlots[decoderIndex].m_metaRetrieved) // block zero with its meta data has been received
+        if (metaRetrieved) { // block zero with its meta data has been received
+            checkMeta(decoderIndex);
+        }
+    } // decode
+}
+
+void RemoteInputBuffer::decodeSlot(int slotIndex, int recoveryCount)
+{
+    bool complete = (m_decoderSlots[slotIndex].m_recoveryCount == 0) || (m_cm256_OK && recoverSlot(slotIndex, recoveryCount));
+
+    if (complete && isCompressed(slotIndex)) {
+        decompressSlot(slotIndex);
+    }
+
+    QMutexLocker mutexLocker(&m_decodeMutex);
+    m_decoding[slotIndex] = false;
+    m_decodeDone.wakeAll();
+}
+
+bool RemoteInputBuffer::recoverSlot(int slotIndex, int recoveryCount)
+{
+    DecoderSlot& slot = m_decoderSlots[slotIndex];
+    CM256::cm256_encoder_params paramsCM256;
+    paramsCM256.BlockBytes = sizeof(RemoteProtectedBlock);
+    paramsCM256.OriginalCount = slot.m_nbOriginalBlocks;
+    paramsCM256.RecoveryCount = recoveryCount;
+
+    // The CM256 tables are read only after initialization so that slots are decoded concurrently
+    if (m_cm256.cm256_decode(paramsCM256, slot.m_cm256DescriptorBlocks)) // CM256 decode
+    {
+        qDebug() << "RemoteInputBuffer::recoverSlot: decode CM256 error:"
+                << " slotIndex: " << slotIndex
+                << " m_originalCount: " << slot.m_originalCount
+                << " m_recoveryCount: " << slot.m_recoveryCount;
+        return false;
+    }
+    else
+    {
+        qDebug() << "RemoteInputBuffer::recoverSlot: decode CM256 success:"
+                << " slotIndex: " << slotIndex
+                << " m_originalCount: " << slot.m_originalCount
+                << " m_recoveryCount: " << slot.m_recoveryCount;
+
+        for (int ir = 0; ir < slot.m_recoveryCount; ir++) // restore missing blocks
         {
-            RemoteMetaDataFEC *metaData = getMetaData(decoderIndex);
+            int recoveryIndex = slot.m_nbOriginalBlocks - slot.m_recoveryCount + ir;
+            int blockIndex = slot.m_cm256DescriptorBlocks[recoveryIndex].Index;
+            RemoteProtectedBlock *recoveredBlock = (RemoteProtectedBlock *) slot.m_cm256DescriptorBlocks[recoveryIndex].Block;
 
-            if (!(*metaData == m_currentMeta))
+            if (blockIndex == 0) // first block with meta
             {
-                uint32_t sampleRate =  metaData->m_sampleRate;
+                RemoteMetaDataFEC *metaData = (RemoteMetaDataFEC *) recoveredBlock;
 
-                if (sampleRate != 0)
+                boost::crc_32_type crc32;
+                crc32.process_bytes(metaData, sizeof(RemoteMetaDataFEC)-4);
+
+                if (crc32.checksum() == metaData->m_crc32)
                 {
-                    setBufferLenSec(*metaData);
-                    m_balCorrLimit = sampleRate / 400; // +/- 5% correction max per read
-                    m_readNbBytes = (sampleRate * metaData->m_sampleBytes * 2) / 20;
+                    slot.m_metaRetrieved = true;
+                    printMeta("RemoteInputBuffer::recoverSlot: recovered meta", metaData);
+                }
+                else
+                {
+                    qDebug() << "RemoteInputBuffer::recoverSlot: recovered meta: invalid CRC32";
                 }
-
-                printMeta("RemoteInputBuffer::writeData: new meta", metaData); // print for change other than timestamp
             }
 
-            m_currentMeta = *metaData; // renew current meta
-        } // check block 0
-    } // decode
+            storeOriginalBlock(slotIndex, blockIndex, *recoveredBlock);
+
+            qDebug() << "RemoteInputBuffer::recoverSlot: recovered block #" << blockIndex;
+        } // restore missing blocks
+
+        return true;
+    } // CM256 decode
+}
+
+void RemoteInputBuffer::decompressSlot(int slotIndex)
+{
+    DecoderSlot& slot = m_decoderSlots[slotIndex];
+
+    if (!RemoteSampleCodec::decompress(
+        (const uint8_t *) &slot.m_originalBlocks[1],
+        (slot.m_nbOriginalBlocks - 1) * RemoteNbBytesPerBlock,
+        (uint8_t *) m_frames[slotIndex].m_blocks,
+        sizeof(BufferFrame)))
+    {
+        qDebug() << "RemoteInputBuffer::decompressSlot: invalid compressed data:"
+                << " slotIndex: " << slotIndex
+                << " m_nbOriginalBlocks: " << slot.m_nbOriginalBlocks;
+        memset((void *) m_frames[slotIndex].m_blocks, 0, sizeof(BufferFrame));
+    }
+}
+
+void RemoteInputBuffer::waitDecoded(int slotIndex)
+{
+    QMutexLocker mutexLocker(&m_decodeMutex);
+
+    while (m_decoding[slotIndex]) {
+        m_decodeDone.wait(&m_decodeMutex);
+    }
+}
+
+bool RemoteInputBuffer::isDecoding(int slotIndex)
+{
+    QMutexLocker mutexLocker(&m_decodeMutex);
+    return m_decoding[slotIndex];
+}
+
+void RemoteInputBuffer::checkPendingMeta(bool wait)
+{
+    if (m_pendingMetaSlot < 0) {
+        return;
+    }
+
+    if (wait) {
+        waitDecoded(m_pendingMetaSlot);
+    } else if (isDecoding(m_pendingMetaSlot)) {
+        return;
+    }
+
+    int slotIndex = m_pendingMetaSlot;
+    m_pendingMetaSlot = -1;
+
+    if (m_decoderSlots[slotIndex].m_metaRetrieved) { // recovered by FEC
+        checkMeta(slotIndex);
+    }
+}
+
+void RemoteInputBuffer::checkMeta(int slotIndex)
+{
+    RemoteMetaDataFEC *metaData = getMetaData(slotIndex);
+
+    if (!(*metaData == m_currentMeta))
+    {
+        uint32_t sampleRate =  metaData->m_sampleRate;
+
+        if (sampleRate != 0)
+        {
+            setBufferLenSec(*metaData);
+            m_balCorrLimit = sampleRate / 400; // +/- 5% correction max per read
+            m_readNbBytes = (sampleRate * metaData->m_sampleBytes * 2) / 20;
+        }
+
+        printMeta("RemoteInputBuffer::checkMeta: new meta", metaData); // print for change other than timestamp
+    }
+
+    m_currentMeta = *metaData; // renew current meta
 }
 
 uint8_t *RemoteInputBuffer::readData(int32_t length)
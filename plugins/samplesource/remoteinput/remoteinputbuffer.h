@@ -21,7 +21,12 @@
 #include <channel/remotedatablock.h>
 #include <QString>
 #include <QDebug>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QMutex>
+#include <QWaitCondition>
 #include <cstdlib>
+#include <vector>
 #include "cm256cc/cm256.h"
 #include "util/movingaverage.h"
 
@@ -111,6 +116,23 @@ public:
     }
 
 private:
+    /** FEC decodes and decompresses a complete slot on the thread pool so that the UDP thread keeps on reading datagrams */
+    class DecodeTask : public QRunnable
+    {
+    public:
+        DecodeTask(RemoteInputBuffer *buffer, int slotIndex, int recoveryCount) :
+            m_buffer(buffer),
+            m_slotIndex(slotIndex),
+            m_recoveryCount(recoveryCount)
+        {}
+        virtual void run() { m_buffer->decodeSlot(m_slotIndex, m_recoveryCount); }
+
+    private:
+        RemoteInputBuffer *m_buffer;
+        int m_slotIndex;
+        int m_recoveryCount;
+    };
+
     int m_nbDecoderSlots;
     int m_framesSize;
 
@@ -130,13 +152,13 @@ private:
         int                     m_blockCount;         //!< number of blocks received for this frame
         int                     m_originalCount;      //!< number of original blocks received
         int                     m_recoveryCount;      //!< number of recovery blocks received
+        int                     m_nbOriginalBlocks;   //!< number of original blocks of the frame (less if compressed)
         bool                    m_decoded;            //!< true if decoded
         bool                    m_metaRetrieved;      //!< true if meta data (block zero) was retrieved
         DecoderSlot() {}
     };
 
     RemoteMetaDataFEC m_currentMeta;             //!< Stored current meta data
-    CM256::cm256_encoder_params m_paramsCM256;   //!< CM256 decoder parameters block
     DecoderSlot          *m_decoderSlots;        //!< CM256 decoding control/buffer slots
     BufferFrame          *m_frames;              //!< Samples buffer
     int                  m_framesNbBytes;        //!< Number of bytes in samples buffer
@@ -170,6 +192,12 @@ private:
     CM256    m_cm256;         //!< CM256 library
     bool     m_cm256_OK;      //!< CM256 library initialized OK
 
+    QThreadPool       m_threadPool;     //!< FEC decoding
+    QMutex            m_decodeMutex;
+    QWaitCondition    m_decodeDone;
+    std::vector<bool> m_decoding;       //!< FEC decoding of slot is in progress
+    int               m_pendingMetaSlot; //!< slot which meta data can only be checked once decoded or -1
+
     inline RemoteProtectedBlock* storeOriginalBlock(int slotIndex, int blockIndex, const RemoteProtectedBlock& protectedBlock)
     {
         if (blockIndex == 0) {
@@ -177,6 +205,9 @@ private:
             // return &m_decoderSlots[slotIndex].m_originalBlocks[0];
             m_decoderSlots[slotIndex].m_blockZero = protectedBlock;
             return &m_decoderSlots[slotIndex].m_blockZero;
+        } else if (isCompressed(slotIndex)) { // samples are decompressed into the frame when complete
+            m_decoderSlots[slotIndex].m_originalBlocks[blockIndex] = protectedBlock;
+            return &m_decoderSlots[slotIndex].m_originalBlocks[blockIndex];
         } else {
             // m_decoderSlots[slotIndex].m_originalBlocks[blockIndex] = protectedBlock;
             // return &m_decoderSlots[slotIndex].m_originalBlocks[blockIndex];
@@ -185,6 +216,11 @@ private:
         }
     }
 
+    inline bool isCompressed(int slotIndex) const
+    {
+        return m_decoderSlots[slotIndex].m_nbOriginalBlocks < RemoteNbOrginalBlocks;
+    }
+
     inline RemoteProtectedBlock& getOriginalBlock(int slotIndex, int blockIndex)
     {
         if (blockIndex == 0) {
@@ -214,6 +250,13 @@ private:
     void rwCorrectionEstimate(int slotIndex);
     void checkSlotData(int slotIndex);
     void initDecodeSlot(int slotIndex);
+    void decodeSlot(int slotIndex, int recoveryCount);
+    bool recoverSlot(int slotIndex, int recoveryCount);
+    void decompressSlot(int slotIndex);
+    void waitDecoded(int slotIndex);
+    bool isDecoding(int slotIndex);
+    void checkPendingMeta(bool wait);
+    void checkMeta(int slotIndex);
 
     static void printMeta(const QString& header, RemoteMetaDataFEC *metaData);
 };
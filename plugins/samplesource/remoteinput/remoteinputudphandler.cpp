@@ -22,6 +22,7 @@
 #include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
 #include "device/deviceapi.h"
+#include "util/udpbatch.h"
 
 #include "remoteinputudphandler.h"
 #include "remoteinput.h"
@@ -43,7 +44,6 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceA
     m_multicast(false),
 	m_dataConnected(false),
 	m_udpBuf(0),
-	m_udpReadBytes(0),
 	m_sampleFifo(sampleFifo),
 	m_samplerate(0),
 	m_centerFrequency(0),
@@ -60,7 +60,7 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceA
     m_throttleToggle(false),
 	m_autoCorrBuffer(true)
 {
-    m_udpBuf = new char[RemoteUdpSize];
+    m_udpBuf = new char[UDPBatch::m_maxBatchSize * RemoteMaxDatagramSize];
 
 #ifdef USE_INTERNAL_TIMER
 #warning "Uses internal timer"
@@ -193,23 +193,63 @@ void RemoteInputUDPHandler::applyUDPLink(const QString& address, quint16 port, c
 
 void RemoteInputUDPHandler::dataReadyRead()
 {
-    m_udpReadBytes = 0;
+    qint64 sizes[UDPBatch::m_maxBatchSize];
 
-	while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
+	while (m_dataConnected)
 	{
-		qint64 pendingDataSize = m_dataSocket->pendingDatagramSize();
-		m_udpReadBytes += m_dataSocket->readDatagram(&m_udpBuf[m_udpReadBytes], pendingDataSize, &m_remoteAddress, 0);
+        int nbDatagrams = UDPBatch::receive(*m_dataSocket, m_udpBuf, RemoteMaxDatagramSize, UDPBatch::m_maxBatchSize, sizes, &m_remoteAddress);
 
-		if (m_udpReadBytes == RemoteUdpSize) {
-		    processData();
-		    m_udpReadBytes = 0;
-		}
+        if (nbDatagrams == 0)
+        {
+            // Queue is drained. Finish with a read through the socket that re-enables its read notification.
+            qint64 pendingSize = m_dataSocket->pendingDatagramSize();
+
+            if (pendingSize > RemoteMaxDatagramSize) // would be truncated
+            {
+                m_dataSocket->readDatagram(nullptr, 0, &m_remoteAddress, 0);
+                qWarning("RemoteInputUDPHandler::dataReadyRead: discard oversize datagram of size %lld from %s",
+                    pendingSize, qPrintable(m_remoteAddress.toString()));
+                continue;
+            }
+
+            sizes[0] = m_dataSocket->readDatagram(m_udpBuf, RemoteMaxDatagramSize, &m_remoteAddress, 0);
+
+            if (sizes[0] < 0) {
+                break;
+            }
+
+            nbDatagrams = 1;
+        }
+
+        for (int i = 0; i < nbDatagrams; i++) {
+            processDatagram(&m_udpBuf[i * RemoteMaxDatagramSize], sizes[i]);
+        }
 	}
 }
 
-void RemoteInputUDPHandler::processData()
+void RemoteInputUDPHandler::processDatagram(char *datagram, qint64 size)
+{
+    // A datagram carries one or more consecutive blocks
+    if (size < 0) // truncated by the batch receive
+    {
+        qWarning("RemoteInputUDPHandler::processDatagram: discard oversize datagram");
+        return;
+    }
+
+    if ((size == 0) || (size % RemoteUdpSize != 0))
+    {
+        qDebug("RemoteInputUDPHandler::processDatagram: discard datagram of size %lld", size);
+        return;
+    }
+
+    for (qint64 offset = 0; offset < size; offset += RemoteUdpSize) {
+        processData(&datagram[offset]);
+    }
+}
+
+void RemoteInputUDPHandler::processData(char *block)
 {
-    m_remoteInputBuffer.writeData(m_udpBuf);
+    m_remoteInputBuffer.writeData(block);
     const RemoteMetaDataFEC& metaData =  m_remoteInputBuffer.getCurrentMeta();
     bool change = false;
 
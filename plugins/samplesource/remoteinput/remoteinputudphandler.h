@@ -120,8 +120,7 @@ private:
 	QHostAddress m_multicastAddress;
 	bool m_multicast;
 	bool m_dataConnected;
-	char *m_udpBuf;
-	qint64 m_udpReadBytes;
+	char *m_udpBuf;             //!< room for a batch of datagrams of maximum size
 	SampleSinkFifo *m_sampleFifo;
 	uint32_t m_samplerate;
 	uint64_t m_centerFrequency;
@@ -145,7 +144,8 @@ private:
 
 	void connectTimer();
     void disconnectTimer();
-	void processData();
+	void processDatagram(char *datagram, qint64 size);
+	void processData(char *block);
     void adjustNbDecoderSlots(const RemoteMetaDataFEC& metaData);
 	void applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool muticastJoin);
 	bool handleMessage(const Message& message);
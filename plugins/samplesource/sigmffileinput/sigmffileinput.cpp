@@ -107,8 +107,8 @@ bool SigMFFileInput::openFileStreams(const QString& fileName)
 		m_metaStream.close();
 	}
 
-	if (m_dataStream.is_open()) {
-		m_dataStream.close();
+	if (m_dataFile.isOpen()) {
+		m_dataFile.close();
 	}
 
     QString metaFileName = fileName + ".sigmf-meta";
@@ -120,19 +120,13 @@ bool SigMFFileInput::openFileStreams(const QString& fileName)
 	m_metaStream.open(metaFileName.toStdString().c_str());
 #endif
 
-#ifdef Q_OS_WIN
-	m_dataStream.open(dataFileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
-#else
-	m_dataStream.open(dataFileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
-#endif
-
-    if (!m_dataStream.is_open())
+    if (!m_dataFile.open(dataFileName))
     {
         qCritical("SigMFFileInput::openFileStreams: error opening data file %s", qPrintable(dataFileName));
         return false;
     }
 
-    uint64_t dataFileSize = m_dataStream.tellg();
+    uint64_t dataFileSize = m_dataFile.size();
 
     sigmf::SigMF<sigmf::Global<core::DescrT, sdrangel::DescrT>,
             sigmf::Capture<core::DescrT, sdrangel::DescrT>,
@@ -410,11 +404,10 @@ void SigMFFileInput::seekFileStream(uint64_t sampleIndex)
 {
     QMutexLocker mutexLocker(&m_mutex);
 
-	if (m_dataStream.is_open())
+	if (m_dataFile.isOpen())
 	{
         uint64_t seekPoint = sampleIndex*m_sampleBytes*2;
-		m_dataStream.clear();
-		m_dataStream.seekg(seekPoint, std::ios::beg);
+		m_dataFile.seek(seekPoint);
     }
 }
 
@@ -436,7 +429,7 @@ void SigMFFileInput::init()
 
 bool SigMFFileInput::start()
 {
-    if (!m_dataStream.is_open())
+    if (!m_dataFile.isOpen())
     {
         qWarning("SigMFFileInput::start: file not open. not starting");
         return false;
@@ -445,17 +438,14 @@ bool SigMFFileInput::start()
 	QMutexLocker mutexLocker(&m_mutex);
 	qDebug() << "SigMFFileInput::start";
 
-	if (m_dataStream.tellg() != (std::streampos) 0) {
-		m_dataStream.clear();
-		m_dataStream.seekg(0, std::ios::beg);
-	}
+	m_dataFile.seek(0);
 
 	if(!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample))) {
 		qCritical("Could not allocate SampleFifo");
 		return false;
 	}
 
-	m_fileInputWorker = new SigMFFileInputWorker(&m_dataStream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+	m_fileInputWorker = new SigMFFileInputWorker(&m_dataFile, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
 	startWorker();
     m_fileInputWorker->setMetaInformation(&m_metaInfo, &m_captures);
     m_fileInputWorker->setAccelerationFactor(m_settings.m_accelerationFactor);
@@ -31,6 +31,7 @@
 #include "dsp/sigmf_forward.h"
 
 #include "dsp/devicesamplesource.h"
+#include "util/mappedfilereader.h"
 #include "sigmffileinputsettings.h"
 #include "sigmffiledata.h"
 
@@ -446,7 +447,7 @@ private:
 	QMutex m_mutex;
 	SigMFFileInputSettings m_settings;
 	std::ifstream m_metaStream;
-    std::ifstream m_dataStream;
+    MappedFileReader m_dataFile;
     SigMFFileMetaInfo m_metaInfo;
     QList<SigMFFileCapture> m_captures;
     std::vector<uint64_t> m_captureStarts;
@@ -22,6 +22,7 @@
 #include "dsp/filerecord.h"
 #include "dsp/samplesinkfifo.h"
 #include "util/messagequeue.h"
+#include "util/mappedfilereader.h"
 
 #include "sigmffiledata.h"
 #include "sigmffileconvert.h"
@@ -31,7 +32,7 @@
 MESSAGE_CLASS_DEFINITION(SigMFFileInputWorker::MsgReportEOF, Message)
 MESSAGE_CLASS_DEFINITION(SigMFFileInputWorker::MsgReportTrackChange, Message)
 
-SigMFFileInputWorker::SigMFFileInputWorker(std::ifstream *samplesStream,
+SigMFFileInputWorker::SigMFFileInputWorker(MappedFileReader *samplesFile,
         SampleSinkFifo* sampleFifo,
         const QTimer& timer,
         MessageQueue *fileInputMessageQueue,
@@ -39,10 +40,7 @@ SigMFFileInputWorker::SigMFFileInputWorker(std::ifstream *samplesStream,
 	QObject(parent),
 	m_running(false),
     m_currentTrackIndex(0),
-	m_ifstream(samplesStream),
-	m_fileBuf(0),
-	m_convertBuf(0),
-	m_bufsize(0),
+	m_samplesFile(samplesFile),
 	m_chunksize(0),
 	m_sampleFifo(sampleFifo),
 	m_samplesCount(0),
@@ -52,6 +50,7 @@ SigMFFileInputWorker::SigMFFileInputWorker(std::ifstream *samplesStream,
     m_accelerationFactor(1),
 	m_samplesize(16),
 	m_samplebytes(2),
+	m_inputSampleBytes(4),
     m_throttlems(FILESOURCE_THROTTLE_MS),
     m_throttleToggle(false),
     m_sigMFConverter(nullptr)
@@ -63,21 +62,13 @@ SigMFFileInputWorker::~SigMFFileInputWorker()
 	if (m_running) {
 		stopWork();
 	}
-
-	if (m_fileBuf != 0) {
-		free(m_fileBuf);
-	}
-
-	if (m_convertBuf != 0) {
-		free(m_convertBuf);
-	}
 }
 
 void SigMFFileInputWorker::startWork()
 {
 	qDebug() << "SigMFFileInputWorker::startWork: ";
 
-    if (m_ifstream->is_open())
+    if (m_samplesFile->isOpen())
     {
         qDebug() << "SigMFFileInputWorker::startWork: file stream open, starting...";
         m_elapsedTimer.start();
@@ -138,53 +129,14 @@ void SigMFFileInputWorker::setSampleRate()
     }
 
     m_samplebytes = SigMFFileInputSettings::bitsToBytes(m_samplesize);
-    m_chunksize = (m_accelerationFactor * m_samplerate * 2 * m_samplebytes * m_throttlems) / 1000;
-
-    setBuffers(m_chunksize);
+    m_inputSampleBytes = (m_metaInfo->m_dataType.m_complex ? 2 : 1) * m_samplebytes;
+    m_chunksize = m_inputSampleBytes * ((m_accelerationFactor * m_samplerate * m_throttlems) / 1000);
 
     if (running) {
         startWork();
     }
 }
 
-void SigMFFileInputWorker::setBuffers(std::size_t chunksize)
-{
-    if (chunksize > m_bufsize)
-    {
-        m_bufsize = chunksize;
-        int nbSamples = m_bufsize/(2 * m_samplebytes);
-
-        if (m_fileBuf == 0)
-        {
-            qDebug() << "FileInputThread::setBuffers: Allocate file buffer";
-            m_fileBuf = (quint8*) malloc(m_bufsize);
-        }
-        else
-        {
-            qDebug() << "FileInputThread::setBuffers: Re-allocate file buffer";
-            quint8 *buf = m_fileBuf;
-            m_fileBuf = (quint8*) realloc((void*) m_fileBuf, m_bufsize);
-            if (!m_fileBuf) free(buf);
-        }
-
-        if (m_convertBuf == 0)
-        {
-            qDebug() << "FileInputThread::setBuffers: Allocate conversion buffer";
-            m_convertBuf = (quint8*) malloc(nbSamples*sizeof(Sample));
-        }
-        else
-        {
-            qDebug() << "FileInputThread::setBuffers: Re-allocate conversion buffer";
-            quint8 *buf = m_convertBuf;
-            m_convertBuf = (quint8*) realloc((void*) m_convertBuf, nbSamples*sizeof(Sample));
-            if (!m_convertBuf) free(buf);
-        }
-
-        qDebug() << "FileInputThread::setBuffers: size: " << m_bufsize
-                << " #samples: " << nbSamples;
-    }
-}
-
 void SigMFFileInputWorker::tick()
 {
 	if (m_running)
@@ -194,29 +146,31 @@ void SigMFFileInputWorker::tick()
         if (throttlems != m_throttlems)
         {
             m_throttlems = throttlems;
-            m_chunksize = 2 * m_samplebytes * ((m_samplerate * (m_throttlems+(m_throttleToggle ? 1 : 0))) / 1000);
+            m_chunksize = m_inputSampleBytes * ((m_samplerate * (m_throttlems+(m_throttleToggle ? 1 : 0))) / 1000);
             m_throttleToggle = !m_throttleToggle;
-            setBuffers(m_chunksize);
         }
 
-		// read samples directly feeding the SampleFifo (no callback)
+		// samples are taken from the file mapping directly feeding the SampleFifo (no callback)
+        quint64 nbSamples = m_chunksize / m_inputSampleBytes;
+        bool end = m_samplesCount + nbSamples >= m_totalSamples;
 
-        if (m_samplesCount + m_chunksize > m_totalSamples) {
-            m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_totalSamples - m_samplesCount);
-        } else {
-    		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+        if (end) {
+            nbSamples = m_samplesCount < m_totalSamples ? m_totalSamples - m_samplesCount : 0;
         }
 
-        if ((m_samplesCount + m_chunksize > m_totalSamples) || m_ifstream->eof())
+        quint64 nbBytes;
+        const quint8 *buf = m_samplesFile->read(nbSamples * m_inputSampleBytes, nbBytes);
+
+        if (end || (nbBytes < nbSamples * m_inputSampleBytes))
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount()); // take what has been read
+        	writeToSampleFifo(buf, (qint32) nbBytes); // take what has been read
         	MsgReportEOF *message = MsgReportEOF::create();
         	m_fileInputMessageQueue->push(message);
         }
         else
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
-    		m_samplesCount += m_chunksize / (2 * m_samplebytes);
+        	writeToSampleFifo(buf, (qint32) nbBytes);
+    		m_samplesCount += nbSamples;
 
             if ((m_currentTrackIndex + 1 < m_captures->size())
              && (m_samplesCount > m_captures->at(m_currentTrackIndex+1).m_sampleStart))
@@ -448,292 +402,18 @@ void SigMFFileInputWorker::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
         }
     }
 #endif
-    int nbSamples = m_sigMFConverter->convert((FixReal *) m_convertBuf, buf, nbBytes);
-    m_sampleFifo->write(m_convertBuf, nbSamples*sizeof(Sample));
-}
-
-void SigMFFileInputWorker::writeToSampleFifoBAK(const quint8* buf, qint32 nbBytes)
-{
-    if (m_metaInfo->m_dataType.m_floatingPoint) // FP assumes 32 bit floats (float) always
-    {
-        FixReal *convertBuf = (FixReal *) m_convertBuf;
-        const float *fileBuf = (float *) buf;
-        int nbSamples;
+    // conversion done in place in the FIFO
+    SampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+    unsigned int count = m_sampleFifo->writeBegin(nbBytes / m_inputSampleBytes, &part1Begin, &part1End, &part2Begin, &part2End);
+    int part1Bytes = (part1End - part1Begin) * m_inputSampleBytes;
 
-        if (m_metaInfo->m_dataType.m_complex)
-        {
-            nbSamples = nbBytes / (2 * m_samplebytes);
-            for (int is = 0; is < nbSamples; is++)
-            {
-                convertBuf[2*is]   = fileBuf[2*is] * SDR_RX_SCALEF;
-                convertBuf[2*is+1] = fileBuf[2*is+1] * SDR_RX_SCALEF;
-            }
-        }
-        else
-        {
-            nbSamples = nbBytes / m_samplebytes;
-            for (int is = 0; is < nbSamples; is++)
-            {
-                convertBuf[2*is]   = fileBuf[is] * SDR_RX_SCALEF;
-                convertBuf[2*is+1] = 0;
-            }
-        }
-
-        m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
+    if (part1Begin != part1End) {
+        m_sigMFConverter->convert((FixReal *) &(*part1Begin), buf, part1Bytes);
     }
-    else if (m_metaInfo->m_dataType.m_signed) // signed integers
-    {
-        if (m_samplesize == 8)
-        {
-            FixReal *convertBuf = (FixReal *) m_convertBuf;
-            const int8_t *fileBuf = (int8_t *) buf;
-            int nbSamples;
-
-            if (m_metaInfo->m_dataType.m_complex)
-            {
-                nbSamples = nbBytes / (2 * m_samplebytes);
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[2*is];
-                    convertBuf[2*is]   <<= (SDR_RX_SAMP_SZ == 16) ? 8 : 16;
-                    convertBuf[2*is+1] = fileBuf[2*is+1];
-                    convertBuf[2*is+1] <<= (SDR_RX_SAMP_SZ == 16) ? 8 : 16;
-                }
-            }
-            else
-            {
-                nbSamples = nbBytes / m_samplebytes;
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[is];
-                    convertBuf[2*is]   <<= (SDR_RX_SAMP_SZ == 16) ? 8 : 16;
-                    convertBuf[2*is+1] = 0;
-                }
-            }
 
-            m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-        }
-        else if (m_samplesize == 16)
-        {
-            if (SDR_RX_SAMP_SZ == 16)
-            {
-                if (m_metaInfo->m_dataType.m_complex)
-                {
-                    m_sampleFifo->write(buf, nbBytes);
-                }
-                else
-                {
-                    FixReal *convertBuf = (FixReal *) m_convertBuf;
-                    const int16_t *fileBuf = (int16_t *) buf;
-                    int nbSamples = nbBytes / m_samplebytes;
-
-                    for (int is = 0; is < nbSamples; is++)
-                    {
-                        convertBuf[2*is]   = fileBuf[2*is];
-                        convertBuf[2*is+1] = 0;
-                    }
-
-                    m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-                }
-            }
-            else if (SDR_RX_SAMP_SZ == 24)
-            {
-                FixReal *convertBuf = (FixReal *) m_convertBuf;
-                const int16_t *fileBuf = (int16_t *) buf;
-                int nbSamples;
-
-                if (m_metaInfo->m_dataType.m_complex)
-                {
-                    nbSamples = nbBytes / (2 * m_samplebytes);
-                    for (int is = 0; is < nbSamples; is++)
-                    {
-                        convertBuf[2*is]   = fileBuf[2*is] << 8;
-                        convertBuf[2*is+1] = fileBuf[2*is+1] << 8;
-                    }
-                }
-                else
-                {
-                    nbSamples = nbBytes / m_samplebytes;
-                    for (int is = 0; is < nbSamples; is++)
-                    {
-                        convertBuf[2*is]   = fileBuf[is] << 8;
-                        convertBuf[2*is+1] = 0;
-                    }
-                }
-
-                m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-            }
-        }
-        else if (m_samplesize == 24)
-        {
-            if (SDR_RX_SAMP_SZ == 24)
-            {
-                if (m_metaInfo->m_dataType.m_complex)
-                {
-                    m_sampleFifo->write(buf, nbBytes);
-                }
-                else
-                {
-                    FixReal *convertBuf = (FixReal *) m_convertBuf;
-                    const int32_t *fileBuf = (int32_t *) buf;
-                    int nbSamples = nbBytes / m_samplebytes;
-
-                    for (int is = 0; is < nbSamples; is++)
-                    {
-                        convertBuf[2*is]   = fileBuf[2*is];
-                        convertBuf[2*is+1] = 0;
-                    }
-
-                    m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-                }
-            }
-            else if (SDR_RX_SAMP_SZ == 16)
-            {
-                FixReal *convertBuf = (FixReal *) m_convertBuf;
-                const int32_t *fileBuf = (int32_t *) buf;
-                int nbSamples;
-
-                if (m_metaInfo->m_dataType.m_complex)
-                {
-                    nbSamples = nbBytes / (2 * m_samplebytes);
-                    for (int is = 0; is < nbSamples; is++)
-                    {
-                        convertBuf[2*is]   = fileBuf[2*is] >> 8;
-                        convertBuf[2*is+1] = fileBuf[2*is+1] >> 8;
-                    }
-                }
-                else
-                {
-                    nbSamples = nbBytes / m_samplebytes;
-                    for (int is = 0; is < nbSamples; is++)
-                    {
-                        convertBuf[2*is]   = fileBuf[is] >> 8;
-                        convertBuf[2*is+1] = 0;
-                    }
-                }
-
-                m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-            }
-        }
-        if (m_samplesize == 32)
-        {
-            FixReal *convertBuf = (FixReal *) m_convertBuf;
-            const int32_t *fileBuf = (int32_t *) buf;
-            int nbSamples;
-
-            if (m_metaInfo->m_dataType.m_complex)
-            {
-                nbSamples = nbBytes / (2 * m_samplebytes);
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[2*is] >> (SDR_RX_SAMP_SZ == 24) ? 8 : 16;
-                    convertBuf[2*is+1] = fileBuf[2*is+1] >> (SDR_RX_SAMP_SZ == 24) ? 8 : 16;
-                }
-            }
-            else
-            {
-                nbSamples = nbBytes / m_samplebytes;
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[is] >> (SDR_RX_SAMP_SZ == 24) ? 8 : 16;
-                    convertBuf[2*is+1] = 0;
-                }
-            }
-
-            m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-        }
+    if (part2Begin != part2End) {
+        m_sigMFConverter->convert((FixReal *) &(*part2Begin), buf + part1Bytes, (part2End - part2Begin) * m_inputSampleBytes);
     }
-    else // unsigned integers
-    {
-        if (m_samplesize == 8)
-        {
-            FixReal *convertBuf = (FixReal *) m_convertBuf;
-            const uint8_t *fileBuf = (uint8_t *) buf;
-            int nbSamples;
-
-            if (m_metaInfo->m_dataType.m_complex)
-            {
-                nbSamples = nbBytes / (2 * m_samplebytes);
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[2*is] - 128;
-                    convertBuf[2*is]   <<= (SDR_RX_SAMP_SZ == 16) ? 8 : 16;
-                    convertBuf[2*is+1] = fileBuf[2*is+1] - 128;
-                    convertBuf[2*is+1] <<= (SDR_RX_SAMP_SZ == 16) ? 8 : 16;
-                }
-            }
-            else
-            {
-                nbSamples = nbBytes / m_samplebytes;
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[is] - 128;
-                    convertBuf[2*is]   <<= (SDR_RX_SAMP_SZ == 16) ? 8 : 16;
-                    convertBuf[2*is+1] = 0;
-                }
-            }
-
-            m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-        }
-        else if (m_samplesize == 16)
-        {
-            FixReal *convertBuf = (FixReal *) m_convertBuf;
-            const uint16_t *fileBuf = (uint16_t *) buf;
-            int nbSamples;
 
-            if (m_metaInfo->m_dataType.m_complex)
-            {
-                nbSamples = nbBytes / (2 * m_samplebytes);
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[2*is] - 32768;
-                    convertBuf[2*is]   <<= (SDR_RX_SAMP_SZ == 16) ? 0 : 8;
-                    convertBuf[2*is+1] = fileBuf[2*is+1] - 32768;
-                    convertBuf[2*is+1] <<= (SDR_RX_SAMP_SZ == 16) ? 0 : 8;
-                }
-            }
-            else
-            {
-                nbSamples = nbBytes / m_samplebytes;
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is]   = fileBuf[is] - 32768;
-                    convertBuf[2*is]   <<= (SDR_RX_SAMP_SZ == 16) ? 0 : 8;
-                    convertBuf[2*is+1] = 0;
-                }
-            }
-
-            m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-        }
-        else if (m_samplesize == 32)
-        {
-            FixReal *convertBuf = (FixReal *) m_convertBuf;
-            const uint32_t *fileBuf = (uint32_t *) buf;
-            int nbSamples;
-
-            if (m_metaInfo->m_dataType.m_complex)
-            {
-                nbSamples = nbBytes / (2 * m_samplebytes);
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is] = (fileBuf[2*is] >> (SDR_RX_SAMP_SZ == 24) ? 8 : 16)
-                        - ((SDR_RX_SAMP_SZ == 24) ? (1<<23) : (1<<15));
-                    convertBuf[2*is+1] = (fileBuf[2*is+1] >> (SDR_RX_SAMP_SZ == 24) ? 8 : 16)
-                        - ((SDR_RX_SAMP_SZ == 24) ? (1<<23) : (1<<15));;
-                }
-            }
-            else
-            {
-                nbSamples = nbBytes / m_samplebytes;
-                for (int is = 0; is < nbSamples; is++)
-                {
-                    convertBuf[2*is] = (fileBuf[is] >> (SDR_RX_SAMP_SZ == 24) ? 8 : 16)
-                        - ((SDR_RX_SAMP_SZ == 24) ? (1<<23) : (1<<15));
-                    convertBuf[2*is+1] = 0;
-                }
-            }
-
-            m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-        }
-    }
+    m_sampleFifo->writeCommit(count);
 }
@@ -21,11 +21,9 @@
 #include <QObject>
 #include <QTimer>
 #include <QElapsedTimer>
-#include <iostream>
-#include <fstream>
 #include <cstdlib>
 
-#include "dsp/inthalfbandfilter.h"
+#include "dsp/dsptypes.h"
 #include "util/message.h"
 
 #define FILESOURCE_THROTTLE_MS 50
@@ -35,6 +33,7 @@ class MessageQueue;
 class SigMFFileCapture;
 class SigMFFileMetaInfo;
 class SigMFConverterInterface;
+class MappedFileReader;
 
 class SigMFFileInputWorker : public QObject {
 	Q_OBJECT
@@ -71,7 +70,7 @@ public:
         { }
     };
 
-	SigMFFileInputWorker(std::ifstream *samplesStream,
+	SigMFFileInputWorker(MappedFileReader *samplesFile,
 	        SampleSinkFifo* sampleFifo,
 	        const QTimer& timer,
 	        MessageQueue *fileInputMessageQueue,
@@ -80,7 +79,6 @@ public:
 
 	void startWork();
 	void stopWork();
-    void setBuffers(std::size_t chunksize);
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
     void setSamplesCount(uint64_t samplesCount) { m_samplesCount = samplesCount; }
@@ -95,10 +93,7 @@ private:
     const SigMFFileMetaInfo *m_metaInfo;
     const QList<SigMFFileCapture> *m_captures;
     int m_currentTrackIndex;
-	std::ifstream* m_ifstream;
-	quint8  *m_fileBuf;
-	quint8  *m_convertBuf;
-	std::size_t m_bufsize;
+	MappedFileReader* m_samplesFile;
     qint64 m_chunksize;
 	SampleSinkFifo* m_sampleFifo;
     uint64_t m_samplesCount;
@@ -110,6 +105,7 @@ private:
     int m_accelerationFactor;
     quint64 m_samplesize;  //!< File effective sample size in bits (I or Q). Ex: 16, 24.
     quint64 m_samplebytes; //!< Number of bytes used to store a I or Q sample. Ex: 2. 4.
+    quint64 m_inputSampleBytes; //!< Number of bytes of a sample in the file (I and Q if complex)
     qint64 m_throttlems;
     QElapsedTimer m_elapsedTimer;
     bool m_throttleToggle;
@@ -121,7 +117,6 @@ private:
 	void setSampleRate();
     void setConverter();
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
-	void writeToSampleFifoBAK(const quint8* buf, qint32 nbBytes);
 
 private slots:
 	void tick();
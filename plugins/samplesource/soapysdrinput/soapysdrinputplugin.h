@@ -39,6 +39,7 @@ public:
     void initPlugin(PluginAPI* pluginAPI);
 
 	virtual void enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices);
+	virtual bool canRestoreEnumeration() const { return false; } // devices are opened by their index in the SoapySDR scan
 	virtual SamplingDevices enumSampleSources(const OriginDevices& originDevices);
     virtual DeviceGUI* createSampleSourcePluginInstanceGUI(
             const QString& sourceId,
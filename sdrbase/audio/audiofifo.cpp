@@ -32,11 +32,13 @@ AudioFifo::AudioFifo() :
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_sampleRate = 0;
 }
 
 AudioFifo::AudioFifo(uint32_t numSamples) :
 	m_fifo(nullptr),
-    m_sampleSize(sizeof(AudioSample))
+    m_sampleSize(sizeof(AudioSample)),
+	m_sampleRate(0)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
@@ -22,6 +22,7 @@
 #include <QObject>
 #include <QMutex>
 #include <QWaitCondition>
+#include <atomic>
 
 #include "dsp/dsptypes.h"
 #include "export.h"
@@ -46,6 +47,8 @@ public:
 	inline bool isEmpty() const { return m_fill == 0; }
 	inline bool isFull() const { return m_fill == m_size; }
 	inline uint32_t size() const { return m_size; }
+	void setSampleRate(int sampleRate) { m_sampleRate = sampleRate; } //!< rate of the written samples. 0 (default) is the audio device rate.
+	int getSampleRate() const { return m_sampleRate; }
 
 private:
 	QMutex m_mutex;
@@ -58,6 +61,7 @@ private:
 	uint32_t m_fill;
 	uint32_t m_head;
 	uint32_t m_tail;
+	std::atomic<int> m_sampleRate;
 
 	bool create(uint32_t numSamples);
 
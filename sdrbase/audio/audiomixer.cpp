@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "dsp/cpufeatures.h"
+#include "audiomixer.h"
+
+#if defined(SDR_SIMD_X86)
+#include <immintrin.h>
+#elif defined(SDR_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+static void accumulateScalar(qint32 *mix, const qint16 *src, unsigned int nbValues)
+{
+    for (unsigned int i = 0; i < nbValues; i++) {
+        mix[i] += src[i];
+    }
+}
+
+static void saturateScalar(qint16 *dst, const qint32 *mix, unsigned int nbValues)
+{
+    for (unsigned int i = 0; i < nbValues; i++)
+    {
+        qint32 s = mix[i];
+        dst[i] = s < -32768 ? -32768 : s > 32767 ? 32767 : s;
+    }
+}
+
+#if defined(SDR_SIMD_X86)
+static SDR_SIMD_TARGET_SSE2 unsigned int accumulateSSE2(qint32 *mix, const qint16 *src, unsigned int nbValues)
+{
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbValues; i += 8)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i*) &src[i]);
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16); // sign extension
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+        _mm_storeu_si128((__m128i*) &mix[i],   _mm_add_epi32(_mm_loadu_si128((const __m128i*) &mix[i]), lo));
+        _mm_storeu_si128((__m128i*) &mix[i+4], _mm_add_epi32(_mm_loadu_si128((const __m128i*) &mix[i+4]), hi));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int accumulateAVX2(qint32 *mix, const qint16 *src, unsigned int nbValues)
+{
+    unsigned int i = 0;
+
+    for (; i + 16 <= nbValues; i += 16)
+    {
+        __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*) &src[i]));
+        __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*) &src[i+8]));
+        _mm256_storeu_si256((__m256i*) &mix[i],   _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) &mix[i]), lo));
+        _mm256_storeu_si256((__m256i*) &mix[i+8], _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) &mix[i+8]), hi));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int saturateSSE2(qint16 *dst, const qint32 *mix, unsigned int nbValues)
+{
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbValues; i += 8)
+    {
+        __m128i lo = _mm_loadu_si128((const __m128i*) &mix[i]);
+        __m128i hi = _mm_loadu_si128((const __m128i*) &mix[i+4]);
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_packs_epi32(lo, hi));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int saturateAVX2(qint16 *dst, const qint32 *mix, unsigned int nbValues)
+{
+    unsigned int i = 0;
+
+    for (; i + 16 <= nbValues; i += 16)
+    {
+        __m256i lo = _mm256_loadu_si256((const __m256i*) &mix[i]);
+        __m256i hi = _mm256_loadu_si256((const __m256i*) &mix[i+8]);
+        // packs works within 128 bit lanes: restore the order of the 64 bit quarters
+        __m256i p = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256((__m256i*) &dst[i], p);
+    }
+
+    return i;
+}
+#elif defined(SDR_SIMD_NEON)
+static unsigned int accumulateNEON(qint32 *mix, const qint16 *src, unsigned int nbValues)
+{
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbValues; i += 8)
+    {
+        int16x8_t s = vld1q_s16(&src[i]);
+        vst1q_s32(&mix[i],   vaddw_s16(vld1q_s32(&mix[i]), vget_low_s16(s)));
+        vst1q_s32(&mix[i+4], vaddw_s16(vld1q_s32(&mix[i+4]), vget_high_s16(s)));
+    }
+
+    return i;
+}
+
+static unsigned int saturateNEON(qint16 *dst, const qint32 *mix, unsigned int nbValues)
+{
+    unsigned int i = 0;
+
+    for (; i + 8 <= nbValues; i += 8) {
+        vst1q_s16(&dst[i], vcombine_s16(vqmovn_s32(vld1q_s32(&mix[i])), vqmovn_s32(vld1q_s32(&mix[i+4]))));
+    }
+
+    return i;
+}
+#endif
+
+void AudioMixer::accumulate(qint32 *mix, const qint16 *src, unsigned int nbValues)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = accumulateAVX2(mix, src, nbValues);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = accumulateSSE2(mix, src, nbValues);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = accumulateNEON(mix, src, nbValues);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    accumulateScalar(&mix[done], &src[done], nbValues - done);
+}
+
+void AudioMixer::saturate(qint16 *dst, const qint32 *mix, unsigned int nbValues)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = saturateAVX2(dst, mix, nbValues);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = saturateSSE2(dst, mix, nbValues);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = saturateNEON(dst, mix, nbValues);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    saturateScalar(&dst[done], &mix[done], nbValues - done);
+}
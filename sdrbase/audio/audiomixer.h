@@ -0,0 +1,38 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_AUDIO_AUDIOMIXER_H_
+#define SDRBASE_AUDIO_AUDIOMIXER_H_
+
+#include <QtGlobal>
+
+#include "export.h"
+
+/**
+ * Kernels of the audio output mixer. Sources are interleaved stereo 16 bit samples
+ * summed into a 32 bit mix buffer that is finally saturated back to 16 bit. The
+ * instruction set is selected at run time with CPUFeatures and all kernels give
+ * the same result as the scalar code.
+ */
+class SDRBASE_API AudioMixer
+{
+public:
+    static void accumulate(qint32 *mix, const qint16 *src, unsigned int nbValues); //!< mix[i] += src[i]
+    static void saturate(qint16 *dst, const qint32 *mix, unsigned int nbValues);   //!< dst[i] = clip(mix[i])
+};
+
+#endif // SDRBASE_AUDIO_AUDIOMIXER_H_
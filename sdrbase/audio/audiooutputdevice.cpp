@@ -22,6 +22,7 @@
 #include <QAudioOutput>
 #include "audiooutputdevice.h"
 #include "audiofifo.h"
+#include "audiomixer.h"
 #include "audionetsink.h"
 
 AudioOutputDevice::AudioOutputDevice() :
@@ -34,12 +35,23 @@ AudioOutputDevice::AudioOutputDevice() :
 	m_audioUsageCount(0),
 	m_onExit(false),
 	m_volume(1.0),
-	m_audioFifos()
+	m_audioFifos(),
+	m_mixerSources(new MixerSources()),
+	m_mixerSourcesInUse(nullptr),
+	m_mixerSourcesPending(0)
 {
 }
 
 AudioOutputDevice::~AudioOutputDevice()
 {
+    MixerSources *mixerSources = m_mixerSources.exchange(nullptr);
+
+    for (auto source : *mixerSources) {
+        delete source;
+    }
+
+    delete mixerSources;
+
 //	stop();
 //
 //	QMutexLocker mutexLocker(&m_mutex);
@@ -161,16 +173,80 @@ void AudioOutputDevice::stop()
 
 void AudioOutputDevice::addFifo(AudioFifo* audioFifo)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	MixerSources *previous;
 
-	m_audioFifos.push_back(audioFifo);
+	{
+		QMutexLocker mutexLocker(&m_mutex);
+
+		m_audioFifos.push_back(audioFifo);
+		MixerSources *mixerSources = new MixerSources(*m_mixerSources.load());
+		MixerSource *source = new MixerSource();
+		source->m_audioFifo = audioFifo;
+		mixerSources->push_back(source);
+		previous = publishMixerSources(mixerSources);
+	}
+
+	retireMixerSources(previous);
 }
 
 void AudioOutputDevice::removeFifo(AudioFifo* audioFifo)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	MixerSources *previous;
+	std::vector<MixerSource*> removed;
+
+	{
+		QMutexLocker mutexLocker(&m_mutex);
+
+		m_audioFifos.remove(audioFifo);
+		MixerSources *mixerSources = new MixerSources();
+
+		for (auto source : *m_mixerSources.load())
+		{
+			if (source->m_audioFifo == audioFifo) {
+				removed.push_back(source);
+			} else {
+				mixerSources->push_back(source);
+			}
+		}
+
+		previous = publishMixerSources(mixerSources);
+	}
 
-	m_audioFifos.remove(audioFifo);
+	retireMixerSources(previous);
+
+	for (auto source : removed) { // no longer reachable from readData
+		delete source;
+	}
+}
+
+AudioOutputDevice::MixerSources *AudioOutputDevice::publishMixerSources(MixerSources *mixerSources)
+{
+	m_mixerSourcesPending++; // before the exchange so that readData signals the release
+	return m_mixerSources.exchange(mixerSources);
+}
+
+void AudioOutputDevice::retireMixerSources(MixerSources *previous)
+{
+	{
+		// readData holds a snapshot for the duration of one audio buffer at most. Publishers no longer
+		// wait in turn so any replaced snapshot may still reference a removed source: wait until
+		// readData is either idle or mixing the current snapshot.
+		QMutexLocker releaseLocker(&m_mixerSourcesReleaseMutex);
+
+		while (true)
+		{
+			MixerSources *inUse = m_mixerSourcesInUse.load();
+
+			if (!inUse || (inUse == m_mixerSources.load())) {
+				break;
+			}
+
+			m_mixerSourcesReleased.wait(&m_mixerSourcesReleaseMutex);
+		}
+	}
+
+	m_mixerSourcesPending--;
+	delete previous;
 }
 
 /*
@@ -224,11 +300,8 @@ qint64 AudioOutputDevice::readData(char* data, qint64 maxLen)
 {
     //qDebug("AudioOutputDevice::readData: %lld", maxLen);
 
-    // Study this mutex on OSX, for now deadlocks possible
-    // Removed as it may indeed cause lockups and is in fact useless.
-//#ifndef __APPLE__
-//    QMutexLocker mutexLocker(&m_mutex);
-//#endif
+    // No mutex here: FIFOs are registered through an immutable snapshot of the
+    // sources that is only freed once this method has released it.
 
 	unsigned int samplesPerBuffer = maxLen / 4;
 
@@ -240,6 +313,7 @@ qint64 AudioOutputDevice::readData(char* data, qint64 maxLen)
 	if (m_mixBuffer.size() < samplesPerBuffer * 2)
 	{
 		m_mixBuffer.resize(samplesPerBuffer * 2); // allocate 2 qint32 per sample (stereo)
+		m_sourceBuffer.resize(samplesPerBuffer * 2);
 
 		if (m_mixBuffer.size() != samplesPerBuffer * 2)
 		{
@@ -249,72 +323,74 @@ qint64 AudioOutputDevice::readData(char* data, qint64 maxLen)
 
 	memset(&m_mixBuffer[0], 0x00, 2 * samplesPerBuffer * sizeof(m_mixBuffer[0])); // start with silence
 
-	// sum up a block from all fifos
+	MixerSources *mixerSources = m_mixerSources.load();
 
-	for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
+	while (true)
 	{
-		// use outputBuffer as temp - yes, one memcpy could be saved
-		unsigned int samples = (*it)->read((quint8*) data, samplesPerBuffer);
-		const qint16* src = (const qint16*) data;
-		std::vector<qint32>::iterator dst = m_mixBuffer.begin();
-
-//		if (samples != framesPerBuffer)
-//		{
-//            qDebug("AudioOutputDevice::readData: read %d samples vs %d requested", samples, framesPerBuffer);
-//		}
+		m_mixerSourcesInUse.store(mixerSources);
+		MixerSources *current = m_mixerSources.load(); // make sure it was not replaced before being marked in use
 
-		for (unsigned int i = 0; i < samples; i++)
-		{
-			*dst += *src;
-			++src;
-			++dst;
-			*dst += *src;
-			++src;
-			++dst;
+		if (current == mixerSources) {
+			break;
 		}
-    }
-	// convert to int16
 
-	//std::vector<qint32>::const_iterator src = m_mixBuffer.begin(); // Valgrind optim
-	qint16* dst = (qint16*) data;
-	qint32 sl, sr;
+		mixerSources = current;
+	}
 
-	for (unsigned int i = 0; i < samplesPerBuffer; i++)
-	{
-		// left channel
+	// sum up a block from all fifos
 
-		//s = *src++; // Valgrind optim
-		sl = m_mixBuffer[2*i];
+	int deviceRate = m_audioFormat.sampleRate();
 
-		if(sl < -32768)
+	for (auto source : *mixerSources)
+	{
+		int fifoRate = source->m_audioFifo->getSampleRate();
+		unsigned int samples;
+
+		if ((fifoRate == 0) || (fifoRate == deviceRate))
 		{
-			sl = -32768;
+			samples = source->m_audioFifo->read((quint8*) &m_sourceBuffer[0], samplesPerBuffer);
 		}
-		else if (sl > 32767)
+		else
 		{
-			sl = 32767;
-		}
+			AudioResampler& resampler = source->m_resampler;
 
-		*dst++ = sl;
+			if ((resampler.getInputRate() != fifoRate) || (resampler.getOutputRate() != deviceRate)) {
+				resampler.setRates(fifoRate, deviceRate);
+			}
 
-		// right channel
+			unsigned int nbInput = resampler.getNbInputFrames(samplesPerBuffer);
 
-		//s = *src++; // Valgrind optim
-		sr = m_mixBuffer[2*i + 1];
+			if (m_resamplerBuffer.size() < nbInput * 2) {
+				m_resamplerBuffer.resize(nbInput * 2);
+			}
 
-		if(sr < -32768)
-		{
-			sr = -32768;
-		}
-		else if (sr > 32767)
-		{
-			sr = 32767;
+			nbInput = source->m_audioFifo->read((quint8*) &m_resamplerBuffer[0], nbInput);
+			samples = resampler.resample(&m_resamplerBuffer[0], nbInput, &m_sourceBuffer[0], samplesPerBuffer);
 		}
 
-		*dst++ = sr;
+		AudioMixer::accumulate(&m_mixBuffer[0], &m_sourceBuffer[0], 2 * samples);
+	}
+
+	m_mixerSourcesInUse.store(nullptr);
+
+	if (m_mixerSourcesPending.load() > 0) // only lock when a previous snapshot is being retired
+	{
+		QMutexLocker releaseLocker(&m_mixerSourcesReleaseMutex);
+		m_mixerSourcesReleased.wakeAll();
+	}
+
+	// convert to int16
 
-		if ((m_copyAudioToUdp) && (m_audioNetSink))
+	qint16* dst = (qint16*) data;
+	AudioMixer::saturate(dst, &m_mixBuffer[0], 2 * samplesPerBuffer);
+
+	if ((m_copyAudioToUdp) && (m_audioNetSink))
+	{
+		for (unsigned int i = 0; i < samplesPerBuffer; i++)
 		{
+			qint16 sl = dst[2*i];
+			qint16 sr = dst[2*i + 1];
+
 	        switch (m_udpChannelMode)
 	        {
             case UDPChannelStereo:
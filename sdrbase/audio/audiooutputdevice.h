@@ -20,11 +20,14 @@
 #define INCLUDE_AUDIOOUTPUTDEVICE_H
 
 #include <QMutex>
+#include <QWaitCondition>
 #include <QIODevice>
 #include <QAudioFormat>
 #include <list>
 #include <vector>
+#include <atomic>
 #include <stdint.h>
+#include "audioresampler.h"
 #include "export.h"
 
 class QAudioOutput;
@@ -74,6 +77,14 @@ public:
 	void setVolume(float volume);
 
 private:
+    struct MixerSource
+    {
+        AudioFifo *m_audioFifo;
+        AudioResampler m_resampler; //!< used when the FIFO is not at the device rate
+    };
+
+    typedef std::vector<MixerSource*> MixerSources;
+
 	QMutex m_mutex;
 	QAudioOutput* m_audioOutput;
 	AudioNetSink* m_audioNetSink;
@@ -85,10 +96,19 @@ private:
 	float m_volume;
 
 	std::list<AudioFifo*> m_audioFifos;
+	std::atomic<MixerSources*> m_mixerSources;      //!< immutable snapshot of the sources published to readData
+	std::atomic<MixerSources*> m_mixerSourcesInUse; //!< snapshot being mixed by readData (hazard pointer)
+	std::atomic<int> m_mixerSourcesPending;         //!< number of previous snapshots waiting for readData to release them
+	QMutex m_mixerSourcesReleaseMutex;
+	QWaitCondition m_mixerSourcesReleased;
 	std::vector<qint32> m_mixBuffer;
+	std::vector<qint16> m_sourceBuffer;
+	std::vector<qint16> m_resamplerBuffer;
 
 	QAudioFormat m_audioFormat;
 
+	MixerSources *publishMixerSources(MixerSources *mixerSources);
+	void retireMixerSources(MixerSources *previous);
 	//virtual bool open(OpenMode mode);
 	virtual qint64 readData(char* data, qint64 maxLen);
 	virtual qint64 writeData(const char* data, qint64 len);
@@ -16,11 +16,17 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
+
 #include "audioresampler.h"
 
 AudioResampler::AudioResampler() :
     m_decimation(1),
-    m_decimationCount(0)
+    m_decimationCount(0),
+    m_inputRate(0),
+    m_outputRate(0),
+    m_step(1.0),
+    m_time(0.0)
 {}
 
 AudioResampler::~AudioResampler()
@@ -92,4 +98,110 @@ bool AudioResampler::upSample(qint16 sampleIn, qint16& sampleOut)
     }
 }
 
+void AudioResampler::setRates(int inputRate, int outputRate)
+{
+    if ((inputRate <= 0) || (outputRate <= 0)) {
+        return;
+    }
+
+    m_inputRate = inputRate;
+    m_outputRate = outputRate;
+    m_step = inputRate / (double) outputRate;
+
+    // cutoff relative to the input rate: below the lowest of the two Nyquist frequencies
+    double fc = 0.45 * (outputRate < inputRate ? outputRate / (double) inputRate : 1.0);
+    m_phases.resize((m_nbPhases + 1) * m_nbTaps);
+
+    for (int j = 0; j <= m_nbPhases; j++)
+    {
+        float *row = &m_phases[j * m_nbTaps];
+        double sum = 0.0;
+
+        for (int k = 0; k < m_nbTaps; k++)
+        {
+            double x = k - (m_nbTaps/2 - 1) - j / (double) m_nbPhases; // distance to the output point in input samples
+            double sinc = x == 0.0 ? 2.0 * fc : std::sin(2.0 * M_PI * fc * x) / (M_PI * x);
+            double window = 0.42 + 0.5 * std::cos(2.0 * M_PI * x / m_nbTaps) + 0.08 * std::cos(4.0 * M_PI * x / m_nbTaps); // Blackman
+            row[k] = sinc * window;
+            sum += row[k];
+        }
+
+        for (int k = 0; k < m_nbTaps; k++) {
+            row[k] /= sum; // unity gain at DC for every phase
+        }
+    }
+
+    // start on a history of silence with the first output frame aligned on its last sample
+    m_history.assign(2 * (m_nbTaps - 1), 0.0f);
+    m_time = m_nbTaps/2 - 1;
+}
+
+unsigned int AudioResampler::getNbInputFrames(unsigned int nbOutputFrames) const
+{
+    if ((m_inputRate == 0) || (nbOutputFrames == 0)) {
+        return nbOutputFrames;
+    }
+
+    long last = (long) std::floor(m_time + (nbOutputFrames - 1) * m_step);
+    long needed = last + m_nbTaps/2 + 1 - (long) (m_history.size() / 2);
+    return needed < 0 ? 0 : needed;
+}
+
+unsigned int AudioResampler::resample(const qint16 *in, unsigned int nbIn, qint16 *out, unsigned int maxOut)
+{
+    if (m_inputRate == 0) {
+        return 0;
+    }
+
+    std::size_t start = m_history.size();
+    m_history.resize(start + 2 * nbIn);
+
+    for (unsigned int i = 0; i < 2 * nbIn; i++) {
+        m_history[start + i] = in[i];
+    }
+
+    long nbFrames = m_history.size() / 2;
+    unsigned int nbOut = 0;
+
+    for (; nbOut < maxOut; nbOut++)
+    {
+        long center = (long) m_time;
+
+        if (center + m_nbTaps/2 >= nbFrames) {
+            break;
+        }
 
+        double phase = (m_time - center) * m_nbPhases;
+        int j = (int) phase;
+        float mu = phase - j;
+        const float *h0 = &m_phases[j * m_nbTaps];
+        const float *h1 = h0 + m_nbTaps;
+        const float *x = &m_history[2 * (center - (m_nbTaps/2 - 1))];
+        float l = 0.0f, r = 0.0f;
+
+        for (int k = 0; k < m_nbTaps; k++)
+        {
+            float h = h0[k] + mu * (h1[k] - h0[k]);
+            l += h * x[2*k];
+            r += h * x[2*k + 1];
+        }
+
+        l = l < -32768.0f ? -32768.0f : l > 32767.0f ? 32767.0f : l;
+        r = r < -32768.0f ? -32768.0f : r > 32767.0f ? 32767.0f : r;
+        out[2*nbOut]     = (qint16) std::lrint(l);
+        out[2*nbOut + 1] = (qint16) std::lrint(r);
+        m_time += m_step;
+    }
+
+    // drop the frames no longer reachable by the filter span
+    long consumed = (long) m_time - (m_nbTaps/2 - 1);
+
+    if (consumed > 0)
+    {
+        consumed = consumed > nbFrames ? nbFrames : consumed;
+        m_history.erase(m_history.begin(), m_history.begin() + 2 * consumed);
+        m_time -= consumed;
+    }
+
+    return nbOut;
+}
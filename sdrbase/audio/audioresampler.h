@@ -19,6 +19,8 @@
 #ifndef SDRBASE_AUDIO_AUDIORESAMPLER_H_
 #define SDRBASE_AUDIO_AUDIORESAMPLER_H_
 
+#include <vector>
+
 #include "dsp/dsptypes.h"
 #include "audiofilter.h"
 
@@ -34,10 +36,31 @@ public:
     bool downSample(qint16 sampleIn, qint16& sampleOut);
     bool upSample(qint16 sampleIn, qint16& sampleOut);
 
+    /**
+     * Polyphase resampling of interleaved stereo frames between arbitrary rates. Each
+     * output frame is computed from a windowed sinc interpolated between the two
+     * nearest of the tabulated phases. Input frames are kept between calls so that
+     * the stream can be fed in blocks of any size.
+     */
+    void setRates(int inputRate, int outputRate);
+    int getInputRate() const { return m_inputRate; }
+    int getOutputRate() const { return m_outputRate; }
+    unsigned int getNbInputFrames(unsigned int nbOutputFrames) const; //!< input frames to feed for this number of output frames
+    unsigned int resample(const qint16 *in, unsigned int nbIn, qint16 *out, unsigned int maxOut); //!< returns the number of output frames
+
 private:
     AudioFilter m_audioFilter;
     uint32_t m_decimation;
     uint32_t m_decimationCount;
+
+    static const int m_nbTaps = 64;     //!< taps of each polyphase branch
+    static const int m_nbPhases = 128;  //!< tabulated phases per input sample
+    int m_inputRate;
+    int m_outputRate;
+    double m_step;                      //!< input frames per output frame
+    double m_time;                      //!< position of the next output frame in the history
+    std::vector<float> m_phases;        //!< (m_nbPhases + 1) rows of m_nbTaps coefficients
+    std::vector<float> m_history;       //!< interleaved stereo input frames
 };
 
 #endif /* SDRBASE_AUDIO_AUDIORESAMPLER_H_ */
@@ -33,6 +33,7 @@
 
 #define UDPSINKFEC_UDPSIZE 512
 #define UDPSINKFEC_NBORIGINALBLOCKS 128
+#define UDPSINKFEC_MAXBLOCKSPERDATAGRAM 16 // 8192 bytes datagrams fit in 9000 bytes jumbo frames
 //#define UDPSINKFEC_NBTXBLOCKS 8
 
 #pragma pack(push, 1)
@@ -80,7 +81,7 @@ struct RemoteHeader
     uint8_t  m_blockIndex;
     uint8_t  m_sampleBytes; //!<  number of bytes per sample (2 or 4) for this block
     uint8_t  m_sampleBits;  //!<  number of bits per sample
-    uint8_t  m_filler;
+    uint8_t  m_nbOriginalBlocks; //!< number of original blocks of a compressed frame or 0 for a raw frame
     uint16_t m_filler2;
 
     void init()
@@ -89,7 +90,7 @@ struct RemoteHeader
         m_blockIndex = 0;
         m_sampleBytes = 2;
         m_sampleBits = 16;
-        m_filler = 0;
+        m_nbOriginalBlocks = 0;
         m_filler2 = 0;
     }
 };
@@ -97,6 +98,8 @@ struct RemoteHeader
 static const int RemoteUdpSize = UDPSINKFEC_UDPSIZE;
 static const int RemoteNbOrginalBlocks = UDPSINKFEC_NBORIGINALBLOCKS;
 static const int RemoteNbBytesPerBlock = UDPSINKFEC_UDPSIZE - sizeof(RemoteHeader);
+static const int RemoteMaxBlocksPerDatagram = UDPSINKFEC_MAXBLOCKSPERDATAGRAM;
+static const int RemoteMaxDatagramSize = UDPSINKFEC_UDPSIZE * UDPSINKFEC_MAXBLOCKSPERDATAGRAM;
 
 struct RemoteProtectedBlock
 {
@@ -127,6 +130,10 @@ struct RemoteTxControlBlock
     uint16_t m_frameIndex;
     int m_nbBlocksFEC;
     int m_txDelay;
+    int m_nbBlocksPerDatagram;
+    bool m_compression;
+    int m_compressionLossBits;
+    int m_nbOriginalBlocks; //!< number of original blocks after compression
     QString m_dataAddress;
     uint16_t m_dataPort;
 
@@ -136,6 +143,10 @@ struct RemoteTxControlBlock
         m_frameIndex = 0;
         m_nbBlocksFEC = 0;
         m_txDelay = 100;
+        m_nbBlocksPerDatagram = 1;
+        m_compression = false;
+        m_compressionLossBits = 0;
+        m_nbOriginalBlocks = UDPSINKFEC_NBORIGINALBLOCKS;
         m_dataAddress = "127.0.0.1";
         m_dataPort = 9090;
     }
@@ -0,0 +1,309 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "remotesamplecodec.h"
+
+namespace {
+
+struct BitWriter
+{
+    uint8_t *m_out;
+    int m_size;
+    int m_pos;
+    uint64_t m_acc;
+    int m_nbBits;
+    bool m_overflow;
+
+    BitWriter(uint8_t *out, int size) :
+        m_out(out), m_size(size), m_pos(0), m_acc(0), m_nbBits(0), m_overflow(false)
+    {}
+
+    inline void put(uint32_t value, int n) // n <= 32
+    {
+        m_acc = (m_acc << n) | value;
+        m_nbBits += n;
+
+        while (m_nbBits >= 8)
+        {
+            m_nbBits -= 8;
+
+            if (m_pos < m_size) {
+                m_out[m_pos++] = (uint8_t) (m_acc >> m_nbBits);
+            } else {
+                m_overflow = true;
+            }
+        }
+    }
+
+    inline void putLong(uint64_t value, int n) // n <= 64
+    {
+        if (n > 32)
+        {
+            put((uint32_t) (value >> 32), n - 32);
+            put((uint32_t) value, 32);
+        }
+        else
+        {
+            put((uint32_t) value, n);
+        }
+    }
+
+    void flush()
+    {
+        if (m_nbBits > 0) {
+            put(0, 8 - m_nbBits);
+        }
+    }
+};
+
+struct BitReader
+{
+    const uint8_t *m_in;
+    int m_size;
+    int m_pos;
+    uint64_t m_acc;
+    int m_nbBits;
+    bool m_underflow;
+
+    BitReader(const uint8_t *in, int size) :
+        m_in(in), m_size(size), m_pos(0), m_acc(0), m_nbBits(0), m_underflow(false)
+    {}
+
+    inline uint32_t get(int n) // n <= 32
+    {
+        while (m_nbBits < n)
+        {
+            if (m_pos < m_size) {
+                m_acc = (m_acc << 8) | m_in[m_pos++];
+            } else {
+                m_acc <<= 8;
+                m_underflow = true;
+            }
+
+            m_nbBits += 8;
+        }
+
+        m_nbBits -= n;
+        return (uint32_t) ((m_acc >> m_nbBits) & ((1ULL << n) - 1));
+    }
+
+    inline uint64_t getLong(int n) // n <= 64
+    {
+        if (n > 32)
+        {
+            uint64_t hi = get(n - 32);
+            return (hi << 32) | get(32);
+        }
+        else
+        {
+            return get(n);
+        }
+    }
+};
+
+inline int64_t readComponent(const uint8_t *samples, int index, int sampleBytes)
+{
+    if (sampleBytes == 2)
+    {
+        int16_t v;
+        memcpy(&v, &samples[2*index], 2);
+        return v;
+    }
+    else
+    {
+        int32_t v;
+        memcpy(&v, &samples[4*index], 4);
+        return v;
+    }
+}
+
+inline void writeComponent(uint8_t *samples, int index, int sampleBytes, int64_t value)
+{
+    if (sampleBytes == 2)
+    {
+        int16_t v = value < INT16_MIN ? INT16_MIN : value > INT16_MAX ? INT16_MAX : value;
+        memcpy(&samples[2*index], &v, 2);
+    }
+    else
+    {
+        int32_t v = value < INT32_MIN ? INT32_MIN : value > INT32_MAX ? INT32_MAX : value;
+        memcpy(&samples[4*index], &v, 4);
+    }
+}
+
+inline int64_t predict(int order, int64_t p1, int64_t p2)
+{
+    return order == 0 ? 0 : order == 1 ? p1 : 2*p1 - p2;
+}
+
+} // namespace
+
+int RemoteSampleCodec::compress(const uint8_t *samples, int nbBytes, int sampleBytes, int lossBits, uint8_t *out, int outSize)
+{
+    if (((sampleBytes != 2) && (sampleBytes != 4)) || (lossBits < 0) || (lossBits > m_maxLossBits) || (outSize < m_headerSize)) {
+        return -1;
+    }
+
+    out[0] = m_version;
+    out[1] = sampleBytes;
+    out[2] = lossBits;
+    out[3] = 0;
+
+    BitWriter writer(&out[m_headerSize], outSize - m_headerSize);
+    int nbSamples = nbBytes / (2*sampleBytes);
+    int escapeBits = 8*sampleBytes + 3; // zigzag of order 2 residuals
+    int64_t half = lossBits == 0 ? 0 : 1LL << (lossBits - 1);
+    int64_t history[2][2] = {{0, 0}, {0, 0}}; // last two values of I and Q
+    int64_t values[m_chunkSize];
+    uint64_t residuals[m_chunkSize];
+
+    for (int start = 0; start < nbSamples; start += m_chunkSize)
+    {
+        int len = nbSamples - start < m_chunkSize ? nbSamples - start : m_chunkSize;
+
+        for (int c = 0; c < 2; c++)
+        {
+            int64_t& p1 = history[c][0];
+            int64_t& p2 = history[c][1];
+            uint64_t sums[3] = {0, 0, 0};
+            int64_t h1 = p1, h2 = p2;
+
+            for (int i = 0; i < len; i++)
+            {
+                int64_t v = (readComponent(samples, 2*(start + i) + c, sampleBytes) + half) >> lossBits;
+                values[i] = v;
+                sums[0] += v < 0 ? -v : v;
+                int64_t r1 = v - h1;
+                sums[1] += r1 < 0 ? -r1 : r1;
+                int64_t r2 = v - 2*h1 + h2;
+                sums[2] += r2 < 0 ? -r2 : r2;
+                h2 = h1;
+                h1 = v;
+            }
+
+            int order = sums[1] < sums[0] ? 1 : 0;
+            order = sums[2] < sums[order] ? 2 : order;
+            uint64_t sum = 0;
+
+            for (int i = 0; i < len; i++)
+            {
+                int64_t r = values[i] - predict(order, p1, p2);
+                residuals[i] = ((uint64_t) r << 1) ^ (uint64_t) (r >> 63); // zigzag
+                sum += residuals[i];
+                p2 = p1;
+                p1 = values[i];
+            }
+
+            int k = 0;
+
+            while ((k < 31) && (((uint64_t) len << (k + 1)) <= sum)) {
+                k++;
+            }
+
+            writer.put(order, 2);
+            writer.put(k, 5);
+
+            for (int i = 0; i < len; i++)
+            {
+                uint64_t q = residuals[i] >> k;
+
+                if (q < (uint64_t) m_maxUnary)
+                {
+                    writer.put(((1U << q) - 1) << 1, q + 1);
+                    writer.put((uint32_t) (residuals[i] & ((1ULL << k) - 1)), k);
+                }
+                else
+                {
+                    writer.put((1U << m_maxUnary) - 1, m_maxUnary);
+                    writer.putLong(residuals[i], escapeBits);
+                }
+            }
+        }
+
+        if (writer.m_overflow) {
+            return -1;
+        }
+    }
+
+    writer.flush();
+
+    if (writer.m_overflow) {
+        return -1;
+    }
+
+    return m_headerSize + writer.m_pos;
+}
+
+bool RemoteSampleCodec::decompress(const uint8_t *in, int inSize, uint8_t *samples, int nbBytes)
+{
+    if (inSize < m_headerSize) {
+        return false;
+    }
+
+    int sampleBytes = in[1];
+    int lossBits = in[2];
+
+    if ((in[0] != m_version) || ((sampleBytes != 2) && (sampleBytes != 4)) || (lossBits > m_maxLossBits)) {
+        return false;
+    }
+
+    BitReader reader(&in[m_headerSize], inSize - m_headerSize);
+    int nbSamples = nbBytes / (2*sampleBytes);
+    int escapeBits = 8*sampleBytes + 3;
+    int64_t history[2][2] = {{0, 0}, {0, 0}};
+
+    for (int start = 0; start < nbSamples; start += m_chunkSize)
+    {
+        int len = nbSamples - start < m_chunkSize ? nbSamples - start : m_chunkSize;
+
+        for (int c = 0; c < 2; c++)
+        {
+            int64_t& p1 = history[c][0];
+            int64_t& p2 = history[c][1];
+            int order = reader.get(2);
+            int k = reader.get(5);
+
+            if (order > 2) {
+                return false;
+            }
+
+            for (int i = 0; i < len; i++)
+            {
+                int q = 0;
+
+                while ((q < m_maxUnary) && reader.get(1)) {
+                    q++;
+                }
+
+                uint64_t u = q < m_maxUnary ? ((uint64_t) q << k) | reader.get(k) : reader.getLong(escapeBits);
+                int64_t v = (int64_t) (u >> 1) ^ -(int64_t) (u & 1);
+                v += predict(order, p1, p2);
+                writeComponent(samples, 2*(start + i) + c, sampleBytes, v * (1LL << lossBits));
+                p2 = p1;
+                p1 = v;
+            }
+        }
+
+        if (reader.m_underflow) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,57 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHANNEL_REMOTESAMPLECODEC_H_
+#define CHANNEL_REMOTESAMPLECODEC_H_
+
+#include <stdint.h>
+
+#include "export.h"
+
+/**
+ * Compression of the samples of a Remote Sink to Remote Input frame.
+ *
+ * I and Q are coded separately in chunks of samples. For each chunk the predictor of order
+ * 0 (none), 1 (delta) or 2 giving the smallest residuals is selected and residuals are
+ * Rice coded with a parameter adapted to the chunk. Optionally the given number of LSBs is
+ * rounded off before coding so that the error is bounded by half of the quantization step.
+ *
+ * The compressed stream starts with a 4 bytes header (version, sample bytes, loss bits, 0)
+ * so that it can be decompressed without the frame meta data.
+ */
+class SDRBASE_API RemoteSampleCodec
+{
+public:
+    /**
+     * Compress raw samples as they are laid out in the protected blocks (I/Q interleaved
+     * with sampleBytes (2 or 4) bytes per component). Returns the size of the compressed
+     * data or -1 if it does not fit in outSize bytes.
+     */
+    static int compress(const uint8_t *samples, int nbBytes, int sampleBytes, int lossBits, uint8_t *out, int outSize);
+    /** Decompress into nbBytes of raw samples. Returns false if the compressed data is corrupt. */
+    static bool decompress(const uint8_t *in, int inSize, uint8_t *samples, int nbBytes);
+
+    static const int m_headerSize = 4;
+    static const int m_maxLossBits = 12;
+
+private:
+    static const uint8_t m_version = 1;
+    static const int m_chunkSize = 64;   //!< number of samples of one component coded with the same parameters
+    static const int m_maxUnary = 16;    //!< quotients from this value are escaped with the full residual
+};
+
+#endif /* CHANNEL_REMOTESAMPLECODEC_H_ */
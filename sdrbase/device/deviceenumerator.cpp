@@ -16,8 +16,11 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QGlobalStatic>
+#include <QSettings>
+#include <QDataStream>
 
 #include "plugin/pluginmanager.h"
+#include "util/simpleserializer.h"
 
 #include "deviceenumerator.h"
 
@@ -27,6 +30,8 @@ DeviceEnumerator *DeviceEnumerator::instance()
     return deviceEnumerator;
 }
 
+const QString DeviceEnumerator::m_enumerationSettingsKey = "deviceEnumeration";
+
 DeviceEnumerator::DeviceEnumerator()
 {}
 
@@ -324,6 +329,196 @@ void DeviceEnumerator::enumerateMIMODevices(PluginManager *pluginManager)
     }
 }
 
+void DeviceEnumerator::saveEnumeration() const
+{
+    QSettings s;
+    s.setValue(m_enumerationSettingsKey, qCompress(serialize()).toBase64());
+}
+
+bool DeviceEnumerator::restoreEnumeration(PluginManager *pluginManager)
+{
+    QSettings s;
+
+    if (!s.contains(m_enumerationSettingsKey))
+    {
+        qDebug("DeviceEnumerator::restoreEnumeration: no saved enumeration");
+        return false;
+    }
+
+    if (!deserialize(pluginManager, qUncompress(QByteArray::fromBase64(s.value(m_enumerationSettingsKey).toByteArray()))))
+    {
+        qWarning("DeviceEnumerator::restoreEnumeration: saved enumeration does not match the plugins");
+        m_rxEnumeration.clear();
+        m_txEnumeration.clear();
+        m_mimoEnumeration.clear();
+        return false;
+    }
+
+    m_originDevices.clear();
+    m_originDevicesHwIds.clear();
+    probeUnrestorableDevices(pluginManager->getSourceDeviceRegistrations(), PluginInterface::SamplingDevice::StreamSingleRx, m_rxEnumeration);
+    probeUnrestorableDevices(pluginManager->getSinkDeviceRegistrations(), PluginInterface::SamplingDevice::StreamSingleTx, m_txEnumeration);
+    probeUnrestorableDevices(pluginManager->getMIMODeviceRegistrations(), PluginInterface::SamplingDevice::StreamMIMO, m_mimoEnumeration);
+
+    qDebug("DeviceEnumerator::restoreEnumeration: Rx: %d Tx: %d MIMO: %d",
+        (int) m_rxEnumeration.size(), (int) m_txEnumeration.size(), (int) m_mimoEnumeration.size());
+    return true;
+}
+
+void DeviceEnumerator::probeUnrestorableDevices(
+    const PluginAPI::SamplingDeviceRegistrations& registrations,
+    PluginInterface::SamplingDevice::StreamType streamType,
+    DevicesEnumeration& enumeration)
+{
+    // Devices of plugins that cannot use a saved enumeration are probed again in place of the saved
+    // ones. Plugins are taken in registration order like in a full enumeration.
+    DevicesEnumeration restored;
+    restored.swap(enumeration);
+
+    for (int i = 0; i < registrations.count(); i++)
+    {
+        PluginInterface *plugin = registrations[i].m_plugin;
+
+        if (plugin->canRestoreEnumeration())
+        {
+            for (const auto& device : restored)
+            {
+                if (device.m_samplingDevice.id == registrations[i].m_deviceId) {
+                    enumeration.push_back(DeviceEnumeration(device.m_samplingDevice, plugin, (int) enumeration.size()));
+                }
+            }
+
+            continue;
+        }
+
+        qDebug("DeviceEnumerator::probeUnrestorableDevices: %s", qPrintable(registrations[i].m_deviceId));
+        plugin->enumOriginDevices(m_originDevicesHwIds, m_originDevices);
+        PluginInterface::SamplingDevices samplingDevices;
+
+        if (streamType == PluginInterface::SamplingDevice::StreamSingleRx) {
+            samplingDevices = plugin->enumSampleSources(m_originDevices);
+        } else if (streamType == PluginInterface::SamplingDevice::StreamSingleTx) {
+            samplingDevices = plugin->enumSampleSinks(m_originDevices);
+        } else {
+            samplingDevices = plugin->enumSampleMIMO(m_originDevices);
+        }
+
+        for (int j = 0; j < samplingDevices.count(); j++) {
+            enumeration.push_back(DeviceEnumeration(samplingDevices[j], plugin, (int) enumeration.size()));
+        }
+    }
+}
+
+QByteArray DeviceEnumerator::serialize() const
+{
+    SimpleSerializer s(1);
+    QByteArray rxData, txData, mimoData;
+    QDataStream rxStream(&rxData, QIODevice::WriteOnly);
+    QDataStream txStream(&txData, QIODevice::WriteOnly);
+    QDataStream mimoStream(&mimoData, QIODevice::WriteOnly);
+    serializeEnumeration(rxStream, m_rxEnumeration);
+    serializeEnumeration(txStream, m_txEnumeration);
+    serializeEnumeration(mimoStream, m_mimoEnumeration);
+    s.writeBlob(1, rxData);
+    s.writeBlob(2, txData);
+    s.writeBlob(3, mimoData);
+    return s.final();
+}
+
+bool DeviceEnumerator::deserialize(PluginManager *pluginManager, const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid() || (d.getVersion() != 1)) {
+        return false;
+    }
+
+    QByteArray rxData, txData, mimoData;
+    d.readBlob(1, &rxData);
+    d.readBlob(2, &txData);
+    d.readBlob(3, &mimoData);
+    QDataStream rxStream(&rxData, QIODevice::ReadOnly);
+    QDataStream txStream(&txData, QIODevice::ReadOnly);
+    QDataStream mimoStream(&mimoData, QIODevice::ReadOnly);
+
+    return deserializeEnumeration(rxStream, pluginManager->getSourceDeviceRegistrations(), m_rxEnumeration)
+        && deserializeEnumeration(txStream, pluginManager->getSinkDeviceRegistrations(), m_txEnumeration)
+        && deserializeEnumeration(mimoStream, pluginManager->getMIMODeviceRegistrations(), m_mimoEnumeration);
+}
+
+void DeviceEnumerator::serializeEnumeration(QDataStream& stream, const DevicesEnumeration& enumeration)
+{
+    stream << (qint32) enumeration.size();
+
+    for (DevicesEnumeration::const_iterator it = enumeration.begin(); it != enumeration.end(); ++it)
+    {
+        const PluginInterface::SamplingDevice& device = it->m_samplingDevice;
+        stream << device.displayedName
+            << device.hardwareId
+            << device.id
+            << device.serial
+            << (qint32) device.sequence
+            << (qint32) device.type
+            << (qint32) device.streamType
+            << (qint32) device.deviceNbItems
+            << (qint32) device.deviceItemIndex;
+    }
+}
+
+bool DeviceEnumerator::deserializeEnumeration(
+    QDataStream& stream,
+    const PluginAPI::SamplingDeviceRegistrations& registrations,
+    DevicesEnumeration& enumeration)
+{
+    qint32 count;
+    stream >> count;
+    enumeration.clear();
+
+    for (int index = 0; (index < count) && (stream.status() == QDataStream::Ok); index++)
+    {
+        QString displayedName, hardwareId, id, serial;
+        qint32 sequence, type, streamType, deviceNbItems, deviceItemIndex;
+        stream >> displayedName >> hardwareId >> id >> serial >> sequence >> type >> streamType >> deviceNbItems >> deviceItemIndex;
+        PluginInterface *plugin = nullptr;
+
+        // the sampling device id is the id the plugin registered with
+        for (int i = 0; i < registrations.count(); i++)
+        {
+            if (registrations[i].m_deviceId == id)
+            {
+                plugin = registrations[i].m_plugin;
+                break;
+            }
+        }
+
+        if (!plugin)
+        {
+            qDebug("DeviceEnumerator::deserializeEnumeration: no plugin for %s", qPrintable(id));
+            return false;
+        }
+
+        enumeration.push_back(
+            DeviceEnumeration(
+                PluginInterface::SamplingDevice(
+                    displayedName,
+                    hardwareId,
+                    id,
+                    serial,
+                    sequence,
+                    (PluginInterface::SamplingDevice::SamplingDeviceType) type,
+                    (PluginInterface::SamplingDevice::StreamType) streamType,
+                    deviceNbItems,
+                    deviceItemIndex
+                ),
+                plugin,
+                index
+            )
+        );
+    }
+
+    return stream.status() == QDataStream::Ok;
+}
+
 void DeviceEnumerator::listRxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const
 {
     for (DevicesEnumeration::const_iterator it = m_rxEnumeration.begin(); it != m_rxEnumeration.end(); ++it)
@@ -21,9 +21,11 @@
 #include <vector>
 
 #include "plugin/plugininterface.h"
+#include "plugin/pluginapi.h"
 #include "device/deviceuserargs.h"
 #include "export.h"
 
+class QDataStream;
 class PluginManager;
 
 class SDRBASE_API DeviceEnumerator
@@ -38,6 +40,8 @@ public:
     void enumerateTxDevices(PluginManager *pluginManager);
     void enumerateMIMODevices(PluginManager *pluginManager);
     void addNonDiscoverableDevices(PluginManager *pluginManager, const DeviceUserArgs& deviceUserArgs);
+    void saveEnumeration() const;                            //!< Persist the current enumeration in the settings
+    bool restoreEnumeration(PluginManager *pluginManager);   //!< Enumerate from the persisted enumeration without probing hardware
     void listRxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void listTxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void listMIMODeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
@@ -85,6 +89,21 @@ private:
     PluginInterface::OriginDevices m_originDevices;
     QStringList m_originDevicesHwIds;
 
+    static const QString m_enumerationSettingsKey;
+
+    QByteArray serialize() const;
+    bool deserialize(PluginManager *pluginManager, const QByteArray& data);
+    static void serializeEnumeration(QDataStream& stream, const DevicesEnumeration& enumeration);
+    void probeUnrestorableDevices(
+        const PluginAPI::SamplingDeviceRegistrations& registrations,
+        PluginInterface::SamplingDevice::StreamType streamType,
+        DevicesEnumeration& enumeration
+    );
+    static bool deserializeEnumeration(
+        QDataStream& stream,
+        const PluginAPI::SamplingDeviceRegistrations& registrations,
+        DevicesEnumeration& enumeration
+    );
     PluginInterface *getRxRegisteredPlugin(PluginManager *pluginManager, const QString& deviceHwId);
     PluginInterface *getTxRegisteredPlugin(PluginManager *pluginManager, const QString& deviceHwId);
     PluginInterface *getMIMORegisteredPlugin(PluginManager *pluginManager, const QString& deviceHwId);
@@ -17,9 +17,13 @@
 
 #include <algorithm>
 
+#include "SWGSpectrumAnalyzers.h"
+#include "SWGSuccessResponse.h"
+
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/spectrumvis.h"
+#include "dsp/spectrumanalyzers.h"
 #include "plugin/pluginapi.h"
 #include "plugin/plugininterface.h"
 #include "settings/preset.h"
@@ -39,15 +43,24 @@ DeviceSet::DeviceSet(int tabIndex, int deviceType)
     m_deviceMIMOEngine = nullptr;
     m_deviceTabIndex = tabIndex;
 
-    if ((deviceType == 0) || (deviceType == 2)) { // Single Rx or MIMO
+    if ((deviceType == 0) || (deviceType == 2)) // Single Rx or MIMO
+    {
         m_spectrumVis = new SpectrumVis(SDR_RX_SCALEF);
-    } else if (deviceType == 1) { // Single Tx
+        m_spectrumAnalyzers = new SpectrumAnalyzers(m_spectrumVis, SDR_RX_SCALEF);
+    }
+    else if (deviceType == 1) // Single Tx
+    {
         m_spectrumVis = new SpectrumVis(SDR_TX_SCALEF);
+        m_spectrumAnalyzers = new SpectrumAnalyzers(m_spectrumVis, SDR_TX_SCALEF);
     }
+
+    m_spectrumVis->setAnalyzers(m_spectrumAnalyzers);
 }
 
 DeviceSet::~DeviceSet()
 {
+    m_spectrumVis->setAnalyzers(nullptr);
+    delete m_spectrumAnalyzers;
     delete m_spectrumVis;
 }
 
@@ -490,6 +503,177 @@ int DeviceSet::webapiSpectrumServerDelete(SWGSDRangel::SWGSuccessResponse& respo
     return m_spectrumVis->webapiSpectrumServerDelete(response, errorMessage);
 }
 
+int DeviceSet::webapiSpectrumAnalyzersGet(SWGSDRangel::SWGSpectrumAnalyzers& response, QString& errorMessage) const
+{
+    QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex());
+    int nbAnalyzers = m_spectrumAnalyzers->getNbAnalyzers();
+    response.setCount(nbAnalyzers);
+    response.setAnalyzers(new QList<SWGSDRangel::SWGGLSpectrum*>);
+
+    for (int i = 0; i < nbAnalyzers; i++)
+    {
+        response.getAnalyzers()->append(new SWGSDRangel::SWGGLSpectrum);
+        response.getAnalyzers()->back()->init();
+        int status = webapiSpectrumAnalyzerSettingsGet(i, *response.getAnalyzers()->back(), errorMessage);
+
+        if (status != 200) {
+            return status;
+        }
+    }
+
+    return 200;
+}
+
+int DeviceSet::webapiSpectrumAnalyzersPost(
+    const QStringList& spectrumSettingsKeys,
+    SWGSDRangel::SWGGLSpectrum& query,
+    SWGSDRangel::SWGSpectrumAnalyzers& response,
+    QString& errorMessage)
+{
+    const SpectrumVis *spectrumVis;
+    int status;
+
+    {
+        QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex());
+        int analyzerIndex = m_spectrumAnalyzers->addAnalyzer();
+        spectrumVis = m_spectrumAnalyzers->getAnalyzer(analyzerIndex);
+        QStringList keys(spectrumSettingsKeys);
+
+        if (!keys.contains("wsSpectrumPort")) // do not clash with the main spectrum or the other analyzers
+        {
+            query.setWsSpectrumPort(m_spectrumAnalyzers->getFreeWSSpectrumPort(m_spectrumVis->getSettings().m_wsSpectrumPort));
+            keys.append("wsSpectrumPort");
+        }
+
+        status = webapiSpectrumAnalyzerSettingsPutPatch(analyzerIndex, true, keys, query, errorMessage);
+    }
+
+    if (status != 200)
+    {
+        m_spectrumAnalyzers->removeAnalyzer(spectrumVis); // by identity as indexes may have moved since the lock was released
+        return status;
+    }
+
+    return webapiSpectrumAnalyzersGet(response, errorMessage);
+}
+
+int DeviceSet::webapiSpectrumAnalyzerDelete(int analyzerIndex, SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage)
+{
+    if (!m_spectrumAnalyzers->removeAnalyzer(analyzerIndex))
+    {
+        errorMessage = QString("There is no spectrum analyzer with index %1").arg(analyzerIndex);
+        return 404;
+    }
+
+    response.setMessage(new QString(QString("Spectrum analyzer %1 removed").arg(analyzerIndex)));
+    return 200;
+}
+
+int DeviceSet::webapiSpectrumAnalyzerSettingsGet(int analyzerIndex, SWGSDRangel::SWGGLSpectrum& response, QString& errorMessage) const
+{
+    QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex()); // keeps the analyzer alive
+    const SpectrumVis *spectrumVis = m_spectrumAnalyzers->getAnalyzer(analyzerIndex);
+    unsigned int log2Zoom;
+    float zoomPos;
+
+    if (!spectrumVis || !m_spectrumAnalyzers->getZoom(analyzerIndex, log2Zoom, zoomPos))
+    {
+        errorMessage = QString("There is no spectrum analyzer with index %1").arg(analyzerIndex);
+        return 404;
+    }
+
+    int status = spectrumVis->webapiSpectrumSettingsGet(response, errorMessage);
+    response.setZoomLog2(log2Zoom);
+    response.setZoomPosition(zoomPos);
+
+    return status;
+}
+
+int DeviceSet::webapiSpectrumAnalyzerSettingsPutPatch(
+    int analyzerIndex,
+    bool force,
+    const QStringList& spectrumSettingsKeys,
+    SWGSDRangel::SWGGLSpectrum& response, // query + response
+    QString& errorMessage)
+{
+    QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex()); // keeps the analyzer alive
+    SpectrumVis *spectrumVis = m_spectrumAnalyzers->getAnalyzer(analyzerIndex);
+    unsigned int log2Zoom;
+    float zoomPos;
+
+    if (!spectrumVis || !m_spectrumAnalyzers->getZoom(analyzerIndex, log2Zoom, zoomPos))
+    {
+        errorMessage = QString("There is no spectrum analyzer with index %1").arg(analyzerIndex);
+        return 404;
+    }
+
+    if (spectrumSettingsKeys.contains("zoomLog2")) {
+        log2Zoom = response.getZoomLog2() < 0 ? 0 : response.getZoomLog2();
+    } else if (force) {
+        log2Zoom = 0;
+    }
+    if (spectrumSettingsKeys.contains("zoomPosition")) {
+        zoomPos = response.getZoomPosition();
+    } else if (force) {
+        zoomPos = 0.5f;
+    }
+
+    m_spectrumAnalyzers->setZoom(analyzerIndex, log2Zoom, zoomPos);
+    int status = spectrumVis->webapiSpectrumSettingsPutPatch(force, spectrumSettingsKeys, response, errorMessage);
+
+    if (status == 200) {
+        m_spectrumAnalyzers->setWSSpectrumPort(analyzerIndex, response.getWsSpectrumPort());
+    }
+
+    m_spectrumAnalyzers->getZoom(analyzerIndex, log2Zoom, zoomPos); // as clamped
+    response.setZoomLog2(log2Zoom);
+    response.setZoomPosition(zoomPos);
+
+    return status;
+}
+
+int DeviceSet::webapiSpectrumAnalyzerServerGet(int analyzerIndex, SWGSDRangel::SWGSpectrumServer& response, QString& errorMessage) const
+{
+    QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex()); // keeps the analyzer alive
+    const SpectrumVis *spectrumVis = m_spectrumAnalyzers->getAnalyzer(analyzerIndex);
+
+    if (!spectrumVis)
+    {
+        errorMessage = QString("There is no spectrum analyzer with index %1").arg(analyzerIndex);
+        return 404;
+    }
+
+    return spectrumVis->webapiSpectrumServerGet(response, errorMessage);
+}
+
+int DeviceSet::webapiSpectrumAnalyzerServerPost(int analyzerIndex, SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage)
+{
+    QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex()); // keeps the analyzer alive
+    SpectrumVis *spectrumVis = m_spectrumAnalyzers->getAnalyzer(analyzerIndex);
+
+    if (!spectrumVis)
+    {
+        errorMessage = QString("There is no spectrum analyzer with index %1").arg(analyzerIndex);
+        return 404;
+    }
+
+    return spectrumVis->webapiSpectrumServerPost(response, errorMessage);
+}
+
+int DeviceSet::webapiSpectrumAnalyzerServerDelete(int analyzerIndex, SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage)
+{
+    QMutexLocker analyzersLocker(m_spectrumAnalyzers->getMutex()); // keeps the analyzer alive
+    SpectrumVis *spectrumVis = m_spectrumAnalyzers->getAnalyzer(analyzerIndex);
+
+    if (!spectrumVis)
+    {
+        errorMessage = QString("There is no spectrum analyzer with index %1").arg(analyzerIndex);
+        return 404;
+    }
+
+    return spectrumVis->webapiSpectrumServerDelete(response, errorMessage);
+}
+
 void DeviceSet::addChannelInstance(ChannelAPI *channelAPI)
 {
     MainCore *mainCore = MainCore::instance();
@@ -30,9 +30,11 @@ class PluginAPI;
 class ChannelAPI;
 class Preset;
 class SpectrumVis;
+class SpectrumAnalyzers;
 
 namespace SWGSDRangel {
     class SWGGLSpectrum;
+    class SWGSpectrumAnalyzers;
     class SWGSpectrumServer;
     class SWGSuccessResponse;
 };
@@ -45,6 +47,7 @@ public:
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DSPDeviceMIMOEngine *m_deviceMIMOEngine;
     SpectrumVis *m_spectrumVis;
+    SpectrumAnalyzers *m_spectrumAnalyzers; //!< additional spectrums fed by m_spectrumVis
 
     DeviceSet(int tabIndex, int deviceType);
     ~DeviceSet();
@@ -80,6 +83,23 @@ public:
     int webapiSpectrumServerGet(SWGSDRangel::SWGSpectrumServer& response, QString& errorMessage) const;
     int webapiSpectrumServerPost(SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage);
     int webapiSpectrumServerDelete(SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage);
+    int webapiSpectrumAnalyzersGet(SWGSDRangel::SWGSpectrumAnalyzers& response, QString& errorMessage) const;
+    int webapiSpectrumAnalyzersPost(
+            const QStringList& spectrumSettingsKeys,
+            SWGSDRangel::SWGGLSpectrum& query,
+            SWGSDRangel::SWGSpectrumAnalyzers& response,
+            QString& errorMessage);
+    int webapiSpectrumAnalyzerDelete(int analyzerIndex, SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage);
+    int webapiSpectrumAnalyzerSettingsGet(int analyzerIndex, SWGSDRangel::SWGGLSpectrum& response, QString& errorMessage) const;
+    int webapiSpectrumAnalyzerSettingsPutPatch(
+            int analyzerIndex,
+            bool force,
+            const QStringList& spectrumSettingsKeys,
+            SWGSDRangel::SWGGLSpectrum& response, // query + response
+            QString& errorMessage);
+    int webapiSpectrumAnalyzerServerGet(int analyzerIndex, SWGSDRangel::SWGSpectrumServer& response, QString& errorMessage) const;
+    int webapiSpectrumAnalyzerServerPost(int analyzerIndex, SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage);
+    int webapiSpectrumAnalyzerServerDelete(int analyzerIndex, SWGSDRangel::SWGSuccessResponse& response, QString& errorMessage);
 
 private:
     typedef QList<ChannelAPI*> ChannelInstanceRegistrations;
@@ -0,0 +1,453 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <algorithm>
+
+#include <QtGlobal>
+#include <QDebug>
+#include <QThread>
+#include <QElapsedTimer>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#include <malloc.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
+#include "asyncfilewriter.h"
+
+const unsigned int AsyncFileWriter::m_defaultNbBuffers = 16;
+const unsigned int AsyncFileWriter::m_defaultBufferSize = 1<<20;
+const std::size_t AsyncFileWriter::m_alignment = 4096;
+const quint64 AsyncFileWriter::m_preallocationSize = 64<<20;
+const qint64 AsyncFileWriter::m_flushIntervalMs = 1000;
+
+class AsyncFileWriter::IOThread : public QThread
+{
+public:
+    IOThread(AsyncFileWriter *writer) : m_writer(writer) {}
+
+protected:
+    virtual void run() override { m_writer->run(); }
+
+private:
+    AsyncFileWriter *m_writer;
+};
+
+AsyncFileWriter::AsyncFileWriter(unsigned int nbBuffers, unsigned int bufferSize) :
+    m_bufferSize(((bufferSize + m_alignment - 1) / m_alignment) * m_alignment),
+    m_fd(-1),
+    m_direct(false),
+    m_size(0),
+    m_initialSize(0),
+    m_current(-1),
+    m_tail(nullptr),
+    m_tailFill(0),
+    m_stop(false),
+    m_thread(nullptr),
+    m_allocatedSize(0),
+    m_preallocate(false),
+    m_error(false),
+    m_writtenBytes(0),
+    m_latencyTotalUs(0),
+    m_nbWrites(0),
+    m_latencyMaxUs(0),
+    m_droppedBytes(0)
+{
+    m_buffers.resize(std::max(nbBuffers, 2U), Buffer{nullptr, 0, 0});
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    close();
+
+    for (auto& buffer : m_buffers) {
+        freeAligned(buffer.m_data);
+    }
+
+    freeAligned(m_tail);
+}
+
+char *AsyncFileWriter::allocateAligned(std::size_t size)
+{
+#ifdef Q_OS_WIN
+    return (char *) _aligned_malloc(size, m_alignment);
+#else
+    void *p;
+    return posix_memalign(&p, m_alignment, size) == 0 ? (char *) p : nullptr;
+#endif
+}
+
+void AsyncFileWriter::freeAligned(char *p)
+{
+#ifdef Q_OS_WIN
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+bool AsyncFileWriter::open(const QString& fileName, bool append)
+{
+    close();
+
+    if (!m_tail) // allocated on first use as most records are never started
+    {
+        for (auto& buffer : m_buffers) {
+            buffer.m_data = allocateAligned(m_bufferSize);
+        }
+
+        m_tail = allocateAligned(m_alignment);
+    }
+
+    m_fileName = fileName;
+    m_direct = false;
+    QByteArray name = fileName.toLocal8Bit();
+#ifdef Q_OS_WIN
+    int flags = _O_RDWR | _O_CREAT | _O_BINARY | (append ? 0 : _O_TRUNC);
+    m_fd = _open(name.constData(), flags, _S_IREAD | _S_IWRITE);
+#else
+    int flags = O_RDWR | O_CREAT | (append ? 0 : O_TRUNC);
+#ifdef O_DIRECT
+    m_fd = ::open(name.constData(), flags | O_DIRECT, 0644);
+    m_direct = m_fd >= 0;
+#endif
+    if (m_fd < 0) { // no O_DIRECT support on this file system
+        m_fd = ::open(name.constData(), flags, 0644);
+    }
+#endif
+
+    if (m_fd < 0)
+    {
+        qWarning("AsyncFileWriter::open: cannot open %s: %s", qPrintable(fileName), strerror(errno));
+        return false;
+    }
+
+#ifdef Q_OS_WIN
+    struct _stat64 fileStat;
+    m_size = _fstat64(m_fd, &fileStat) == 0 ? fileStat.st_size : 0;
+#else
+    struct stat fileStat;
+    m_size = fstat(m_fd, &fileStat) == 0 ? fileStat.st_size : 0;
+#endif
+    m_initialSize = m_size;
+    m_tailFill = 0;
+
+#ifndef Q_OS_WIN
+    if (m_direct && (m_size % m_alignment != 0)) // the last partial page is rewritten with the new data
+    {
+        quint64 offset = m_size - (m_size % m_alignment);
+        memset(m_tail, 0, m_alignment);
+
+        if (pread(m_fd, m_tail, m_alignment, offset) < 0)
+        {
+            qWarning("AsyncFileWriter::open: cannot read the end of %s: %s", qPrintable(fileName), strerror(errno));
+            ::close(m_fd);
+            m_fd = -1;
+            return false;
+        }
+
+        m_tailFill = m_size - offset;
+    }
+#endif
+
+    m_allocatedSize = m_size;
+#ifdef Q_OS_LINUX
+    m_preallocate = true;
+#endif
+    m_error = false;
+    m_writtenBytes = 0;
+    m_latencyTotalUs = 0;
+    m_nbWrites = 0;
+    m_latencyMaxUs = 0;
+    m_droppedBytes = 0;
+    m_pending.clear();
+    m_free.clear();
+
+    for (int i = m_buffers.size() - 1; i >= 0; i--) {
+        m_free.push_back(i);
+    }
+
+    m_current = -1;
+    m_stop = false;
+    m_flushTimer.start();
+    m_thread = new IOThread(this);
+    m_thread->start(QThread::HighPriority);
+
+    qDebug("AsyncFileWriter::open: %s size: %llu direct: %s",
+        qPrintable(fileName), m_size, m_direct ? "yes" : "no");
+    return true;
+}
+
+bool AsyncFileWriter::close()
+{
+    if (m_fd < 0) {
+        return true;
+    }
+
+    flush();
+    m_mutex.lock();
+    m_stop = true;
+    m_queued.wakeOne();
+    m_mutex.unlock();
+    m_thread->wait();
+    delete m_thread;
+    m_thread = nullptr;
+    m_current = -1;
+
+    // remove the padding of the last direct write and the preallocated space
+#ifdef Q_OS_WIN
+    bool truncated = _chsize_s(m_fd, m_size) == 0;
+    _close(m_fd);
+#else
+    bool truncated = ftruncate(m_fd, m_size) == 0;
+    ::close(m_fd);
+#endif
+    m_fd = -1;
+
+    if (!truncated)
+    {
+        qWarning("AsyncFileWriter::close: cannot set size of %s", qPrintable(m_fileName));
+        m_error = true;
+    }
+
+    qDebug("AsyncFileWriter::close: %s size: %llu dropped: %llu",
+        qPrintable(m_fileName), m_size, m_droppedBytes.load());
+    return !m_error.load();
+}
+
+bool AsyncFileWriter::acquireBuffer()
+{
+    int index;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (m_free.empty()) {
+            return false;
+        }
+
+        index = m_free.back();
+        m_free.pop_back();
+    }
+
+    Buffer& buffer = m_buffers[index];
+    buffer.m_offset = m_size - m_tailFill; // aligned in direct mode
+    buffer.m_fill = m_tailFill;
+
+    if (m_tailFill != 0)
+    {
+        memcpy(buffer.m_data, m_tail, m_tailFill);
+        m_tailFill = 0;
+    }
+
+    m_current = index;
+    return true;
+}
+
+void AsyncFileWriter::submitCurrent()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_pending.push_back(m_current);
+    m_current = -1;
+    m_queued.wakeOne();
+    m_flushTimer.start();
+}
+
+bool AsyncFileWriter::write(const char *data, std::size_t size)
+{
+    if (m_fd < 0) {
+        return false;
+    }
+
+    std::size_t available = m_current < 0 ? 0 : m_bufferSize - m_buffers[m_current].m_fill;
+
+    if (size > available)
+    {
+        std::size_t needed = (size - available + m_tailFill + m_bufferSize - 1) / m_bufferSize;
+        m_mutex.lock();
+        bool dropped = m_free.size() < needed;
+        m_mutex.unlock();
+
+        if (dropped)
+        {
+            m_droppedBytes += size;
+            return false;
+        }
+    }
+
+    while (size > 0)
+    {
+        if (m_current < 0) {
+            acquireBuffer(); // cannot fail: checked above and the I/O thread only releases buffers
+        }
+
+        Buffer& buffer = m_buffers[m_current];
+        std::size_t chunk = std::min(size, m_bufferSize - buffer.m_fill);
+        memcpy(buffer.m_data + buffer.m_fill, data, chunk);
+        buffer.m_fill += chunk;
+        data += chunk;
+        size -= chunk;
+        m_size += chunk;
+
+        if (buffer.m_fill == m_bufferSize) {
+            submitCurrent();
+        }
+    }
+
+    if (m_flushTimer.hasExpired(m_flushIntervalMs)) { // time based flush for low rate streams
+        flush();
+    }
+
+    return true;
+}
+
+void AsyncFileWriter::flush()
+{
+    if ((m_current < 0) || (m_buffers[m_current].m_fill == 0)) {
+        return;
+    }
+
+    const Buffer& buffer = m_buffers[m_current];
+
+    if (m_direct) // the partial page written with padding is rewritten by the next buffer
+    {
+        m_tailFill = (buffer.m_offset + buffer.m_fill) % m_alignment;
+        memcpy(m_tail, buffer.m_data + buffer.m_fill - m_tailFill, m_tailFill);
+    }
+
+    submitCurrent();
+}
+
+void AsyncFileWriter::getStatistics(Statistics& statistics) const
+{
+    quint32 nbWrites = m_nbWrites.load();
+    statistics.m_writtenBytes = m_writtenBytes.load();
+    statistics.m_droppedBytes = m_droppedBytes.load();
+    statistics.m_latencyAverageUs = nbWrites == 0 ? 0 : m_latencyTotalUs.load() / nbWrites;
+    statistics.m_latencyMaxUs = m_latencyMaxUs.load();
+    statistics.m_direct = m_direct;
+}
+
+void AsyncFileWriter::run()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (true)
+    {
+        while (m_pending.empty() && !m_stop) {
+            m_queued.wait(&m_mutex);
+        }
+
+        if (m_pending.empty()) { // stopped and everything written
+            break;
+        }
+
+        int index = m_pending.front();
+        m_pending.pop_front();
+        mutexLocker.unlock();
+        writeBuffer(m_buffers[index]);
+        mutexLocker.relock();
+        m_free.push_back(index);
+    }
+}
+
+void AsyncFileWriter::writeBuffer(Buffer& buffer)
+{
+    if (m_error.load()) { // do not insist
+        return;
+    }
+
+    std::size_t size = buffer.m_fill;
+
+    if (m_direct)
+    {
+        size = ((size + m_alignment - 1) / m_alignment) * m_alignment;
+        memset(buffer.m_data + buffer.m_fill, 0, size - buffer.m_fill);
+    }
+
+    preallocate(buffer.m_offset + size);
+    QElapsedTimer timer;
+    timer.start();
+    const char *data = buffer.m_data;
+    quint64 offset = buffer.m_offset;
+    std::size_t remainder = size;
+
+    while (remainder > 0)
+    {
+#ifdef Q_OS_WIN
+        long long written = _lseeki64(m_fd, offset, SEEK_SET) < 0 ? -1 : _write(m_fd, data, remainder);
+#else
+        ssize_t written = pwrite(m_fd, data, remainder, offset);
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            qWarning("AsyncFileWriter::writeBuffer: error writing to %s: %s", qPrintable(m_fileName), strerror(errno));
+            m_error = true;
+            return;
+        }
+
+        data += written;
+        offset += written;
+        remainder -= written;
+    }
+
+    quint32 latencyUs = timer.nsecsElapsed() / 1000;
+    m_latencyTotalUs += latencyUs;
+    m_nbWrites++;
+
+    if (latencyUs > m_latencyMaxUs.load()) {
+        m_latencyMaxUs = latencyUs;
+    }
+
+    m_writtenBytes = buffer.m_offset + buffer.m_fill - m_initialSize;
+}
+
+void AsyncFileWriter::preallocate(quint64 end)
+{
+#ifdef Q_OS_LINUX
+    if (!m_preallocate || (end <= m_allocatedSize)) {
+        return;
+    }
+
+    // reserve the blocks without changing the file size: close() trims what is not used
+    if (fallocate(m_fd, FALLOC_FL_KEEP_SIZE, m_allocatedSize, end - m_allocatedSize + m_preallocationSize) == 0)
+    {
+        m_allocatedSize = end + m_preallocationSize;
+    }
+    else
+    {
+        qDebug("AsyncFileWriter::preallocate: not supported for %s: %s", qPrintable(m_fileName), strerror(errno));
+        m_preallocate = false;
+    }
+#else
+    (void) end;
+#endif
+}
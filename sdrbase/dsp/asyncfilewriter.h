@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_ASYNCFILEWRITER_H_
+#define SDRBASE_DSP_ASYNCFILEWRITER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <deque>
+
+#include <QString>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+
+#include "export.h"
+
+class QThread;
+
+/**
+ * Sequential file writer that takes disk I/O out of the DSP threads. Data is copied into
+ * a fixed set of page aligned buffers that a dedicated thread writes to disk with pwrite
+ * (O_DIRECT when the file system supports it). The file is preallocated ahead of the
+ * write position. The producer never waits on the disk: when all buffers are in flight
+ * a write is dropped as a whole (so that sample boundaries are kept) and accounted for.
+ * A partially filled buffer is handed to the I/O thread at least every m_flushIntervalMs
+ * so that a slow stream still reaches the disk regularly. Only one producer thread is supported.
+ */
+class SDRBASE_API AsyncFileWriter
+{
+public:
+    struct Statistics
+    {
+        quint64 m_writtenBytes;     //!< bytes committed to disk
+        quint64 m_droppedBytes;     //!< bytes dropped because no buffer was available
+        quint32 m_latencyAverageUs; //!< average duration of a buffer write
+        quint32 m_latencyMaxUs;     //!< longest buffer write
+        bool m_direct;              //!< file is opened with O_DIRECT
+
+        Statistics() :
+            m_writtenBytes(0),
+            m_droppedBytes(0),
+            m_latencyAverageUs(0),
+            m_latencyMaxUs(0),
+            m_direct(false)
+        {}
+    };
+
+    AsyncFileWriter(unsigned int nbBuffers = m_defaultNbBuffers, unsigned int bufferSize = m_defaultBufferSize);
+    ~AsyncFileWriter();
+
+    bool open(const QString& fileName, bool append = false); //!< append keeps the existing content
+    bool close();                                //!< writes pending data and returns false if an error occurred
+    bool isOpen() const { return m_fd >= 0; }
+    bool write(const char *data, std::size_t size); //!< returns false if the data was dropped
+    void flush();                                //!< hands the data written so far to the I/O thread
+    bool hasError() const { return m_error.load(); }
+    quint64 getSize() const { return m_size; }   //!< logical file size including data not yet on disk
+    void getStatistics(Statistics& statistics) const;
+
+    static const unsigned int m_defaultNbBuffers;
+    static const unsigned int m_defaultBufferSize;
+    static const std::size_t m_alignment;        //!< O_DIRECT offset, size and memory alignment
+    static const quint64 m_preallocationSize;
+    static const qint64 m_flushIntervalMs;       //!< longest time data written stays in the current buffer
+
+private:
+    class IOThread;
+
+    struct Buffer
+    {
+        char *m_data;
+        std::size_t m_fill;
+        quint64 m_offset;  //!< file offset of the first byte
+    };
+
+    std::vector<Buffer> m_buffers;
+    std::size_t m_bufferSize;
+    int m_fd;
+    bool m_direct;
+    quint64 m_size;
+    quint64 m_initialSize;         //!< size of an appended file when opened
+    int m_current;                 //!< buffer being filled or -1 if none available
+    char *m_tail;                  //!< last partial page already written in direct mode
+    std::size_t m_tailFill;
+    QString m_fileName;
+
+    // shared with the I/O thread
+    QMutex m_mutex;
+    QWaitCondition m_queued;       //!< wakes the I/O thread
+    std::deque<int> m_pending;     //!< buffers to write in order
+    std::vector<int> m_free;
+    bool m_stop;
+    IOThread *m_thread;
+
+    // written by the I/O thread
+    quint64 m_allocatedSize;
+    bool m_preallocate;
+    std::atomic<bool> m_error;
+    std::atomic<quint64> m_writtenBytes;
+    std::atomic<quint64> m_latencyTotalUs;
+    std::atomic<quint32> m_nbWrites;
+    std::atomic<quint32> m_latencyMaxUs;
+
+    // written by the producer
+    std::atomic<quint64> m_droppedBytes;
+    QElapsedTimer m_flushTimer;    //!< time since the last buffer was handed to the I/O thread
+
+    void submitCurrent();
+    bool acquireBuffer();
+    void run();
+    void writeBuffer(Buffer& buffer);
+    void preallocate(quint64 end);
+    static char *allocateAligned(std::size_t size);
+    static void freeAligned(char *p);
+};
+
+#endif // SDRBASE_DSP_ASYNCFILEWRITER_H_
@@ -19,7 +19,8 @@
 
 #include "basebandsamplesink.h"
 
-BasebandSampleSink::BasebandSampleSink()
+BasebandSampleSink::BasebandSampleSink() :
+    m_subbandRequestChanged(1)
 {
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
 }
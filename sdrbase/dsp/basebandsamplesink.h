@@ -20,11 +20,13 @@
 #define INCLUDE_SAMPLESINK_H
 
 #include <QObject>
+#include <QAtomicInt>
 #include "dsp/dsptypes.h"
 #include "export.h"
 #include "util/messagequeue.h"
 
 class Message;
+class SampleSinkRingReader;
 
 class SDRBASE_API BasebandSampleSink : public QObject {
 	Q_OBJECT
@@ -45,9 +47,40 @@ public:
         (void) length;
     }
 
+    virtual bool setSampleRingReader(SampleSinkRingReader *reader) //!< Attach (or detach with nullptr) a shared ring read cursor. Returns true if supported.
+    {
+        (void) reader;
+        return false;
+    }
+
+    virtual bool getSubbandRequest(qint64& frequencyOffset, int& bandwidth) //!< Channel that could be fed from a polyphase channelizer sub-band. Returns true if supported.
+    {
+        (void) frequencyOffset;
+        (void) bandwidth;
+        return false;
+    }
+
+    virtual void setSubband(int sampleRate, qint64 frequencyOffset) //!< Samples fed are now those of the sub-band at this rate and offset (rate 0: back to full baseband)
+    {
+        (void) sampleRate;
+        (void) frequencyOffset;
+    }
+
+    virtual bool canSkipBlocks() const //!< Blocks may be skipped when the sink falls behind. False for sinks that record or forward every sample.
+    {
+        return true;
+    }
+
+    bool takeSubbandRequestChanged() { return m_subbandRequestChanged.fetchAndStoreOrdered(0) != 0; } //!< True if getSubbandRequest may return something new since last call
+
 protected:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
 
+    void setSubbandRequestChanged() { m_subbandRequestChanged.storeRelease(1); } //!< To be called when the values of getSubbandRequest change
+
+private:
+    QAtomicInt m_subbandRequestChanged;
+
 protected slots:
 	void handleInputMessages();
 };
@@ -0,0 +1,227 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "dsp/basebandsamplesink.h"
+#include "basebandsinkdispatcher.h"
+
+const unsigned int BasebandSinkDispatcher::m_maxSkipBlocks = 16;
+const qint64 BasebandSinkDispatcher::m_logIntervalMs = 1000;
+
+BasebandSinkDispatcher::FeedTask::FeedTask(BasebandSampleSink *sink, QSemaphore *done) :
+    m_sink(sink),
+    m_positiveOnly(false),
+    m_done(done),
+    m_skipBlocks(0),
+    m_canSkip(sink->canSkipBlocks()),
+    m_scheduled(false)
+{
+    setAutoDelete(false);
+    resetStats();
+}
+
+void BasebandSinkDispatcher::FeedTask::setBlock(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    m_begin = begin;
+    m_end = end;
+    m_positiveOnly = positiveOnly;
+}
+
+void BasebandSinkDispatcher::FeedTask::resetStats()
+{
+    m_lastFeedNs = 0;
+    m_avgFeedNs = 0;
+    m_maxFeedNs = 0;
+    m_nbFeeds = 0;
+    m_dropped = 0;
+    m_droppedBlocks = 0;
+    m_logTimer.invalidate();
+}
+
+void BasebandSinkDispatcher::FeedTask::feed()
+{
+    m_timer.start();
+    m_sink->feed(m_begin, m_end, m_positiveOnly);
+    m_lastFeedNs = m_timer.nsecsElapsed();
+    m_avgFeedNs = m_nbFeeds == 0 ? m_lastFeedNs : (m_avgFeedNs * 15 + m_lastFeedNs) / 16;
+    m_maxFeedNs = std::max(m_maxFeedNs, m_lastFeedNs);
+    m_nbFeeds++;
+}
+
+void BasebandSinkDispatcher::FeedTask::run()
+{
+    feed();
+    m_done->release();
+}
+
+void BasebandSinkDispatcher::FeedTask::runInline()
+{
+    feed();
+}
+
+BasebandSinkDispatcher::BasebandSinkDispatcher() :
+    m_nbThreads(0),
+    m_sampleRate(0)
+{
+    m_threadPool.setExpiryTimeout(-1); // keep the threads alive
+}
+
+BasebandSinkDispatcher::~BasebandSinkDispatcher()
+{
+    m_threadPool.waitForDone();
+
+    for (auto task : m_tasks) {
+        delete task;
+    }
+}
+
+void BasebandSinkDispatcher::setNbThreads(int nbThreads)
+{
+    qDebug("BasebandSinkDispatcher::setNbThreads: %d", nbThreads);
+    m_threadPool.waitForDone();
+    m_nbThreads = nbThreads < 0 ? 0 : nbThreads;
+
+    if (m_nbThreads > 0) {
+        m_threadPool.setMaxThreadCount(m_nbThreads);
+    }
+}
+
+void BasebandSinkDispatcher::addSink(BasebandSampleSink *sink)
+{
+    if (!hasSink(sink)) {
+        m_tasks.push_back(new FeedTask(sink, &m_done));
+    }
+}
+
+void BasebandSinkDispatcher::removeSink(BasebandSampleSink *sink)
+{
+    for (auto it = m_tasks.begin(); it != m_tasks.end(); ++it)
+    {
+        if ((*it)->m_sink == sink)
+        {
+            delete *it;
+            m_tasks.erase(it);
+            break;
+        }
+    }
+}
+
+bool BasebandSinkDispatcher::hasSink(BasebandSampleSink *sink) const
+{
+    for (auto task : m_tasks)
+    {
+        if (task->m_sink == sink) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void BasebandSinkDispatcher::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    unsigned int count = end - begin;
+    FeedTask *inlineTask = nullptr;
+    int nbScheduled = 0;
+
+    for (auto task : m_tasks)
+    {
+        task->m_scheduled = false;
+
+        if (task->m_skipBlocks > 0) // back pressure
+        {
+            task->m_skipBlocks--;
+            task->m_dropped += count;
+            task->m_droppedBlocks++;
+            continue;
+        }
+
+        task->setBlock(begin, end, positiveOnly);
+        task->m_scheduled = true;
+
+        if (!inlineTask) // the calling thread does its share of the work
+        {
+            inlineTask = task;
+        }
+        else
+        {
+            m_threadPool.start(task);
+            nbScheduled++;
+        }
+    }
+
+    if (inlineTask) {
+        inlineTask->runInline();
+    }
+
+    m_done.acquire(nbScheduled);
+
+    if (m_sampleRate == 0) {
+        return;
+    }
+
+    qint64 blockNs = ((qint64) count * 1000000000LL) / m_sampleRate;
+
+    for (auto task : m_tasks)
+    {
+        if (task->m_scheduled && (blockNs > 0) && (task->m_lastFeedNs > blockNs))
+        {
+            if (task->m_canSkip) {
+                task->m_skipBlocks = std::min((unsigned int) (task->m_lastFeedNs / blockNs), m_maxSkipBlocks);
+            }
+
+            if (!task->m_logTimer.isValid() || (task->m_logTimer.elapsed() >= m_logIntervalMs))
+            {
+                qWarning("BasebandSinkDispatcher::feed: %s falls behind: %lld ns for a %lld ns block: %s (%llu blocks %llu samples dropped so far)",
+                    qPrintable(task->m_sink->objectName()), task->m_lastFeedNs, blockNs,
+                    task->m_canSkip ? "skipping" : "not skipped",
+                    task->m_droppedBlocks, task->m_dropped);
+                task->m_logTimer.start();
+            }
+        }
+    }
+}
+
+void BasebandSinkDispatcher::getStats(std::vector<SinkStats>& stats) const
+{
+    stats.clear();
+
+    for (auto task : m_tasks)
+    {
+        stats.push_back(SinkStats{
+            task->m_sink,
+            task->m_lastFeedNs,
+            task->m_avgFeedNs,
+            task->m_maxFeedNs,
+            task->m_nbFeeds,
+            task->m_dropped,
+            task->m_droppedBlocks
+        });
+    }
+}
+
+void BasebandSinkDispatcher::resetStats()
+{
+    for (auto task : m_tasks)
+    {
+        task->resetStats();
+        task->m_skipBlocks = 0;
+    }
+}
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_BASEBANDSINKDISPATCHER_H
+#define INCLUDE_BASEBANDSINKDISPATCHER_H
+
+#include <vector>
+
+#include <QRunnable>
+#include <QThreadPool>
+#include <QSemaphore>
+#include <QElapsedTimer>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class BasebandSampleSink;
+
+/**
+ * Feeds a block of samples to several baseband sample sinks in parallel using a fixed
+ * thread pool. The calling thread takes part in the work and returns when all sinks have
+ * consumed the block so that the source FIFO can be committed.
+ *
+ * Back pressure: when a sink takes longer than the real time duration of a block it is
+ * skipped for as many following blocks as needed to catch up and the skipped samples are
+ * accounted as dropped and logged. This way one slow sink does not stall the whole device set.
+ * Sinks that must see every sample (see BasebandSampleSink::canSkipBlocks) are never skipped.
+ */
+class SDRBASE_API BasebandSinkDispatcher
+{
+public:
+    struct SinkStats
+    {
+        BasebandSampleSink *m_sink;
+        qint64 m_lastFeedNs;  //!< duration of last feed
+        qint64 m_avgFeedNs;   //!< moving average of feed duration
+        qint64 m_maxFeedNs;   //!< maximum feed duration
+        quint64 m_nbFeeds;    //!< number of blocks fed
+        quint64 m_dropped;    //!< number of samples skipped by back pressure
+        quint64 m_droppedBlocks; //!< number of blocks skipped by back pressure
+    };
+
+    BasebandSinkDispatcher();
+    ~BasebandSinkDispatcher();
+
+    void setNbThreads(int nbThreads); //!< 0 disables parallel dispatch
+    int getNbThreads() const { return m_nbThreads; }
+    void setSampleRate(unsigned int sampleRate) { m_sampleRate = sampleRate; }
+    void addSink(BasebandSampleSink *sink);
+    void removeSink(BasebandSampleSink *sink);
+    bool hasSink(BasebandSampleSink *sink) const;
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    void getStats(std::vector<SinkStats>& stats) const;
+    void resetStats();
+
+private:
+    class FeedTask : public QRunnable
+    {
+    public:
+        FeedTask(BasebandSampleSink *sink, QSemaphore *done);
+        virtual void run();
+        void runInline();
+        void setBlock(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+        void resetStats();
+
+        BasebandSampleSink *m_sink;
+        SampleVector::const_iterator m_begin;
+        SampleVector::const_iterator m_end;
+        bool m_positiveOnly;
+        QSemaphore *m_done;
+        QElapsedTimer m_timer;
+        qint64 m_lastFeedNs;
+        qint64 m_avgFeedNs;
+        qint64 m_maxFeedNs;
+        quint64 m_nbFeeds;
+        quint64 m_dropped;
+        quint64 m_droppedBlocks;
+        unsigned int m_skipBlocks; //!< blocks still to be skipped
+        bool m_canSkip;            //!< sink accepts to be skipped (fixed at creation)
+        bool m_scheduled;
+        QElapsedTimer m_logTimer;  //!< rate limits the back pressure warnings
+
+    private:
+        void feed();
+    };
+
+    QThreadPool m_threadPool;
+    QSemaphore m_done;
+    std::vector<FeedTask*> m_tasks;
+    int m_nbThreads;
+    unsigned int m_sampleRate;
+
+    static const unsigned int m_maxSkipBlocks;
+    static const qint64 m_logIntervalMs;
+};
+
+#endif // INCLUDE_BASEBANDSINKDISPATCHER_H
@@ -29,8 +29,8 @@ public:
 	ChannelSampleSource();
 	virtual ~ChannelSampleSource();
 
-	virtual void pull(SampleVector::iterator begin, unsigned int nbSamples) = 0; //!< pull nbSamples from the source and write them starting at begin
-    virtual void pullOne(Sample& sample) = 0; //!< pull a single sample from the source
+	virtual void pull(SampleVector::iterator begin, unsigned int nbSamples) = 0; //!< pull nbSamples from the source and write them starting at begin. Main path: one call per block.
+    virtual void pullOne(Sample& sample) = 0; //!< pull a single sample from the source. Only for consumers interleaving sources sample by sample.
 	virtual void prefetch(unsigned int nbSamples) = 0; //!< Do operation(s) before pulling nbSamples
 };
 
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#include <QDebug>
+
+#include "cpufeatures.h"
+
+CPUFeatures::SIMDLevel CPUFeatures::m_detectedLevel = CPUFeatures::detect();
+CPUFeatures::SIMDLevel CPUFeatures::m_level = CPUFeatures::m_detectedLevel;
+
+CPUFeatures::SIMDLevel CPUFeatures::detect()
+{
+#if defined(SDR_SIMD_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuid(regs, 0);
+    int nbIds = regs[0];
+    __cpuid(regs, 1);
+    bool sse2 = (regs[3] & (1<<26)) != 0;
+    bool osxsave = (regs[2] & (1<<27)) != 0;
+    bool avx2 = false;
+
+    if (osxsave && (nbIds >= 7) && ((_xgetbv(0) & 0x6) == 0x6)) // OS saves YMM registers
+    {
+        __cpuidex(regs, 7, 0);
+        avx2 = (regs[1] & (1<<5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    bool sse2 = __builtin_cpu_supports("sse2");
+    bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+    if (avx2) {
+        return SIMDAVX2;
+    } else if (sse2) {
+        return SIMDSSE2;
+    } else {
+        return SIMDNone;
+    }
+#elif defined(SDR_SIMD_NEON)
+    return SIMDNEON;
+#else
+    return SIMDNone;
+#endif
+}
+
+void CPUFeatures::setSIMDLevel(SIMDLevel level)
+{
+    if ((level == SIMDNone) || (level == m_detectedLevel)) {
+        m_level = level;
+    } else if ((level == SIMDSSE2) && (m_detectedLevel == SIMDAVX2)) {
+        m_level = level;
+    } else {
+        m_level = m_detectedLevel;
+    }
+
+    qDebug("CPUFeatures::setSIMDLevel: %s (requested %s)", getSIMDLevelName(m_level), getSIMDLevelName(level));
+}
+
+const char *CPUFeatures::getSIMDLevelName(SIMDLevel level)
+{
+    switch (level)
+    {
+    case SIMDSSE2:
+        return "SSE2";
+    case SIMDAVX2:
+        return "AVX2";
+    case SIMDNEON:
+        return "NEON";
+    case SIMDNone:
+    default:
+        return "scalar";
+    }
+}
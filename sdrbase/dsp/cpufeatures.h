@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_CPUFEATURES_H
+#define INCLUDE_CPUFEATURES_H
+
+#include "export.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SDR_SIMD_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SDR_SIMD_TARGET_SSE2
+#define SDR_SIMD_TARGET_AVX2
+#else
+#define SDR_SIMD_TARGET_SSE2 __attribute__ ((target ("sse2")))
+#define SDR_SIMD_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SDR_SIMD_NEON 1
+#endif
+
+/**
+ * Run time selection of the SIMD instruction set used by the DSP kernels. x86 kernels
+ * are compiled for their own target whatever the architecture option of the build so
+ * that the level can be chosen on the CPU actually running the code. NEON is selected
+ * at build time.
+ */
+class SDRBASE_API CPUFeatures
+{
+public:
+    enum SIMDLevel
+    {
+        SIMDNone, //!< Scalar code
+        SIMDSSE2,
+        SIMDAVX2,
+        SIMDNEON
+    };
+
+    static SIMDLevel getDetectedSIMDLevel() { return m_detectedLevel; } //!< Best level supported by this CPU
+    static SIMDLevel getSIMDLevel() { return m_level; }                 //!< Level in use by the kernels
+    static void setSIMDLevel(SIMDLevel level); //!< Force a level (e.g. scalar for benchmarks). Clamped to detected level.
+    static const char *getSIMDLevelName(SIMDLevel level);
+
+private:
+    static SIMDLevel detect();
+
+    static SIMDLevel m_detectedLevel;
+    static SIMDLevel m_level;
+};
+
+#endif // INCLUDE_CPUFEATURES_H
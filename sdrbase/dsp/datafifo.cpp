@@ -18,158 +18,183 @@
 
 #include "datafifo.h"
 
-void DataFifo::create(unsigned int s)
+DataFifo::Buffer::Buffer(unsigned int size, DataType dataType) :
+	m_data(size, 0),
+	m_size(size),
+	m_dataType(dataType),
+	m_writePos(0),
+	m_readPos(0)
+{}
+
+unsigned int DataFifo::Buffer::fill() const
 {
-	m_size = 0;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	unsigned int writePos = m_writePos.loadAcquire();
+	unsigned int readPos = m_readPos.loadAcquire();
+	return writePos >= readPos ? writePos - readPos : writePos + 2*m_size - readPos;
+}
+
+void DataFifo::create(unsigned int s, DataType dataType)
+{
+	QMutexLocker resizeLocker(&m_resizeMutex);
+	Buffer *retired = m_buffer.fetchAndStoreOrdered(new Buffer(s, dataType));
+
+	// wait until neither side still uses the previous buffer before freeing it
+	m_resizesPending.fetchAndAddOrdered(1);
+
+	while ((m_readHazard.loadAcquire() == retired) || (m_writeHazard.loadAcquire() == retired)) {
+		m_hazardReleased.wait(&m_resizeMutex);
+	}
 
-	m_data.resize(s);
-	m_size = m_data.size();
+	m_resizesPending.fetchAndAddOrdered(-1);
+	delete retired;
+}
+
+DataFifo::Buffer *DataFifo::acquire(QAtomicPointer<Buffer>& hazard)
+{
+	Buffer *buffer = m_buffer.loadAcquire();
+
+	while (true)
+	{
+		hazard.fetchAndStoreOrdered(buffer);
+		Buffer *current = m_buffer.loadAcquire();
+
+		if (current == buffer) { // not replaced before the hazard was visible
+			return buffer;
+		}
+
+		buffer = current;
+	}
+}
+
+void DataFifo::release(QAtomicPointer<Buffer>& hazard)
+{
+	hazard.fetchAndStoreOrdered(nullptr);
+
+	if (m_resizesPending.loadAcquire() > 0) // a resize is waiting
+	{
+		QMutexLocker resizeLocker(&m_resizeMutex);
+		m_hazardReleased.wakeAll();
+	}
 }
 
 void DataFifo::reset()
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	QMutexLocker resizeLocker(&m_resizeMutex);
+	Buffer *buffer = m_buffer.loadAcquire();
 	m_suppressed = -1;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	buffer->m_readPos.storeRelease(buffer->m_writePos.loadAcquire());
+}
+
+unsigned int DataFifo::size()
+{
+	QMutexLocker resizeLocker(&m_resizeMutex);
+	return m_buffer.loadAcquire()->m_size;
+}
+
+unsigned int DataFifo::fill()
+{
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = m_readHazard.loadAcquire();
+
+	if (buffer) { // called between readBegin and readCommit
+		return buffer->fill();
+	}
+
+	buffer = acquire(m_readHazard);
+	unsigned int fill = buffer->fill();
+	release(m_readHazard);
+	return fill;
 }
 
 DataFifo::DataFifo(QObject* parent) :
 	QObject(parent),
-	m_data(),
-	m_currentDataType(DataTypeI16),
-	m_mutex(QMutex::Recursive)
+	m_mode(ModeLocked),
+	m_mutex(QMutex::Recursive),
+	m_buffer(new Buffer(0, DataTypeI16)),
+	m_readHazard(nullptr),
+	m_writeHazard(nullptr),
+	m_resizesPending(0)
 {
 	m_suppressed = -1;
-	m_size = 0;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
 }
 
 DataFifo::DataFifo(int size, QObject* parent) :
 	QObject(parent),
-	m_data(),
-	m_currentDataType(DataTypeI16),
-	m_mutex(QMutex::Recursive)
+	m_mode(ModeLocked),
+	m_mutex(QMutex::Recursive),
+	m_buffer(new Buffer(size, DataTypeI16)),
+	m_readHazard(nullptr),
+	m_writeHazard(nullptr),
+	m_resizesPending(0)
 {
 	m_suppressed = -1;
-	create(size);
 }
 
 DataFifo::DataFifo(const DataFifo& other) :
     QObject(other.parent()),
-    m_data(other.m_data),
-	m_currentDataType(DataTypeI16),
-	m_mutex(QMutex::Recursive)
+	m_mode(other.m_mode),
+	m_mutex(QMutex::Recursive),
+	m_buffer(new Buffer(other.m_buffer.loadAcquire()->m_size, DataTypeI16)),
+	m_readHazard(nullptr),
+	m_writeHazard(nullptr),
+	m_resizesPending(0)
 {
   	m_suppressed = -1;
-	m_size = m_data.size();
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	m_buffer.loadAcquire()->m_data = other.m_buffer.loadAcquire()->m_data;
 }
 
 DataFifo::~DataFifo()
 {
-	QMutexLocker mutexLocker(&m_mutex);
-	m_size = 0;
+	delete m_buffer.fetchAndStoreOrdered(nullptr);
 }
 
 bool DataFifo::setSize(int size)
 {
-	QMutexLocker mutexLocker(&m_mutex);
-	create(size);
-	return m_data.size() == size;
-}
-
-unsigned int DataFifo::write(const quint8* data, unsigned int count, DataType dataType)
-{
-	QMutexLocker mutexLocker(&m_mutex);
+	DataType dataType;
 
-	if (dataType != m_currentDataType)
 	{
-		m_suppressed = -1;
-		m_fill = 0;
-		m_head = 0;
-		m_tail = 0;
-		m_currentDataType = dataType;
-	}
-
-	unsigned int total;
-	unsigned int remaining;
-	unsigned int len;
-	const quint8* begin = (const quint8*) data;
-	//count /= sizeof(Sample);
-
-	total = std::min(count, m_size - m_fill);
-
-    if (total < count)
-    {
-		if (m_suppressed < 0)
-        {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("DataFifo::write: overflow - dropping %u samples", count - total);
-		}
-        else
-        {
-			if (m_msgRateTimer.elapsed() > 2500)
-            {
-				qCritical("DataFifo::write: %u messages dropped", m_suppressed);
-				qCritical("DataFifo::write: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			}
-            else
-            {
-				m_suppressed++;
-			}
-		}
-	}
-
-	remaining = total;
-
-    while (remaining > 0)
-    {
-		len = std::min(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
-		m_tail += len;
-		m_tail %= m_size;
-		m_fill += len;
-		begin += len;
-		remaining -= len;
+		QMutexLocker resizeLocker(&m_resizeMutex);
+		dataType = m_buffer.loadAcquire()->m_dataType;
 	}
 
-	if (m_fill > 0) {
-		emit dataReady();
-    }
+	create(size, dataType);
+	return this->size() == (unsigned int) size;
+}
 
-	return total;
+unsigned int DataFifo::write(const quint8* data, unsigned int count, DataType dataType)
+{
+	return writeData((const char*) data, count, dataType);
 }
 
 unsigned int DataFifo::write(QByteArray::const_iterator begin, QByteArray::const_iterator end, DataType dataType)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	return writeData(begin, end - begin, dataType);
+}
+
+unsigned int DataFifo::writeData(const char* begin, unsigned int count, DataType dataType)
+{
+	Buffer *buffer = acquire(m_writeHazard);
 
-	if (dataType != m_currentDataType)
+	if (dataType != buffer->m_dataType) // restart with an empty buffer of the new type
 	{
+		unsigned int size = buffer->m_size;
+		release(m_writeHazard);
 		m_suppressed = -1;
-		m_fill = 0;
-		m_head = 0;
-		m_tail = 0;
-		m_currentDataType = dataType;
+		create(size, dataType);
+		buffer = acquire(m_writeHazard);
 	}
 
-	unsigned int count = end - begin;
+	QMutexLocker mutexLocker(accessMutex());
+
+	unsigned int size = buffer->m_size;
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
+	unsigned int writePos = buffer->m_writePos.loadAcquire();
+	unsigned int fill = buffer->fill();
 
-	total = std::min(count, m_size - m_fill);
+	total = std::min(count, size - fill);
 
     if (total < count)
     {
@@ -198,16 +223,19 @@ unsigned int DataFifo::write(QByteArray::const_iterator begin, QByteArray::const
 
     while (remaining > 0)
     {
-		len = std::min(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
-		m_tail += len;
-		m_tail %= m_size;
-		m_fill += len;
+		unsigned int tail = buffer->index(writePos);
+		len = std::min(remaining, size - tail);
+		std::copy(begin, begin + len, buffer->m_data.begin() + tail);
+		writePos = buffer->advance(writePos, len);
 		begin += len;
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
+	// publish the data to the consumer
+	buffer->m_writePos.storeRelease(writePos);
+	release(m_writeHazard);
+
+	if (fill + total > 0) {
 		emit dataReady();
     }
 
@@ -216,14 +244,17 @@ unsigned int DataFifo::write(QByteArray::const_iterator begin, QByteArray::const
 
 unsigned int DataFifo::read(QByteArray::iterator begin, QByteArray::iterator end, DataType& dataType)
 {
-	QMutexLocker mutexLocker(&m_mutex);
-	dataType = m_currentDataType;
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = acquire(m_readHazard);
+	dataType = buffer->m_dataType;
+	unsigned int size = buffer->m_size;
 	unsigned int count = end - begin;
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
+	unsigned int readPos = buffer->m_readPos.loadAcquire();
 
-	total = std::min(count, m_fill);
+	total = std::min(count, buffer->fill());
 
     if (total < count) {
 		qCritical("DataFifo::read: underflow - missing %u samples", count - total);
@@ -233,15 +264,18 @@ unsigned int DataFifo::read(QByteArray::iterator begin, QByteArray::iterator end
 
     while (remaining > 0)
     {
-		len = std::min(remaining, m_size - m_head);
-		std::copy(m_data.begin() + m_head, m_data.begin() + m_head + len, begin);
-		m_head += len;
-		m_head %= m_size;
-		m_fill -= len;
+		unsigned int head = buffer->index(readPos);
+		len = std::min(remaining, size - head);
+		std::copy(buffer->m_data.begin() + head, buffer->m_data.begin() + head + len, begin);
+		readPos = buffer->advance(readPos, len);
 		begin += len;
 		remaining -= len;
 	}
 
+	// release the space to the producer
+	buffer->m_readPos.storeRelease(readPos);
+	release(m_readHazard);
+
 	return total;
 }
 
@@ -250,14 +284,16 @@ unsigned int DataFifo::readBegin(unsigned int count,
 	QByteArray::iterator* part2Begin, QByteArray::iterator* part2End,
 	DataType& dataType)
 {
-	QMutexLocker mutexLocker(&m_mutex);
-	dataType = m_currentDataType;
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = acquire(m_readHazard); // kept until readCommit
+	dataType = buffer->m_dataType;
+	unsigned int size = buffer->m_size;
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
-	unsigned int head = m_head;
+	unsigned int head = buffer->index(buffer->m_readPos.loadAcquire());
 
-	total = std::min(count, m_fill);
+	total = std::min(count, buffer->fill());
 
     if (total < count) {
 		qCritical("DataFifo::readBegin: underflow - missing %u samples", count - total);
@@ -267,29 +303,33 @@ unsigned int DataFifo::readBegin(unsigned int count,
 
     if (remaining > 0)
     {
-		len = std::min(remaining, m_size - head);
-		*part1Begin = m_data.begin() + head;
-		*part1End = m_data.begin() + head + len;
+		len = std::min(remaining, size - head);
+		*part1Begin = buffer->m_data.begin() + head;
+		*part1End = buffer->m_data.begin() + head + len;
 		head += len;
-		head %= m_size;
+		head %= size;
 		remaining -= len;
 	}
     else
     {
-		*part1Begin = m_data.end();
-		*part1End = m_data.end();
+		*part1Begin = buffer->m_data.end();
+		*part1End = buffer->m_data.end();
 	}
 
     if (remaining > 0)
     {
-		len = std::min(remaining, m_size - head);
-		*part2Begin = m_data.begin() + head;
-		*part2End = m_data.begin() + head + len;
+		len = std::min(remaining, size - head);
+		*part2Begin = buffer->m_data.begin() + head;
+		*part2End = buffer->m_data.begin() + head + len;
 	}
     else
     {
-		*part2Begin = m_data.end();
-		*part2End = m_data.end();
+		*part2Begin = buffer->m_data.end();
+		*part2End = buffer->m_data.end();
+	}
+
+	if (total == 0) {
+		release(m_readHazard);
 	}
 
 	return total;
@@ -297,16 +337,29 @@ unsigned int DataFifo::readBegin(unsigned int count,
 
 unsigned int DataFifo::readCommit(unsigned int count)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = m_readHazard.loadAcquire();
+
+	if (!buffer) { // nothing pending from readBegin
+		return 0;
+	}
+
+	if (buffer != m_buffer.loadAcquire()) // FIFO has been re-created since readBegin
+	{
+		release(m_readHazard);
+		return 0;
+	}
+
+	unsigned int fill = buffer->fill();
 
-	if (count > m_fill)
+	if (count > fill)
     {
 		qCritical("DataFifo::readCommit: cannot commit more than available samples");
-		count = m_fill;
+		count = fill;
 	}
 
-    m_head = (m_head + count) % m_size;
-	m_fill -= count;
+	buffer->m_readPos.storeRelease(buffer->advance(buffer->m_readPos.loadAcquire(), count));
+	release(m_readHazard);
 
 	return count;
 }
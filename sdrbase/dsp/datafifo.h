@@ -21,6 +21,10 @@
 
 #include <QObject>
 #include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
 #include <QElapsedTimer>
 #include <QByteArray>
 
@@ -36,15 +40,23 @@ public:
 		DataTypeCI16  //!< Complex (i.e. Re, Im pair of) 16 bit signed integer
 	};
 
+	enum Mode
+	{
+		ModeSPSC,  //!< Lock free single producer single consumer
+		ModeLocked //!< Every access is serialized with a mutex (default)
+	};
+
 	DataFifo(QObject* parent = nullptr);
 	DataFifo(int size, QObject* parent = nullptr);
     DataFifo(const DataFifo& other);
 	~DataFifo();
 
+	void setMode(Mode mode) { m_mode = mode; } //!< To be set before the FIFO is used
+	Mode getMode() const { return m_mode; }
 	bool setSize(int size);
     void reset();
-	inline unsigned int size() const { return m_size; }
-	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
+	unsigned int size();
+	unsigned int fill(); //!< Consumer side
 
 	unsigned int write(const quint8* data, unsigned int count, DataType dataType);
 	unsigned int write(QByteArray::const_iterator begin, QByteArray::const_iterator end, DataType dataType);
@@ -61,18 +73,44 @@ signals:
 	void dataReady();
 
 private:
+	/**
+	 * Storage, data type and read/write positions in [0, 2*size). Same scheme as SampleSinkFifo:
+	 * the producer owns the write position, the consumer the read position, and a data type
+	 * change or a resize publishes a new buffer. The previous one is freed once released by both sides.
+	 */
+	struct Buffer
+	{
+		Buffer(unsigned int size, DataType dataType);
+		QByteArray m_data;
+		unsigned int m_size;
+		DataType m_dataType;
+		char m_padding0[64];
+		QAtomicInteger<unsigned int> m_writePos;
+		char m_padding1[64];
+		QAtomicInteger<unsigned int> m_readPos;
+		char m_padding2[64];
+
+		unsigned int fill() const;
+		unsigned int index(unsigned int pos) const { return pos < m_size ? pos : pos - m_size; }
+		unsigned int advance(unsigned int pos, unsigned int count) const { pos += count; return pos < 2*m_size ? pos : pos - 2*m_size; }
+	};
+
 	QElapsedTimer m_msgRateTimer;
 	int m_suppressed;
-	QByteArray m_data;
-	DataType m_currentDataType;
+	Mode m_mode;
 	QMutex m_mutex;
+	QAtomicPointer<Buffer> m_buffer;
+	QAtomicPointer<Buffer> m_readHazard;    //!< buffer in use by the consumer (from readBegin to readCommit)
+	QAtomicPointer<Buffer> m_writeHazard;   //!< buffer in use by the producer
+	QAtomicInt m_resizesPending;            //!< resizes waiting for a side to release the previous buffer
+	QMutex m_resizeMutex;
+	QWaitCondition m_hazardReleased;
 
-	unsigned int m_size;
-	unsigned int m_fill;
-	unsigned int m_head;
-	unsigned int m_tail;
-
-	void create(unsigned int s);
+	void create(unsigned int s, DataType dataType);
+	QMutex *accessMutex() { return m_mode == ModeLocked ? &m_mutex : nullptr; }
+	Buffer *acquire(QAtomicPointer<Buffer>& hazard);
+	void release(QAtomicPointer<Buffer>& hazard);
+	unsigned int writeData(const char* begin, unsigned int count, DataType dataType);
 };
 
 #endif // INCLUDE_DATAFIFO_H
@@ -20,6 +20,7 @@
 #include <QDebug>
 
 #include "dsp/inthalfbandfilter.h"
+#include "dsp/cpufeatures.h"
 #include "dsp/dspcommands.h"
 #include "dsp/hbfilterchainconverter.h"
 #include "downchannelizer.h"
@@ -56,34 +57,22 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 	}
 	else
 	{
-		for (SampleVector::const_iterator sample = begin; sample != end; ++sample)
-		{
-			Sample s(*sample);
-			FilterStages::iterator stage = m_filterStages.begin();
-
-			for (; stage != m_filterStages.end(); ++stage)
-			{
-#ifndef SDR_RX_SAMPLE_24BIT
-                s.m_real /= 2; // avoid saturation on 16 bit samples
-                s.m_imag /= 2;
-#endif
-				if (!(*stage)->work(&s)) {
-					break;
-				}
-			}
+		m_sampleBuffer.assign(begin, end);
+		unsigned int nbSamples = m_sampleBuffer.size();
+
+		for (auto& stage : m_filterStages) {
+			nbSamples = stage.work(m_sampleBuffer.begin(), nbSamples);
+		}
 
-			if(stage == m_filterStages.end())
-			{
 #ifdef SDR_RX_SAMPLE_24BIT
-			    s.m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
-			    s.m_imag /= (1<<(m_filterStages.size()));
-#endif
-				m_sampleBuffer.push_back(s);
-			}
+		for (unsigned int i = 0; i < nbSamples; i++)
+		{
+			m_sampleBuffer[i].m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
+			m_sampleBuffer[i].m_imag /= (1<<(m_filterStages.size()));
 		}
+#endif
 
-		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
-		m_sampleBuffer.clear();
+		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.begin() + nbSamples);
 	}
 }
 
@@ -169,53 +158,9 @@ void DownChannelizer::applyDecimation()
 			<< " fc:" << m_channelFrequencyOffset;
 }
 
-#ifdef SDR_RX_SAMPLE_24BIT
-DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>),
-    m_workFunction(0),
-    m_mode(mode),
-    m_sse(true)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateUpperHalf;
-            break;
-    }
-}
-#else
 DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>),
-    m_workFunction(0),
-    m_mode(mode),
-    m_sse(true)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateUpperHalf;
-            break;
-    }
-}
-#endif
-
-DownChannelizer::FilterStage::~FilterStage()
+    m_mode(mode)
 {
-	delete m_filter;
 }
 
 bool DownChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
@@ -239,7 +184,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take left half (rotate by +1/4 and decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+		m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
 		return createFilterChain(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd);
 	}
 
@@ -247,7 +192,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take right half (rotate by -1/4 and decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+		m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
 		return createFilterChain(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd);
 	}
 
@@ -255,7 +200,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigStart + rot, sigEnd - rot, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take center half (decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+		m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
 		return createFilterChain(sigStart + rot, sigEnd - rot, chanStart, chanEnd);
 	}
 
@@ -277,18 +222,18 @@ double DownChannelizer::setFilterChain(const std::vector<unsigned int>& stageInd
     {
         if (*rit == 0)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
             ofs -= ofs_stage;
             qDebug("DownChannelizer::setFilterChain: lower half: ofs: %f", ofs);
         }
         else if (*rit == 1)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
             qDebug("DownChannelizer::setFilterChain: center: ofs: %f", ofs);
         }
         else if (*rit == 2)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
             ofs += ofs_stage;
             qDebug("DownChannelizer::setFilterChain: upper half: ofs: %f", ofs);
         }
@@ -299,30 +244,29 @@ double DownChannelizer::setFilterChain(const std::vector<unsigned int>& stageInd
 
 void DownChannelizer::freeFilterChain()
 {
-	for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
-		delete *it;
 	m_filterStages.clear();
 }
 
 void DownChannelizer::debugFilterChain()
 {
-    qDebug("DownChannelizer::debugFilterChain: %lu stages", m_filterStages.size());
+    qDebug("DownChannelizer::debugFilterChain: %lu stages (%s)", m_filterStages.size(),
+        CPUFeatures::getSIMDLevelName(CPUFeatures::getSIMDLevel()));
 
-    for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
+    for (const auto& stage : m_filterStages)
     {
-        switch ((*it)->m_mode)
+        switch (stage.m_mode)
         {
         case FilterStage::ModeCenter:
-            qDebug("DownChannelizer::debugFilterChain: center %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: center");
             break;
         case FilterStage::ModeLowerHalf:
-            qDebug("DownChannelizer::debugFilterChain: lower %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: lower");
             break;
         case FilterStage::ModeUpperHalf:
-            qDebug("DownChannelizer::debugFilterChain: upper %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: upper");
             break;
         default:
-            qDebug("DownChannelizer::debugFilterChain: none %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: none");
             break;
         }
     }
@@ -19,7 +19,6 @@
 #ifndef SDRBASE_DSP_DOWNCHANNELIZER_H
 #define SDRBASE_DSP_DOWNCHANNELIZER_H
 
-#include <list>
 #include <vector>
 
 #include "export.h"
@@ -53,26 +52,51 @@ protected:
 		};
 
 #ifdef SDR_RX_SAMPLE_24BIT
-        typedef bool (IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>* m_filter;
+        typedef IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true> Filter;
 #else
-        typedef bool (IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>* m_filter;
+        typedef IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true> Filter;
 #endif
-
-		WorkFunction m_workFunction;
+		Filter m_filter;
 		Mode m_mode;
-		bool m_sse;
 
 		FilterStage(Mode mode);
-		~FilterStage();
 
-		bool work(Sample* sample)
+		/** Decimate a block in place. Returns the number of output samples. */
+		unsigned int work(SampleVector::iterator buf, unsigned int nbSamples)
+		{
+			switch (m_mode)
+			{
+			case ModeLowerHalf:
+				return workBlock<&Filter::workDecimateLowerHalf>(buf, nbSamples);
+			case ModeUpperHalf:
+				return workBlock<&Filter::workDecimateUpperHalf>(buf, nbSamples);
+			case ModeCenter:
+			default:
+				return workBlock<&Filter::workDecimateCenter>(buf, nbSamples);
+			}
+		}
+
+		template<bool (Filter::*WorkFunction)(Sample*)>
+		unsigned int workBlock(SampleVector::iterator buf, unsigned int nbSamples)
 		{
-			return (m_filter->*m_workFunction)(sample);
+			unsigned int nbOut = 0;
+
+			for (unsigned int i = 0; i < nbSamples; i++)
+			{
+				Sample s(buf[i]);
+#ifndef SDR_RX_SAMPLE_24BIT
+				s.m_real /= 2; // avoid saturation on 16 bit samples
+				s.m_imag /= 2;
+#endif
+				if ((m_filter.*WorkFunction)(&s)) {
+					buf[nbOut++] = s; // output never overtakes input
+				}
+			}
+
+			return nbOut;
 		}
 	};
-	typedef std::list<FilterStage*> FilterStages;
+	typedef std::vector<FilterStage> FilterStages; //!< stages are contiguous and processed one block at a time
 	FilterStages m_filterStages;
     bool m_filterChainSetMode;
 	ChannelSampleSink* m_sampleSink; //!< Demodulator
@@ -38,6 +38,8 @@ MESSAGE_CLASS_DEFINITION(DSPRemoveBasebandSampleSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddAudioSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPRemoveAudioSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureCorrection, Message)
+MESSAGE_CLASS_DEFINITION(DSPConfigureParallelDispatch, Message)
+MESSAGE_CLASS_DEFINITION(DSPConfigurePolyphaseChannelizer, Message)
 MESSAGE_CLASS_DEFINITION(DSPEngineReport, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureScopeVis, Message)
 MESSAGE_CLASS_DEFINITION(DSPSignalNotification, Message)
@@ -226,6 +226,36 @@ private:
 
 };
 
+class SDRBASE_API DSPConfigureParallelDispatch : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPConfigureParallelDispatch(int nbThreads) :
+		Message(),
+		m_nbThreads(nbThreads)
+	{ }
+
+	int getNbThreads() const { return m_nbThreads; }
+
+private:
+	int m_nbThreads;
+};
+
+class SDRBASE_API DSPConfigurePolyphaseChannelizer : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPConfigurePolyphaseChannelizer(int log2NbSubbands) :
+		Message(),
+		m_log2NbSubbands(log2NbSubbands)
+	{ }
+
+	int getLog2NbSubbands() const { return m_log2NbSubbands; }
+
+private:
+	int m_log2NbSubbands;
+};
+
 class SDRBASE_API DSPEngineReport : public Message {
 	MESSAGE_CLASS_DECLARATION
 
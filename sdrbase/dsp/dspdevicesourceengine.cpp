@@ -33,6 +33,8 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_deviceSampleSource(nullptr),
 	m_sampleSourceSequence(0),
 	m_basebandSampleSinks(),
+	m_polyphaseLog2Subbands(0),
+	m_subbandSinksDirty(false),
 	m_sampleRate(0),
 	m_centerFrequency(0),
 	m_dcOffsetCorrection(false),
@@ -43,6 +45,8 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_qRange(1 << 16),
 	m_imbalance(65536)
 {
+	registerSynchronousMessages();
+	registerInputMessages();
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
 	connect(&m_syncMessenger, SIGNAL(messageSent()), this, SLOT(handleSynchronousMessages()), Qt::QueuedConnection);
 
@@ -134,6 +138,20 @@ void DSPDeviceSourceEngine::removeSink(BasebandSampleSink* sink)
 	m_syncMessenger.sendWait(cmd);
 }
 
+void DSPDeviceSourceEngine::configureParallelDispatch(int nbThreads)
+{
+	qDebug() << "DSPDeviceSourceEngine::configureParallelDispatch: " << nbThreads;
+	DSPConfigureParallelDispatch* cmd = new DSPConfigureParallelDispatch(nbThreads);
+	m_inputMessageQueue.push(cmd);
+}
+
+void DSPDeviceSourceEngine::configurePolyphaseChannelizer(int log2NbSubbands)
+{
+	qDebug() << "DSPDeviceSourceEngine::configurePolyphaseChannelizer: " << log2NbSubbands;
+	DSPConfigurePolyphaseChannelizer* cmd = new DSPConfigurePolyphaseChannelizer(log2NbSubbands);
+	m_inputMessageQueue.push(cmd);
+}
+
 void DSPDeviceSourceEngine::configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection)
 {
 	qDebug() << "DSPDeviceSourceEngine::configureCorrections";
@@ -313,6 +331,8 @@ void DSPDeviceSourceEngine::work()
 	std::size_t samplesDone = 0;
 	bool positiveOnly = false;
 
+	updateSubbandSinks();
+
 	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
 	{
 		SampleVector::iterator part1begin;
@@ -331,10 +351,29 @@ void DSPDeviceSourceEngine::work()
                 iqCorrections(part1begin, part1end, m_iqImbalanceCorrection);
             }
 
+			// publish data once for the sinks reading the shared ring
+			if (!m_sampleRingReaders.isEmpty()) {
+				m_sampleRing.write(part1begin, part1end);
+			}
+
+			// split into sub-bands once for the sinks fed by the polyphase channelizer
+			if (!m_subbandSinks.isEmpty()) {
+				feedSubbandSinks(part1begin, part1end);
+			}
+
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+			if (m_sinkDispatcher.getNbThreads() > 0)
 			{
-				(*it)->feed(part1begin, part1end, positiveOnly);
+				m_sinkDispatcher.feed(part1begin, part1end, positiveOnly);
+			}
+			else
+			{
+				for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+				{
+					if (!m_sampleRingReaders.contains(*it) && !m_subbandSinks.contains(*it)) {
+						(*it)->feed(part1begin, part1end, positiveOnly);
+					}
+				}
 			}
 
 		}
@@ -348,10 +387,29 @@ void DSPDeviceSourceEngine::work()
                 iqCorrections(part2begin, part2end, m_iqImbalanceCorrection);
             }
 
+			// publish data once for the sinks reading the shared ring
+			if (!m_sampleRingReaders.isEmpty()) {
+				m_sampleRing.write(part2begin, part2end);
+			}
+
+			// split into sub-bands once for the sinks fed by the polyphase channelizer
+			if (!m_subbandSinks.isEmpty()) {
+				feedSubbandSinks(part2begin, part2end);
+			}
+
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
+			if (m_sinkDispatcher.getNbThreads() > 0)
+			{
+				m_sinkDispatcher.feed(part2begin, part2end, positiveOnly);
+			}
+			else
 			{
-				(*it)->feed(part2begin, part2end, positiveOnly);
+				for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
+				{
+					if (!m_sampleRingReaders.contains(*it) && !m_subbandSinks.contains(*it)) {
+						(*it)->feed(part2begin, part2end, positiveOnly);
+					}
+				}
 			}
 
 		}
@@ -362,6 +420,119 @@ void DSPDeviceSourceEngine::work()
 	}
 }
 
+void DSPDeviceSourceEngine::feedSubbandSinks(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+	m_polyphaseChannelizer.feed(begin, end);
+
+	for (SubbandSinks::const_iterator it = m_subbandSinks.begin(); it != m_subbandSinks.end(); ++it)
+	{
+		const SampleVector& subbandSamples = m_polyphaseChannelizer.getSubbandSamples(it.value());
+		it.key()->feed(subbandSamples.begin(), subbandSamples.end(), false);
+	}
+}
+
+void DSPDeviceSourceEngine::attachSink(BasebandSampleSink *sink)
+{
+	// attach the sink to the shared ring if it supports it
+	SampleSinkRingReader *reader = m_sampleRing.addReader();
+	reader->setObjectName(sink->objectName());
+
+	if (sink->setSampleRingReader(reader))
+	{
+		m_sampleRingReaders.insert(sink, reader);
+	}
+	else
+	{
+		m_sampleRing.removeReader(reader);
+		m_sinkDispatcher.addSink(sink);
+	}
+}
+
+void DSPDeviceSourceEngine::detachSink(BasebandSampleSink *sink)
+{
+	if (m_sampleRingReaders.contains(sink))
+	{
+		sink->setSampleRingReader(nullptr);
+		m_sampleRing.removeReader(m_sampleRingReaders.take(sink));
+	}
+
+	m_sinkDispatcher.removeSink(sink);
+}
+
+void DSPDeviceSourceEngine::updateSubbandSinks()
+{
+	if (!m_polyphaseChannelizer.isEnabled()) {
+		return;
+	}
+
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+	{
+		// unless the sub-band grid changed only sinks whose request changed are looked at again
+		if (!(*it)->takeSubbandRequestChanged() && !m_subbandSinksDirty) {
+			continue;
+		}
+
+		qint64 frequencyOffset;
+		int bandwidth;
+		int subbandIndex = (*it)->getSubbandRequest(frequencyOffset, bandwidth) ?
+			m_polyphaseChannelizer.getSubbandIndex(frequencyOffset, bandwidth) : -1;
+		SubbandSinks::iterator subbandIt = m_subbandSinks.find(*it);
+		int currentIndex = subbandIt == m_subbandSinks.end() ? -1 : subbandIt.value();
+
+		if (subbandIndex == currentIndex) {
+			continue;
+		}
+
+		if (currentIndex < 0) {
+			detachSink(*it);
+		} else {
+			m_polyphaseChannelizer.removeSubbandUser(currentIndex);
+		}
+
+		if (subbandIndex < 0) // off grid: back to its own channelizer on full baseband
+		{
+			m_subbandSinks.remove(*it);
+			(*it)->setSubband(0, 0);
+			attachSink(*it);
+		}
+		else
+		{
+			m_subbandSinks.insert(*it, subbandIndex);
+			m_polyphaseChannelizer.addSubbandUser(subbandIndex);
+			(*it)->setSubband(m_polyphaseChannelizer.getSubbandSampleRate(), m_polyphaseChannelizer.getSubbandFrequencyOffset(subbandIndex));
+		}
+
+		qDebug("DSPDeviceSourceEngine::updateSubbandSinks: %s: sub-band %d -> %d",
+			qPrintable((*it)->objectName()), currentIndex, subbandIndex);
+	}
+
+	m_subbandSinksDirty = false;
+}
+
+void DSPDeviceSourceEngine::releaseSubbandSinks()
+{
+	for (SubbandSinks::const_iterator it = m_subbandSinks.begin(); it != m_subbandSinks.end(); ++it)
+	{
+		m_polyphaseChannelizer.removeSubbandUser(it.value());
+		it.key()->setSubband(0, 0);
+		attachSink(it.key());
+	}
+
+	m_subbandSinks.clear();
+}
+
+void DSPDeviceSourceEngine::applyPolyphaseChannelizer()
+{
+	releaseSubbandSinks();
+	m_subbandSinksDirty = true;
+
+	if ((m_polyphaseLog2Subbands > 0) && (m_sampleRate > 0)) {
+		m_polyphaseChannelizer.configure(m_polyphaseLog2Subbands, m_sampleRate);
+	} else {
+		m_polyphaseChannelizer.configure(0, 0);
+	}
+}
+
 // notStarted -> idle -> init -> running -+
 //                ^                       |
 //                +-----------------------+
@@ -396,6 +567,20 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoIdle()
 		(*it)->stop();
 	}
 
+	if (m_sinkDispatcher.getNbThreads() > 0)
+	{
+		std::vector<BasebandSinkDispatcher::SinkStats> stats;
+		m_sinkDispatcher.getStats(stats);
+
+		for (const auto& sinkStats : stats)
+		{
+			qDebug("DSPDeviceSourceEngine::gotoIdle: %s: feeds: %llu avg: %lld ns max: %lld ns dropped: %llu blocks %llu samples",
+				qPrintable(sinkStats.m_sink->objectName()), sinkStats.m_nbFeeds, sinkStats.m_avgFeedNs, sinkStats.m_maxFeedNs, sinkStats.m_droppedBlocks, sinkStats.m_dropped);
+		}
+
+		m_sinkDispatcher.resetStats();
+	}
+
 	m_deviceDescription.clear();
 	m_sampleRate = 0;
 
@@ -440,6 +625,9 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 			<< " sampleRate: " << m_sampleRate
 			<< " centerFrequency: " << m_centerFrequency;
 
+	m_sampleRing.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
+	m_sinkDispatcher.setSampleRate(m_sampleRate);
+	applyPolyphaseChannelizer();
 	DSPSignalNotification notif(m_sampleRate, m_centerFrequency);
 
 	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
@@ -526,6 +714,8 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 	if(m_deviceSampleSource != 0)
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
+		// the device worker is the only producer and this engine the only consumer
+		m_deviceSampleSource->getSampleFifo()->setMode(SampleSinkFifo::ModeSPSC);
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
 	}
 	else
@@ -547,59 +737,109 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
     Message *message = m_syncMessenger.getMessage();
 	qDebug() << "DSPDeviceSourceEngine::handleSynchronousMessages: " << message->getIdentifier();
 
-	if (DSPAcquisitionInit::match(*message))
-	{
-		m_state = gotoIdle();
+	m_syncMessageDispatcher.dispatch(this, *message);
 
-		if(m_state == StIdle) {
-			m_state = gotoInit(); // State goes ready if init is performed
-		}
-	}
-	else if (DSPAcquisitionStart::match(*message))
-	{
-		if(m_state == StReady) {
-			m_state = gotoRunning();
-		}
-	}
-	else if (DSPAcquisitionStop::match(*message))
-	{
-		m_state = gotoIdle();
+	m_syncMessenger.done(m_state);
+}
+
+void DSPDeviceSourceEngine::registerSynchronousMessages()
+{
+	m_syncMessageDispatcher.add<DSPAcquisitionInit>(&DSPDeviceSourceEngine::handleAcquisitionInit);
+	m_syncMessageDispatcher.add<DSPAcquisitionStart>(&DSPDeviceSourceEngine::handleAcquisitionStart);
+	m_syncMessageDispatcher.add<DSPAcquisitionStop>(&DSPDeviceSourceEngine::handleAcquisitionStop);
+	m_syncMessageDispatcher.add<DSPGetSourceDeviceDescription>(&DSPDeviceSourceEngine::handleGetSourceDeviceDescription);
+	m_syncMessageDispatcher.add<DSPGetErrorMessage>(&DSPDeviceSourceEngine::handleGetErrorMessage);
+	m_syncMessageDispatcher.add<DSPSetSource>(&DSPDeviceSourceEngine::handleSetSourceMessage);
+	m_syncMessageDispatcher.add<DSPAddBasebandSampleSink>(&DSPDeviceSourceEngine::handleAddSink);
+	m_syncMessageDispatcher.add<DSPRemoveBasebandSampleSink>(&DSPDeviceSourceEngine::handleRemoveSink);
+}
+
+bool DSPDeviceSourceEngine::handleAcquisitionInit(const Message& message)
+{
+	(void) message;
+	m_state = gotoIdle();
+
+	if(m_state == StIdle) {
+		m_state = gotoInit(); // State goes ready if init is performed
 	}
-	else if (DSPGetSourceDeviceDescription::match(*message))
-	{
-		((DSPGetSourceDeviceDescription*) message)->setDeviceDescription(m_deviceDescription);
+
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleAcquisitionStart(const Message& message)
+{
+	(void) message;
+
+	if(m_state == StReady) {
+		m_state = gotoRunning();
 	}
-	else if (DSPGetErrorMessage::match(*message))
-	{
-		((DSPGetErrorMessage*) message)->setErrorMessage(m_errorMessage);
+
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleAcquisitionStop(const Message& message)
+{
+	(void) message;
+	m_state = gotoIdle();
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleGetSourceDeviceDescription(const Message& message)
+{
+	((DSPGetSourceDeviceDescription&) message).setDeviceDescription(m_deviceDescription);
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleGetErrorMessage(const Message& message)
+{
+	((DSPGetErrorMessage&) message).setErrorMessage(m_errorMessage);
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleSetSourceMessage(const Message& message)
+{
+	handleSetSource(((const DSPSetSource&) message).getSampleSource());
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleAddSink(const Message& message)
+{
+	BasebandSampleSink* sink = ((const DSPAddBasebandSampleSink&) message).getSampleSink();
+	m_basebandSampleSinks.push_back(sink);
+	m_subbandSinksDirty = true;
+	attachSink(sink);
+
+	// initialize sample rate and center frequency in the sink:
+	DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
+	sink->handleMessage(msg);
+	// start the sink:
+	if(m_state == StRunning) {
+		sink->start();
 	}
-	else if (DSPSetSource::match(*message)) {
-		handleSetSource(((DSPSetSource*) message)->getSampleSource());
+
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleRemoveSink(const Message& message)
+{
+	BasebandSampleSink* sink = ((const DSPRemoveBasebandSampleSink&) message).getSampleSink();
+
+	if(m_state == StRunning) {
+		sink->stop();
 	}
-	else if (DSPAddBasebandSampleSink::match(*message))
+
+	if (m_subbandSinks.contains(sink))
 	{
-		BasebandSampleSink* sink = ((DSPAddBasebandSampleSink*) message)->getSampleSink();
-		m_basebandSampleSinks.push_back(sink);
-        // initialize sample rate and center frequency in the sink:
-        DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
-        sink->handleMessage(msg);
-        // start the sink:
-        if(m_state == StRunning) {
-            sink->start();
-        }
+		m_polyphaseChannelizer.removeSubbandUser(m_subbandSinks.take(sink));
+		sink->setSubband(0, 0);
 	}
-	else if (DSPRemoveBasebandSampleSink::match(*message))
+	else
 	{
-		BasebandSampleSink* sink = ((DSPRemoveBasebandSampleSink*) message)->getSampleSink();
-
-		if(m_state == StRunning) {
-			sink->stop();
-		}
-
-		m_basebandSampleSinks.remove(sink);
+		detachSink(sink);
 	}
 
-	m_syncMessenger.done(m_state);
+	m_basebandSampleSinks.remove(sink);
+	return true;
 }
 
 void DSPDeviceSourceEngine::handleInputMessages()
@@ -609,72 +849,100 @@ void DSPDeviceSourceEngine::handleInputMessages()
 	while ((message = m_inputMessageQueue.pop()) != 0)
 	{
 		qDebug("DSPDeviceSourceEngine::handleInputMessages: message: %s", message->getIdentifier());
+		m_inputMessageDispatcher.dispatch(this, *message);
+		delete message;
+	}
+}
 
-		if (DSPConfigureCorrection::match(*message))
-		{
-			DSPConfigureCorrection* conf = (DSPConfigureCorrection*) message;
-			m_iqImbalanceCorrection = conf->getIQImbalanceCorrection();
+void DSPDeviceSourceEngine::registerInputMessages()
+{
+	m_inputMessageDispatcher.add<DSPConfigureCorrection>(&DSPDeviceSourceEngine::handleConfigureCorrection);
+	m_inputMessageDispatcher.add<DSPConfigureParallelDispatch>(&DSPDeviceSourceEngine::handleConfigureParallelDispatch);
+	m_inputMessageDispatcher.add<DSPConfigurePolyphaseChannelizer>(&DSPDeviceSourceEngine::handleConfigurePolyphaseChannelizer);
+	m_inputMessageDispatcher.add<DSPSignalNotification>(&DSPDeviceSourceEngine::handleSignalNotification);
+}
 
-			if(m_dcOffsetCorrection != conf->getDCOffsetCorrection())
-			{
-				m_dcOffsetCorrection = conf->getDCOffsetCorrection();
-				m_iOffset = 0;
-				m_qOffset = 0;
-			}
+bool DSPDeviceSourceEngine::handleConfigureCorrection(const Message& message)
+{
+	const DSPConfigureCorrection& conf = (const DSPConfigureCorrection&) message;
+	m_iqImbalanceCorrection = conf.getIQImbalanceCorrection();
 
-			if(m_iqImbalanceCorrection != conf->getIQImbalanceCorrection())
-			{
-				m_iqImbalanceCorrection = conf->getIQImbalanceCorrection();
-				m_iRange = 1 << 16;
-				m_qRange = 1 << 16;
-				m_imbalance = 65536;
-			}
+	if(m_dcOffsetCorrection != conf.getDCOffsetCorrection())
+	{
+		m_dcOffsetCorrection = conf.getDCOffsetCorrection();
+		m_iOffset = 0;
+		m_qOffset = 0;
+	}
 
-			m_avgAmp.reset();
-			m_avgII.reset();
-			m_avgII2.reset();
-			m_avgIQ.reset();
-			m_avgPhi.reset();
-			m_avgQQ2.reset();
-			m_iBeta.reset();
-			m_qBeta.reset();
+	if(m_iqImbalanceCorrection != conf.getIQImbalanceCorrection())
+	{
+		m_iqImbalanceCorrection = conf.getIQImbalanceCorrection();
+		m_iRange = 1 << 16;
+		m_qRange = 1 << 16;
+		m_imbalance = 65536;
+	}
 
-			delete message;
-		}
-		else if (DSPSignalNotification::match(*message))
-		{
-			DSPSignalNotification *notif = (DSPSignalNotification *) message;
+	m_avgAmp.reset();
+	m_avgII.reset();
+	m_avgII2.reset();
+	m_avgIQ.reset();
+	m_avgPhi.reset();
+	m_avgQQ2.reset();
+	m_iBeta.reset();
+	m_qBeta.reset();
 
-			// update DSP values
+	return true;
+}
 
-			m_sampleRate = notif->getSampleRate();
-			m_centerFrequency = notif->getCenterFrequency();
+bool DSPDeviceSourceEngine::handleConfigureParallelDispatch(const Message& message)
+{
+	const DSPConfigureParallelDispatch& conf = (const DSPConfigureParallelDispatch&) message;
+	m_sinkDispatcher.setNbThreads(conf.getNbThreads());
+	return true;
+}
 
-			qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification:"
-				<< " m_sampleRate: " << m_sampleRate
-				<< " m_centerFrequency: " << m_centerFrequency;
+bool DSPDeviceSourceEngine::handleConfigurePolyphaseChannelizer(const Message& message)
+{
+	const DSPConfigurePolyphaseChannelizer& conf = (const DSPConfigurePolyphaseChannelizer&) message;
+	m_polyphaseLog2Subbands = conf.getLog2NbSubbands();
+	applyPolyphaseChannelizer();
+	return true;
+}
 
-			// forward source changes to channel sinks with immediate execution (no queuing)
+bool DSPDeviceSourceEngine::handleSignalNotification(const Message& message)
+{
+	const DSPSignalNotification& notif = (const DSPSignalNotification&) message;
 
-			for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
-			{
-				qDebug() << "DSPDeviceSourceEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
-				(*it)->handleMessage(*message);
-			}
+	// update DSP values
 
-			// forward changes to source GUI input queue
+	m_sampleRate = notif.getSampleRate();
+	m_centerFrequency = notif.getCenterFrequency();
+	m_sampleRing.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
+	m_sinkDispatcher.setSampleRate(m_sampleRate);
+	applyPolyphaseChannelizer(); // sub-band sinks go back to full baseband before being notified
 
-			MessageQueue *guiMessageQueue = m_deviceSampleSource->getMessageQueueToGUI();
-			qDebug("DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification: guiMessageQueue: %p", guiMessageQueue);
+	qDebug() << "DSPDeviceSourceEngine::handleSignalNotification:"
+		<< " m_sampleRate: " << m_sampleRate
+		<< " m_centerFrequency: " << m_centerFrequency;
 
-			if (guiMessageQueue) {
-			    DSPSignalNotification* rep = new DSPSignalNotification(*notif); // make a copy for the source GUI
-                guiMessageQueue->push(rep);
-			}
+	// forward source changes to channel sinks with immediate execution (no queuing)
+
+	for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
+	{
+		qDebug() << "DSPDeviceSourceEngine::handleSignalNotification: forward message to " << (*it)->objectName().toStdString().c_str();
+		(*it)->handleMessage(message);
+	}
 
-			//m_outputMessageQueue.push(rep);
+	// forward changes to source GUI input queue
 
-			delete message;
-		}
+	MessageQueue *guiMessageQueue = m_deviceSampleSource->getMessageQueueToGUI();
+	qDebug("DSPDeviceSourceEngine::handleSignalNotification: guiMessageQueue: %p", guiMessageQueue);
+
+	if (guiMessageQueue)
+	{
+		DSPSignalNotification* rep = new DSPSignalNotification(notif); // make a copy for the source GUI
+		guiMessageQueue->push(rep);
 	}
+
+	return true;
 }
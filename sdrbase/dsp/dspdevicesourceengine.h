@@ -23,10 +23,15 @@
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QMap>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
+#include "dsp/samplesinkring.h"
+#include "dsp/basebandsinkdispatcher.h"
+#include "dsp/polyphasechannelizer.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
+#include "util/messagedispatcher.h"
 #include "export.h"
 #include "util/movingaverage.h"
 
@@ -67,6 +72,8 @@ public:
 	void removeSink(BasebandSampleSink* sink); //!< Remove a sample sink
 
 	void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure DSP corrections
+	void configureParallelDispatch(int nbThreads); //!< Feed the sinks in parallel with this number of threads (0 for sequential feed)
+	void configurePolyphaseChannelizer(int log2NbSubbands); //!< Feed the channels that fit in a sub-band of a polyphase channelizer (0 to disable)
 
 	State state() const { return m_state; } //!< Return DSP engine current state
 
@@ -90,6 +97,17 @@ private:
 	typedef std::list<BasebandSampleSink*> BasebandSampleSinks;
 	BasebandSampleSinks m_basebandSampleSinks; //!< sample sinks within main thread (usually spectrum, file output)
 
+	typedef QMap<BasebandSampleSink*, SampleSinkRingReader*> SampleRingReaders;
+	SampleSinkRing m_sampleRing;              //!< shared ring read by the sinks that support it
+	SampleRingReaders m_sampleRingReaders;    //!< read cursors of the sinks fed through the shared ring
+	BasebandSinkDispatcher m_sinkDispatcher;  //!< parallel feed of the sinks not reading the shared ring
+
+	typedef QMap<BasebandSampleSink*, int> SubbandSinks;
+	PolyphaseChannelizer m_polyphaseChannelizer; //!< filter bank splitting the baseband in sub-bands once for all channels
+	SubbandSinks m_subbandSinks;                 //!< sinks fed with a sub-band of the polyphase channelizer and their sub-band index
+	int m_polyphaseLog2Subbands;
+	bool m_subbandSinksDirty;                    //!< sub-band grid or sink list changed: all sinks requests are looked at again
+
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
 
@@ -129,6 +147,12 @@ private:
 	void dcOffset(SampleVector::iterator begin, SampleVector::iterator end);
 	void imbalance(SampleVector::iterator begin, SampleVector::iterator end);
 	void work(); //!< transfer samples from source to sinks if in running state
+	void attachSink(BasebandSampleSink *sink); //!< feed the sink from the shared ring or else the direct feed
+	void detachSink(BasebandSampleSink *sink); //!< stop feeding the sink from the shared ring or the direct feed
+	void updateSubbandSinks();   //!< move sinks between full baseband and polyphase channelizer sub-bands
+	void releaseSubbandSinks();  //!< move all sub-band sinks back to full baseband
+	void applyPolyphaseChannelizer(); //!< reconfigure polyphase channelizer after a change of setting or sample rate
+	void feedSubbandSinks(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
@@ -137,6 +161,24 @@ private:
 
 	void handleSetSource(DeviceSampleSource* source); //!< Manage source setting
 
+	MessageDispatcher<DSPDeviceSourceEngine> m_syncMessageDispatcher;
+	void registerSynchronousMessages();
+	bool handleAcquisitionInit(const Message& message);
+	bool handleAcquisitionStart(const Message& message);
+	bool handleAcquisitionStop(const Message& message);
+	bool handleGetSourceDeviceDescription(const Message& message);
+	bool handleGetErrorMessage(const Message& message);
+	bool handleSetSourceMessage(const Message& message);
+	bool handleAddSink(const Message& message);
+	bool handleRemoveSink(const Message& message);
+
+	MessageDispatcher<DSPDeviceSourceEngine> m_inputMessageDispatcher;
+	void registerInputMessages();
+	bool handleConfigureCorrection(const Message& message);
+	bool handleConfigureParallelDispatch(const Message& message);
+	bool handleConfigurePolyphaseChannelizer(const Message& message);
+	bool handleSignalNotification(const Message& message);
+
 private slots:
 	void handleData(); //!< Handle data when samples from source FIFO are ready to be processed
 	void handleInputMessages(); //!< Handle input message queue
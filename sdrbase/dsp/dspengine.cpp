@@ -35,6 +35,8 @@ DSPEngine::DSPEngine() :
 {
 	m_dvSerialSupport = false;
     m_mimoSupport = false;
+    m_dispatchThreads = 0;
+    m_polyphaseLog2Subbands = 0;
     m_masterTimer.start(50);
 }
 
@@ -63,6 +65,15 @@ DSPDeviceSourceEngine *DSPEngine::addDeviceSourceEngine()
 {
     m_deviceSourceEngines.push_back(new DSPDeviceSourceEngine(m_deviceSourceEnginesUIDSequence));
     m_deviceSourceEnginesUIDSequence++;
+
+    if (m_dispatchThreads > 0) {
+        m_deviceSourceEngines.back()->configureParallelDispatch(m_dispatchThreads);
+    }
+
+    if (m_polyphaseLog2Subbands > 0) {
+        m_deviceSourceEngines.back()->configurePolyphaseChannelizer(m_polyphaseLog2Subbands);
+    }
+
     return m_deviceSourceEngines.back();
 }
 
@@ -83,6 +83,10 @@ public:
 
     const QTimer& getMasterTimer() const { return m_masterTimer; }
     void setMIMOSupport(bool mimoSupport) { m_mimoSupport = mimoSupport; }
+    void setDispatchThreads(int dispatchThreads) { m_dispatchThreads = dispatchThreads; } //!< Applies to device source engines created afterwards
+    int getDispatchThreads() const { return m_dispatchThreads; }
+    void setPolyphaseLog2Subbands(int log2Subbands) { m_polyphaseLog2Subbands = log2Subbands; } //!< Applies to device source engines created afterwards
+    int getPolyphaseLog2Subbands() const { return m_polyphaseLog2Subbands; }
     bool getMIMOSupport() const { return m_mimoSupport; }
     void createFFTFactory(const QString& fftWisdomFileName);
     void preAllocateFFTs();
@@ -101,6 +105,8 @@ private:
     QTimer m_masterTimer;
 	bool m_dvSerialSupport;
     bool m_mimoSupport;
+    int m_dispatchThreads; //!< Number of threads to feed the sinks of a device source engine in parallel (0: sequential)
+    int m_polyphaseLog2Subbands; //!< Log2 of number of sub-bands of the device source engines polyphase channelizer (0: none)
 	AMBEEngine m_ambeEngine;
     FFTFactory *m_fftFactory;
 };
@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
-//	fftfilt.cxx  --  Fast convolution Overlap-Add filter
+//	fftfilt.cxx  --  Fast convolution Overlap-Save filter
 //
-// Filter implemented using overlap-add FFT convolution method
+// Filter implemented using overlap-save FFT convolution method
 // h(t) characterized by Windowed-Sinc impulse response
 //
 // Reference:
@@ -27,43 +27,34 @@
 // along with fldigi.  If not, see <http://www.gnu.org/licenses/>.
 // ----------------------------------------------------------------------------
 
-#include <memory.h>
 #include <algorithm>
-#include <iostream>
-#include <fstream>
-#include <cstdlib>
 #include <cmath>
-#include <typeinfo>
 
-#include <stdio.h>
-#include <sys/types.h>
-#include <memory.h>
-
-#include <dsp/misc.h>
-#include <dsp/fftfilt.h>
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "dsp/fftfilt.h"
 
 //------------------------------------------------------------------------------
 // initialize the filter
-// create forward and reverse FFTs
+// get forward and reverse FFTs from the FFT factory
 //------------------------------------------------------------------------------
 
-// Only need a single instance of g_fft, used for both forward and reverse
 void fftfilt::init_filter()
 {
 	flen2	= flen >> 1;
-	fft	= new g_fft<float>(flen);
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    fwdFFTSequence = fftFactory->getEngine(flen, false, &fwdFFT);
+    invFFTSequence = fftFactory->getEngine(flen, true, &invFFT);
 
 	filter		= new cmplx[flen];
     filterOpp   = new cmplx[flen];
 	data		= new cmplx[flen];
-	output		= new cmplx[flen2];
-	ovlbuf		= new cmplx[flen2];
 
 	std::fill(filter, filter + flen, cmplx{0, 0});
     std::fill(filterOpp, filterOpp + flen, cmplx{0, 0});
 	std::fill(data, data + flen , cmplx{0, 0});
-	std::fill(output, output + flen2, cmplx{0, 0});
-	std::fill(ovlbuf, ovlbuf + flen2, cmplx{0, 0});
 
 	inptr = 0;
 }
@@ -103,13 +94,37 @@ fftfilt::fftfilt(float f2, int len)
 
 fftfilt::~fftfilt()
 {
-	if (fft) delete fft;
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    fftFactory->releaseEngine(flen, false, fwdFFTSequence);
+    fftFactory->releaseEngine(flen, true, invFFTSequence);
 
 	if (filter) delete [] filter;
     if (filterOpp) delete [] filterOpp;
 	if (data) delete [] data;
-	if (output) delete [] output;
-	if (ovlbuf) delete [] ovlbuf;
+}
+
+// The forward engine input is rebuilt from data for each block so it can be used here at any time
+void fftfilt::fft_filter(cmplx *f)
+{
+    std::copy(f, f + flen, fwdFFT->in());
+    fwdFFT->transform();
+    std::copy(fwdFFT->out(), fwdFFT->out() + flen, f);
+}
+
+// FFTW and Kiss inverse transforms are not normalized so the 1/flen factor is folded in the coefficients
+void fftfilt::normalize_filter(cmplx *f, int len)
+{
+	float scale = 0, mag;
+	for (int i = 0; i < len; i++) {
+		mag = abs(f[i]);
+		if (mag > scale) scale = mag;
+	}
+	if (scale == 0) {
+		scale = 1;
+	}
+	scale *= flen;
+	for (int i = 0; i < flen; i++)
+		f[i] /= scale;
 }
 
 void fftfilt::create_filter(float f1, float f2)
@@ -138,18 +153,10 @@ void fftfilt::create_filter(float f1, float f2)
 	for (int i = 0; i < flen2; i++)
 		filter[i] *= _blackman(i, flen2);
 
-	fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+	fft_filter(filter); // filter was expressed in the time domain (impulse response)
 
 	// normalize the output filter for unity gain
-	float scale = 0, mag;
-	for (int i = 0; i < flen2; i++) {
-		mag = abs(filter[i]);
-		if (mag > scale) scale = mag;
-	}
-	if (scale != 0) {
-		for (int i = 0; i < flen; i++)
-			filter[i] /= scale;
-	}
+	normalize_filter(filter, flen2);
 }
 
 // Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
@@ -163,18 +170,10 @@ void fftfilt::create_dsb_filter(float f2)
 		filter[i] *= _blackman(i, flen2);
 	}
 
-	fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+	fft_filter(filter); // filter was expressed in the time domain (impulse response)
 
 	// normalize the output filter for unity gain
-	float scale = 0, mag;
-	for (int i = 0; i < flen2; i++) {
-		mag = abs(filter[i]);
-		if (mag > scale) scale = mag;
-	}
-	if (scale != 0) {
-		for (int i = 0; i < flen; i++)
-			filter[i] /= scale;
-	}
+	normalize_filter(filter, flen2);
 }
 
 // Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
@@ -190,18 +189,10 @@ void fftfilt::create_asym_filter(float fopp, float fin)
         filter[i] *= _blackman(i, flen2);
     }
 
-    fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+    fft_filter(filter); // filter was expressed in the time domain (impulse response)
 
     // normalize the output filter for unity gain
-    float scale = 0, mag;
-    for (int i = 0; i < flen2; i++) {
-        mag = abs(filter[i]);
-        if (mag > scale) scale = mag;
-    }
-    if (scale != 0) {
-        for (int i = 0; i < flen; i++)
-            filter[i] /= scale;
-    }
+    normalize_filter(filter, flen2);
 
     // opposite band
     // initialize the filter to zero
@@ -212,18 +203,10 @@ void fftfilt::create_asym_filter(float fopp, float fin)
         filterOpp[i] *= _blackman(i, flen2);
     }
 
-    fft->ComplexFFT(filterOpp); // filter was expressed in the time domain (impulse response)
+    fft_filter(filterOpp); // filter was expressed in the time domain (impulse response)
 
     // normalize the output filter for unity gain
-    scale = 0;
-    for (int i = 0; i < flen2; i++) {
-        mag = abs(filterOpp[i]);
-        if (mag > scale) scale = mag;
-    }
-    if (scale != 0) {
-        for (int i = 0; i < flen; i++)
-            filterOpp[i] /= scale;
-    }
+    normalize_filter(filterOpp, flen2);
 }
 
 // This filter is constructed directly from frequency domain response. Run with runFilt.
@@ -236,178 +219,201 @@ void fftfilt::create_rrc_filter(float fb, float a)
     }
 
     // normalize the output filter for unity gain
-    float scale = 0, mag;
-    for (int i = 0; i < flen; i++)
-    {
-        mag = abs(filter[i]);
-        if (mag > scale) {
-            scale = mag;
-        }
-    }
-    if (scale != 0)
-    {
-        for (int i = 0; i < flen; i++) {
-            filter[i] /= scale;
-        }
-    }
+    normalize_filter(filter, flen);
 }
 
-// test bypass
-int fftfilt::noFilt(const cmplx & in, cmplx **out)
+// Overlap-save: the FFT input is the previous block followed by the current block.
+// The impulse response is at most flen2 long so the second half of the circular
+// convolution is the linear convolution (same output as the former overlap-add).
+fftfilt::cmplx *fftfilt::fwd()
 {
-	data[inptr++] = in;
-	if (inptr < flen2)
-		return 0;
-	inptr = 0;
-
-	*out = data;
-	return flen2;
+    std::copy(data, data + flen, fwdFFT->in());
+    fwdFFT->transform();
+    std::copy(data + flen2, data + flen, data);
+    return fwdFFT->out();
 }
 
-// Filter with fast convolution (overlap-add algorithm).
-int fftfilt::runFilt(const cmplx & in, cmplx **out)
+fftfilt::cmplx *fftfilt::inv()
 {
-	data[inptr++] = in;
-	if (inptr < flen2)
-		return 0;
-	inptr = 0;
+    invFFT->transform();
+    return invFFT->out() + flen2;
+}
 
-	fft->ComplexFFT(data);
+void fftfilt::applyFilt(const cmplx *x, cmplx *y)
+{
 	for (int i = 0; i < flen; i++)
-		data[i] *= filter[i];
-
-	fft->InverseComplexFFT(data);
-
-	for (int i = 0; i < flen2; i++) {
-		output[i] = ovlbuf[i] + data[i];
-		ovlbuf[i] = data[flen2 + i];
-	}
-	std::fill(data, data + flen , cmplx{0, 0});
-
-	*out = output;
-	return flen2;
+		y[i] = x[i] * filter[i];
 }
 
-// Second version for single sideband
-int fftfilt::runSSB(const cmplx & in, cmplx **out, bool usb, bool getDC)
+void fftfilt::applySSB(const cmplx *x, cmplx *y, bool usb, bool getDC)
 {
-	data[inptr++] = in;
-	if (inptr < flen2)
-		return 0;
-	inptr = 0;
-
-	fft->ComplexFFT(data);
-
 	// get or reject DC component
-	data[0] = getDC ? data[0]*filter[0] : 0;
+	y[0] = getDC ? x[0]*filter[0] : 0;
 
 	// Discard frequencies for ssb
 	if (usb)
 	{
 		for (int i = 1; i < flen2; i++) {
-			data[i] *= filter[i];
-			data[flen2 + i] = 0;
+			y[i] = x[i] * filter[i];
+			y[flen2 + i] = 0;
 		}
 	}
 	else
 	{
 		for (int i = 1; i < flen2; i++) {
-			data[i] = 0;
-			data[flen2 + i] *= filter[flen2 + i];
+			y[i] = 0;
+			y[flen2 + i] = x[flen2 + i] * filter[flen2 + i];
 		}
 	}
 
-	// in-place FFT: freqdata overwritten with filtered timedata
-	fft->InverseComplexFFT(data);
-
-	// overlap and add
-	for (int i = 0; i < flen2; i++) {
-		output[i] = ovlbuf[i] + data[i];
-		ovlbuf[i] = data[i+flen2];
-	}
-	std::fill(data, data + flen , cmplx{0, 0});
-
-	*out = output;
-	return flen2;
+	y[flen2] = x[flen2] * filter[flen2]; // Nyquist bin is not covered by the loop
 }
 
-// Version for double sideband. You have to double the FFT size used for SSB.
-int fftfilt::runDSB(const cmplx & in, cmplx **out, bool getDC)
+void fftfilt::applyDSB(const cmplx *x, cmplx *y, bool getDC)
 {
-	data[inptr++] = in;
-	if (inptr < flen2)
-		return 0;
-	inptr = 0;
-
-	fft->ComplexFFT(data);
-
-	for (int i = 0; i < flen2; i++) {
-		data[i] *= filter[i];
-		data[flen2 + i] *= filter[flen2 + i];
-	}
+	for (int i = 0; i < flen; i++)
+		y[i] = x[i] * filter[i];
 
     // get or reject DC component
-    data[0] = getDC ? data[0] : 0;
-
-	// in-place FFT: freqdata overwritten with filtered timedata
-	fft->InverseComplexFFT(data);
-
-	// overlap and add
-	for (int i = 0; i < flen2; i++) {
-		output[i] = ovlbuf[i] + data[i];
-		ovlbuf[i] = data[i+flen2];
-	}
-
-	std::fill(data, data + flen , cmplx{0, 0});
-
-	*out = output;
-	return flen2;
+    y[0] = getDC ? y[0] : 0;
 }
 
-// Version for asymmetrical sidebands. You have to double the FFT size used for SSB.
-int fftfilt::runAsym(const cmplx & in, cmplx **out, bool usb)
+void fftfilt::applyAsym(const cmplx *x, cmplx *y, bool usb)
 {
-    data[inptr++] = in;
-    if (inptr < flen2)
-        return 0;
-    inptr = 0;
-
-    fft->ComplexFFT(data);
-
-    data[0] *= filter[0]; // always keep DC
+    y[0] = x[0] * filter[0]; // always keep DC
+    y[flen2] = x[flen2] * filter[flen2];
 
     if (usb)
     {
         for (int i = 1; i < flen2; i++)
         {
-            data[i] *= filter[i]; // usb
-            data[flen2 + i] *= filterOpp[flen2 + i]; // lsb is the opposite
+            y[i] = x[i] * filter[i]; // usb
+            y[flen2 + i] = x[flen2 + i] * filterOpp[flen2 + i]; // lsb is the opposite
         }
     }
     else
     {
         for (int i = 1; i < flen2; i++)
         {
-            data[i] *= filterOpp[i]; // usb is the opposite
-            data[flen2 + i] *= filter[flen2 + i]; // lsb
+            y[i] = x[i] * filterOpp[i]; // usb is the opposite
+            y[flen2 + i] = x[flen2 + i] * filter[flen2 + i]; // lsb
         }
     }
+}
 
-    // in-place FFT: freqdata overwritten with filtered timedata
-    fft->InverseComplexFFT(data);
+template<typename Apply>
+int fftfilt::runSample(const cmplx& in, cmplx **out, Apply apply)
+{
+	data[flen2 + inptr++] = in;
+	if (inptr < flen2)
+		return 0;
+	inptr = 0;
 
-    // overlap and add
-    for (int i = 0; i < flen2; i++) {
-        output[i] = ovlbuf[i] + data[i];
-        ovlbuf[i] = data[i+flen2];
+	apply(fwd(), invFFT->in());
+	*out = inv();
+	return flen2;
+}
+
+template<typename Apply>
+int fftfilt::runBlock(const cmplx *in, int nbIn, cmplx *out, Apply apply)
+{
+    int nbOut = 0;
+
+    while (nbIn > 0)
+    {
+        int n = std::min(flen2 - inptr, nbIn);
+        std::copy(in, in + n, data + flen2 + inptr);
+        in += n;
+        nbIn -= n;
+        inptr += n;
+
+        if (inptr == flen2)
+        {
+            inptr = 0;
+            apply(fwd(), invFFT->in());
+            cmplx *filtered = inv();
+            std::copy(filtered, filtered + flen2, out + nbOut);
+            nbOut += flen2;
+        }
     }
 
-    std::fill(data, data + flen , cmplx{0, 0});
+    return nbOut;
+}
+
+// test bypass
+int fftfilt::noFilt(const cmplx & in, cmplx **out)
+{
+	data[flen2 + inptr++] = in;
+	if (inptr < flen2)
+		return 0;
+	inptr = 0;
+
+	*out = data + flen2;
+	return flen2;
+}
 
-    *out = output;
-    return flen2;
+// Filter with fast convolution (overlap-save algorithm).
+int fftfilt::runFilt(const cmplx & in, cmplx **out)
+{
+    return runSample(in, out, [this](const cmplx *x, cmplx *y) {
+        applyFilt(x, y);
+    });
 }
 
+// Second version for single sideband
+int fftfilt::runSSB(const cmplx & in, cmplx **out, bool usb, bool getDC)
+{
+    return runSample(in, out, [this, usb, getDC](const cmplx *x, cmplx *y) {
+        applySSB(x, y, usb, getDC);
+    });
+}
+
+// Version for double sideband. You have to double the FFT size used for SSB.
+int fftfilt::runDSB(const cmplx & in, cmplx **out, bool getDC)
+{
+    return runSample(in, out, [this, getDC](const cmplx *x, cmplx *y) {
+        applyDSB(x, y, getDC);
+    });
+}
+
+// Version for asymmetrical sidebands. You have to double the FFT size used for SSB.
+int fftfilt::runAsym(const cmplx & in, cmplx **out, bool usb)
+{
+    return runSample(in, out, [this, usb](const cmplx *x, cmplx *y) {
+        applyAsym(x, y, usb);
+    });
+}
+
+int fftfilt::runFilt(const cmplx *in, int nbIn, cmplx *out)
+{
+    return runBlock(in, nbIn, out, [this](const cmplx *x, cmplx *y) {
+        applyFilt(x, y);
+    });
+}
+
+int fftfilt::runSSB(const cmplx *in, int nbIn, cmplx *out, bool usb, bool getDC)
+{
+    return runBlock(in, nbIn, out, [this, usb, getDC](const cmplx *x, cmplx *y) {
+        applySSB(x, y, usb, getDC);
+    });
+}
+
+int fftfilt::runDSB(const cmplx *in, int nbIn, cmplx *out, bool getDC)
+{
+    return runBlock(in, nbIn, out, [this, getDC](const cmplx *x, cmplx *y) {
+        applyDSB(x, y, getDC);
+    });
+}
+
+int fftfilt::runAsym(const cmplx *in, int nbIn, cmplx *out, bool usb)
+{
+    return runBlock(in, nbIn, out, [this, usb](const cmplx *x, cmplx *y) {
+        applyAsym(x, y, usb);
+    });
+}
+
+
+
 /* Sliding FFT from Fldigi */
 
 struct sfft::vrot_bins_pair {
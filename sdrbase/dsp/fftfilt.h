@@ -8,9 +8,10 @@
 #include <complex>
 #include <cmath>
 
-#include "gfft.h"
 #include "export.h"
 
+class FFTEngine;
+
 //----------------------------------------------------------------------
 
 class SDRBASE_API fftfilt {
@@ -36,15 +37,23 @@ public:
 	int runDSB(const cmplx& in, cmplx **out, bool getDC = true);
 	int runAsym(const cmplx & in, cmplx **out, bool usb); //!< Asymmetrical fitering can be used for vestigial sideband
 
+    // Block versions: filter nbIn samples from in and write the filtered samples to out.
+    // Return the number of samples written (a multiple of flen/2). out must hold nbIn + flen/2 samples.
+    int runFilt(const cmplx *in, int nbIn, cmplx *out);
+    int runSSB(const cmplx *in, int nbIn, cmplx *out, bool usb, bool getDC = true);
+    int runDSB(const cmplx *in, int nbIn, cmplx *out, bool getDC = true);
+    int runAsym(const cmplx *in, int nbIn, cmplx *out, bool usb);
+
 protected:
 	int flen;
 	int flen2;
-	g_fft<float> *fft;
+    FFTEngine *fwdFFT;
+    FFTEngine *invFFT;
+    unsigned int fwdFFTSequence;
+    unsigned int invFFTSequence;
 	cmplx *filter;
     cmplx *filterOpp;
-	cmplx *data;
-	cmplx *ovlbuf;
-	cmplx *output;
+	cmplx *data;    //!< previous and current input blocks (overlap-save)
 	int inptr;
 	int pass;
 	int window;
@@ -88,6 +97,16 @@ protected:
 
 	void init_filter();
 	void init_dsb_filter();
+    void fft_filter(cmplx *f); //!< impulse response to frequency response in place
+    void normalize_filter(cmplx *f, int len); //!< unity gain over the first len bins including the inverse FFT 1/flen factor
+    cmplx *fwd(); //!< forward FFT of the overlap-save input buffer
+    cmplx *inv(); //!< inverse FFT of the filtered spectrum. Returns the flen2 valid output samples.
+    void applyFilt(const cmplx *x, cmplx *y);
+    void applySSB(const cmplx *x, cmplx *y, bool usb, bool getDC);
+    void applyDSB(const cmplx *x, cmplx *y, bool getDC);
+    void applyAsym(const cmplx *x, cmplx *y, bool usb);
+    template<typename Apply> int runSample(const cmplx& in, cmplx **out, Apply apply);
+    template<typename Apply> int runBlock(const cmplx *in, int nbIn, cmplx *out, Apply apply);
 };
 
 
@@ -15,6 +15,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef>
+
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
 
@@ -27,6 +29,25 @@
 
 #include "filerecord.h"
 
+namespace {
+
+quint32 headerCRC(const FileRecord::Header& header)
+{
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, offsetof(FileRecord::Header, crc32));
+    return crc32.checksum();
+}
+
+// serialization shared by the std::ofstream and the asynchronous writers
+template<typename Stream>
+void writeHeaderWithCRC(Stream& stream, FileRecord::Header& header)
+{
+    header.crc32 = headerCRC(header);
+    stream.write((const char *) &header, sizeof(FileRecord::Header));
+}
+
+}
+
 FileRecord::FileRecord(quint32 sampleRate, quint64 centerFrequency) :
 	FileRecordInterface(),
     m_fileBase("test"),
@@ -94,8 +115,10 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
             m_recordStart = false;
         }
 
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
-        m_byteCount += end - begin;
+        // never blocks: when the disk cannot keep up the block is dropped and accounted for by the writer
+        if (m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample))) {
+            m_byteCount += end - begin;
+        }
     }
 }
 
@@ -116,12 +139,11 @@ bool FileRecord::startRecording()
         stopRecording();
     }
 
-    if (!m_sampleFile.is_open())
+    if (!m_sampleFile.isOpen())
     {
     	qDebug() << "FileRecord::startRecording";
         m_curentFileName = QString("%1.%2.sdriq").arg(m_fileBase).arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz"));
-        m_sampleFile.open(m_curentFileName.toStdString().c_str(), std::ios::binary);
-        if (!m_sampleFile.is_open())
+        if (!m_sampleFile.open(m_curentFileName))
         {
             qWarning() << "FileRecord::startRecording: failed to open file: " << m_curentFileName;
             return false;
@@ -137,13 +159,13 @@ bool FileRecord::stopRecording()
 {
     QMutexLocker mutexLocker(&m_mutex);
 
-    if (m_sampleFile.is_open())
+    if (m_sampleFile.isOpen())
     {
     	qDebug() << "FileRecord::stopRecording";
-        m_sampleFile.close();
+        bool success = m_sampleFile.close();
         m_recordOn = false;
         m_recordStart = false;
-        if (m_sampleFile.bad())
+        if (!success)
         {
             qWarning() << "FileRecord::stopRecording: an error occurred while writing to " << m_curentFileName;
             return false;
@@ -187,22 +209,16 @@ void FileRecord::writeHeader()
     header.startTimeStamp = (quint64)(ts + m_msShift);
     header.sampleSize = SDR_RX_SAMP_SZ;
     header.filler = 0;
-
-    writeHeader(m_sampleFile, header);
+    writeHeaderWithCRC(m_sampleFile, header);
 }
 
 bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
 {
     sampleFile.read((char *) &header, sizeof(Header));
-    boost::crc_32_type crc32;
-    crc32.process_bytes(&header, 28);
-    return header.crc32 == crc32.checksum();
+    return header.crc32 == headerCRC(header);
 }
 
 void FileRecord::writeHeader(std::ofstream& sampleFile, Header& header)
 {
-    boost::crc_32_type crc32;
-    crc32.process_bytes(&header, 28);
-    header.crc32 = crc32.checksum();
-    sampleFile.write((const char *) &header, sizeof(Header));
+    writeHeaderWithCRC(sampleFile, header);
 }
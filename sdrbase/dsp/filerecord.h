@@ -51,6 +51,10 @@ public:
     quint64 getByteCount() const { return m_byteCount; }
     void setMsShift(qint64 shift) { m_msShift = shift; }
     const QString& getCurrentFileName() { return m_curentFileName; }
+    virtual bool getWriteStatistics(AsyncFileWriter::Statistics& statistics) const {
+        m_sampleFile.getStatistics(statistics);
+        return true;
+    }
 
     void genUniqueFileName(uint deviceUID, int istream = -1);
 
@@ -73,7 +77,7 @@ private:
 	quint64 m_centerFrequency;
 	bool m_recordOn;
     bool m_recordStart;
-    std::ofstream m_sampleFile;
+    AsyncFileWriter m_sampleFile;
     QString m_curentFileName;
     quint64 m_byteCount;
     qint64 m_msShift;
@@ -24,6 +24,7 @@
 #include <QObject>
 
 #include "dsp/dsptypes.h"
+#include "dsp/asyncfilewriter.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 #include "export.h"
@@ -59,6 +60,10 @@ public:
 
     virtual void setMsShift(qint64 msShift) = 0;
     virtual int getBytesPerSample() { return sizeof(Sample); };
+    virtual bool getWriteStatistics(AsyncFileWriter::Statistics& statistics) const { //!< false if samples are not written asynchronously
+        (void) statistics;
+        return false;
+    }
 
     static QString genUniqueFileName(unsigned int deviceUID, int istream = -1);
     static RecordType guessTypeFromFileName(const QString& fileName, QString& fileBase);
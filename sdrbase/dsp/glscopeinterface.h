@@ -22,13 +22,28 @@
 #include "physicalunit.h"
 #include "glscopesettings.h"
 
+struct GLScopeDisplayTraces //!< Traces reduced to display resolution
+{
+    std::vector<float *> m_traces;  //!< Min and max points (x, y) of each bucket in sample order
+    std::vector<uint32_t> m_sizes;  //!< Number of points available for each trace (0: use full trace)
+    int m_start;                    //!< First sample of the displayed window
+    int m_end;                      //!< Past last sample of the displayed window
+
+    GLScopeDisplayTraces() : m_start(0), m_end(0) {}
+};
+
 class GLScopeInterface
 {
 public:
     GLScopeInterface() {}
     virtual ~GLScopeInterface() {}
     virtual void setTraces(std::vector<GLScopeSettings::TraceData>* tracesData, std::vector<float *>* traces) = 0;
-    virtual void newTraces(std::vector<float *>* traces, int traceIndex, std::vector<Projector::ProjectionType>* projectionTypes) = 0;
+    virtual void newTraces(
+        std::vector<float *>* traces,
+        int traceIndex,
+        std::vector<Projector::ProjectionType>* projectionTypes,
+        GLScopeDisplayTraces* displayTraces
+    ) = 0;
     virtual void setSampleRate(int sampleRate) = 0;
     virtual void setTraceSize(int trceSize, bool emitSignal = false) = 0;
     virtual void setTriggerPre(uint32_t triggerPre, bool emitSignal = false) = 0;
@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include "dsp/dsptypes.h"
 #include "dsp/hbfiltertraits.h"
+#include "dsp/inthalfbandfiltereosimd.h"
 
 template<typename EOStorageType, typename AccuType, uint32_t HBFilterOrder, bool IQorder>
 class IntHalfbandFilterEO {
@@ -787,6 +788,12 @@ public:
         *y3 = -x;
     }
 
+    /** Interpolation: number of input samples consumed while producing nbOutputSamples */
+    unsigned int getNbInterpolateInputs(unsigned int nbOutputSamples) const
+    {
+        return (m_state & 1) == 0 ? nbOutputSamples / 2 : (nbOutputSamples + 1) / 2; // odd states consume
+    }
+
 protected:
     EOStorageType m_even[2][HBFIRFilterTraits<HBFilterOrder>::hbOrder];
     EOStorageType m_odd[2][HBFIRFilterTraits<HBFilterOrder>::hbOrder];
@@ -845,21 +852,24 @@ protected:
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+        if (!IntHalfbandFilterEOSIMD<HBFilterOrder>::work(m_ptr, m_even, m_odd, iAcc, qAcc))
         {
-            if ((m_ptr % 2) == 0)
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
             {
-                iAcc += ((EOStorageType)(m_even[0][a] + m_even[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_even[1][a] + m_even[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                if ((m_ptr % 2) == 0)
+                {
+                    iAcc += ((EOStorageType)(m_even[0][a] + m_even[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                    qAcc += ((EOStorageType)(m_even[1][a] + m_even[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                }
+                else
+                {
+                    iAcc += ((EOStorageType)(m_odd[0][a] + m_odd[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                    qAcc += ((EOStorageType)(m_odd[1][a] + m_odd[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                }
+
+                a -= 1;
+                b += 1;
             }
-            else
-            {
-                iAcc += ((EOStorageType)(m_odd[0][a] + m_odd[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_odd[1][a] + m_odd[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-
-            a -= 1;
-            b += 1;
         }
 
         if ((m_ptr % 2) == 0)
@@ -885,21 +895,24 @@ protected:
         int a = m_ptr/2 + m_size; // tip pointer
         int b = m_ptr/2 + 1; // tail pointer
 
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+        if (!IntHalfbandFilterEOSIMD<HBFilterOrder>::work(m_ptr, m_even, m_odd, iAcc, qAcc))
         {
-            if ((m_ptr % 2) == 0)
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
             {
-                iAcc += ((EOStorageType)(m_even[0][a] + m_even[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_even[1][a] + m_even[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                if ((m_ptr % 2) == 0)
+                {
+                    iAcc += ((EOStorageType)(m_even[0][a] + m_even[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                    qAcc += ((EOStorageType)(m_even[1][a] + m_even[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                }
+                else
+                {
+                    iAcc += ((EOStorageType)(m_odd[0][a] + m_odd[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                    qAcc += ((EOStorageType)(m_odd[1][a] + m_odd[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                }
+
+                a -= 1;
+                b += 1;
             }
-            else
-            {
-                iAcc += ((EOStorageType)(m_odd[0][a] + m_odd[0][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-                qAcc += ((EOStorageType)(m_odd[1][a] + m_odd[1][b])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            }
-
-            a -= 1;
-            b += 1;
         }
 
         if ((m_ptr % 2) == 0)
@@ -926,12 +939,15 @@ protected:
         qint16 b = m_ptr + (HBFIRFilterTraits<HBFilterOrder>::hbOrder / 2) - 1;
 
         // go through samples in buffer
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+        if (!IntHalfbandFilterEOSIMD<HBFilterOrder>::workInterpolate(m_ptr, m_samples, iAcc, qAcc))
         {
-            iAcc += ((EOStorageType)(m_samples[a][0] + m_samples[b][0])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            qAcc += ((EOStorageType)(m_samples[a][1] + m_samples[b][1])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            a++;
-            b--;
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+            {
+                iAcc += ((EOStorageType)(m_samples[a][0] + m_samples[b][0])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                qAcc += ((EOStorageType)(m_samples[a][1] + m_samples[b][1])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                a++;
+                b--;
+            }
         }
 
         sample->setReal(iAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1));
@@ -947,12 +963,15 @@ protected:
         qint16 b = m_ptr + (HBFIRFilterTraits<HBFilterOrder>::hbOrder / 2) - 1;
 
         // go through samples in buffer
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+        if (!IntHalfbandFilterEOSIMD<HBFilterOrder>::workInterpolate(m_ptr, m_samples, iAcc, qAcc))
         {
-            iAcc += ((EOStorageType)(m_samples[a][0] + m_samples[b][0])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            qAcc += ((EOStorageType)(m_samples[a][1] + m_samples[b][1])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            a++;
-            b--;
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+            {
+                iAcc += ((EOStorageType)(m_samples[a][0] + m_samples[b][0])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                qAcc += ((EOStorageType)(m_samples[a][1] + m_samples[b][1])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+                a++;
+                b--;
+            }
         }
 
         *x = iAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1);
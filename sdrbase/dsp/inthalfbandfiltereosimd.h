@@ -0,0 +1,472 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// SIMD kernels of the even/odd half-band filters symmetric taps. These are the  //
+// inner loops of the decimators and of the channelizers filter stages.          //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_INTHALFBANDFILTEREOSIMD_H_
+#define SDRBASE_DSP_INTHALFBANDFILTEREOSIMD_H_
+
+#include <stdint.h>
+#include <QtGlobal>
+
+#include "dsp/cpufeatures.h"
+#include "dsp/hbfiltertraits.h"
+
+#if defined(SDR_SIMD_X86)
+#include <immintrin.h>
+#elif defined(SDR_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+/**
+ * Accumulates the symmetric taps of the even/odd half-band filter i.e. everything but
+ * the center tap. The "work" methods return false when no kernel is available for the
+ * storage type or the CPU so that the caller runs its scalar loop. Integer kernels are
+ * bit exact with the scalar code. Float kernels only differ by the summation order.
+ */
+template<uint32_t HBFilterOrder>
+class IntHalfbandFilterEOSIMD
+{
+public:
+    static const int hbOrder = HBFIRFilterTraits<HBFilterOrder>::hbOrder;
+    static const int nbTaps = HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4;
+
+    template<typename EOStorageType, typename AccuType>
+    static bool work(int, EOStorageType[2][hbOrder], EOStorageType[2][hbOrder], AccuType&, AccuType&)
+    {
+        return false;
+    }
+
+    static bool work(int ptr, qint32 even[2][hbOrder], qint32 odd[2][hbOrder], qint32& iAcc, qint32& qAcc)
+    {
+        qint32 (*s)[hbOrder] = (ptr % 2) == 0 ? even : odd;
+        int a = ptr/2 + hbOrder/2; // tip pointer
+        int b = ptr/2 + 1;         // tail pointer
+
+        switch (CPUFeatures::getSIMDLevel())
+        {
+#if defined(SDR_SIMD_X86)
+        case CPUFeatures::SIMDAVX2:
+            workI32AVX2(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+        case CPUFeatures::SIMDSSE2:
+            workI32SSE2(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+#elif defined(SDR_SIMD_NEON)
+        case CPUFeatures::SIMDNEON:
+            workI32NEON(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    static bool work(int ptr, qint64 even[2][hbOrder], qint64 odd[2][hbOrder], qint64& iAcc, qint64& qAcc)
+    {
+#if defined(SDR_SIMD_X86)
+        qint64 (*s)[hbOrder] = (ptr % 2) == 0 ? even : odd;
+        int a = ptr/2 + hbOrder/2;
+        int b = ptr/2 + 1;
+
+        switch (CPUFeatures::getSIMDLevel())
+        {
+        case CPUFeatures::SIMDAVX2:
+            workI64AVX2(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+        case CPUFeatures::SIMDSSE2:
+            workI64SSE2(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+        default:
+            return false;
+        }
+#else
+        (void) ptr;
+        (void) even;
+        (void) odd;
+        (void) iAcc;
+        (void) qAcc;
+        return false; // no 64 bit multiply on NEON
+#endif
+    }
+
+    static bool work(int ptr, float even[2][hbOrder], float odd[2][hbOrder], float& iAcc, float& qAcc)
+    {
+        float (*s)[hbOrder] = (ptr % 2) == 0 ? even : odd;
+        int a = ptr/2 + hbOrder/2;
+        int b = ptr/2 + 1;
+
+        switch (CPUFeatures::getSIMDLevel())
+        {
+#if defined(SDR_SIMD_X86)
+        case CPUFeatures::SIMDAVX2:
+            workFAVX2(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+        case CPUFeatures::SIMDSSE2:
+            workFSSE2(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+#elif defined(SDR_SIMD_NEON)
+        case CPUFeatures::SIMDNEON:
+            workFNEON(s[0], s[1], a, b, iAcc, qAcc);
+            return true;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    template<typename EOStorageType, typename AccuType>
+    static bool workInterpolate(int, EOStorageType[hbOrder][2], AccuType&, AccuType&)
+    {
+        return false;
+    }
+
+    /** Symmetric taps of the interpolator on the interleaved I/Q double buffer */
+    static bool workInterpolate(int ptr, qint32 samples[hbOrder][2], qint32& iAcc, qint32& qAcc)
+    {
+        int a = ptr;                  // head pointer going up
+        int b = ptr + hbOrder/2 - 1;  // tail pointer going down
+
+        switch (CPUFeatures::getSIMDLevel())
+        {
+#if defined(SDR_SIMD_X86)
+        case CPUFeatures::SIMDAVX2: // interleaved samples gain nothing from 256 bit lanes
+        case CPUFeatures::SIMDSSE2:
+            workInterpolateI32SSE2(&samples[0][0], a, b, iAcc, qAcc);
+            return true;
+#elif defined(SDR_SIMD_NEON)
+        case CPUFeatures::SIMDNEON:
+            workInterpolateI32NEON(&samples[0][0], a, b, iAcc, qAcc);
+            return true;
+#endif
+        default:
+            return false;
+        }
+    }
+
+private:
+    struct CoeffsF // float copy of coefficients that are double for some orders
+    {
+        float m_c[nbTaps];
+
+        CoeffsF()
+        {
+            for (int i = 0; i < nbTaps; i++) {
+                m_c[i] = HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+            }
+        }
+    };
+
+    static const CoeffsF m_coeffsF;
+
+#if defined(SDR_SIMD_X86)
+    static SDR_SIMD_TARGET_SSE2 __m128i mullo32SSE2(__m128i x, __m128i y)
+    {
+        __m128i even = _mm_mul_epu32(x, y);
+        __m128i odd = _mm_mul_epu32(_mm_srli_si128(x, 4), _mm_srli_si128(y, 4));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0,0,2,0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0,0,2,0)));
+    }
+
+    static SDR_SIMD_TARGET_SSE2 __m128i mullo64SSE2(__m128i x, __m128i y)
+    {
+        __m128i lolo = _mm_mul_epu32(x, y);
+        __m128i hilo = _mm_mul_epu32(_mm_srli_epi64(x, 32), y);
+        __m128i lohi = _mm_mul_epu32(x, _mm_srli_epi64(y, 32));
+        return _mm_add_epi64(lolo, _mm_slli_epi64(_mm_add_epi64(hilo, lohi), 32));
+    }
+
+    static SDR_SIMD_TARGET_SSE2 qint32 hsum32SSE2(__m128i x)
+    {
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1,0,3,2)));
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2,3,0,1)));
+        return _mm_cvtsi128_si32(x);
+    }
+
+    static SDR_SIMD_TARGET_SSE2 qint64 hsum64SSE2(__m128i x)
+    {
+        qint64 r[2];
+        _mm_storeu_si128((__m128i*) r, x);
+        return r[0] + r[1];
+    }
+
+    static SDR_SIMD_TARGET_SSE2 float hsumFSSE2(__m128 x)
+    {
+        float r[4];
+        _mm_storeu_ps(r, x);
+        return (r[0] + r[1]) + (r[2] + r[3]);
+    }
+
+    static SDR_SIMD_TARGET_SSE2 void workInterpolateI32SSE2(const qint32 *s, int a, int b, qint32& iAcc, qint32& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        __m128i sum = _mm_setzero_si128();
+
+        for (int i = 0; i < nbTaps; i += 2) // 2 complex samples per vector
+        {
+            __m128i c = _mm_loadl_epi64((const __m128i*) &h[i]);
+            c = _mm_unpacklo_epi32(c, c);
+            __m128i sa = _mm_loadu_si128((const __m128i*) &s[2*(a+i)]);
+            __m128i sb = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &s[2*(b-i-1)]), _MM_SHUFFLE(1,0,3,2));
+            sum = _mm_add_epi32(sum, mullo32SSE2(_mm_add_epi32(sa, sb), c));
+        }
+
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1,0,3,2)));
+        iAcc += _mm_cvtsi128_si32(sum);
+        qAcc += _mm_cvtsi128_si32(_mm_shuffle_epi32(sum, _MM_SHUFFLE(1,1,1,1)));
+    }
+
+    static SDR_SIMD_TARGET_SSE2 void workI32SSE2(const qint32 *si, const qint32 *sq, int a, int b, qint32& iAcc, qint32& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        __m128i sumI = _mm_setzero_si128();
+        __m128i sumQ = _mm_setzero_si128();
+
+        for (int i = 0; i < nbTaps; i += 4)
+        {
+            __m128i c = _mm_loadu_si128((const __m128i*) &h[i]);
+            __m128i sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &si[a-i-3]), _MM_SHUFFLE(0,1,2,3));
+            __m128i sb = _mm_loadu_si128((const __m128i*) &si[b+i]);
+            sumI = _mm_add_epi32(sumI, mullo32SSE2(_mm_add_epi32(sa, sb), c));
+            sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &sq[a-i-3]), _MM_SHUFFLE(0,1,2,3));
+            sb = _mm_loadu_si128((const __m128i*) &sq[b+i]);
+            sumQ = _mm_add_epi32(sumQ, mullo32SSE2(_mm_add_epi32(sa, sb), c));
+        }
+
+        iAcc += hsum32SSE2(sumI);
+        qAcc += hsum32SSE2(sumQ);
+    }
+
+    static SDR_SIMD_TARGET_AVX2 void workI32AVX2(const qint32 *si, const qint32 *sq, int a, int b, qint32& iAcc, qint32& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        const __m256i rev = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        __m256i sumI = _mm256_setzero_si256();
+        __m256i sumQ = _mm256_setzero_si256();
+        int i = 0;
+
+        for (; i + 8 <= nbTaps; i += 8)
+        {
+            __m256i c = _mm256_loadu_si256((const __m256i*) &h[i]);
+            __m256i sa = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) &si[a-i-7]), rev);
+            __m256i sb = _mm256_loadu_si256((const __m256i*) &si[b+i]);
+            sumI = _mm256_add_epi32(sumI, _mm256_mullo_epi32(_mm256_add_epi32(sa, sb), c));
+            sa = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) &sq[a-i-7]), rev);
+            sb = _mm256_loadu_si256((const __m256i*) &sq[b+i]);
+            sumQ = _mm256_add_epi32(sumQ, _mm256_mullo_epi32(_mm256_add_epi32(sa, sb), c));
+        }
+
+        __m128i sumI4 = _mm_add_epi32(_mm256_castsi256_si128(sumI), _mm256_extracti128_si256(sumI, 1));
+        __m128i sumQ4 = _mm_add_epi32(_mm256_castsi256_si128(sumQ), _mm256_extracti128_si256(sumQ, 1));
+
+        if (i < nbTaps) // remaining 4 taps
+        {
+            __m128i c = _mm_loadu_si128((const __m128i*) &h[i]);
+            __m128i sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &si[a-i-3]), _MM_SHUFFLE(0,1,2,3));
+            __m128i sb = _mm_loadu_si128((const __m128i*) &si[b+i]);
+            sumI4 = _mm_add_epi32(sumI4, _mm_mullo_epi32(_mm_add_epi32(sa, sb), c));
+            sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &sq[a-i-3]), _MM_SHUFFLE(0,1,2,3));
+            sb = _mm_loadu_si128((const __m128i*) &sq[b+i]);
+            sumQ4 = _mm_add_epi32(sumQ4, _mm_mullo_epi32(_mm_add_epi32(sa, sb), c));
+        }
+
+        iAcc += hsum32SSE2(sumI4);
+        qAcc += hsum32SSE2(sumQ4);
+    }
+
+    static SDR_SIMD_TARGET_SSE2 void workI64SSE2(const qint64 *si, const qint64 *sq, int a, int b, qint64& iAcc, qint64& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        __m128i sumI = _mm_setzero_si128();
+        __m128i sumQ = _mm_setzero_si128();
+
+        for (int i = 0; i < nbTaps; i += 2)
+        {
+            __m128i c = _mm_loadl_epi64((const __m128i*) &h[i]);
+            c = _mm_unpacklo_epi32(c, _mm_srai_epi32(c, 31)); // sign extend to 64 bits
+            __m128i sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &si[a-i-1]), _MM_SHUFFLE(1,0,3,2));
+            __m128i sb = _mm_loadu_si128((const __m128i*) &si[b+i]);
+            sumI = _mm_add_epi64(sumI, mullo64SSE2(_mm_add_epi64(sa, sb), c));
+            sa = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &sq[a-i-1]), _MM_SHUFFLE(1,0,3,2));
+            sb = _mm_loadu_si128((const __m128i*) &sq[b+i]);
+            sumQ = _mm_add_epi64(sumQ, mullo64SSE2(_mm_add_epi64(sa, sb), c));
+        }
+
+        iAcc += hsum64SSE2(sumI);
+        qAcc += hsum64SSE2(sumQ);
+    }
+
+    static SDR_SIMD_TARGET_AVX2 __m256i mullo64AVX2(__m256i x, __m256i y)
+    {
+        __m256i lolo = _mm256_mul_epu32(x, y);
+        __m256i hilo = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), y);
+        __m256i lohi = _mm256_mul_epu32(x, _mm256_srli_epi64(y, 32));
+        return _mm256_add_epi64(lolo, _mm256_slli_epi64(_mm256_add_epi64(hilo, lohi), 32));
+    }
+
+    static SDR_SIMD_TARGET_AVX2 void workI64AVX2(const qint64 *si, const qint64 *sq, int a, int b, qint64& iAcc, qint64& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        __m256i sumI = _mm256_setzero_si256();
+        __m256i sumQ = _mm256_setzero_si256();
+
+        for (int i = 0; i < nbTaps; i += 4)
+        {
+            __m256i c = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*) &h[i]));
+            __m256i sa = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*) &si[a-i-3]), _MM_SHUFFLE(0,1,2,3));
+            __m256i sb = _mm256_loadu_si256((const __m256i*) &si[b+i]);
+            sumI = _mm256_add_epi64(sumI, mullo64AVX2(_mm256_add_epi64(sa, sb), c));
+            sa = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*) &sq[a-i-3]), _MM_SHUFFLE(0,1,2,3));
+            sb = _mm256_loadu_si256((const __m256i*) &sq[b+i]);
+            sumQ = _mm256_add_epi64(sumQ, mullo64AVX2(_mm256_add_epi64(sa, sb), c));
+        }
+
+        iAcc += hsum64SSE2(_mm_add_epi64(_mm256_castsi256_si128(sumI), _mm256_extracti128_si256(sumI, 1)));
+        qAcc += hsum64SSE2(_mm_add_epi64(_mm256_castsi256_si128(sumQ), _mm256_extracti128_si256(sumQ, 1)));
+    }
+
+    static SDR_SIMD_TARGET_SSE2 void workFSSE2(const float *si, const float *sq, int a, int b, float& iAcc, float& qAcc)
+    {
+        const float *h = m_coeffsF.m_c;
+        __m128 sumI = _mm_setzero_ps();
+        __m128 sumQ = _mm_setzero_ps();
+
+        for (int i = 0; i < nbTaps; i += 4)
+        {
+            __m128 c = _mm_loadu_ps(&h[i]);
+            __m128 sa = _mm_loadu_ps(&si[a-i-3]);
+            sa = _mm_shuffle_ps(sa, sa, _MM_SHUFFLE(0,1,2,3));
+            sumI = _mm_add_ps(sumI, _mm_mul_ps(_mm_add_ps(sa, _mm_loadu_ps(&si[b+i])), c));
+            sa = _mm_loadu_ps(&sq[a-i-3]);
+            sa = _mm_shuffle_ps(sa, sa, _MM_SHUFFLE(0,1,2,3));
+            sumQ = _mm_add_ps(sumQ, _mm_mul_ps(_mm_add_ps(sa, _mm_loadu_ps(&sq[b+i])), c));
+        }
+
+        iAcc += hsumFSSE2(sumI);
+        qAcc += hsumFSSE2(sumQ);
+    }
+
+    static SDR_SIMD_TARGET_AVX2 void workFAVX2(const float *si, const float *sq, int a, int b, float& iAcc, float& qAcc)
+    {
+        const float *h = m_coeffsF.m_c;
+        const __m256i rev = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        __m256 sumI = _mm256_setzero_ps();
+        __m256 sumQ = _mm256_setzero_ps();
+        int i = 0;
+
+        for (; i + 8 <= nbTaps; i += 8)
+        {
+            __m256 c = _mm256_loadu_ps(&h[i]);
+            __m256 sa = _mm256_permutevar8x32_ps(_mm256_loadu_ps(&si[a-i-7]), rev);
+            sumI = _mm256_add_ps(sumI, _mm256_mul_ps(_mm256_add_ps(sa, _mm256_loadu_ps(&si[b+i])), c));
+            sa = _mm256_permutevar8x32_ps(_mm256_loadu_ps(&sq[a-i-7]), rev);
+            sumQ = _mm256_add_ps(sumQ, _mm256_mul_ps(_mm256_add_ps(sa, _mm256_loadu_ps(&sq[b+i])), c));
+        }
+
+        __m128 sumI4 = _mm_add_ps(_mm256_castps256_ps128(sumI), _mm256_extractf128_ps(sumI, 1));
+        __m128 sumQ4 = _mm_add_ps(_mm256_castps256_ps128(sumQ), _mm256_extractf128_ps(sumQ, 1));
+
+        if (i < nbTaps) // remaining 4 taps
+        {
+            __m128 c = _mm_loadu_ps(&h[i]);
+            __m128 sa = _mm_loadu_ps(&si[a-i-3]);
+            sa = _mm_shuffle_ps(sa, sa, _MM_SHUFFLE(0,1,2,3));
+            sumI4 = _mm_add_ps(sumI4, _mm_mul_ps(_mm_add_ps(sa, _mm_loadu_ps(&si[b+i])), c));
+            sa = _mm_loadu_ps(&sq[a-i-3]);
+            sa = _mm_shuffle_ps(sa, sa, _MM_SHUFFLE(0,1,2,3));
+            sumQ4 = _mm_add_ps(sumQ4, _mm_mul_ps(_mm_add_ps(sa, _mm_loadu_ps(&sq[b+i])), c));
+        }
+
+        iAcc += hsumFSSE2(sumI4);
+        qAcc += hsumFSSE2(sumQ4);
+    }
+#elif defined(SDR_SIMD_NEON)
+    static int32x4_t reverseNEON(int32x4_t x)
+    {
+        x = vrev64q_s32(x);
+        return vcombine_s32(vget_high_s32(x), vget_low_s32(x));
+    }
+
+    static float32x4_t reverseNEON(float32x4_t x)
+    {
+        x = vrev64q_f32(x);
+        return vcombine_f32(vget_high_f32(x), vget_low_f32(x));
+    }
+
+    static void workInterpolateI32NEON(const qint32 *s, int a, int b, qint32& iAcc, qint32& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        int32x4_t sum = vdupq_n_s32(0);
+
+        for (int i = 0; i < nbTaps; i += 2)
+        {
+            int32x2x2_t cz = vzip_s32(vld1_s32(&h[i]), vld1_s32(&h[i]));
+            int32x4_t c = vcombine_s32(cz.val[0], cz.val[1]);
+            int32x4_t sb = vld1q_s32(&s[2*(b-i-1)]);
+            sb = vcombine_s32(vget_high_s32(sb), vget_low_s32(sb));
+            sum = vmlaq_s32(sum, vaddq_s32(vld1q_s32(&s[2*(a+i)]), sb), c);
+        }
+
+        int32x2_t iq = vadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+        iAcc += vget_lane_s32(iq, 0);
+        qAcc += vget_lane_s32(iq, 1);
+    }
+
+    static void workI32NEON(const qint32 *si, const qint32 *sq, int a, int b, qint32& iAcc, qint32& qAcc)
+    {
+        const int32_t *h = HBFIRFilterTraits<HBFilterOrder>::hbCoeffs;
+        int32x4_t sumI = vdupq_n_s32(0);
+        int32x4_t sumQ = vdupq_n_s32(0);
+
+        for (int i = 0; i < nbTaps; i += 4)
+        {
+            int32x4_t c = vld1q_s32(&h[i]);
+            sumI = vmlaq_s32(sumI, vaddq_s32(reverseNEON(vld1q_s32(&si[a-i-3])), vld1q_s32(&si[b+i])), c);
+            sumQ = vmlaq_s32(sumQ, vaddq_s32(reverseNEON(vld1q_s32(&sq[a-i-3])), vld1q_s32(&sq[b+i])), c);
+        }
+
+        int32x2_t sI = vadd_s32(vget_low_s32(sumI), vget_high_s32(sumI));
+        int32x2_t sQ = vadd_s32(vget_low_s32(sumQ), vget_high_s32(sumQ));
+        iAcc += vget_lane_s32(vpadd_s32(sI, sI), 0);
+        qAcc += vget_lane_s32(vpadd_s32(sQ, sQ), 0);
+    }
+
+    static void workFNEON(const float *si, const float *sq, int a, int b, float& iAcc, float& qAcc)
+    {
+        const float *h = m_coeffsF.m_c;
+        float32x4_t sumI = vdupq_n_f32(0.0f);
+        float32x4_t sumQ = vdupq_n_f32(0.0f);
+
+        for (int i = 0; i < nbTaps; i += 4)
+        {
+            float32x4_t c = vld1q_f32(&h[i]);
+            sumI = vmlaq_f32(sumI, vaddq_f32(reverseNEON(vld1q_f32(&si[a-i-3])), vld1q_f32(&si[b+i])), c);
+            sumQ = vmlaq_f32(sumQ, vaddq_f32(reverseNEON(vld1q_f32(&sq[a-i-3])), vld1q_f32(&sq[b+i])), c);
+        }
+
+        float32x2_t sI = vadd_f32(vget_low_f32(sumI), vget_high_f32(sumI));
+        float32x2_t sQ = vadd_f32(vget_low_f32(sumQ), vget_high_f32(sumQ));
+        iAcc += vget_lane_f32(vpadd_f32(sI, sI), 0);
+        qAcc += vget_lane_f32(vpadd_f32(sQ, sQ), 0);
+    }
+#endif
+};
+
+template<uint32_t HBFilterOrder>
+const typename IntHalfbandFilterEOSIMD<HBFilterOrder>::CoeffsF IntHalfbandFilterEOSIMD<HBFilterOrder>::m_coeffsF;
+
+#endif /* SDRBASE_DSP_INTHALFBANDFILTEREOSIMD_H_ */
@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "dsp/wfir.h"
+#include "polyphasechannelizer.h"
+
+const unsigned int PolyphaseChannelizer::m_minLog2NbSubbands = 2;
+const unsigned int PolyphaseChannelizer::m_maxLog2NbSubbands = 10;
+const unsigned int PolyphaseChannelizer::m_defaultTapsPerBranch = 12;
+const float PolyphaseChannelizer::m_passbandRatio = 0.6f;
+
+PolyphaseChannelizer::PolyphaseChannelizer() :
+    m_nbSubbands(0),
+    m_tapsPerBranch(m_defaultTapsPerBranch),
+    m_basebandSampleRate(0),
+    m_historyIndex(0),
+    m_decimationCount(0),
+    m_oddOutput(false),
+    m_fft(nullptr),
+    m_fftEngineSequence(0)
+{
+}
+
+PolyphaseChannelizer::~PolyphaseChannelizer()
+{
+    releaseFFT();
+}
+
+void PolyphaseChannelizer::releaseFFT()
+{
+    if (m_fft)
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(m_nbSubbands, true, m_fftEngineSequence);
+        m_fft = nullptr;
+    }
+}
+
+void PolyphaseChannelizer::configure(unsigned int log2NbSubbands, int basebandSampleRate)
+{
+    if ((log2NbSubbands != 0) && ((log2NbSubbands < m_minLog2NbSubbands) || (log2NbSubbands > m_maxLog2NbSubbands)))
+    {
+        qWarning("PolyphaseChannelizer::configure: invalid log2 number of sub-bands: %u", log2NbSubbands);
+        return;
+    }
+
+    releaseFFT();
+    m_nbSubbands = log2NbSubbands == 0 ? 0 : 1 << log2NbSubbands;
+    m_basebandSampleRate = basebandSampleRate;
+    m_historyIndex = 0;
+    m_decimationCount = 0;
+    m_oddOutput = false;
+    m_subbandUsers.assign(m_nbSubbands, 0);
+    m_subbandSamples.assign(m_nbSubbands, SampleVector());
+
+    if (m_nbSubbands == 0)
+    {
+        m_prototype.clear();
+        m_history.clear();
+        qDebug("PolyphaseChannelizer::configure: disabled");
+        return;
+    }
+
+    // lowpass prototype with -6 dB point at 0.8 times the sub-band spacing
+    unsigned int nbTaps = m_nbSubbands * m_tapsPerBranch;
+    std::vector<double> taps(nbTaps);
+    WFIR::BasicFIR(taps.data(), nbTaps, WFIR::LPF, 1.6 / m_nbSubbands, 0.0, WFIR::wtKAISER, 7.0);
+    double sum = 0.0;
+
+    for (auto tap : taps) {
+        sum += tap;
+    }
+
+    m_prototype.resize(nbTaps);
+
+    for (unsigned int i = 0; i < nbTaps; i++) {
+        m_prototype[i] = taps[i] / sum; // unity gain in the passband
+    }
+
+    m_history.assign(2*nbTaps, Complex{0.0f, 0.0f});
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    m_fftEngineSequence = fftFactory->getEngine(m_nbSubbands, true, &m_fft);
+
+    qDebug("PolyphaseChannelizer::configure: %u sub-bands of %d S/s taps: %u",
+        m_nbSubbands, getSubbandSampleRate(), nbTaps);
+}
+
+int PolyphaseChannelizer::getSubbandSampleRate() const
+{
+    return m_nbSubbands == 0 ? 0 : (2 * m_basebandSampleRate) / m_nbSubbands;
+}
+
+int PolyphaseChannelizer::getSubbandIndex(qint64 frequencyOffset, int bandwidth) const
+{
+    if ((m_nbSubbands == 0) || (m_basebandSampleRate == 0)) {
+        return -1;
+    }
+
+    double spacing = (double) m_basebandSampleRate / m_nbSubbands;
+    int nearest = (int) std::round(frequencyOffset / spacing);
+    int half = m_nbSubbands / 2;
+
+    if ((nearest <= -half) || (nearest >= half)) { // the sub-band straddling the band edges is not used
+        return -1;
+    }
+
+    double distance = std::fabs(frequencyOffset - nearest * spacing);
+
+    if (distance + bandwidth / 2.0 > m_passbandRatio * spacing) {
+        return -1;
+    }
+
+    return nearest < 0 ? nearest + m_nbSubbands : nearest;
+}
+
+qint64 PolyphaseChannelizer::getSubbandFrequencyOffset(int index) const
+{
+    if (m_nbSubbands == 0) {
+        return 0;
+    }
+
+    int k = index < (int) m_nbSubbands / 2 ? index : index - (int) m_nbSubbands;
+    return ((qint64) k * m_basebandSampleRate) / m_nbSubbands;
+}
+
+void PolyphaseChannelizer::addSubbandUser(int index)
+{
+    if ((index >= 0) && (index < (int) m_nbSubbands)) {
+        m_subbandUsers[index]++;
+    }
+}
+
+void PolyphaseChannelizer::removeSubbandUser(int index)
+{
+    if ((index >= 0) && (index < (int) m_nbSubbands) && (m_subbandUsers[index] > 0))
+    {
+        m_subbandUsers[index]--;
+
+        if (m_subbandUsers[index] == 0) {
+            m_subbandSamples[index].clear();
+        }
+    }
+}
+
+void PolyphaseChannelizer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (m_nbSubbands == 0) {
+        return;
+    }
+
+    for (unsigned int k = 0; k < m_nbSubbands; k++)
+    {
+        if (m_subbandUsers[k] > 0) {
+            m_subbandSamples[k].clear();
+        }
+    }
+
+    unsigned int nbTaps = m_prototype.size();
+    unsigned int decimation = m_nbSubbands / 2;
+
+    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    {
+        Complex c(it->real(), it->imag());
+        m_history[m_historyIndex] = c;
+        m_history[m_historyIndex + nbTaps] = c;
+        m_historyIndex = m_historyIndex == nbTaps - 1 ? 0 : m_historyIndex + 1;
+
+        if (++m_decimationCount == decimation)
+        {
+            m_decimationCount = 0;
+            produce();
+        }
+    }
+}
+
+void PolyphaseChannelizer::produce()
+{
+    // y_k[m] = (-1)^(k*m) * sum_r u_r[m] * exp(j*2*pi*k*r/M)
+    // with u_r[m] = sum_p h[r+pM] * x[mM/2 - r - pM] (polyphase branches)
+    unsigned int nbTaps = m_prototype.size();
+    const Complex *x = &m_history[m_historyIndex + nbTaps - 1]; // newest sample
+    const float *h = m_prototype.data();
+    Complex *u = m_fft->in();
+
+    for (unsigned int r = 0; r < m_nbSubbands; r++) {
+        u[r] = Complex{0.0f, 0.0f};
+    }
+
+    for (unsigned int p = 0; p < nbTaps; p += m_nbSubbands)
+    {
+        for (unsigned int r = 0; r < m_nbSubbands; r++) {
+            u[r] += h[p + r] * x[-(int) (p + r)];
+        }
+    }
+
+    m_fft->transform();
+    const Complex *y = m_fft->out();
+
+    for (unsigned int k = 0; k < m_nbSubbands; k++)
+    {
+        if (m_subbandUsers[k] == 0) {
+            continue;
+        }
+
+        Complex s = (m_oddOutput && (k & 1)) ? -y[k] : y[k];
+        m_subbandSamples[k].push_back(Sample((FixReal) s.real(), (FixReal) s.imag()));
+    }
+
+    m_oddOutput = !m_oddOutput;
+}
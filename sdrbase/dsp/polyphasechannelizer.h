@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_POLYPHASECHANNELIZER_H_
+#define SDRBASE_DSP_POLYPHASECHANNELIZER_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class FFTEngine;
+
+/**
+ * 2x oversampled polyphase filter bank. The baseband is split in M uniformly spaced
+ * sub-bands (M a power of two) centered on k*fs/M. Each sub-band is mixed down to zero
+ * and output at 2*fs/M so that a channel anywhere in the flat part of the sub-band
+ * (+/- 0.6*fs/M around its center) can be further channelized without aliasing.
+ *
+ * The cost per input sample is that of the prototype filter polyphase branches plus one
+ * inverse FFT of size M every M/2 samples whatever the number of sub-bands in use.
+ * Only the sub-bands with at least one user are converted back to samples.
+ */
+class SDRBASE_API PolyphaseChannelizer
+{
+public:
+    PolyphaseChannelizer();
+    ~PolyphaseChannelizer();
+
+    void configure(unsigned int log2NbSubbands, int basebandSampleRate); //!< log2NbSubbands of 0 disables the bank
+    bool isEnabled() const { return m_nbSubbands != 0; }
+    unsigned int getNbSubbands() const { return m_nbSubbands; }
+    int getSubbandSampleRate() const;
+    int getSubbandIndex(qint64 frequencyOffset, int bandwidth) const; //!< Sub-band containing the channel or -1 if none
+    qint64 getSubbandFrequencyOffset(int index) const;                //!< Center of the sub-band relative to baseband center
+    void addSubbandUser(int index);
+    void removeSubbandUser(int index);
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end); //!< Fill the sub-bands in use
+    const SampleVector& getSubbandSamples(int index) const { return m_subbandSamples[index]; }  //!< Output of the last feed
+
+    static const unsigned int m_minLog2NbSubbands;
+    static const unsigned int m_maxLog2NbSubbands;
+
+private:
+    unsigned int m_nbSubbands;       //!< M
+    unsigned int m_tapsPerBranch;
+    int m_basebandSampleRate;
+    std::vector<float> m_prototype;  //!< M * taps per branch lowpass prototype
+    std::vector<Complex> m_history;  //!< last samples written twice for contiguous reads
+    unsigned int m_historyIndex;
+    unsigned int m_decimationCount;
+    bool m_oddOutput;                //!< parity of output sample index for odd sub-bands phase correction
+    std::vector<int> m_subbandUsers;
+    std::vector<SampleVector> m_subbandSamples;
+    FFTEngine *m_fft;
+    unsigned int m_fftEngineSequence;
+
+    static const unsigned int m_defaultTapsPerBranch;
+    static const float m_passbandRatio; //!< flat part of a sub-band relative to spacing (each side)
+
+    void releaseFFT();
+    void produce();
+};
+
+#endif // SDRBASE_DSP_POLYPHASECHANNELIZER_H_
@@ -18,195 +18,313 @@
 
 #include "samplesinkfifo.h"
 
-//#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+SampleSinkFifo::Buffer::Buffer(unsigned int size) :
+	m_data(size),
+	m_size(size),
+	m_writePos(0),
+	m_readPos(0)
+{}
+
+unsigned int SampleSinkFifo::Buffer::fill() const
+{
+	unsigned int writePos = m_writePos.loadAcquire();
+	unsigned int readPos = m_readPos.loadAcquire();
+	return writePos >= readPos ? writePos - readPos : writePos + 2*m_size - readPos;
+}
 
 void SampleSinkFifo::create(unsigned int s)
 {
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	QMutexLocker resizeLocker(&m_resizeMutex);
+	Buffer *retired = m_buffer.fetchAndStoreOrdered(new Buffer(s));
+
+	// wait until neither side still uses the previous buffer before freeing it
+	m_resizesPending.fetchAndAddOrdered(1);
+
+	while ((m_readHazard.loadAcquire() == retired) || (m_writeHazard.loadAcquire() == retired)) {
+		m_hazardReleased.wait(&m_resizeMutex);
+	}
+
+	m_resizesPending.fetchAndAddOrdered(-1);
+	delete retired;
+}
 
-	m_data.resize(s);
-	m_size = m_data.size();
+SampleSinkFifo::Buffer *SampleSinkFifo::acquire(QAtomicPointer<Buffer>& hazard)
+{
+	Buffer *buffer = m_buffer.loadAcquire();
+
+	while (true)
+	{
+		hazard.fetchAndStoreOrdered(buffer);
+		Buffer *current = m_buffer.loadAcquire();
+
+		if (current == buffer) { // not replaced before the hazard was visible
+			return buffer;
+		}
+
+		buffer = current;
+	}
+}
+
+void SampleSinkFifo::release(QAtomicPointer<Buffer>& hazard)
+{
+	hazard.fetchAndStoreOrdered(nullptr);
+
+	if (m_resizesPending.loadAcquire() > 0) // a resize is waiting
+	{
+		QMutexLocker resizeLocker(&m_resizeMutex);
+		m_hazardReleased.wakeAll();
+	}
 }
 
 void SampleSinkFifo::reset()
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	QMutexLocker resizeLocker(&m_resizeMutex);
+	Buffer *buffer = m_buffer.loadAcquire();
 	m_suppressed = -1;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	buffer->m_readPos.storeRelease(buffer->m_writePos.loadAcquire());
+}
+
+unsigned int SampleSinkFifo::size()
+{
+	QMutexLocker resizeLocker(&m_resizeMutex);
+	return m_buffer.loadAcquire()->m_size;
+}
+
+unsigned int SampleSinkFifo::fill()
+{
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = m_readHazard.loadAcquire();
+
+	if (buffer) { // called between readBegin and readCommit
+		return buffer->fill();
+	}
+
+	buffer = acquire(m_readHazard);
+	unsigned int fill = buffer->fill();
+	release(m_readHazard);
+	return fill;
 }
 
 SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	QObject(parent),
-	m_data(),
-	m_mutex(QMutex::Recursive)
+	m_mode(ModeLocked),
+	m_mutex(QMutex::Recursive),
+	m_buffer(new Buffer(0)),
+	m_readHazard(nullptr),
+	m_writeHazard(nullptr),
+	m_resizesPending(0)
 {
 	m_suppressed = -1;
-	m_size = 0;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
 }
 
 SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	QObject(parent),
-	m_data(),
-	m_mutex(QMutex::Recursive)
+	m_mode(ModeLocked),
+	m_mutex(QMutex::Recursive),
+	m_buffer(new Buffer(size)),
+	m_readHazard(nullptr),
+	m_writeHazard(nullptr),
+	m_resizesPending(0)
 {
 	m_suppressed = -1;
-	create(size);
 }
 
 SampleSinkFifo::SampleSinkFifo(const SampleSinkFifo& other) :
     QObject(other.parent()),
-    m_data(other.m_data),
-	m_mutex(QMutex::Recursive)
+	m_mode(other.m_mode),
+	m_mutex(QMutex::Recursive),
+	m_buffer(new Buffer(other.m_buffer.loadAcquire()->m_size)),
+	m_readHazard(nullptr),
+	m_writeHazard(nullptr),
+	m_resizesPending(0)
 {
   	m_suppressed = -1;
-	m_size = m_data.size();
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	m_buffer.loadAcquire()->m_data = other.m_buffer.loadAcquire()->m_data;
 }
 
 SampleSinkFifo::~SampleSinkFifo()
 {
-	QMutexLocker mutexLocker(&m_mutex);
-	m_size = 0;
+	delete m_buffer.fetchAndStoreOrdered(nullptr);
 }
 
 bool SampleSinkFifo::setSize(int size)
 {
-	QMutexLocker mutexLocker(&m_mutex);
 	create(size);
-	return m_data.size() == (unsigned int)size;
+	return this->size() == (unsigned int) size;
+}
+
+void SampleSinkFifo::overflow(unsigned int count, unsigned int total)
+{
+	if (m_suppressed < 0)
+	{
+		m_suppressed = 0;
+		m_msgRateTimer.start();
+		qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
+	}
+	else
+	{
+		if (m_msgRateTimer.elapsed() > 2500)
+		{
+			qCritical("SampleSinkFifo::write: %u messages dropped", m_suppressed);
+			qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
+			m_suppressed = -1;
+		}
+		else
+		{
+			m_suppressed++;
+		}
+	}
 }
 
 unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	return writeSamples((const Sample*) data, count / sizeof(Sample));
+}
+
+unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+{
+	if (begin == end) {
+		return 0;
+	}
+
+	return writeSamples(&(*begin), end - begin);
+}
+
+unsigned int SampleSinkFifo::writeSamples(const Sample* begin, unsigned int count)
+{
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = acquire(m_writeHazard);
+	unsigned int size = buffer->m_size;
 
-	if (m_size == 0) {
+	if (size == 0)
+	{
+		release(m_writeHazard);
 		return 0;
 	}
 
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
-	const Sample* begin = (const Sample*)data;
-	count /= sizeof(Sample);
+	unsigned int writePos = buffer->m_writePos.loadAcquire();
+	unsigned int fill = buffer->fill();
 
-	total = std::min(count, m_size - m_fill);
+	total = std::min(count, size - fill);
 
-    if (total < count)
-    {
-		if (m_suppressed < 0)
-        {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-		}
-        else
-        {
-			if (m_msgRateTimer.elapsed() > 2500)
-            {
-				qCritical("SampleSinkFifo::write: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			}
-            else
-            {
-				m_suppressed++;
-			}
-		}
+    if (total < count) {
+		overflow(count, total);
 	}
 
 	remaining = total;
 
     while (remaining > 0)
     {
-		len = std::min(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
-		m_tail += len;
-		m_tail %= m_size;
-		m_fill += len;
+		unsigned int tail = buffer->index(writePos);
+		len = std::min(remaining, size - tail);
+		std::copy(begin, begin + len, buffer->m_data.begin() + tail);
+		writePos = buffer->advance(writePos, len);
 		begin += len;
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
+	// publish the samples to the consumer
+	buffer->m_writePos.storeRelease(writePos);
+	release(m_writeHazard);
+
+	if (fill + total > 0) {
 		emit dataReady();
     }
 
 	return total;
 }
 
-unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+unsigned int SampleSinkFifo::writeBegin(unsigned int count,
+	SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+	SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = acquire(m_writeHazard); // kept until writeCommit
+	unsigned int size = buffer->m_size;
+	*part1Begin = *part1End = *part2Begin = *part2End = buffer->m_data.end();
+
+	if (size == 0)
+	{
+		release(m_writeHazard);
+		return 0;
+	}
+
+	unsigned int total = std::min(count, size - buffer->fill());
 
-	if (m_size == 0) {
+	if (total < count) {
+		overflow(count, total);
+	}
+
+	if (total == 0)
+	{
+		release(m_writeHazard);
 		return 0;
 	}
 
-	unsigned int count = end - begin;
-	unsigned int total;
-	unsigned int remaining;
-	unsigned int len;
+	unsigned int tail = buffer->index(buffer->m_writePos.loadAcquire());
+	unsigned int len = std::min(total, size - tail);
 
-	total = std::min(count, m_size - m_fill);
+	if (len > 0)
+	{
+		*part1Begin = buffer->m_data.begin() + tail;
+		*part1End = buffer->m_data.begin() + tail + len;
+	}
 
-    if (total < count)
-    {
-		if (m_suppressed < 0)
-        {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-		}
-        else
-        {
-			if (m_msgRateTimer.elapsed() > 2500)
-            {
-				qCritical("SampleSinkFifo::write: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			}
-            else
-            {
-				m_suppressed++;
-			}
-		}
+	if (total > len)
+	{
+		*part2Begin = buffer->m_data.begin();
+		*part2End = buffer->m_data.begin() + (total - len);
 	}
 
-	remaining = total;
+	return total;
+}
 
-    while (remaining > 0)
-    {
-		len = std::min(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
-		m_tail += len;
-		m_tail %= m_size;
-		m_fill += len;
-		begin += len;
-		remaining -= len;
+unsigned int SampleSinkFifo::writeCommit(unsigned int count)
+{
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = m_writeHazard.loadAcquire();
+
+	if (!buffer) { // nothing pending from writeBegin
+		return 0;
+	}
+
+	if (buffer != m_buffer.loadAcquire()) // FIFO has been resized since writeBegin
+	{
+		release(m_writeHazard);
+		return 0;
+	}
+
+	unsigned int fill = buffer->fill();
+
+	if (count > buffer->m_size - fill)
+	{
+		qCritical("SampleSinkFifo::writeCommit: cannot commit more than available space");
+		count = buffer->m_size - fill;
 	}
 
-	if (m_fill > 0) {
+	buffer->m_writePos.storeRelease(buffer->advance(buffer->m_writePos.loadAcquire(), count));
+	release(m_writeHazard);
+
+	if (fill + count > 0) {
 		emit dataReady();
-    }
+	}
 
-	return total;
+	return count;
 }
 
 unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::iterator end)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = acquire(m_readHazard);
+	unsigned int size = buffer->m_size;
 
-	if (m_size == 0) {
+	if (size == 0)
+	{
+		release(m_readHazard);
 		return 0;
 	}
 
@@ -214,8 +332,9 @@ unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::it
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
+	unsigned int readPos = buffer->m_readPos.loadAcquire();
 
-	total = std::min(count, m_fill);
+	total = std::min(count, buffer->fill());
 
     if (total < count) {
 		qCritical("SampleSinkFifo::read: underflow - missing %u samples", count - total);
@@ -225,15 +344,18 @@ unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::it
 
     while (remaining > 0)
     {
-		len = std::min(remaining, m_size - m_head);
-		std::copy(m_data.begin() + m_head, m_data.begin() + m_head + len, begin);
-		m_head += len;
-		m_head %= m_size;
-		m_fill -= len;
+		unsigned int head = buffer->index(readPos);
+		len = std::min(remaining, size - head);
+		std::copy(buffer->m_data.begin() + head, buffer->m_data.begin() + head + len, begin);
+		readPos = buffer->advance(readPos, len);
 		begin += len;
 		remaining -= len;
 	}
 
+	// release the space to the producer
+	buffer->m_readPos.storeRelease(readPos);
+	release(m_readHazard);
+
 	return total;
 }
 
@@ -241,18 +363,22 @@ unsigned int SampleSinkFifo::readBegin(unsigned int count,
 	SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
 	SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = acquire(m_readHazard); // kept until readCommit
+	unsigned int size = buffer->m_size;
 
-	if (m_size == 0) {
+	if (size == 0)
+	{
+		release(m_readHazard);
 		return 0;
 	}
 
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
-	unsigned int head = m_head;
+	unsigned int head = buffer->index(buffer->m_readPos.loadAcquire());
 
-	total = std::min(count, m_fill);
+	total = std::min(count, buffer->fill());
 
     if (total < count) {
 		qCritical("SampleSinkFifo::readBegin: underflow - missing %u samples", count - total);
@@ -262,29 +388,33 @@ unsigned int SampleSinkFifo::readBegin(unsigned int count,
 
     if (remaining > 0)
     {
-		len = std::min(remaining, m_size - head);
-		*part1Begin = m_data.begin() + head;
-		*part1End = m_data.begin() + head + len;
+		len = std::min(remaining, size - head);
+		*part1Begin = buffer->m_data.begin() + head;
+		*part1End = buffer->m_data.begin() + head + len;
 		head += len;
-		head %= m_size;
+		head %= size;
 		remaining -= len;
 	}
     else
     {
-		*part1Begin = m_data.end();
-		*part1End = m_data.end();
+		*part1Begin = buffer->m_data.end();
+		*part1End = buffer->m_data.end();
 	}
 
     if (remaining > 0)
     {
-		len = std::min(remaining, m_size - head);
-		*part2Begin = m_data.begin() + head;
-		*part2End = m_data.begin() + head + len;
+		len = std::min(remaining, size - head);
+		*part2Begin = buffer->m_data.begin() + head;
+		*part2End = buffer->m_data.begin() + head + len;
 	}
     else
     {
-		*part2Begin = m_data.end();
-		*part2End = m_data.end();
+		*part2Begin = buffer->m_data.end();
+		*part2End = buffer->m_data.end();
+	}
+
+	if (total == 0) {
+		release(m_readHazard);
 	}
 
 	return total;
@@ -292,20 +422,29 @@ unsigned int SampleSinkFifo::readBegin(unsigned int count,
 
 unsigned int SampleSinkFifo::readCommit(unsigned int count)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(accessMutex());
+	Buffer *buffer = m_readHazard.loadAcquire();
+
+	if (!buffer) { // nothing pending from readBegin
+		return 0;
+	}
 
-	if (m_size == 0) {
+	if (buffer != m_buffer.loadAcquire()) // FIFO has been resized since readBegin
+	{
+		release(m_readHazard);
 		return 0;
 	}
 
-	if (count > m_fill)
+	unsigned int fill = buffer->fill();
+
+	if (count > fill)
     {
 		qCritical("SampleSinkFifo::readCommit: cannot commit more than available samples");
-		count = m_fill;
+		count = fill;
 	}
 
-    m_head = (m_head + count) % m_size;
-	m_fill -= count;
+	buffer->m_readPos.storeRelease(buffer->advance(buffer->m_readPos.loadAcquire(), count));
+	release(m_readHazard);
 
 	return count;
 }
@@ -21,6 +21,10 @@
 
 #include <QObject>
 #include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
 #include <QElapsedTimer>
 #include "dsp/dsptypes.h"
 #include "export.h"
@@ -28,18 +32,54 @@
 class SDRBASE_API SampleSinkFifo : public QObject {
 	Q_OBJECT
 
+public:
+	enum Mode
+	{
+		ModeSPSC,  //!< Lock free single producer single consumer
+		ModeLocked //!< Every access is serialized with a mutex (default)
+	};
+
 private:
+	/**
+	 * Storage and read/write positions. Positions run in [0, 2*size) so that full and empty
+	 * states are distinct. The write position is only updated by the producer and the read
+	 * position only by the consumer. They are kept on separate cache lines.
+	 * On a resize a new buffer is published and the previous one is only freed once neither
+	 * side has it as its hazard buffer anymore.
+	 */
+	struct Buffer
+	{
+		Buffer(unsigned int size);
+		SampleVector m_data;
+		unsigned int m_size;
+		char m_padding0[64];
+		QAtomicInteger<unsigned int> m_writePos;
+		char m_padding1[64];
+		QAtomicInteger<unsigned int> m_readPos;
+		char m_padding2[64];
+
+		unsigned int fill() const;
+		unsigned int index(unsigned int pos) const { return pos < m_size ? pos : pos - m_size; }
+		unsigned int advance(unsigned int pos, unsigned int count) const { pos += count; return pos < 2*m_size ? pos : pos - 2*m_size; }
+	};
+
 	QElapsedTimer m_msgRateTimer;
 	int m_suppressed;
-	SampleVector m_data;
-	QMutex m_mutex;
-
-	unsigned int m_size;
-	unsigned int m_fill;
-	unsigned int m_head;
-	unsigned int m_tail;
+	Mode m_mode;
+	QMutex m_mutex;       //!< serializes all accesses in locked mode
+	QAtomicPointer<Buffer> m_buffer;
+	QAtomicPointer<Buffer> m_readHazard;    //!< buffer in use by the consumer (from readBegin to readCommit)
+	QAtomicPointer<Buffer> m_writeHazard;   //!< buffer in use by the producer (from writeBegin to writeCommit)
+	QAtomicInt m_resizesPending;            //!< resizes waiting for a side to release the previous buffer
+	QMutex m_resizeMutex;     //!< serializes resizes with each other and with reset (taken after m_mutex)
+	QWaitCondition m_hazardReleased;
 
 	void create(unsigned int s);
+	QMutex *accessMutex() { return m_mode == ModeLocked ? &m_mutex : nullptr; }
+	Buffer *acquire(QAtomicPointer<Buffer>& hazard);
+	void release(QAtomicPointer<Buffer>& hazard);
+	void overflow(unsigned int count, unsigned int total);
+	unsigned int writeSamples(const Sample* begin, unsigned int count);
 
 public:
 	SampleSinkFifo(QObject* parent = nullptr);
@@ -47,14 +87,23 @@ public:
     SampleSinkFifo(const SampleSinkFifo& other);
 	~SampleSinkFifo();
 
+	void setMode(Mode mode) { m_mode = mode; } //!< To be set before the FIFO is used
+	Mode getMode() const { return m_mode; }
 	bool setSize(int size);
     void reset();
-	inline unsigned int size() { QMutexLocker mutexLocker(&m_mutex); unsigned int size = m_size; return size; }
-	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
+	unsigned int size();
+	unsigned int fill(); //!< Consumer side
 
 	unsigned int write(const quint8* data, unsigned int count);
 	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
 
+	/** Producer side zero copy: get the free space for up to count samples in one or two parts,
+	 *  fill it in place then publish it with writeCommit */
+	unsigned int writeBegin(unsigned int count,
+		SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
+	unsigned int writeCommit(unsigned int count);
+
 	unsigned int read(SampleVector::iterator begin, SampleVector::iterator end);
 
 	unsigned int readBegin(unsigned int count,
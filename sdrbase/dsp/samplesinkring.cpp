@@ -0,0 +1,353 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+
+#include <QDebug>
+
+#include "dsp/channelsamplesink.h"
+#include "util/messagequeue.h"
+#include "samplesinkring.h"
+
+SampleSinkRingReader::SampleSinkRingReader(SampleSinkRing *ring) :
+    m_ring(ring),
+    m_readPos(0),
+    m_locked(false),
+    m_slow(0),
+    m_overrunSamples(0),
+    m_overrunCount(0),
+    m_suppressed(-1)
+{}
+
+SampleSinkRingReader::~SampleSinkRingReader()
+{}
+
+unsigned int SampleSinkRingReader::fill()
+{
+    quint32 lag = m_ring->m_writePos.loadAcquire() - m_readPos.loadAcquire();
+    return std::min(lag, (quint32) m_ring->m_size);
+}
+
+unsigned int SampleSinkRingReader::lag()
+{
+    return m_ring->m_writePos.loadAcquire() - m_readPos.loadAcquire();
+}
+
+void SampleSinkRingReader::reset()
+{
+    m_readPos.storeRelease(m_ring->m_writePos.loadAcquire());
+    m_suppressed = -1;
+}
+
+unsigned int SampleSinkRingReader::readBegin(unsigned int count,
+    SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+    SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
+{
+    if (!m_locked)
+    {
+        m_ring->m_dataLock.lockForRead(); // released by readCommit
+        m_locked = true;
+    }
+
+    SampleVector& data = m_ring->m_data;
+    unsigned int size = m_ring->m_size;
+    *part1Begin = m_copy.end();
+    *part1End = m_copy.end();
+    *part2Begin = m_copy.end();
+    *part2End = m_copy.end();
+
+    if (size == 0) {
+        return 0;
+    }
+
+    quint32 writePos = m_ring->m_writePos.loadAcquire();
+    quint32 readPos = m_readPos.loadAcquire();
+
+    // the oldest unread samples may be overwritten by the next write: move this reader forward to half the ring
+    if (writePos - readPos > size - size/4)
+    {
+        overrun(writePos - size/2 - readPos);
+        readPos = writePos - size/2;
+        m_readPos.storeRelease(readPos);
+    }
+
+    unsigned int total = std::min(count, (unsigned int) (writePos - readPos));
+    unsigned int head = readPos & m_ring->m_mask;
+    unsigned int len1 = std::min(total, size - head);
+    unsigned int len2 = total - len1;
+
+    if (total == 0) {
+        return 0;
+    }
+
+    if (m_copy.size() < total) {
+        m_copy.resize(total);
+    }
+
+    std::copy(data.begin() + head, data.begin() + head + len1, m_copy.begin());
+    std::copy(data.begin(), data.begin() + len2, m_copy.begin() + len1);
+
+    // samples copied before the write in progress reached them are valid
+    std::atomic_thread_fence(std::memory_order_acquire);
+    quint32 validPos = m_ring->m_writeReserve.loadAcquire() - size;
+    unsigned int lost = (quint32) (validPos - readPos) > size ? 0 : std::min(total, (unsigned int) (validPos - readPos));
+
+    if (lost > 0)
+    {
+        overrun(lost);
+        readPos += lost;
+        m_readPos.storeRelease(readPos);
+    }
+
+    *part1Begin = m_copy.begin() + lost;
+    *part1End = m_copy.begin() + total;
+
+    return total - lost;
+}
+
+unsigned int SampleSinkRingReader::readCommit(unsigned int count)
+{
+    if (!m_locked) {
+        m_ring->m_dataLock.lockForRead();
+    }
+
+    if (m_ring->m_size != 0)
+    {
+        quint32 writePos = m_ring->m_writePos.loadAcquire();
+        quint32 readPos = m_readPos.loadAcquire();
+        count = std::min(count, (unsigned int) (writePos - readPos));
+        m_readPos.storeRelease(readPos + count);
+    }
+    else
+    {
+        count = 0;
+    }
+
+    m_locked = false;
+    m_ring->m_dataLock.unlock();
+
+    return count;
+}
+
+void SampleSinkRingReader::overrun(quint32 nbSamples)
+{
+    m_overrunSamples.fetchAndAddRelaxed(nbSamples);
+    m_overrunCount.fetchAndAddRelaxed(1);
+
+    if (m_suppressed < 0)
+    {
+        m_suppressed = 0;
+        m_msgRateTimer.start();
+        qCritical("SampleSinkRingReader::overrun: %s: lost %u samples", qPrintable(objectName()), nbSamples);
+    }
+    else
+    {
+        if (m_msgRateTimer.elapsed() > 2500)
+        {
+            qCritical("SampleSinkRingReader::overrun: %s: %u messages dropped", qPrintable(objectName()), m_suppressed);
+            qCritical("SampleSinkRingReader::overrun: %s: lost %u samples", qPrintable(objectName()), nbSamples);
+            m_suppressed = -1;
+        }
+        else
+        {
+            m_suppressed++;
+        }
+    }
+}
+
+SampleSinkRing::SampleSinkRing() :
+    m_size(0),
+    m_mask(0),
+    m_writePos(0),
+    m_writeReserve(0)
+{}
+
+SampleSinkRing::~SampleSinkRing()
+{
+    QMutexLocker mutexLocker(&m_readersMutex);
+
+    for (auto reader : m_readers) {
+        delete reader;
+    }
+
+    m_readers.clear();
+}
+
+void SampleSinkRing::setSize(unsigned int size)
+{
+    unsigned int ringSize = 1;
+
+    while (ringSize < size) {
+        ringSize <<= 1;
+    }
+
+    if (size == 0) {
+        ringSize = 0;
+    }
+
+    QWriteLocker dataLocker(&m_dataLock);
+
+    if (ringSize == m_size) {
+        return;
+    }
+
+    qDebug("SampleSinkRing::setSize: %u (%u)", ringSize, size);
+    m_data.resize(ringSize);
+    m_size = ringSize;
+    m_mask = ringSize == 0 ? 0 : ringSize - 1;
+    m_writePos.storeRelease(0);
+    m_writeReserve.storeRelease(0);
+
+    QMutexLocker mutexLocker(&m_readersMutex);
+
+    for (auto reader : m_readers)
+    {
+        reader->m_readPos.storeRelease(0);
+        reader->m_slow.storeRelease(0);
+    }
+}
+
+SampleSinkRingReader *SampleSinkRing::addReader()
+{
+    SampleSinkRingReader *reader = new SampleSinkRingReader(this);
+    reader->reset();
+    QMutexLocker mutexLocker(&m_readersMutex);
+    m_readers.push_back(reader);
+    return reader;
+}
+
+void SampleSinkRing::removeReader(SampleSinkRingReader *reader)
+{
+    QMutexLocker mutexLocker(&m_readersMutex);
+    m_readers.remove(reader);
+    delete reader;
+}
+
+int SampleSinkRing::getNbReaders()
+{
+    QMutexLocker mutexLocker(&m_readersMutex);
+    return m_readers.size();
+}
+
+void SampleSinkRing::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+{
+    QReadLocker dataLocker(&m_dataLock);
+
+    if (m_size == 0) {
+        return;
+    }
+
+    unsigned int count = end - begin;
+
+    if (count > m_size) // keep only the most recent samples
+    {
+        begin += count - m_size;
+        count = m_size;
+    }
+
+    quint32 writePos = m_writePos.loadAcquire();
+
+    // announce the overwritten region before writing so that readers copying it can detect it
+    m_writeReserve.storeRelease(writePos + count);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    unsigned int tail = writePos & m_mask;
+    unsigned int len = std::min(count, m_size - tail);
+    std::copy(begin, begin + len, m_data.begin() + tail);
+
+    if (len < count) {
+        std::copy(begin + len, begin + count, m_data.begin());
+    }
+
+    writePos += count;
+    m_writePos.storeRelease(writePos);
+
+    QMutexLocker mutexLocker(&m_readersMutex);
+
+    for (auto reader : m_readers)
+    {
+        bool slow = (writePos - reader->m_readPos.loadAcquire()) > m_size/2;
+
+        if (slow != (reader->m_slow.loadAcquire() != 0))
+        {
+            reader->m_slow.storeRelease(slow ? 1 : 0);
+            qWarning("SampleSinkRing::write: %s: slow reader %s", qPrintable(reader->objectName()), slow ? "detected" : "recovered");
+        }
+
+        emit reader->dataReady();
+    }
+}
+
+SampleSinkRingInput::SampleSinkRingInput() :
+    m_reader(nullptr),
+    m_sink(nullptr)
+{}
+
+SampleSinkRingInput::~SampleSinkRingInput()
+{}
+
+void SampleSinkRingInput::setReader(SampleSinkRingReader *reader)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_reader) {
+        QObject::disconnect(m_reader, &SampleSinkRingReader::dataReady, this, &SampleSinkRingInput::dataReady);
+    }
+
+    m_reader = reader;
+
+    if (m_reader) {
+        QObject::connect(m_reader, &SampleSinkRingReader::dataReady, this, &SampleSinkRingInput::dataReady, Qt::DirectConnection);
+    }
+}
+
+void SampleSinkRingInput::reset()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_reader) {
+        m_reader->reset();
+    }
+}
+
+bool SampleSinkRingInput::read(MessageQueue& inputMessageQueue)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_reader) {
+        return false;
+    }
+
+    while ((m_reader->fill() > 0) && (inputMessageQueue.size() == 0))
+    {
+        SampleVector::iterator part1begin;
+        SampleVector::iterator part1end;
+        SampleVector::iterator part2begin;
+        SampleVector::iterator part2end;
+
+        unsigned int count = m_reader->readBegin(m_reader->fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+        if (m_sink && (part1begin != part1end)) { // samples are handed out in one part
+            m_sink->feed(part1begin, part1end);
+        }
+
+        m_reader->readCommit(count);
+    }
+
+    return true;
+}
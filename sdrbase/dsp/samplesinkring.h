@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_SAMPLESINKRING_H
+#define INCLUDE_SAMPLESINKRING_H
+
+#include <list>
+
+#include <QObject>
+#include <QMutex>
+#include <QReadWriteLock>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class SampleSinkRing;
+class ChannelSampleSink;
+class MessageQueue;
+
+/**
+ * Read cursor on a SampleSinkRing. Samples are read with the same readBegin/readCommit
+ * sequence as SampleSinkFifo. A readBegin must always be followed by a readCommit from
+ * the same thread. Samples are copied to a private buffer and checked against the write
+ * in progress after the copy: those the writer has overwritten meanwhile are dropped and
+ * accounted as overrun so that the writer never waits for a reader.
+ */
+class SDRBASE_API SampleSinkRingReader : public QObject
+{
+    Q_OBJECT
+public:
+    unsigned int fill();   //!< Number of samples available to this reader
+    unsigned int lag();    //!< Distance to the write point (may exceed ring size when overrun)
+    void reset();          //!< Skip all pending samples
+    unsigned int readBegin(unsigned int count,
+        SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+        SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
+    unsigned int readCommit(unsigned int count);
+    quint64 getOverrunSamples() const { return m_overrunSamples.loadAcquire(); }
+    quint32 getOverrunCount() const { return m_overrunCount.loadAcquire(); }
+    bool isSlow() const { return m_slow.loadAcquire() != 0; }
+
+signals:
+    void dataReady();
+
+private:
+    friend class SampleSinkRing;
+
+    SampleSinkRingReader(SampleSinkRing *ring);
+    ~SampleSinkRingReader();
+
+    SampleSinkRing *m_ring;
+    QAtomicInteger<quint32> m_readPos;        //!< Absolute read position (wraps at 2^32)
+    bool m_locked;                            //!< Ring read lock taken by readBegin
+    SampleVector m_copy;                      //!< Samples handed out by readBegin
+    QAtomicInt m_slow;                        //!< Reader is lagging more than half the ring
+    QAtomicInteger<quint64> m_overrunSamples; //!< Total samples lost by this reader
+    QAtomicInteger<quint32> m_overrunCount;   //!< Number of overrun events
+    QElapsedTimer m_msgRateTimer;
+    int m_suppressed;
+
+    void overrun(quint32 nbSamples);
+};
+
+/**
+ * Single writer multiple readers sample ring. The device engine writes the baseband
+ * samples once and each channel reads them through its own cursor. The writer never waits:
+ * a reader lagging by more than 3/4 of the ring is moved forward and a reader overtaken
+ * while it copies drops the overwritten samples. Lost samples are accounted as overrun.
+ */
+class SDRBASE_API SampleSinkRing
+{
+public:
+    SampleSinkRing();
+    ~SampleSinkRing();
+
+    void setSize(unsigned int size); //!< Size is rounded up to the next power of two. Readers are reset.
+    unsigned int size() const { return m_size; }
+    SampleSinkRingReader *addReader();               //!< Create a new read cursor at the current write point
+    void removeReader(SampleSinkRingReader *reader); //!< Remove and delete a read cursor
+    int getNbReaders();
+    void write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
+
+private:
+    friend class SampleSinkRingReader;
+
+    SampleVector m_data;
+    unsigned int m_size; //!< power of two
+    quint32 m_mask;
+    QAtomicInteger<quint32> m_writePos;     //!< Absolute write position (wraps at 2^32)
+    QAtomicInteger<quint32> m_writeReserve; //!< End of the samples being written: samples before m_writeReserve - m_size are overwritten
+    QReadWriteLock m_dataLock;              //!< Write locked only when the buffer is re-allocated
+    QMutex m_readersMutex;                  //!< Protects the readers list
+    std::list<SampleSinkRingReader*> m_readers;
+};
+
+/**
+ * Ring input of a channel baseband. Relays the data ready signal of the attached read cursor
+ * and feeds the samples read to the baseband sink, usually its channelizer.
+ */
+class SDRBASE_API SampleSinkRingInput : public QObject
+{
+    Q_OBJECT
+public:
+    SampleSinkRingInput();
+    ~SampleSinkRingInput();
+
+    void setSink(ChannelSampleSink *sink) { m_sink = sink; }
+    void setReader(SampleSinkRingReader *reader); //!< Attach (or detach with nullptr) a read cursor
+    void reset();                                 //!< Skip all pending samples
+    bool read(MessageQueue& inputMessageQueue);   //!< Feed pending samples until messages are queued. False if no cursor is attached.
+
+signals:
+    void dataReady(); //!< Emitted from the writer thread: connect with a queued connection
+
+private:
+    SampleSinkRingReader *m_reader;
+    ChannelSampleSink *m_sink;
+    QMutex m_mutex; //!< Serializes reads with attach and detach
+};
+
+#endif // INCLUDE_SAMPLESINKRING_H
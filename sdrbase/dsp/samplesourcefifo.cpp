@@ -21,7 +21,14 @@ const unsigned int SampleSourceFifo::m_rwDivisor = 2;
 const unsigned int SampleSourceFifo::m_guardDivisor = 10;
 
 SampleSourceFifo::SampleSourceFifo(QObject *parent) :
-    QObject(parent)
+    QObject(parent),
+    m_size(0),
+    m_lowGuard(0),
+    m_highGuard(0),
+    m_midPoint(0),
+    m_readHead(0),
+    m_writeHead(0),
+    m_readCount(0)
 {}
 
 SampleSourceFifo::SampleSourceFifo(unsigned int size, QObject *parent) :
@@ -37,18 +44,18 @@ void SampleSourceFifo::resize(unsigned int size)
     m_lowGuard = m_size / m_guardDivisor;
     m_highGuard = m_size - (m_size/m_guardDivisor);
     m_midPoint = m_size / m_rwDivisor;
-	m_readCount = 0;
-    m_readHead = 0;
-    m_writeHead = m_midPoint;
+    m_readCount.storeRelease(0);
+    m_readHead.storeRelease(0);
+    m_writeHead.storeRelease(m_midPoint);
     m_data.resize(size);
 }
 
 void SampleSourceFifo::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
-	m_readCount = 0;
-    m_readHead = 0;
-    m_writeHead = m_midPoint;
+    m_readCount.storeRelease(0);
+    m_readHead.storeRelease(0);
+    m_writeHead.storeRelease(m_midPoint);
 }
 
 SampleSourceFifo::~SampleSourceFifo()
@@ -61,25 +68,31 @@ void SampleSourceFifo::read(
 )
 {
     QMutexLocker mutexLocker(&m_mutex);
-    unsigned int spaceLeft = m_size - m_readHead;
-    m_readCount = m_readCount + amount < m_size ? m_readCount + amount : m_size; // cannot exceed FIFO size
+    unsigned int readHead = m_readHead.loadAcquire();
+    unsigned int spaceLeft = m_size - readHead;
+    unsigned int readCount = m_readCount.loadAcquire();
+
+    // cannot exceed FIFO size
+    while (!m_readCount.testAndSetOrdered(readCount, readCount + amount < m_size ? readCount + amount : m_size)) {
+        readCount = m_readCount.loadAcquire();
+    }
 
     if (amount <= spaceLeft)
     {
-        ipart1Begin = m_readHead;
-        ipart1End = m_readHead + amount;
+        ipart1Begin = readHead;
+        ipart1End = readHead + amount;
         ipart2Begin = m_size;
         ipart2End = m_size;
-        m_readHead += amount;
+        m_readHead.storeRelease(readHead + amount);
     }
     else
     {
         unsigned int remaining = (amount < m_size ? amount : m_size) - spaceLeft;
-        ipart1Begin = m_readHead;
+        ipart1Begin = readHead;
         ipart1End = m_size;
         ipart2Begin = 0;
         ipart2End = remaining;
-        m_readHead = remaining;
+        m_readHead.storeRelease(remaining);
     }
 
     emit dataRead();
@@ -92,40 +105,47 @@ void SampleSourceFifo::write(
 )
 {
     QMutexLocker mutexLocker(&m_mutex);
-    unsigned int rwDelta = m_writeHead >= m_readHead ? m_writeHead - m_readHead : m_size - (m_readHead - m_writeHead);
+    unsigned int readHead = m_readHead.loadAcquire();
+    unsigned int writeHead = m_writeHead.loadAcquire();
+    unsigned int rwDelta = writeHead >= readHead ? writeHead - readHead : m_size - (readHead - writeHead);
 
     if (rwDelta < m_lowGuard)
     {
         qWarning("SampleSourceFifo::write: underrun (write too slow) using %d old samples", m_midPoint - m_lowGuard);
-        m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
+        writeHead = readHead + m_midPoint < m_size ? readHead + m_midPoint : readHead + m_midPoint - m_size;
     }
     else if (rwDelta > m_highGuard)
     {
         qWarning("SampleSourceFifo::write: overrrun (read too slow) dropping %d samples", m_highGuard - m_midPoint);
-        m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
+        writeHead = readHead + m_midPoint < m_size ? readHead + m_midPoint : readHead + m_midPoint - m_size;
     }
 
-    unsigned int spaceLeft = m_size - m_writeHead;
+    unsigned int spaceLeft = m_size - writeHead;
 
     if (amount <= spaceLeft)
     {
-        ipart1Begin = m_writeHead;
-        ipart1End = m_writeHead + amount;
+        ipart1Begin = writeHead;
+        ipart1End = writeHead + amount;
         ipart2Begin = m_size;
         ipart2End = m_size;
-        m_writeHead += amount;
+        m_writeHead.storeRelease(writeHead + amount);
     }
     else
     {
         unsigned int remaining = (amount < m_size ? amount : m_size) - spaceLeft;
-        ipart1Begin = m_writeHead;
+        ipart1Begin = writeHead;
         ipart1End = m_size;
         ipart2Begin = 0;
         ipart2End = remaining;
-        m_writeHead = remaining;
+        m_writeHead.storeRelease(remaining);
     }
 
-    m_readCount = amount < m_readCount ? m_readCount - amount : 0; // cannot be less than 0
+    // cannot be less than 0
+    unsigned int readCount = m_readCount.loadAcquire();
+
+    while (!m_readCount.testAndSetOrdered(readCount, amount < readCount ? readCount - amount : 0)) {
+        readCount = m_readCount.loadAcquire();
+    }
 }
 
 unsigned int SampleSourceFifo::getSizePolicy(unsigned int sampleRate)
@@ -20,6 +20,7 @@
 
 #include <QObject>
 #include <QMutex>
+#include <QAtomicInteger>
 #include "dsp/dsptypes.h"
 #include "export.h"
 
@@ -45,17 +46,18 @@ public:
     );
     unsigned int remainder()
     {
-        QMutexLocker mutexLocker(&m_mutex);
-        return m_readCount;
+        return m_readCount.loadAcquire();
     }
     /** returns ratio of off center over buffer size with sign: negative read lags and positive read leads */
     float getRWBalance() const
     {
         int delta;
-        if (m_writeHead > m_readHead) {
-            delta = (m_size/m_rwDivisor) - (m_writeHead - m_readHead);
+        unsigned int writeHead = m_writeHead.loadAcquire();
+        unsigned int readHead = m_readHead.loadAcquire();
+        if (writeHead > readHead) {
+            delta = (m_size/m_rwDivisor) - (writeHead - readHead);
         } else {
-            delta = (m_readHead - m_writeHead) - (m_size/m_rwDivisor);
+            delta = (readHead - writeHead) - (m_size/m_rwDivisor);
         }
         return delta / (float) m_size;
     }
@@ -74,10 +76,13 @@ private:
     unsigned int m_lowGuard;
     unsigned int m_highGuard;
     unsigned int m_midPoint;
-    unsigned int m_readHead;
-    unsigned int m_writeHead;
-    unsigned int m_readCount;
-    QMutex m_mutex;
+    char m_padding0[64];
+    QAtomicInteger<unsigned int> m_readHead;  //!< updated by the reader only
+    char m_padding1[64];
+    QAtomicInteger<unsigned int> m_writeHead; //!< updated by the writer only
+    char m_padding2[64];
+    QAtomicInteger<unsigned int> m_readCount; //!< incremented by the reader and decremented by the writer
+    QMutex m_mutex; //!< serializes read, write, resize and reset (readers index m_data after read returns)
 };
 
 #endif // SDRBASE_DSP_SAMPLESOURCEFIFO_H_
\ No newline at end of file
@@ -20,10 +20,19 @@
 #include <QDebug>
 #include <QMutexLocker>
 
+#include <limits>
+
 #include "scopevis.h"
 #include "spectrumvis.h"
 #include "dsp/dspcommands.h"
 #include "dsp/glscopeinterface.h"
+#include "dsp/cpufeatures.h"
+
+#if defined(SDR_SIMD_X86)
+#include <immintrin.h>
+#elif defined(SDR_SIMD_NEON)
+#include <arm_neon.h>
+#endif
 
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgConfigureScopeVis, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisAddTrigger, Message)
@@ -61,6 +70,8 @@ ScopeVis::ScopeVis() :
     m_sampleRate(0),
     m_liveSampleRate(0),
     m_traceDiscreteMemory(GLScopeSettings::m_nbTraceMemories),
+    m_captureBuffer(1<<17),
+    m_processingThread(this),
     m_freeRun(true),
     m_maxTraceDelay(0),
     m_mutex(QMutex::Recursive),
@@ -70,18 +81,25 @@ ScopeVis::ScopeVis() :
 {
     setObjectName("ScopeVis");
     m_traceDiscreteMemory.resize(GLScopeSettings::m_traceChunkDefaultSize); // arbitrary
-    m_convertBuffers.resize(GLScopeSettings::m_traceChunkDefaultSize);
 
     for (int i = 0; i < (int) Projector::nbProjectionTypes; i++) {
         m_projectorCache[i] = 0.0;
     }
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    m_processingThread.start();
 }
 
 ScopeVis::~ScopeVis()
 {
     disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    m_processingThread.requestInterruption();
+    m_captureReady.release();
+    m_processingThread.wait();
+
+    if (m_captureBuffer.m_dropped.load() > 0) {
+        qDebug("ScopeVis::~ScopeVis: %u samples dropped", m_captureBuffer.m_dropped.load());
+    }
 
     for (std::vector<TriggerCondition*>::iterator it = m_triggerConditions.begin(); it != m_triggerConditions.end(); ++ it) {
         delete *it;
@@ -141,7 +159,7 @@ void ScopeVis::setNbStreams(uint32_t nbStreams)
     if (m_nbStreams != nbStreams)
     {
         m_traceDiscreteMemory.setNbStreams(nbStreams);
-        m_convertBuffers.setNbStreams(nbStreams);
+        m_captureBuffer.setNbStreams(nbStreams);
         m_nbStreams = nbStreams;
     }
 }
@@ -418,34 +436,28 @@ void ScopeVis::setMemoryIndex(uint32_t memoryIndex)
     getInputMessageQueue()->push(cmd);
 }
 
-void ScopeVis::feed(const std::vector<SampleVector::const_iterator>& vbegin, int nbSamples)
-{
-    std::vector<ComplexVector::const_iterator> vcbegin;
-    std::vector<ComplexVector>& convertBuffers = m_convertBuffers.getBuffers();
-
-    if (nbSamples > (int) m_convertBuffers.size()) {
-        m_convertBuffers.resize(nbSamples);
-    }
+static inline Complex toComplex(const Sample& s) {
+    return Complex{s.m_real / SDR_RX_SCALEF, s.m_imag / SDR_RX_SCALEF};
+}
 
-    for (unsigned int s = 0; s < vbegin.size(); s++)
-    {
-        std::transform(
-            vbegin[s],
-            vbegin[s] + nbSamples,
-            convertBuffers[s].begin(),
-            [](const Sample& s) -> Complex {
-                return Complex{s.m_real / SDR_RX_SCALEF, s.m_imag / SDR_RX_SCALEF};
-            }
-        );
-        vcbegin.push_back(convertBuffers[s].begin());
-    }
+static inline const Complex& toComplex(const Complex& s) {
+    return s;
+}
 
-    feed(vcbegin, nbSamples);
+void ScopeVis::feed(const std::vector<SampleVector::const_iterator>& vbegin, int nbSamples)
+{
+    capture(vbegin, nbSamples);
 }
 
 void ScopeVis::feed(const std::vector<ComplexVector::const_iterator>& vbegin, int nbSamples)
 {
-    if (vbegin.size() == 0) {
+    capture(vbegin, nbSamples);
+}
+
+template<typename T>
+void ScopeVis::capture(const std::vector<T>& vbegin, int nbSamples)
+{
+    if ((vbegin.size() == 0) || (nbSamples <= 0)) {
         return;
     }
 
@@ -453,14 +465,82 @@ void ScopeVis::feed(const std::vector<ComplexVector::const_iterator>& vbegin, in
         return;
     }
 
-    if (!m_mutex.tryLock(0)) { // prevent conflicts with configuration process
+    if (!m_captureBuffer.beginWrite()) { // streams are being reallocated
         return;
     }
 
+    uint32_t count = std::min((uint32_t) nbSamples, m_captureBuffer.writable());
+    uint32_t writePos = m_captureBuffer.m_writePos.load(std::memory_order_relaxed);
+    unsigned int nbStreams = std::min(vbegin.size(), m_captureBuffer.m_streams.size());
+
+    for (unsigned int s = 0; s < nbStreams; s++)
+    {
+        ComplexVector& ring = m_captureBuffer.m_streams[s];
+        T it = vbegin[s];
+        uint32_t index = writePos & (m_captureBuffer.m_size - 1);
+        uint32_t part1 = std::min(count, m_captureBuffer.m_size - index);
+
+        for (uint32_t i = 0; i < part1; i++, ++it) {
+            ring[index + i] = toComplex(*it);
+        }
+
+        for (uint32_t i = 0; i < count - part1; i++, ++it) {
+            ring[i] = toComplex(*it);
+        }
+    }
+
+    m_captureBuffer.endWrite(count);
+
+    if (count < (uint32_t) nbSamples) {
+        m_captureBuffer.m_dropped.fetch_add(nbSamples - count, std::memory_order_relaxed);
+    }
+
+    if (m_captureReady.available() == 0) {
+        m_captureReady.release();
+    }
+}
+
+void ScopeVis::processCaptures()
+{
+    std::vector<ComplexVector::const_iterator> vbegin;
+
+    while (true)
+    {
+        m_captureReady.acquire();
+
+        if (m_processingThread.isInterruptionRequested()) {
+            break;
+        }
+
+        QMutexLocker configLocker(&m_mutex); // prevent conflicts with configuration process
+        uint32_t count = m_captureBuffer.readable();
+
+        while (count > 0)
+        {
+            uint32_t readPos = m_captureBuffer.m_readPos.load(std::memory_order_relaxed);
+            uint32_t index = readPos & (m_captureBuffer.m_size - 1);
+            uint32_t part = std::min(count, m_captureBuffer.m_size - index);
+            vbegin.clear();
+
+            for (const auto& ring : m_captureBuffer.m_streams) {
+                vbegin.push_back(ring.begin() + index);
+            }
+
+            if (m_currentTraceMemoryIndex == 0) { // in memory mode live trace is suspended
+                processCapture(vbegin, part);
+            }
+
+            m_captureBuffer.m_readPos.store(readPos + part, std::memory_order_release);
+            count -= part;
+        }
+    }
+}
+
+void ScopeVis::processCapture(const std::vector<ComplexVector::const_iterator>& vbegin, int nbSamples)
+{
     if (m_triggerWaitForReset)
     {
         m_triggerLocation = 0;
-        m_mutex.unlock();
         return;
     }
 
@@ -504,15 +584,13 @@ void ScopeVis::feed(const std::vector<ComplexVector::const_iterator>& vbegin, in
             m_triggerLocation = m_triggerLocation < 0 ? 0 : m_triggerLocation; // trim negative values
             m_triggerLocation = m_triggerLocation > remainder ? remainder : m_triggerLocation; // trim past begin values
 
-            for (auto begin : nvbegin) {
+            for (auto& begin : nvbegin) {
                 begin += m_traceSize;
             }
 
             remainder -= m_traceSize;
         }
     }
-
-    m_mutex.unlock();
 }
 
 void ScopeVis::processMemoryTrace()
@@ -575,7 +653,7 @@ void ScopeVis::processTrace(const std::vector<ComplexVector::const_iterator>& vc
             {
                 if (triggerCondition->m_triggerDelayCount > 0) // skip samples during delay period
                 {
-                    for (auto begin : vbegin) {
+                    for (auto& begin : vbegin) {
                         begin += triggerCondition->m_triggerDelayCount;
                     }
                     processed += triggerCondition->m_triggerDelayCount;
@@ -589,7 +667,7 @@ void ScopeVis::processTrace(const std::vector<ComplexVector::const_iterator>& vc
                     {
                         m_triggerComparator.reset();
                         m_triggerState = TriggerUntriggered;
-                        for (auto begin : vbegin) {
+                        for (auto& begin : vbegin) {
                             ++begin;
                         }
                         ++processed;
@@ -609,6 +687,19 @@ void ScopeVis::processTrace(const std::vector<ComplexVector::const_iterator>& vc
             }
 
             uint32_t triggerStreamIndex = triggerCondition->m_triggerData.m_streamIndex;
+            int untriggered = m_triggerComparator.untriggeredLength(&(*vbegin[triggerStreamIndex]), firstRemainder, *triggerCondition);
+
+            if (untriggered > 0) // skip samples that cannot match the current trigger
+            {
+                for (auto& begin : vbegin) {
+                    begin += untriggered;
+                }
+
+                processed += untriggered;
+                firstRemainder -= untriggered;
+                continue;
+            }
+
             const Complex& s = *vbegin[triggerStreamIndex];
 
             if (m_triggerComparator.triggered(s, *triggerCondition)) // matched the current trigger
@@ -617,7 +708,7 @@ void ScopeVis::processTrace(const std::vector<ComplexVector::const_iterator>& vc
                 {
                     triggerCondition->m_triggerDelayCount = triggerCondition->m_triggerData.m_triggerDelay; // initialize delayed samples counter
                     m_triggerState = TriggerDelay;
-                    for (auto begin : vbegin) {
+                    for (auto& begin : vbegin) {
                         ++begin;
                     }
                     ++processed;
@@ -641,7 +732,7 @@ void ScopeVis::processTrace(const std::vector<ComplexVector::const_iterator>& vc
                 }
             }
 
-            for (auto begin : vbegin) {
+            for (auto& begin : vbegin) {
                 ++begin;
             }
 
@@ -723,6 +814,312 @@ void ScopeVis::processTrace(const std::vector<ComplexVector::const_iterator>& vc
     }
 }
 
+/**
+ * Trigger search fast path. The samples are compared to the trigger level with a guard band
+ * around it ([lo, hi]) so that the comparison is certain whatever the rounding of the projection
+ * used by the comparator. The search stops on the first sample that makes an edge of the selected
+ * kind or that falls in the guard band. These samples are left to the comparator.
+ */
+enum TriggerComponent
+{
+    TriggerComponentReal,
+    TriggerComponentImag,
+    TriggerComponentMagSq
+};
+
+enum TriggerEdges
+{
+    TriggerEdgePositive = 1,
+    TriggerEdgeNegative = 2
+};
+
+static inline float triggerComponent(const Complex& s, TriggerComponent component)
+{
+    if (component == TriggerComponentReal) {
+        return s.real();
+    } else if (component == TriggerComponentImag) {
+        return s.imag();
+    } else {
+        return s.real()*s.real() + s.imag()*s.imag();
+    }
+}
+
+static int untriggeredScalar(const Complex *s, int start, int length, TriggerComponent component, float lo, float hi, int edges, bool& prev)
+{
+    for (int i = start; i < length; i++)
+    {
+        float v = triggerComponent(s[i], component);
+        bool high = v > hi;
+
+        if ((v > lo) && !high) { // in guard band
+            return i;
+        }
+
+        if ((high != prev) && (edges & (high ? TriggerEdgePositive : TriggerEdgeNegative))) {
+            return i;
+        }
+
+        prev = high;
+    }
+
+    return length;
+}
+
+// Stop bits of a block of nbBits samples given the comparison bits with both thresholds
+static inline unsigned int untriggeredStops(unsigned int highs, unsigned int lows, int nbBits, int edges, bool prev)
+{
+    unsigned int all = (1U << nbBits) - 1;
+    unsigned int previous = ((highs << 1) | (prev ? 1 : 0)) & all;
+    unsigned int stops = lows & ~highs;
+
+    if (edges & TriggerEdgePositive) {
+        stops |= highs & ~previous;
+    }
+
+    if (edges & TriggerEdgeNegative) {
+        stops |= ~highs & previous & all;
+    }
+
+    return stops;
+}
+
+// Position of the first stop in block starting at i and condition of the sample before
+static inline int untriggeredStop(unsigned int stops, unsigned int highs, int i, bool& prev)
+{
+    int k = 0;
+
+    for (; !(stops & 1); k++) {
+        stops >>= 1;
+    }
+
+    if (k > 0) {
+        prev = (highs >> (k - 1)) & 1;
+    }
+
+    return i + k;
+}
+
+#if defined(SDR_SIMD_X86)
+static SDR_SIMD_TARGET_SSE2 int untriggeredSSE2(const Complex *s, int length, TriggerComponent component, float lo, float hi, int edges, bool& prev)
+{
+    const float *p = reinterpret_cast<const float*>(s);
+    __m128 vlo = _mm_set1_ps(lo);
+    __m128 vhi = _mm_set1_ps(hi);
+    int i = 0;
+
+    for (; i + 4 <= length; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(&p[2*i]);     // re0 im0 re1 im1
+        __m128 b = _mm_loadu_ps(&p[2*i + 4]); // re2 im2 re3 im3
+        __m128 v;
+
+        if (component == TriggerComponentReal)
+        {
+            v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        }
+        else if (component == TriggerComponentImag)
+        {
+            v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+        else
+        {
+            __m128 re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            v = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        }
+
+        unsigned int highs = _mm_movemask_ps(_mm_cmpgt_ps(v, vhi));
+        unsigned int lows = _mm_movemask_ps(_mm_cmpgt_ps(v, vlo));
+        unsigned int stops = untriggeredStops(highs, lows, 4, edges, prev);
+
+        if (stops) {
+            return untriggeredStop(stops, highs, i, prev);
+        }
+
+        prev = (highs >> 3) & 1;
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 int untriggeredAVX2(const Complex *s, int length, TriggerComponent component, float lo, float hi, int edges, bool& prev)
+{
+    const float *p = reinterpret_cast<const float*>(s);
+    __m256 vlo = _mm256_set1_ps(lo);
+    __m256 vhi = _mm256_set1_ps(hi);
+    int i = 0;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        __m256 a = _mm256_loadu_ps(&p[2*i]);     // samples 0..3
+        __m256 b = _mm256_loadu_ps(&p[2*i + 8]); // samples 4..7
+        __m256 v;
+
+        // in lane shuffles give samples in order 0 1 4 5 2 3 6 7
+        if (component == TriggerComponentReal)
+        {
+            v = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        }
+        else if (component == TriggerComponentImag)
+        {
+            v = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+        else
+        {
+            __m256 re = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m256 im = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            v = _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+        }
+
+        v = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+        unsigned int highs = _mm256_movemask_ps(_mm256_cmp_ps(v, vhi, _CMP_GT_OQ));
+        unsigned int lows = _mm256_movemask_ps(_mm256_cmp_ps(v, vlo, _CMP_GT_OQ));
+        unsigned int stops = untriggeredStops(highs, lows, 8, edges, prev);
+
+        if (stops) {
+            return untriggeredStop(stops, highs, i, prev);
+        }
+
+        prev = (highs >> 7) & 1;
+    }
+
+    return i;
+}
+#elif defined(SDR_SIMD_NEON)
+static int untriggeredNEON(const Complex *s, int length, TriggerComponent component, float lo, float hi, int edges, bool& prev)
+{
+    const float *p = reinterpret_cast<const float*>(s);
+    float32x4_t vlo = vdupq_n_f32(lo);
+    float32x4_t vhi = vdupq_n_f32(hi);
+    static const uint32_t bits[4] = {1, 2, 4, 8};
+    uint32x4_t weights = vld1q_u32(bits);
+    int i = 0;
+
+    for (; i + 4 <= length; i += 4)
+    {
+        float32x4x2_t iq = vld2q_f32(&p[2*i]); // de-interleaved real and imaginary parts
+        float32x4_t v;
+
+        if (component == TriggerComponentReal) {
+            v = iq.val[0];
+        } else if (component == TriggerComponentImag) {
+            v = iq.val[1];
+        } else {
+            v = vaddq_f32(vmulq_f32(iq.val[0], iq.val[0]), vmulq_f32(iq.val[1], iq.val[1]));
+        }
+
+        uint32x4_t mh = vandq_u32(vcgtq_f32(v, vhi), weights);
+        uint32x4_t ml = vandq_u32(vcgtq_f32(v, vlo), weights);
+        uint32x2_t sh = vpadd_u32(vget_low_u32(mh), vget_high_u32(mh));
+        uint32x2_t sl = vpadd_u32(vget_low_u32(ml), vget_high_u32(ml));
+        unsigned int highs = vget_lane_u32(vpadd_u32(sh, sh), 0);
+        unsigned int lows = vget_lane_u32(vpadd_u32(sl, sl), 0);
+        unsigned int stops = untriggeredStops(highs, lows, 4, edges, prev);
+
+        if (stops) {
+            return untriggeredStop(stops, highs, i, prev);
+        }
+
+        prev = (highs >> 3) & 1;
+    }
+
+    return i;
+}
+#endif
+
+int ScopeVis::TriggerComparator::untriggeredLength(const Complex *s, int length, TriggerCondition& triggerCondition)
+{
+    if (m_reset || (triggerCondition.m_triggerData.m_triggerHoldoff != 0)) {
+        return 0;
+    }
+
+    if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
+    {
+        m_level = triggerCondition.m_triggerData.m_triggerLevel;
+        computeLevels();
+    }
+
+    TriggerComponent component;
+    float threshold;
+
+    switch (triggerCondition.m_projector.getProjectionType())
+    {
+    case Projector::ProjectionReal:
+        component = TriggerComponentReal;
+        threshold = m_level;
+        break;
+    case Projector::ProjectionImag:
+        component = TriggerComponentImag;
+        threshold = m_level;
+        break;
+    case Projector::ProjectionMagSq:
+        component = TriggerComponentMagSq;
+        threshold = m_levelPowerLin;
+        break;
+    case Projector::ProjectionMagLin: // |s| > l <=> |s|^2 > l^2 for positive l
+        component = TriggerComponentMagSq;
+        threshold = m_levelPowerLin < 0.0f ? -1.0f : m_levelPowerLin * m_levelPowerLin;
+        break;
+    case Projector::ProjectionMagDB:
+        component = TriggerComponentMagSq;
+        threshold = std::pow(10.0f, m_levelPowerDB / 10.0f);
+        break;
+    default:
+        return 0;
+    }
+
+    float lo = threshold, hi = threshold;
+
+    if (component == TriggerComponentMagSq) // magnitudes are not computed the same way by the projector
+    {
+        float margin = std::max(std::abs(threshold) * 1e-4f, std::numeric_limits<float>::min());
+        lo = threshold - margin;
+        hi = threshold + margin;
+    }
+
+    int edges;
+
+    if (triggerCondition.m_triggerData.m_triggerBothEdges) {
+        edges = TriggerEdgePositive | TriggerEdgeNegative;
+    } else if (triggerCondition.m_triggerData.m_triggerPositiveEdge) {
+        edges = TriggerEdgePositive;
+    } else {
+        edges = TriggerEdgeNegative;
+    }
+
+    bool prev = triggerCondition.m_prevCondition;
+    int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = untriggeredAVX2(s, length, component, lo, hi, edges, prev);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = untriggeredSSE2(s, length, component, lo, hi, edges, prev);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = untriggeredNEON(s, length, component, lo, hi, edges, prev);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    int untriggered = untriggeredScalar(s, done, length, component, lo, hi, edges, prev);
+
+    if (untriggered > 0)
+    {
+        triggerCondition.m_prevCondition = prev;
+        triggerCondition.m_trues = 0;
+        triggerCondition.m_falses = 0;
+    }
+
+    return untriggered;
+}
+
 bool ScopeVis::nextTrigger()
 {
     TriggerCondition *triggerCondition = m_triggerConditions[m_currentTriggerIndex]; // current trigger condition
@@ -892,8 +1289,12 @@ int ScopeVis::processTraces(const std::vector<ComplexVector::const_iterator>& vc
 
     float traceTime = ((float) m_traceSize) / m_sampleRate;
 
+    if (m_glScope) {
+        decimateTraces();
+    }
+
     if (m_glScope && (traceTime >= 1.0f)) { // display continuously if trace time is 1 second or more
-        m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes);
+        m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes, m_traces.m_displayTraces);
     }
 
     if (m_glScope && (m_nbSamples == 0)) // finished
@@ -903,11 +1304,11 @@ int ScopeVis::processTraces(const std::vector<ComplexVector::const_iterator>& vc
         {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
             if (m_glScope->getProcessingTraceIndex().loadRelaxed() < 0) {
-                m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes);
+                m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes, m_traces.m_displayTraces);
             }
 #else
             if (m_glScope->getProcessingTraceIndex().load() < 0) {
-                m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes);
+                m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes, m_traces.m_displayTraces);
             }
 #endif
         }
@@ -931,6 +1332,65 @@ int ScopeVis::processTraces(const std::vector<ComplexVector::const_iterator>& vc
     }
 }
 
+void ScopeVis::decimateTraces()
+{
+    uint32_t bufferIndex = m_traces.currentBufferIndex();
+    GLScopeDisplayTraces& displayTraces = m_traces.m_displayTraces[bufferIndex];
+    int start = (m_timeOfsProMill / 1000.0) * m_traceSize;
+    int end = std::min(start + (int) (m_traceSize / m_timeBase), (int) m_traceSize);
+
+    if ((displayTraces.m_start != start) || (displayTraces.m_end != end)) // window has changed
+    {
+        m_traces.resetDisplayTraces(bufferIndex);
+        displayTraces.m_start = start;
+        displayTraces.m_end = end;
+    }
+
+    if (end - start <= 2*Traces::m_nbDisplayBuckets) { // display resolution is not exceeded
+        return;
+    }
+
+    double bucketSize = (end - start) / (double) Traces::m_nbDisplayBuckets;
+
+    for (unsigned int i = 0; i < m_traces.m_tracesControl.size(); i++)
+    {
+        const float *trace = m_traces.m_traces[bufferIndex][i];
+        float *points = displayTraces.m_traces[i];
+        int traceCount = m_traces.m_tracesControl[i]->m_traceCount[bufferIndex];
+        uint32_t& nbPoints = displayTraces.m_sizes[i];
+
+        for (int bucket = nbPoints / 2; bucket < Traces::m_nbDisplayBuckets; bucket++)
+        {
+            int bucketStart = start + (int) (bucket * bucketSize);
+            int bucketEnd = bucket == Traces::m_nbDisplayBuckets - 1 ? end : start + (int) ((bucket + 1) * bucketSize);
+
+            if (bucketEnd > traceCount) { // not filled yet
+                break;
+            }
+
+            int iMin = bucketStart;
+            int iMax = bucketStart;
+
+            for (int k = bucketStart + 1; k < bucketEnd; k++)
+            {
+                if (trace[2*k + 1] < trace[2*iMin + 1]) {
+                    iMin = k;
+                } else if (trace[2*k + 1] > trace[2*iMax + 1]) {
+                    iMax = k;
+                }
+            }
+
+            int i0 = std::min(iMin, iMax); // keep sample order so that the polyline goes forward
+            int i1 = std::max(iMin, iMax);
+            points[4*bucket]     = trace[2*i0];
+            points[4*bucket + 1] = trace[2*i0 + 1];
+            points[4*bucket + 2] = trace[2*i1];
+            points[4*bucket + 3] = trace[2*i1 + 1];
+            nbPoints = 2*(bucket + 1);
+        }
+    }
+}
+
 void ScopeVis::handleInputMessages()
 {
 	Message* message;
@@ -22,8 +22,11 @@
 #include <QDebug>
 #include <QColor>
 #include <QByteArray>
+#include <QThread>
+#include <QSemaphore>
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <cmath>
 
@@ -32,6 +35,7 @@
 #include "dsp/dsptypes.h"
 #include "dsp/projector.h"
 #include "dsp/glscopesettings.h"
+#include "dsp/glscopeinterface.h"
 #include "export.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
@@ -39,7 +43,6 @@
 #include "util/doublebuffermultiple.h"
 
 
-class GLScopeInterface;
 class SpectrumVis;
 
 class SDRBASE_API ScopeVis : public QObject {
@@ -596,39 +599,85 @@ private:
 
     typedef std::vector<TraceBackBuffer> TraceBackBufferStream;
 
-    struct ConvertBuffers
+    /**
+     * Single producer single consumer ring of samples between the feeding thread and the processing thread.
+     * Positions are absolute sample counts so that wrapping of the 32 bit counters is harmless.
+     * The feeding thread never waits: samples that do not fit are dropped.
+     */
+    struct CaptureBuffer
     {
-        ConvertBuffers(uint32_t nbStreams = 1) :
-            m_convertBuffers(nbStreams)
+        std::vector<ComplexVector> m_streams; //!< One ring per stream
+        uint32_t m_size;                      //!< Ring size in samples (power of two)
+        std::atomic<uint32_t> m_writePos;     //!< Next position written by the feeding thread
+        std::atomic<uint32_t> m_readPos;      //!< Next position read by the processing thread
+        std::atomic<bool> m_writing;          //!< Feeding thread is writing to the rings
+        std::atomic<bool> m_resizing;         //!< Rings are being reallocated
+        std::atomic<uint32_t> m_dropped;      //!< Number of samples dropped because the ring was full
+
+        CaptureBuffer(uint32_t size) :
+            m_streams(1, ComplexVector(size)),
+            m_size(size),
+            m_writePos(0),
+            m_readPos(0),
+            m_writing(false),
+            m_resizing(false),
+            m_dropped(0)
         {}
 
-        void setNbStreams(uint32_t nbStreams)
+        bool beginWrite()
         {
-            m_convertBuffers.resize(nbStreams);
-            resize(m_size);
+            m_writing.store(true);
+
+            if (m_resizing.load())
+            {
+                m_writing.store(false);
+                return false;
+            }
+
+            return true;
         }
 
-        void resize(unsigned int size)
+        void endWrite(uint32_t count)
         {
-            for (unsigned int s = 0; s < m_convertBuffers.size(); s++) {
-                m_convertBuffers[s].resize(size);
-            }
+            m_writePos.store(m_writePos.load(std::memory_order_relaxed) + count, std::memory_order_release);
+            m_writing.store(false, std::memory_order_release);
+        }
 
-            m_size = size;
+        uint32_t writable() const {
+            return m_size - (m_writePos.load(std::memory_order_relaxed) - m_readPos.load(std::memory_order_acquire));
         }
 
-        unsigned int size() const {
-            return m_size;
+        uint32_t readable() const {
+            return m_writePos.load(std::memory_order_acquire) - m_readPos.load(std::memory_order_relaxed);
         }
 
-        std::vector<ComplexVector>& getBuffers() {
-            return m_convertBuffers;
+        void setNbStreams(uint32_t nbStreams) //!< Must be called with the processing thread excluded
+        {
+            m_resizing.store(true);
+
+            while (m_writing.load()) {
+                QThread::yieldCurrentThread();
+            }
+
+            m_streams.resize(nbStreams, ComplexVector(m_size));
+            m_writePos.store(0);
+            m_readPos.store(0);
+            m_resizing.store(false);
         }
+    };
+
+    class ProcessingThread : public QThread //!< Runs trigger and trace processing out of the feeding thread
+    {
+    public:
+        ProcessingThread(ScopeVis *scopeVis) : m_scopeVis(scopeVis) {}
+
+    protected:
+        virtual void run() { m_scopeVis->processCaptures(); }
 
     private:
-        unsigned int m_size;
-        std::vector<ComplexVector> m_convertBuffers;
+        ScopeVis *m_scopeVis;
     };
+
     struct TraceBackDiscreteMemory
     {
     	/**
@@ -952,10 +1001,12 @@ private:
         std::vector<TraceControl*> m_tracesControl;   //!< Corresponding traces control data
         std::vector<GLScopeSettings::TraceData> m_tracesData; //!< Corresponding traces data
         std::vector<float *> m_traces[2];             //!< Double buffer of traces processed by glScope
+        GLScopeDisplayTraces m_displayTraces[2];      //!< Double buffer of traces decimated to display resolution
         std::vector<Projector::ProjectionType> m_projectionTypes;
         int m_traceSize;                              //!< Current size of a trace in buffer
         int m_maxTraceSize;                           //!< Maximum Size of a trace in buffer
         bool evenOddIndex;                            //!< Even (true) or odd (false) index
+        static const int m_nbDisplayBuckets = 2048;   //!< Number of min/max buckets of a decimated trace
 
         Traces() :
             m_traceSize(0),
@@ -964,6 +1015,8 @@ private:
             m_x0(0),
             m_x1(0)
         {
+            m_d0 = new float[4*m_nbDisplayBuckets*GLScopeSettings::m_maxNbTraces];
+            m_d1 = new float[4*m_nbDisplayBuckets*GLScopeSettings::m_maxNbTraces];
         }
 
         ~Traces()
@@ -980,6 +1033,8 @@ private:
                 delete[] m_x1;
             }
 
+            delete[] m_d0;
+            delete[] m_d1;
             m_maxTraceSize = 0;
         }
 
@@ -1094,6 +1149,23 @@ private:
                 (m_traces[0])[i] = &m_x0[2*m_traceSize*i];
                 (m_traces[1])[i] = &m_x1[2*m_traceSize*i];
             }
+
+            m_displayTraces[0].m_traces.resize(m_traces[0].size());
+            m_displayTraces[1].m_traces.resize(m_traces[1].size());
+
+            for (unsigned int i = 0; i < m_traces[0].size(); i++)
+            {
+                m_displayTraces[0].m_traces[i] = &m_d0[4*m_nbDisplayBuckets*i];
+                m_displayTraces[1].m_traces[i] = &m_d1[4*m_nbDisplayBuckets*i];
+            }
+
+            resetDisplayTraces(0);
+            resetDisplayTraces(1);
+        }
+
+        void resetDisplayTraces(uint32_t bufferIndex)
+        {
+            m_displayTraces[bufferIndex].m_sizes.assign(m_traces[bufferIndex].size(), 0);
         }
 
         uint32_t currentBufferIndex() const { return evenOddIndex? 0 : 1; }
@@ -1106,6 +1178,8 @@ private:
             for (std::vector<TraceControl*>::iterator it = m_tracesControl.begin(); it != m_tracesControl.end(); ++it) {
                 (*it)->m_traceCount[currentBufferIndex()] = 0;
             }
+
+            resetDisplayTraces(currentBufferIndex());
         }
 
         void resetControls()
@@ -1113,11 +1187,16 @@ private:
             for (auto traceControl : m_tracesControl) {
                 traceControl->reset();
             }
+
+            resetDisplayTraces(0);
+            resetDisplayTraces(1);
         }
 
     private:
         float *m_x0;
         float *m_x1;
+        float *m_d0;
+        float *m_d1;
     };
 
     class TriggerComparator
@@ -1201,6 +1280,13 @@ private:
             m_reset = true;
         }
 
+        /**
+         * Number of samples from the start of the buffer that cannot trigger the condition.
+         * When positive the condition is updated as if triggered() was called on these samples.
+         * Returns 0 when the state of the comparator requires a sample by sample evaluation.
+         */
+        int untriggeredLength(const Complex *s, int length, TriggerCondition& triggerCondition);
+
     private:
         void computeLevels()
         {
@@ -1238,7 +1324,9 @@ private:
     int m_sampleRate;                              //!< Actual sample rate being used
     int m_liveSampleRate;                          //!< Sample rate in live mode
     TraceBackDiscreteMemory m_traceDiscreteMemory; //!< Complex trace memory
-    ConvertBuffers m_convertBuffers;               //!< Sample to Complex conversions
+    CaptureBuffer m_captureBuffer;                 //!< Samples fed and not yet processed
+    QSemaphore m_captureReady;                     //!< Signals new samples in capture buffer
+    ProcessingThread m_processingThread;           //!< Processes the capture buffer
     bool m_freeRun;                                //!< True if free running (trigger globally disabled)
     int m_maxTraceDelay;                           //!< Maximum trace delay
     TriggerComparator m_triggerComparator;         //!< Compares sample level to trigger level
@@ -1268,6 +1356,22 @@ private:
      */
     bool nextTrigger(); //!< Returns true if not final
 
+    /**
+     * Copy samples to the capture buffer and wake up the processing thread
+     */
+    template<typename T>
+    void capture(const std::vector<T>& vbegin, int nbSamples);
+
+    /**
+     * Processing thread loop: process the capture buffer contents as they arrive
+     */
+    void processCaptures();
+
+    /**
+     * Process a contiguous part of the capture buffer
+     */
+    void processCapture(const std::vector<ComplexVector::const_iterator>& vbegin, int nbSamples);
+
     /**
      * Process a sample trace which length is at most the trace length (m_traceSize)
      */
@@ -1285,6 +1389,11 @@ private:
      */
     int processTraces(const std::vector<ComplexVector::const_iterator>& vbegin, int length, bool traceBack = false);
 
+    /**
+     * Reduce the displayed window of the current traces to min/max buckets as the traces fill
+     */
+    void decimateTraces();
+
     /**
      * Get maximum trace delay
      */
@@ -81,7 +81,7 @@ SigMFFileRecord::~SigMFFileRecord()
         m_metaFile.close();
     }
 
-    if (m_sampleFile.is_open()) {
+    if (m_sampleFile.isOpen()) {
         m_sampleFile.close();
     }
 
@@ -98,7 +98,7 @@ void SigMFFileRecord::setFileName(const QString& fileName)
             m_metaFile.close();
         }
 
-        if (m_sampleFile.is_open()) {
+        if (m_sampleFile.isOpen()) {
             m_sampleFile.close();
         }
 
@@ -135,8 +135,8 @@ void SigMFFileRecord::setFileName(const QString& fileName)
                     }
 
                     m_sampleFileName = m_fileName + ".sigmf-data";
-                    m_sampleFile.open(m_sampleFileName.toStdString().c_str(), std::ios::binary & std::ios::app);
-                    m_initialBytesCount = (uint64_t) m_sampleFile.tellp();
+                    m_sampleFile.open(m_sampleFileName, true);
+                    m_initialBytesCount = m_sampleFile.getSize();
                     m_sampleStart =  m_initialBytesCount / sizeof(Sample);
 
                     m_recordStart = false;
@@ -182,8 +182,7 @@ bool SigMFFileRecord::startRecording()
         m_sampleStart = 0;
         m_sampleFileName = m_fileName + ".sigmf-data";
         m_metaFileName = m_fileName + ".sigmf-meta";
-        m_sampleFile.open(m_sampleFileName.toStdString().c_str(), std::ios::binary);
-        if (!m_sampleFile.is_open())
+        if (!m_sampleFile.open(m_sampleFileName))
         {
             qWarning() << "SigMFFileRecord::startRecording: failed to open file: " << m_sampleFileName;
             success = false;
@@ -215,7 +214,7 @@ bool SigMFFileRecord::stopRecording()
       	qDebug("SigMFFileRecord::stopRecording: file previous capture");
         makeCapture();
         m_recordOn = false;
-        if (m_sampleFile.bad())
+        if (m_sampleFile.hasError())
         {
             qWarning() << "SigMFFileRecord::stopRecording: an error occurred while writing to " << m_sampleFileName;
             return false;
@@ -292,8 +291,9 @@ void SigMFFileRecord::feed(const SampleVector::const_iterator& begin, const Samp
 
     if (begin < end) // if there is something to put out
     {
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
-        m_sampleCount += end - begin;
+        if (m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample))) {
+            m_sampleCount += end - begin;
+        }
     }
 }
 
@@ -55,6 +55,10 @@ public:
     unsigned int getNbCaptures() const;
     uint64_t getInitialMsCount() const { return m_initialMsCount; }
     uint64_t getInitialBytesCount() const { return m_initialBytesCount; }
+    virtual bool getWriteStatistics(AsyncFileWriter::Statistics& statistics) const override {
+        m_sampleFile.getStatistics(statistics);
+        return true;
+    }
 
 private:
     QString m_hardwareId;
@@ -68,7 +72,7 @@ private:
     bool m_recordStart;
     QDateTime m_captureStartDT;
     std::ofstream m_metaFile;
-    std::ofstream m_sampleFile;
+    AsyncFileWriter m_sampleFile;
     quint64 m_sampleStart;
     quint64 m_sampleCount;
     quint64 m_initialMsCount;
@@ -0,0 +1,332 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/dspcommands.h"
+#include "dsp/spectrumvis.h"
+#include "util/messagequeue.h"
+
+#include "spectrumanalyzers.h"
+
+SpectrumAnalyzers::SpectrumAnalyzers(SpectrumVis *mainSpectrum, Real scalef) :
+    m_mainSpectrum(mainSpectrum),
+    m_scalef(scalef),
+    m_centerFrequency(0),
+    m_sampleRate(48000),
+    m_mutex(QMutex::Recursive) // web API requests hold it while using an analyzer
+{
+}
+
+SpectrumAnalyzers::~SpectrumAnalyzers()
+{
+    for (auto analyzer : m_analyzers)
+    {
+        delete analyzer->m_spectrumVis;
+        delete analyzer;
+    }
+}
+
+int SpectrumAnalyzers::addAnalyzer()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Analyzer *analyzer = new Analyzer();
+    analyzer->m_spectrumVis = new SpectrumVis(m_scalef);
+    analyzer->m_spectrumVis->moveToThread(m_mainSpectrum->thread()); // may be created from a web API thread
+    analyzer->m_spectrumVis->setAnalyzers(this);
+    m_analyzers.push_back(analyzer);
+    applyZoom(analyzer);
+    qDebug("SpectrumAnalyzers::addAnalyzer: %d analyzers", (int) m_analyzers.size());
+
+    return m_analyzers.size() - 1;
+}
+
+bool SpectrumAnalyzers::removeAnalyzer(int index)
+{
+    Analyzer *analyzer;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if ((index < 0) || (index >= (int) m_analyzers.size())) {
+            return false;
+        }
+
+        analyzer = m_analyzers[index];
+        m_analyzers.erase(m_analyzers.begin() + index);
+        qDebug("SpectrumAnalyzers::removeAnalyzer: %d: %d analyzers left", index, (int) m_analyzers.size());
+    }
+
+    deleteAnalyzer(analyzer);
+
+    return true;
+}
+
+bool SpectrumAnalyzers::removeAnalyzer(const SpectrumVis *spectrumVis)
+{
+    Analyzer *analyzer = nullptr;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        for (auto it = m_analyzers.begin(); it != m_analyzers.end(); ++it)
+        {
+            if ((*it)->m_spectrumVis == spectrumVis)
+            {
+                analyzer = *it;
+                m_analyzers.erase(it);
+                break;
+            }
+        }
+
+        if (!analyzer) {
+            return false;
+        }
+
+        qDebug("SpectrumAnalyzers::removeAnalyzer: %d analyzers left", (int) m_analyzers.size());
+    }
+
+    deleteAnalyzer(analyzer);
+
+    return true;
+}
+
+void SpectrumAnalyzers::deleteAnalyzer(Analyzer *analyzer)
+{
+    // outside of the lock as the processing thread of the analyzer may be waiting for it
+    analyzer->m_spectrumVis->setAnalyzers(nullptr);
+    analyzer->m_spectrumVis->deleteLater(); // in its own thread
+    delete analyzer;
+}
+
+int SpectrumAnalyzers::getNbAnalyzers() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_analyzers.size();
+}
+
+SpectrumVis *SpectrumAnalyzers::getAnalyzer(int index)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return (index < 0) || (index >= (int) m_analyzers.size()) ? nullptr : m_analyzers[index]->m_spectrumVis;
+}
+
+const SpectrumVis *SpectrumAnalyzers::getAnalyzer(int index) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return (index < 0) || (index >= (int) m_analyzers.size()) ? nullptr : m_analyzers[index]->m_spectrumVis;
+}
+
+bool SpectrumAnalyzers::setWSSpectrumPort(int index, uint16_t port)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((index < 0) || (index >= (int) m_analyzers.size())) {
+        return false;
+    }
+
+    m_analyzers[index]->m_wsSpectrumPort = port;
+
+    return true;
+}
+
+uint16_t SpectrumAnalyzers::getFreeWSSpectrumPort(uint16_t mainPort) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    uint16_t port = mainPort + 1;
+
+    while (true)
+    {
+        bool used = false;
+
+        for (const auto analyzer : m_analyzers)
+        {
+            if (analyzer->m_wsSpectrumPort == port)
+            {
+                used = true;
+                break;
+            }
+        }
+
+        if (!used && (port != 0) && (port != mainPort)) { // skip the main port when wrapping around
+            return port;
+        }
+
+        port++;
+    }
+}
+
+bool SpectrumAnalyzers::setZoom(int index, unsigned int log2Zoom, float zoomPos)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((index < 0) || (index >= (int) m_analyzers.size())) {
+        return false;
+    }
+
+    Analyzer *analyzer = m_analyzers[index];
+    analyzer->m_log2Zoom = log2Zoom > m_maxLog2Zoom ? m_maxLog2Zoom : log2Zoom;
+    // keep the zoomed band inside the full band
+    float halfSpan = 0.5f / (1 << analyzer->m_log2Zoom);
+    analyzer->m_zoomPos = zoomPos < halfSpan ? halfSpan : zoomPos > 1.0f - halfSpan ? 1.0f - halfSpan : zoomPos;
+    applyZoom(analyzer);
+
+    return true;
+}
+
+bool SpectrumAnalyzers::getZoom(int index, unsigned int& log2Zoom, float& zoomPos) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((index < 0) || (index >= (int) m_analyzers.size())) {
+        return false;
+    }
+
+    log2Zoom = m_analyzers[index]->m_log2Zoom;
+    zoomPos = m_analyzers[index]->m_zoomPos;
+
+    return true;
+}
+
+void SpectrumAnalyzers::feed(SpectrumVis *spectrum, const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    if (spectrum != m_mainSpectrum) { // only the main spectrum receives samples from the device
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    bool converted = false;
+
+    for (auto analyzer : m_analyzers)
+    {
+        if (!analyzer->m_spectrumVis->isComputing() || getFFTSource(analyzer)) {
+            continue;
+        }
+
+        if (!converted)
+        {
+            m_samples.resize(end - begin);
+            SampleVector::const_iterator it = begin;
+
+            for (auto& c : m_samples)
+            {
+                c = Complex(it->real() / m_scalef, it->imag() / m_scalef);
+                ++it;
+            }
+
+            converted = true;
+        }
+
+        if (analyzer->m_log2Zoom == 0)
+        {
+            analyzer->m_spectrumVis->feed(m_samples.cbegin(), m_samples.cend(), positiveOnly);
+        }
+        else
+        {
+            Complex cd;
+            analyzer->m_zoomBuffer.clear();
+
+            for (const auto& c : m_samples)
+            {
+                if (analyzer->m_decimator.decimate(c * analyzer->m_nco.nextIQ(), cd)) {
+                    analyzer->m_zoomBuffer.push_back(cd);
+                }
+            }
+
+            analyzer->m_spectrumVis->feed(analyzer->m_zoomBuffer.cbegin(), analyzer->m_zoomBuffer.cend(), false);
+        }
+    }
+}
+
+void SpectrumAnalyzers::shareFFT(SpectrumVis *spectrum, const Real *bins, unsigned int nbBins, bool positiveOnly)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (auto analyzer : m_analyzers)
+    {
+        if ((analyzer->m_spectrumVis != spectrum) && (getFFTSource(analyzer) == spectrum)) {
+            analyzer->m_spectrumVis->feedPowerBins(bins, nbBins, positiveOnly);
+        }
+    }
+}
+
+void SpectrumAnalyzers::setCenterFrequencyAndSampleRate(SpectrumVis *spectrum, uint64_t centerFrequency, int sampleRate)
+{
+    if (spectrum != m_mainSpectrum) { // analyzers are notified with their own zoomed band
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_centerFrequency = centerFrequency;
+    m_sampleRate = sampleRate;
+
+    for (auto analyzer : m_analyzers) {
+        applyZoom(analyzer);
+    }
+}
+
+void SpectrumAnalyzers::setScalef(SpectrumVis *spectrum, Real scalef)
+{
+    if (spectrum != m_mainSpectrum) { // analyzers are fed with normalized samples
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_scalef = scalef;
+}
+
+SpectrumVis *SpectrumAnalyzers::getFFTSource(const Analyzer *analyzer) const
+{
+    if ((analyzer->m_log2Zoom == 0) && m_mainSpectrum->isComputing() && analyzer->m_spectrumVis->sameFFT(*m_mainSpectrum)) {
+        return m_mainSpectrum;
+    }
+
+    // the first previous analyzer with same FFT and zoom computes the FFT for the others
+    for (const auto other : m_analyzers)
+    {
+        if (other == analyzer) {
+            break;
+        }
+
+        if ((other->m_log2Zoom == analyzer->m_log2Zoom)
+         && ((analyzer->m_log2Zoom == 0) || (other->m_zoomPos == analyzer->m_zoomPos))
+         && other->m_spectrumVis->isComputing()
+         && other->m_spectrumVis->sameFFT(*analyzer->m_spectrumVis)) {
+            return other->m_spectrumVis;
+        }
+    }
+
+    return nullptr;
+}
+
+void SpectrumAnalyzers::applyZoom(Analyzer *analyzer)
+{
+    int sampleRate = m_sampleRate;
+    qint64 centerFrequency = m_centerFrequency;
+
+    if (analyzer->m_log2Zoom > 0)
+    {
+        float shift = (analyzer->m_zoomPos - 0.5f) * m_sampleRate;
+        analyzer->m_nco.setFreq(-shift, m_sampleRate);
+        analyzer->m_decimator.setLog2Decim(analyzer->m_log2Zoom);
+        sampleRate = m_sampleRate >> analyzer->m_log2Zoom;
+        centerFrequency += (qint64) shift;
+    }
+
+    DSPSignalNotification *notif = new DSPSignalNotification(sampleRate, centerFrequency);
+    analyzer->m_spectrumVis->getInputMessageQueue()->push(notif);
+}
@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMANALYZERS_H_
+#define SDRBASE_DSP_SPECTRUMANALYZERS_H_
+
+#include <vector>
+
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "dsp/decimatorc.h"
+#include "dsp/ncof.h"
+#include "export.h"
+
+class SpectrumVis;
+
+/**
+ * Additional spectrum analyzers of a device set each with its own settings and websocket
+ * server. Samples are forwarded by the main spectrum of the device set. An analyzer with
+ * the same FFT size, window and overlap as the main spectrum or a previous analyzer (and
+ * the same zoom) does not compute an FFT but takes the power bins of this one and applies
+ * its own averaging, scale and display zoom. A zoomed analyzer is fed with samples shifted
+ * to the zoom position and decimated by the zoom factor so that its FFT spans a narrower
+ * band with a finer resolution.
+ */
+class SDRBASE_API SpectrumAnalyzers
+{
+public:
+    static const unsigned int m_maxLog2Zoom = 6; //!< Decimation by 64
+
+    SpectrumAnalyzers(SpectrumVis *mainSpectrum, Real scalef);
+    ~SpectrumAnalyzers();
+
+    int addAnalyzer();                     //!< Returns index of the new analyzer
+    bool removeAnalyzer(int index);        //!< Must not be called with the mutex held
+    bool removeAnalyzer(const SpectrumVis *spectrumVis); //!< Must not be called with the mutex held
+    int getNbAnalyzers() const;
+    QMutex *getMutex() { return &m_mutex; } //!< Hold it while using an analyzer returned by getAnalyzer
+    SpectrumVis *getAnalyzer(int index);   //!< nullptr if index is out of range
+    const SpectrumVis *getAnalyzer(int index) const;
+    bool setWSSpectrumPort(int index, uint16_t port); //!< Records the websocket port requested for the analyzer
+    uint16_t getFreeWSSpectrumPort(uint16_t mainPort) const; //!< First port after the main one not requested by an analyzer
+    bool setZoom(int index, unsigned int log2Zoom, float zoomPos);
+    bool getZoom(int index, unsigned int& log2Zoom, float& zoomPos) const;
+
+    // Called by the spectrums
+    void feed(SpectrumVis *spectrum, const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    void shareFFT(SpectrumVis *spectrum, const Real *bins, unsigned int nbBins, bool positiveOnly);
+    void setCenterFrequencyAndSampleRate(SpectrumVis *spectrum, uint64_t centerFrequency, int sampleRate);
+    void setScalef(SpectrumVis *spectrum, Real scalef);
+
+private:
+    struct Analyzer
+    {
+        SpectrumVis *m_spectrumVis;
+        unsigned int m_log2Zoom;  //!< 0 for no zoom
+        float m_zoomPos;          //!< Center of the zoomed band relative to the full band (0..1)
+        uint16_t m_wsSpectrumPort; //!< 0 until a port is requested
+        NCOF m_nco;
+        DecimatorC m_decimator;
+        ComplexVector m_zoomBuffer;
+
+        Analyzer() : m_spectrumVis(nullptr), m_log2Zoom(0), m_zoomPos(0.5f), m_wsSpectrumPort(0) {}
+    };
+
+    SpectrumVis *m_mainSpectrum;
+    Real m_scalef;
+    std::vector<Analyzer*> m_analyzers;
+    ComplexVector m_samples;      //!< Scaled samples shared by all analyzers fed with samples
+    uint64_t m_centerFrequency;
+    int m_sampleRate;
+    mutable QMutex m_mutex;
+
+    SpectrumVis *getFFTSource(const Analyzer *analyzer) const;
+    void applyZoom(Analyzer *analyzer);
+    void deleteAnalyzer(Analyzer *analyzer);
+};
+
+#endif // SDRBASE_DSP_SPECTRUMANALYZERS_H_
@@ -0,0 +1,921 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "dsp/cpufeatures.h"
+#include "spectrumkernels.h"
+
+#if defined(SDR_SIMD_X86)
+#include <immintrin.h>
+#elif defined(SDR_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+static const float lnSqrtHalf = 0.707106781186547524f;
+static const float lnP0 = 7.0376836292e-2f;
+static const float lnP1 = -1.1514610310e-1f;
+static const float lnP2 = 1.1676998740e-1f;
+static const float lnP3 = -1.2420140846e-1f;
+static const float lnP4 = 1.4249322787e-1f;
+static const float lnP5 = -1.6668057665e-1f;
+static const float lnP6 = 2.0000714765e-1f;
+static const float lnP7 = -2.4999993993e-1f;
+static const float lnP8 = 3.3333331174e-1f;
+static const float lnQ1 = -2.12194440e-4f;
+static const float lnQ2 = 0.693359375f;
+
+// Natural logarithm (Cephes logf). Zero and negative values are clamped to the smallest normal float.
+static inline float lnScalar(float x)
+{
+    x = x > std::numeric_limits<float>::min() ? x : std::numeric_limits<float>::min();
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    float e = (float) ((int) (bits >> 23) - 126);
+    bits = (bits & 0x807FFFFF) | 0x3F000000; // mantissa in [0.5, 1)
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+
+    if (m < lnSqrtHalf)
+    {
+        e -= 1.0f;
+        m = (m - 1.0f) + m;
+    }
+    else
+    {
+        m = m - 1.0f;
+    }
+
+    float z = m * m;
+    float y = lnP0;
+    y = y * m + lnP1;
+    y = y * m + lnP2;
+    y = y * m + lnP3;
+    y = y * m + lnP4;
+    y = y * m + lnP5;
+    y = y * m + lnP6;
+    y = y * m + lnP7;
+    y = y * m + lnP8;
+    y = (y * m) * z;
+    y = y + e * lnQ1;
+    y = y - z * 0.5f;
+    m = m + y;
+    return m + e * lnQ2;
+}
+
+static void magSqScalar(const Complex *in, float *out, unsigned int start, unsigned int n)
+{
+    for (unsigned int i = start; i < n; i++) {
+        out[i] = in[i].real() * in[i].real() + in[i].imag() * in[i].imag();
+    }
+}
+
+static float maxScalar(const float *in, unsigned int start, unsigned int n, float m)
+{
+    for (unsigned int i = start; i < n; i++) {
+        m = in[i] > m ? in[i] : m;
+    }
+
+    return m;
+}
+
+static void scaleScalar(const float *in, float *out, unsigned int start, unsigned int n, float factor)
+{
+    for (unsigned int i = start; i < n; i++) {
+        out[i] = factor * in[i];
+    }
+}
+
+static void log2AffineScalar(const float *in, float *out, unsigned int start, unsigned int n, float mult, float ofs)
+{
+    for (unsigned int i = start; i < n; i++) {
+        out[i] = mult * lnScalar(in[i]) + ofs;
+    }
+}
+
+static void movingAverageScalar(float *v, double *data, double *sum, unsigned int start, unsigned int n, double depth)
+{
+    for (unsigned int i = start; i < n; i++)
+    {
+        double x = v[i];
+        sum[i] += (x - data[i]);
+        data[i] = x;
+        v[i] = sum[i] / depth;
+    }
+}
+
+static void accumulateScalar(const float *v, double *sum, unsigned int start, unsigned int n)
+{
+    for (unsigned int i = start; i < n; i++) {
+        sum[i] += v[i];
+    }
+}
+
+static void averageScalar(const double *sum, float *out, unsigned int start, unsigned int n, double size)
+{
+    for (unsigned int i = start; i < n; i++) {
+        out[i] = sum[i] / size;
+    }
+}
+
+static void maxUpdateScalar(const float *v, double *max, unsigned int start, unsigned int n)
+{
+    for (unsigned int i = start; i < n; i++) {
+        max[i] = std::max(max[i], (double) v[i]);
+    }
+}
+
+static void toDoubleScalar(const float *in, double *out, unsigned int start, unsigned int n)
+{
+    for (unsigned int i = start; i < n; i++) {
+        out[i] = in[i];
+    }
+}
+
+static void toFloatScalar(const double *in, float *out, unsigned int start, unsigned int n)
+{
+    for (unsigned int i = start; i < n; i++) {
+        out[i] = in[i];
+    }
+}
+
+#if defined(SDR_SIMD_X86)
+static inline SDR_SIMD_TARGET_SSE2 __m128 lnSSE2(__m128 x)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    x = _mm_max_ps(x, _mm_set1_ps(std::numeric_limits<float>::min()));
+    __m128i bits = _mm_castps_si128(x);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x807FFFFF)), _mm_set1_epi32(0x3F000000)));
+    __m128 mask = _mm_cmplt_ps(m, _mm_set1_ps(lnSqrtHalf));
+    __m128 tmp = _mm_and_ps(m, mask);
+    m = _mm_sub_ps(m, one);
+    e = _mm_sub_ps(e, _mm_and_ps(one, mask));
+    m = _mm_add_ps(m, tmp);
+    __m128 z = _mm_mul_ps(m, m);
+    __m128 y = _mm_set1_ps(lnP0);
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP1));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP2));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP3));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP4));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP5));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP6));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP7));
+    y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(lnP8));
+    y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+    y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(lnQ1)));
+    y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    m = _mm_add_ps(m, y);
+    return _mm_add_ps(m, _mm_mul_ps(e, _mm_set1_ps(lnQ2)));
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int magSqSSE2(const Complex *in, float *out, unsigned int n)
+{
+    const float *p = reinterpret_cast<const float*>(in);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(&p[2*i]);
+        __m128 b = _mm_loadu_ps(&p[2*i + 4]);
+        a = _mm_mul_ps(a, a);
+        b = _mm_mul_ps(b, b);
+        _mm_storeu_ps(&out[i], _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int maxSSE2(const float *in, unsigned int n, float& m)
+{
+    __m128 vm = _mm_set1_ps(m);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vm = _mm_max_ps(_mm_loadu_ps(&in[i]), vm);
+    }
+
+    float r[4];
+    _mm_storeu_ps(r, vm);
+    m = maxScalar(r, 0, 4, m);
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int scaleSSE2(const float *in, float *out, unsigned int n, float factor)
+{
+    __m128 f = _mm_set1_ps(factor);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(&out[i], _mm_mul_ps(f, _mm_loadu_ps(&in[i])));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int log2AffineSSE2(const float *in, float *out, unsigned int n, float mult, float ofs)
+{
+    __m128 vmult = _mm_set1_ps(mult);
+    __m128 vofs = _mm_set1_ps(ofs);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(&out[i], _mm_add_ps(_mm_mul_ps(vmult, lnSSE2(_mm_loadu_ps(&in[i]))), vofs));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int movingAverageSSE2(float *v, double *data, double *sum, unsigned int n, double depth)
+{
+    __m128d d = _mm_set1_pd(depth);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&v[i]);
+        __m128d x0 = _mm_cvtps_pd(x);
+        __m128d x1 = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+        __m128d s0 = _mm_add_pd(_mm_loadu_pd(&sum[i]), _mm_sub_pd(x0, _mm_loadu_pd(&data[i])));
+        __m128d s1 = _mm_add_pd(_mm_loadu_pd(&sum[i + 2]), _mm_sub_pd(x1, _mm_loadu_pd(&data[i + 2])));
+        _mm_storeu_pd(&sum[i], s0);
+        _mm_storeu_pd(&sum[i + 2], s1);
+        _mm_storeu_pd(&data[i], x0);
+        _mm_storeu_pd(&data[i + 2], x1);
+        _mm_storeu_ps(&v[i], _mm_movelh_ps(_mm_cvtpd_ps(_mm_div_pd(s0, d)), _mm_cvtpd_ps(_mm_div_pd(s1, d))));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int accumulateSSE2(const float *v, double *sum, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&v[i]);
+        _mm_storeu_pd(&sum[i], _mm_add_pd(_mm_loadu_pd(&sum[i]), _mm_cvtps_pd(x)));
+        _mm_storeu_pd(&sum[i + 2], _mm_add_pd(_mm_loadu_pd(&sum[i + 2]), _mm_cvtps_pd(_mm_movehl_ps(x, x))));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int averageSSE2(const double *sum, float *out, unsigned int n, double size)
+{
+    __m128d s = _mm_set1_pd(size);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 a0 = _mm_cvtpd_ps(_mm_div_pd(_mm_loadu_pd(&sum[i]), s));
+        __m128 a1 = _mm_cvtpd_ps(_mm_div_pd(_mm_loadu_pd(&sum[i + 2]), s));
+        _mm_storeu_ps(&out[i], _mm_movelh_ps(a0, a1));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int maxUpdateSSE2(const float *v, double *max, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&v[i]);
+        _mm_storeu_pd(&max[i], _mm_max_pd(_mm_cvtps_pd(x), _mm_loadu_pd(&max[i])));
+        _mm_storeu_pd(&max[i + 2], _mm_max_pd(_mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_loadu_pd(&max[i + 2])));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int toDoubleSSE2(const float *in, double *out, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&in[i]);
+        _mm_storeu_pd(&out[i], _mm_cvtps_pd(x));
+        _mm_storeu_pd(&out[i + 2], _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_SSE2 unsigned int toFloatSSE2(const double *in, float *out, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(&out[i], _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(&in[i])), _mm_cvtpd_ps(_mm_loadu_pd(&in[i + 2]))));
+    }
+
+    return i;
+}
+
+static inline SDR_SIMD_TARGET_AVX2 __m256 lnAVX2(__m256 x)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    x = _mm256_max_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()));
+    __m256i bits = _mm256_castps_si256(x);
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x807FFFFF)), _mm256_set1_epi32(0x3F000000)));
+    __m256 mask = _mm256_cmp_ps(m, _mm256_set1_ps(lnSqrtHalf), _CMP_LT_OS);
+    __m256 tmp = _mm256_and_ps(m, mask);
+    m = _mm256_sub_ps(m, one);
+    e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+    m = _mm256_add_ps(m, tmp);
+    __m256 z = _mm256_mul_ps(m, m);
+    __m256 y = _mm256_set1_ps(lnP0);
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP1));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP2));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP3));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP4));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP5));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP6));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP7));
+    y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(lnP8));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, m), z);
+    y = _mm256_add_ps(y, _mm256_mul_ps(e, _mm256_set1_ps(lnQ1)));
+    y = _mm256_sub_ps(y, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    m = _mm256_add_ps(m, y);
+    return _mm256_add_ps(m, _mm256_mul_ps(e, _mm256_set1_ps(lnQ2)));
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int magSqAVX2(const Complex *in, float *out, unsigned int n)
+{
+    const float *p = reinterpret_cast<const float*>(in);
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 a = _mm256_loadu_ps(&p[2*i]);
+        __m256 b = _mm256_loadu_ps(&p[2*i + 8]);
+        a = _mm256_mul_ps(a, a);
+        b = _mm256_mul_ps(b, b);
+        // in lane shuffles give samples in order 0 1 4 5 2 3 6 7
+        __m256 v = _mm256_add_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm256_storeu_ps(&out[i], _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0))));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int maxAVX2(const float *in, unsigned int n, float& m)
+{
+    __m256 vm = _mm256_set1_ps(m);
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        vm = _mm256_max_ps(_mm256_loadu_ps(&in[i]), vm);
+    }
+
+    float r[8];
+    _mm256_storeu_ps(r, vm);
+    m = maxScalar(r, 0, 8, m);
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int scaleAVX2(const float *in, float *out, unsigned int n, float factor)
+{
+    __m256 f = _mm256_set1_ps(factor);
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(&out[i], _mm256_mul_ps(f, _mm256_loadu_ps(&in[i])));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int log2AffineAVX2(const float *in, float *out, unsigned int n, float mult, float ofs)
+{
+    __m256 vmult = _mm256_set1_ps(mult);
+    __m256 vofs = _mm256_set1_ps(ofs);
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(&out[i], _mm256_add_ps(_mm256_mul_ps(vmult, lnAVX2(_mm256_loadu_ps(&in[i]))), vofs));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int movingAverageAVX2(float *v, double *data, double *sum, unsigned int n, double depth)
+{
+    __m256d d = _mm256_set1_pd(depth);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x = _mm256_cvtps_pd(_mm_loadu_ps(&v[i]));
+        __m256d s = _mm256_add_pd(_mm256_loadu_pd(&sum[i]), _mm256_sub_pd(x, _mm256_loadu_pd(&data[i])));
+        _mm256_storeu_pd(&sum[i], s);
+        _mm256_storeu_pd(&data[i], x);
+        _mm_storeu_ps(&v[i], _mm256_cvtpd_ps(_mm256_div_pd(s, d)));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int accumulateAVX2(const float *v, double *sum, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(&sum[i], _mm256_add_pd(_mm256_loadu_pd(&sum[i]), _mm256_cvtps_pd(_mm_loadu_ps(&v[i]))));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int averageAVX2(const double *sum, float *out, unsigned int n, double size)
+{
+    __m256d s = _mm256_set1_pd(size);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(&out[i], _mm256_cvtpd_ps(_mm256_div_pd(_mm256_loadu_pd(&sum[i]), s)));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int maxUpdateAVX2(const float *v, double *max, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(&max[i], _mm256_max_pd(_mm256_cvtps_pd(_mm_loadu_ps(&v[i])), _mm256_loadu_pd(&max[i])));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int toDoubleAVX2(const float *in, double *out, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(&out[i], _mm256_cvtps_pd(_mm_loadu_ps(&in[i])));
+    }
+
+    return i;
+}
+
+static SDR_SIMD_TARGET_AVX2 unsigned int toFloatAVX2(const double *in, float *out, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(&out[i], _mm256_cvtpd_ps(_mm256_loadu_pd(&in[i])));
+    }
+
+    return i;
+}
+#elif defined(SDR_SIMD_NEON)
+static inline float32x4_t lnNEON(float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    x = vmaxq_f32(x, vdupq_n_f32(std::numeric_limits<float>::min()));
+    uint32x4_t bits = vreinterpretq_u32_f32(x);
+    float32x4_t e = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(126)));
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x807FFFFF)), vdupq_n_u32(0x3F000000)));
+    uint32x4_t mask = vcltq_f32(m, vdupq_n_f32(lnSqrtHalf));
+    float32x4_t tmp = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(m), mask));
+    m = vsubq_f32(m, one);
+    e = vsubq_f32(e, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(one), mask)));
+    m = vaddq_f32(m, tmp);
+    float32x4_t z = vmulq_f32(m, m);
+    float32x4_t y = vdupq_n_f32(lnP0);
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP1));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP2));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP3));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP4));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP5));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP6));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP7));
+    y = vaddq_f32(vmulq_f32(y, m), vdupq_n_f32(lnP8));
+    y = vmulq_f32(vmulq_f32(y, m), z);
+    y = vaddq_f32(y, vmulq_f32(e, vdupq_n_f32(lnQ1)));
+    y = vsubq_f32(y, vmulq_f32(z, vdupq_n_f32(0.5f)));
+    m = vaddq_f32(m, y);
+    return vaddq_f32(m, vmulq_f32(e, vdupq_n_f32(lnQ2)));
+}
+
+static unsigned int magSqNEON(const Complex *in, float *out, unsigned int n)
+{
+    const float *p = reinterpret_cast<const float*>(in);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4x2_t iq = vld2q_f32(&p[2*i]); // de-interleaved real and imaginary parts
+        vst1q_f32(&out[i], vaddq_f32(vmulq_f32(iq.val[0], iq.val[0]), vmulq_f32(iq.val[1], iq.val[1])));
+    }
+
+    return i;
+}
+
+static unsigned int maxNEON(const float *in, unsigned int n, float& m)
+{
+    float32x4_t vm = vdupq_n_f32(m);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vm = vmaxq_f32(vld1q_f32(&in[i]), vm);
+    }
+
+    float r[4];
+    vst1q_f32(r, vm);
+    m = maxScalar(r, 0, 4, m);
+    return i;
+}
+
+static unsigned int scaleNEON(const float *in, float *out, unsigned int n, float factor)
+{
+    float32x4_t f = vdupq_n_f32(factor);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(&out[i], vmulq_f32(f, vld1q_f32(&in[i])));
+    }
+
+    return i;
+}
+
+static unsigned int log2AffineNEON(const float *in, float *out, unsigned int n, float mult, float ofs)
+{
+    float32x4_t vmult = vdupq_n_f32(mult);
+    float32x4_t vofs = vdupq_n_f32(ofs);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(&out[i], vaddq_f32(vmulq_f32(vmult, lnNEON(vld1q_f32(&in[i]))), vofs));
+    }
+
+    return i;
+}
+
+#if defined(__aarch64__) // double precision vectors
+static unsigned int movingAverageNEON(float *v, double *data, double *sum, unsigned int n, double depth)
+{
+    float64x2_t d = vdupq_n_f64(depth);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4_t x = vld1q_f32(&v[i]);
+        float64x2_t x0 = vcvt_f64_f32(vget_low_f32(x));
+        float64x2_t x1 = vcvt_high_f64_f32(x);
+        float64x2_t s0 = vaddq_f64(vld1q_f64(&sum[i]), vsubq_f64(x0, vld1q_f64(&data[i])));
+        float64x2_t s1 = vaddq_f64(vld1q_f64(&sum[i + 2]), vsubq_f64(x1, vld1q_f64(&data[i + 2])));
+        vst1q_f64(&sum[i], s0);
+        vst1q_f64(&sum[i + 2], s1);
+        vst1q_f64(&data[i], x0);
+        vst1q_f64(&data[i + 2], x1);
+        vst1q_f32(&v[i], vcombine_f32(vcvt_f32_f64(vdivq_f64(s0, d)), vcvt_f32_f64(vdivq_f64(s1, d))));
+    }
+
+    return i;
+}
+
+static unsigned int accumulateNEON(const float *v, double *sum, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4_t x = vld1q_f32(&v[i]);
+        vst1q_f64(&sum[i], vaddq_f64(vld1q_f64(&sum[i]), vcvt_f64_f32(vget_low_f32(x))));
+        vst1q_f64(&sum[i + 2], vaddq_f64(vld1q_f64(&sum[i + 2]), vcvt_high_f64_f32(x)));
+    }
+
+    return i;
+}
+
+static unsigned int averageNEON(const double *sum, float *out, unsigned int n, double size)
+{
+    float64x2_t s = vdupq_n_f64(size);
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x2_t a0 = vcvt_f32_f64(vdivq_f64(vld1q_f64(&sum[i]), s));
+        float32x2_t a1 = vcvt_f32_f64(vdivq_f64(vld1q_f64(&sum[i + 2]), s));
+        vst1q_f32(&out[i], vcombine_f32(a0, a1));
+    }
+
+    return i;
+}
+
+static unsigned int maxUpdateNEON(const float *v, double *max, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4_t x = vld1q_f32(&v[i]);
+        vst1q_f64(&max[i], vmaxq_f64(vcvt_f64_f32(vget_low_f32(x)), vld1q_f64(&max[i])));
+        vst1q_f64(&max[i + 2], vmaxq_f64(vcvt_high_f64_f32(x), vld1q_f64(&max[i + 2])));
+    }
+
+    return i;
+}
+
+static unsigned int toDoubleNEON(const float *in, double *out, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4_t x = vld1q_f32(&in[i]);
+        vst1q_f64(&out[i], vcvt_f64_f32(vget_low_f32(x)));
+        vst1q_f64(&out[i + 2], vcvt_high_f64_f32(x));
+    }
+
+    return i;
+}
+
+static unsigned int toFloatNEON(const double *in, float *out, unsigned int n)
+{
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(&out[i], vcombine_f32(vcvt_f32_f64(vld1q_f64(&in[i])), vcvt_f32_f64(vld1q_f64(&in[i + 2]))));
+    }
+
+    return i;
+}
+#endif // __aarch64__
+#endif
+
+void SpectrumKernels::magSq(const Complex *in, float *out, unsigned int n)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = magSqAVX2(in, out, n);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = magSqSSE2(in, out, n);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = magSqNEON(in, out, n);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    magSqScalar(in, out, done, n);
+}
+
+float SpectrumKernels::max(const float *in, unsigned int n, float init)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = maxAVX2(in, n, init);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = maxSSE2(in, n, init);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = maxNEON(in, n, init);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return maxScalar(in, done, n, init);
+}
+
+void SpectrumKernels::scale(const float *in, float *out, unsigned int n, float factor)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = scaleAVX2(in, out, n, factor);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = scaleSSE2(in, out, n, factor);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = scaleNEON(in, out, n, factor);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    scaleScalar(in, out, done, n, factor);
+}
+
+void SpectrumKernels::log2Affine(const float *in, float *out, unsigned int n, float mult, float ofs)
+{
+    mult *= 1.4426950408889634f; // log2(x) = ln(x) * log2(e)
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = log2AffineAVX2(in, out, n, mult, ofs);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = log2AffineSSE2(in, out, n, mult, ofs);
+        break;
+#elif defined(SDR_SIMD_NEON)
+    case CPUFeatures::SIMDNEON:
+        done = log2AffineNEON(in, out, n, mult, ofs);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    log2AffineScalar(in, out, done, n, mult, ofs);
+}
+
+void SpectrumKernels::movingAverage(float *v, double *data, double *sum, unsigned int n, unsigned int depth)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = movingAverageAVX2(v, data, sum, n, depth);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = movingAverageSSE2(v, data, sum, n, depth);
+        break;
+#elif defined(SDR_SIMD_NEON) && defined(__aarch64__)
+    case CPUFeatures::SIMDNEON:
+        done = movingAverageNEON(v, data, sum, n, depth);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    movingAverageScalar(v, data, sum, done, n, depth);
+}
+
+void SpectrumKernels::accumulate(const float *v, double *sum, unsigned int n)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = accumulateAVX2(v, sum, n);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = accumulateSSE2(v, sum, n);
+        break;
+#elif defined(SDR_SIMD_NEON) && defined(__aarch64__)
+    case CPUFeatures::SIMDNEON:
+        done = accumulateNEON(v, sum, n);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    accumulateScalar(v, sum, done, n);
+}
+
+void SpectrumKernels::average(const double *sum, float *out, unsigned int n, unsigned int size)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = averageAVX2(sum, out, n, size);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = averageSSE2(sum, out, n, size);
+        break;
+#elif defined(SDR_SIMD_NEON) && defined(__aarch64__)
+    case CPUFeatures::SIMDNEON:
+        done = averageNEON(sum, out, n, size);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    averageScalar(sum, out, done, n, size);
+}
+
+void SpectrumKernels::maxUpdate(const float *v, double *max, unsigned int n)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = maxUpdateAVX2(v, max, n);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = maxUpdateSSE2(v, max, n);
+        break;
+#elif defined(SDR_SIMD_NEON) && defined(__aarch64__)
+    case CPUFeatures::SIMDNEON:
+        done = maxUpdateNEON(v, max, n);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    maxUpdateScalar(v, max, done, n);
+}
+
+void SpectrumKernels::toDouble(const float *in, double *out, unsigned int n)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = toDoubleAVX2(in, out, n);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = toDoubleSSE2(in, out, n);
+        break;
+#elif defined(SDR_SIMD_NEON) && defined(__aarch64__)
+    case CPUFeatures::SIMDNEON:
+        done = toDoubleNEON(in, out, n);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    toDoubleScalar(in, out, done, n);
+}
+
+void SpectrumKernels::toFloat(const double *in, float *out, unsigned int n)
+{
+    unsigned int done = 0;
+
+    switch (CPUFeatures::getSIMDLevel())
+    {
+#if defined(SDR_SIMD_X86)
+    case CPUFeatures::SIMDAVX2:
+        done = toFloatAVX2(in, out, n);
+        break;
+    case CPUFeatures::SIMDSSE2:
+        done = toFloatSSE2(in, out, n);
+        break;
+#elif defined(SDR_SIMD_NEON) && defined(__aarch64__)
+    case CPUFeatures::SIMDNEON:
+        done = toFloatNEON(in, out, n);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    toFloatScalar(in, out, done, n);
+}
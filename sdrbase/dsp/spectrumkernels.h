@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMKERNELS_H_
+#define SDRBASE_DSP_SPECTRUMKERNELS_H_
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Kernels of the spectrum processing from FFT output to displayable power values. Powers
+ * are processed as floats and averaging states as doubles like in MovingAverage2D,
+ * FixedAverage2D and Max2D. The instruction set is selected at run time with CPUFeatures.
+ * The logarithm is a polynomial approximation within a few units in the last place used
+ * in all code paths so that results do not depend on the instruction set.
+ */
+class SDRBASE_API SpectrumKernels
+{
+public:
+    static void magSq(const Complex *in, float *out, unsigned int n);             //!< out[i] = |in[i]|^2
+    static float max(const float *in, unsigned int n, float init);                //!< max(init, in[0..n-1])
+    static void scale(const float *in, float *out, unsigned int n, float factor); //!< out[i] = factor * in[i]
+    static void log2Affine(const float *in, float *out, unsigned int n, float mult, float ofs); //!< out[i] = mult * log2(in[i]) + ofs
+    static void movingAverage(float *v, double *data, double *sum, unsigned int n, unsigned int depth); //!< Replace oldest data by v and v by average
+    static void accumulate(const float *v, double *sum, unsigned int n);          //!< sum[i] += v[i]
+    static void average(const double *sum, float *out, unsigned int n, unsigned int size); //!< out[i] = sum[i] / size
+    static void maxUpdate(const float *v, double *max, unsigned int n);           //!< max[i] = max(max[i], v[i])
+    static void toDouble(const float *in, double *out, unsigned int n);
+    static void toFloat(const double *in, float *out, unsigned int n);
+};
+
+#endif // SDRBASE_DSP_SPECTRUMKERNELS_H_
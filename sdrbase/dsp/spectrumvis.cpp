@@ -26,6 +26,8 @@
 #include "dspcommands.h"
 #include "dspengine.h"
 #include "fftfactory.h"
+#include "spectrumkernels.h"
+#include "spectrumanalyzers.h"
 #include "util/messagequeue.h"
 
 #include "spectrumvis.h"
@@ -54,26 +56,48 @@ SpectrumVis::SpectrumVis(Real scalef) :
 	m_fftBuffer(4096),
 	m_powerSpectrum(4096),
     m_psd(4096),
+    m_powerBins(4096),
 	m_fftBufferFill(0),
 	m_needMoreSamples(false),
     m_frequencyZoomFactor(1.0f),
     m_frequencyZoomPos(0.5f),
 	m_scalef(scalef),
 	m_glSpectrum(nullptr),
+    m_analyzers(nullptr),
+    m_fftKey(0),
+    m_wsSpectrum(this), // follows this object when moved to another thread
     m_specMax(0.0f),
     m_centerFrequency(0),
     m_sampleRate(48000),
 	m_ofs(0),
     m_powFFTDiv(1.0),
     m_guiMessageQueue(nullptr),
-	m_mutex(QMutex::Recursive)
+	m_mutex(QMutex::Recursive),
+    m_framesWritten(0),
+    m_framesRead(0),
+    m_framesDropped(0),
+    m_processingThread(this)
 {
 	setObjectName("SpectrumVis");
+
+    for (auto& frame : m_frames) {
+        frame.m_samples.resize(4096);
+    }
+
     applySettings(m_settings, true);
+    m_processingThread.start();
 }
 
 SpectrumVis::~SpectrumVis()
 {
+    m_processingThread.requestInterruption();
+    m_framesReady.release();
+    m_processingThread.wait();
+
+    if (m_framesDropped.load() > 0) {
+        qDebug("SpectrumVis::~SpectrumVis: %u frames dropped", m_framesDropped.load());
+    }
+
     FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
     fftFactory->releaseEngine(m_settings.m_fftSize, false, m_fftEngineSequence);
 }
@@ -84,6 +108,12 @@ void SpectrumVis::setScalef(Real scalef)
     getInputMessageQueue()->push(cmd);
 }
 
+void SpectrumVis::setAnalyzers(SpectrumAnalyzers *analyzers)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_analyzers = analyzers;
+}
+
 void SpectrumVis::configureWSSpectrum(const QString& address, uint16_t port)
 {
     MsgConfigureWSpectrum* cmd = new MsgConfigureWSpectrum(address, port);
@@ -117,204 +147,12 @@ void SpectrumVis::feed(const Complex *begin, unsigned int length)
 		return;
 	}
 
-    if (!m_mutex.tryLock(0)) { // prevent conflicts with configuration process
+    if (!m_feedMutex.tryLock(0)) { // prevent conflicts with configuration process
         return;
     }
 
-    Complex c;
-    Real v;
-    int fftMin = (m_frequencyZoomFactor == 1.0f) ?
-        0 : (m_frequencyZoomPos - (0.5f / m_frequencyZoomFactor)) * m_settings.m_fftSize;
-    int fftMax = (m_frequencyZoomFactor == 1.0f) ?
-        m_settings.m_fftSize : (m_frequencyZoomPos + (0.5f / m_frequencyZoomFactor)) * m_settings.m_fftSize;
-
-    if (m_settings.m_averagingMode == SpectrumSettings::AvgModeNone)
-    {
-        for (int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < (int) length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-            m_psd[i] = v/m_powFFTDiv;
-            v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-            m_powerSpectrum[i] = v;
-        }
-
-        // send new data to visualisation
-        if (m_glSpectrum)
-        {
-            m_glSpectrum->newSpectrum(
-                &m_powerSpectrum.data()[fftMin],
-                fftMax - fftMin,
-                m_settings.m_fftSize
-            );
-        }
-
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear,
-                m_settings.m_ssb,
-                m_settings.m_usb
-            );
-        }
-    }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMoving)
-    {
-        for (int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < (int) length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-            v = m_movingAverage.storeAndGetAvg(v, i);
-            m_psd[i] = v/m_powFFTDiv;
-            v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-            m_powerSpectrum[i] = v;
-        }
-
-        // send new data to visualisation
-        if (m_glSpectrum)
-        {
-            m_glSpectrum->newSpectrum(
-                &m_powerSpectrum.data()[fftMin],
-                fftMax - fftMin,
-                m_settings.m_fftSize
-            );
-        }
-
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear,
-                m_settings.m_ssb,
-                m_settings.m_usb
-            );
-        }
-
-        m_movingAverage.nextAverage();
-    }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeFixed)
-    {
-        double avg;
-
-        for (int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < (int) length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-
-            // result available
-            if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-            {
-                m_psd[i] = avg/m_powFFTDiv;
-                avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                m_powerSpectrum[i] = avg;
-            }
-        }
-
-        // result available
-        if (m_fixedAverage.nextAverage())
-        {
-            // send new data to visualisation
-            if (m_glSpectrum)
-            {
-                m_glSpectrum->newSpectrum(
-                    &m_powerSpectrum.data()[fftMin],
-                    fftMax - fftMin,
-                    m_settings.m_fftSize
-                );
-            }
-
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear,
-                    m_settings.m_ssb,
-                    m_settings.m_usb
-                );
-            }
-        }
-    }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMax)
-    {
-        double max;
-
-        for (int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < (int) length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-
-            // result available
-            if (m_max.storeAndGetMax(max, v, i))
-            {
-                m_psd[i] = max/m_powFFTDiv;
-                max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                m_powerSpectrum[i] = max;
-            }
-        }
-
-        // result available
-        if (m_max.nextMax())
-        {
-            // send new data to visualisation
-            if (m_glSpectrum)
-            {
-                m_glSpectrum->newSpectrum(
-                    &m_powerSpectrum.data()[fftMin],
-                    fftMax - fftMin,
-                    m_settings.m_fftSize
-                );
-            }
-
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear,
-                    m_settings.m_ssb,
-                    m_settings.m_usb
-                );
-            }
-        }
-    }
-
-    m_mutex.unlock();
+    pushFrame(begin, length, false, true);
+    m_feedMutex.unlock();
 }
 
 void SpectrumVis::feed(const ComplexVector::const_iterator& cbegin, const ComplexVector::const_iterator& end, bool positiveOnly)
@@ -328,7 +166,7 @@ void SpectrumVis::feed(const ComplexVector::const_iterator& cbegin, const Comple
 		return;
 	}
 
-    if (!m_mutex.tryLock(0)) { // prevent conflicts with configuration process
+    if (!m_feedMutex.tryLock(0)) { // prevent conflicts with configuration process
         return;
     }
 
@@ -345,7 +183,7 @@ void SpectrumVis::feed(const ComplexVector::const_iterator& cbegin, const Comple
             std::copy(begin, begin + samplesNeeded, m_fftBuffer.begin() + m_fftBufferFill);
             begin += samplesNeeded;
 
-            processFFT(positiveOnly);
+            pushFrame(m_fftBuffer.data(), m_settings.m_fftSize, positiveOnly, false);
 
 			// advance buffer respecting the fft overlap factor
 			std::copy(m_fftBuffer.begin() + m_refillSize, m_fftBuffer.end(), m_fftBuffer.begin());
@@ -364,11 +202,15 @@ void SpectrumVis::feed(const ComplexVector::const_iterator& cbegin, const Comple
 		}
 	}
 
-	m_mutex.unlock();
+	m_feedMutex.unlock();
 }
 
 void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleVector::const_iterator& end, bool positiveOnly)
 {
+    if (m_analyzers) { // additional spectrum analyzers of the device set
+        m_analyzers->feed(this, cbegin, end, positiveOnly);
+    }
+
     if (!m_running) {
         return;
     }
@@ -378,7 +220,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 		return;
 	}
 
-    if (!m_mutex.tryLock(0)) { // prevent conflicts with configuration process
+    if (!m_feedMutex.tryLock(0)) { // prevent conflicts with configuration process
         return;
     }
 
@@ -398,7 +240,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 				*it++ = Complex(begin->real() / m_scalef, begin->imag() / m_scalef);
 			}
 
-            processFFT(positiveOnly);
+            pushFrame(m_fftBuffer.data(), m_settings.m_fftSize, positiveOnly, false);
 
 			// advance buffer respecting the fft overlap factor
 			std::copy(m_fftBuffer.begin() + m_refillSize, m_fftBuffer.end(), m_fftBuffer.begin());
@@ -419,321 +261,208 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 		}
 	}
 
-	m_mutex.unlock();
+	m_feedMutex.unlock();
 }
 
-void SpectrumVis::processFFT(bool positiveOnly)
+void SpectrumVis::pushFrame(const Complex *samples, unsigned int length, bool positiveOnly, bool direct)
 {
-    int fftMin = (m_frequencyZoomFactor == 1.0f) ?
-        0 : (m_frequencyZoomPos - (0.5f / m_frequencyZoomFactor)) * m_settings.m_fftSize;
-    int fftMax = (m_frequencyZoomFactor == 1.0f) ?
-        m_settings.m_fftSize : (m_frequencyZoomPos + (0.5f / m_frequencyZoomFactor)) * m_settings.m_fftSize;
+    uint32_t written = m_framesWritten.load(std::memory_order_relaxed);
+
+    if (written - m_framesRead.load(std::memory_order_acquire) >= m_nbFrames)
+    {
+        // processing is late: drop this frame rather than blocking the feeding thread
+        m_framesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    SpectrumFrame& frame = m_frames[written % m_nbFrames];
+    frame.m_length = std::min(length, (unsigned int) m_settings.m_fftSize);
+    frame.m_positiveOnly = positiveOnly;
+    frame.m_direct = direct;
+    std::copy(samples, samples + frame.m_length, frame.m_samples.begin());
+    m_framesWritten.store(written + 1, std::memory_order_release);
+
+    if (m_framesReady.available() == 0) {
+        m_framesReady.release();
+    }
+}
+
+void SpectrumVis::processFrames()
+{
+    while (true)
+    {
+        m_framesReady.acquire();
 
-    // apply fft window (and copy from m_fftBuffer to m_fftIn)
-    m_window.apply(&m_fftBuffer[0], m_fft->in());
+        if (m_processingThread.isInterruptionRequested()) {
+            break;
+        }
+
+        QMutexLocker mutexLocker(&m_mutex); // prevent conflicts with configuration process
+        uint32_t written = m_framesWritten.load(std::memory_order_acquire);
+
+        for (uint32_t read = m_framesRead.load(std::memory_order_relaxed); read != written; read++)
+        {
+            processFFT(m_frames[read % m_nbFrames]);
+            m_framesRead.store(read + 1, std::memory_order_release);
+        }
+    }
+}
+
+void SpectrumVis::processFFT(const SpectrumFrame& frame)
+{
+    unsigned int fftSize = m_settings.m_fftSize;
+    unsigned int halfSize = fftSize / 2;
+
+    if (frame.m_direct) // samples are FFT bins already
+    {
+        SpectrumKernels::magSq(frame.m_samples.data(), m_powerBins.data(), frame.m_length);
+        std::fill(m_powerBins.begin() + frame.m_length, m_powerBins.begin() + fftSize, 0.0f);
+        processPowerBins(fftSize, false);
+        return;
+    }
+
+    // apply fft window (and copy from frame samples to m_fftIn)
+    m_window.apply(frame.m_samples.data(), m_fft->in());
 
     // calculate FFT
     m_fft->transform();
 
     // extract power spectrum and reorder buckets
     const Complex* fftOut = m_fft->out();
-    Complex c;
-    Real v;
-    std::size_t halfSize = m_settings.m_fftSize / 2;
 
-    if (m_settings.m_averagingMode == SpectrumSettings::AvgModeNone)
+    unsigned int nbBins = frame.m_positiveOnly ? halfSize : fftSize;
+
+    if (frame.m_positiveOnly)
     {
-        m_specMax = 0.0f;
+        SpectrumKernels::magSq(fftOut, m_powerBins.data(), halfSize);
+    }
+    else
+    {
+        SpectrumKernels::magSq(&fftOut[halfSize], m_powerBins.data(), halfSize);
+        SpectrumKernels::magSq(fftOut, &m_powerBins[halfSize], halfSize);
+    }
 
-        if ( positiveOnly )
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i * 2] = v;
-                m_powerSpectrum[i * 2 + 1] = v;
-            }
-        }
-        else
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i] = v;
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                m_psd[i + halfSize] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i + halfSize] = v;
-            }
-        }
+    if (m_analyzers) { // before averaging changes the bins in place
+        m_analyzers->shareFFT(this, m_powerBins.data(), nbBins, frame.m_positiveOnly);
+    }
 
-        // send new data to visualisation
-        if (m_glSpectrum)
-        {
-            m_glSpectrum->newSpectrum(
-                &m_powerSpectrum.data()[fftMin],
-                fftMax - fftMin,
-                m_settings.m_fftSize
-            );
-        }
+    processPowerBins(nbBins, frame.m_positiveOnly);
+}
 
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear,
-                m_settings.m_ssb,
-                m_settings.m_usb
-            );
-        }
+void SpectrumVis::feedPowerBins(const Real *bins, unsigned int nbBins, bool positiveOnly)
+{
+    if (!isComputing()) {
+        return;
+    }
+
+    if (!m_mutex.tryLock(0)) { // busy or being configured: skip this FFT
+        return;
     }
-    else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMoving)
+
+    if (nbBins <= (unsigned int) m_settings.m_fftSize)
     {
-        m_specMax = 0.0f;
+        std::copy(bins, bins + nbBins, m_powerBins.begin());
+        processPowerBins(nbBins, positiveOnly);
+    }
 
-        if ( positiveOnly )
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                v = m_movingAverage.storeAndGetAvg(v, i);
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i * 2] = v;
-                m_powerSpectrum[i * 2 + 1] = v;
-            }
-        }
-        else
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                v = m_movingAverage.storeAndGetAvg(v, i+halfSize);
-                m_psd[i] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i] = v;
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-                v = m_movingAverage.storeAndGetAvg(v, i);
-                m_psd[i + halfSize] = v/m_powFFTDiv;
-                m_specMax = v > m_specMax ? v : m_specMax;
-                v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                m_powerSpectrum[i + halfSize] = v;
-            }
-        }
+    m_mutex.unlock();
+}
 
-        // send new data to visualisation
-        if (m_glSpectrum)
-        {
-            m_glSpectrum->newSpectrum(
-                &m_powerSpectrum.data()[fftMin],
-                fftMax - fftMin,
-                m_settings.m_fftSize
-            );
-        }
+void SpectrumVis::processPowerBins(unsigned int nbBins, bool positiveOnly)
+{
+    Real *bins = m_powerBins.data();
 
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear,
-                m_settings.m_ssb,
-                m_settings.m_usb
-            );
+    // averaging is done in display order on whole rows of bins
+    if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMoving)
+    {
+        if (m_movingAverage.getDepth() > 1) {
+            SpectrumKernels::movingAverage(bins, m_movingAverage.getCurrentData(), m_movingAverage.getSums(), nbBins, m_movingAverage.getDepth());
         }
 
         m_movingAverage.nextAverage();
     }
     else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeFixed)
     {
-        double avg;
-        Real specMax = 0.0f;
-
-        if ( positiveOnly )
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-                {
-                    m_psd[i] = avg/m_powFFTDiv;
-                    specMax = avg > specMax ? avg : specMax;
-                    avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                    m_powerSpectrum[i * 2] = avg;
-                    m_powerSpectrum[i * 2 + 1] = avg;
-                }
-            }
-        }
-        else
+        if (m_fixedAverage.getSize() > 1)
         {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_fixedAverage.storeAndGetAvg(avg, v, i+halfSize))
-                {
-                    m_psd[i] = avg/m_powFFTDiv;
-                    specMax = avg > specMax ? avg : specMax;
-                    avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                    m_powerSpectrum[i] = avg;
-                }
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-                {
-                    m_psd[i + halfSize] = avg/m_powFFTDiv;
-                    specMax = avg > specMax ? avg : specMax;
-                    avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                    m_powerSpectrum[i + halfSize] = avg;
-                }
-            }
-        }
+            SpectrumKernels::accumulate(bins, m_fixedAverage.getSums(), nbBins);
 
-        // result available
-        if (m_fixedAverage.nextAverage())
-        {
-            m_specMax = specMax;
-
-            // send new data to visualisation
-            if (m_glSpectrum)
-            {
-                m_glSpectrum->newSpectrum(
-                    &m_powerSpectrum.data()[fftMin],
-                    fftMax - fftMin,
-                    m_settings.m_fftSize
-                );
+            if (m_fixedAverage.isLastFrame()) {
+                SpectrumKernels::average(m_fixedAverage.getSums(), bins, nbBins, m_fixedAverage.getSize());
             }
+        }
 
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear,
-                    m_settings.m_ssb,
-                    m_settings.m_usb
-                );
-            }
+        if (!m_fixedAverage.nextAverage()) { // result not available yet
+            return;
         }
     }
     else if (m_settings.m_averagingMode == SpectrumSettings::AvgModeMax)
     {
-        double max;
-        Real specMax = 0.0f;
-
-        if ( positiveOnly )
+        if (m_max.getSize() > 1)
         {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_max.storeAndGetMax(max, v, i))
-                {
-                    m_psd[i] = max/m_powFFTDiv;
-                    specMax = max > specMax ? max : specMax;
-                    max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                    m_powerSpectrum[i * 2] = max;
-                    m_powerSpectrum[i * 2 + 1] = max;
-                }
+            if (m_max.getIndex() == 0) {
+                SpectrumKernels::toDouble(bins, m_max.getMax(), nbBins);
+            } else {
+                SpectrumKernels::maxUpdate(bins, m_max.getMax(), nbBins);
             }
-        }
-        else
-        {
-            for (std::size_t i = 0; i < halfSize; i++)
-            {
-                c = fftOut[i + halfSize];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_max.storeAndGetMax(max, v, i+halfSize))
-                {
-                    m_psd[i] = max/m_powFFTDiv;
-                    specMax = max > specMax ? max : specMax;
-                    max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                    m_powerSpectrum[i] = max;
-                }
-
-                c = fftOut[i];
-                v = c.real() * c.real() + c.imag() * c.imag();
-
-                // result available
-                if (m_max.storeAndGetMax(max, v, i))
-                {
-                    m_psd[i + halfSize] = max/m_powFFTDiv;
-                    specMax = max > specMax ? max : specMax;
-                    max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                    m_powerSpectrum[i + halfSize] = max;
-                }
+
+            if (m_max.getIndex() == m_max.getSize() - 1) {
+                SpectrumKernels::toFloat(m_max.getMax(), bins, nbBins);
             }
         }
 
-        // result available
-        if (m_max.nextMax())
-        {
-            m_specMax = specMax;
-
-            // send new data to visualisation
-            if (m_glSpectrum)
-            {
-                m_glSpectrum->newSpectrum(
-                    &m_powerSpectrum.data()[fftMin],
-                    fftMax - fftMin,
-                    m_settings.m_fftSize
-                );
-            }
+        if (!m_max.nextMax()) { // result not available yet
+            return;
+        }
+    }
 
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear,
-                    m_settings.m_ssb,
-                    m_settings.m_usb
-                );
-            }
+    Real *powerSpectrum = m_powerSpectrum.data();
+    m_specMax = SpectrumKernels::max(bins, nbBins, 0.0f);
+    SpectrumKernels::scale(bins, m_psd.data(), nbBins, 1.0f / m_powFFTDiv); // FFT size is a power of two: exact
+
+    if (m_settings.m_linear) {
+        std::copy(m_psd.begin(), m_psd.begin() + nbBins, m_powerSpectrum.begin());
+    } else {
+        SpectrumKernels::log2Affine(bins, powerSpectrum, nbBins, m_mult, m_ofs);
+    }
+
+    if (positiveOnly) // spread each bin over two display points backwards in place
+    {
+        for (int i = nbBins - 1; i >= 0; i--)
+        {
+            powerSpectrum[i * 2 + 1] = powerSpectrum[i];
+            powerSpectrum[i * 2] = powerSpectrum[i];
         }
     }
+
+    int fftMin = (m_frequencyZoomFactor == 1.0f) ?
+        0 : (m_frequencyZoomPos - (0.5f / m_frequencyZoomFactor)) * m_settings.m_fftSize;
+    int fftMax = (m_frequencyZoomFactor == 1.0f) ?
+        m_settings.m_fftSize : (m_frequencyZoomPos + (0.5f / m_frequencyZoomFactor)) * m_settings.m_fftSize;
+
+    // send new data to visualisation
+    if (m_glSpectrum)
+    {
+        m_glSpectrum->newSpectrum(
+            &m_powerSpectrum.data()[fftMin],
+            fftMax - fftMin,
+            m_settings.m_fftSize
+        );
+    }
+
+    // web socket spectrum connections
+    if (m_wsSpectrum.socketOpened())
+    {
+        m_wsSpectrum.newSpectrum(
+            m_powerSpectrum,
+            m_settings.m_fftSize,
+            m_centerFrequency,
+            m_sampleRate,
+            m_settings.m_linear,
+            m_settings.m_ssb,
+            m_settings.m_usb
+        );
+    }
 }
 
 void SpectrumVis::getZoomedPSDCopy(std::vector<Real>& copy) const
@@ -825,6 +554,7 @@ bool SpectrumVis::handleMessage(const Message& message)
 void SpectrumVis::applySettings(const SpectrumSettings& settings, bool force)
 {
     QMutexLocker mutexLocker(&m_mutex);
+    QMutexLocker feedMutexLocker(&m_feedMutex);
 
     int fftSize = settings.m_fftSize > (1<<SpectrumSettings::m_log2FFTSizeMax) ?
         (1<<SpectrumSettings::m_log2FFTSizeMax) :
@@ -866,6 +596,11 @@ void SpectrumVis::applySettings(const SpectrumSettings& settings, bool force)
             m_fftBuffer.resize(fftSize);
             m_powerSpectrum.resize(fftSize);
             m_psd.resize(fftSize);
+            m_powerBins.resize(fftSize);
+
+            for (auto& frame : m_frames) {
+                frame.m_samples.resize(fftSize);
+            }
         }
     }
 
@@ -903,6 +638,8 @@ void SpectrumVis::applySettings(const SpectrumSettings& settings, bool force)
 
     m_settings = settings;
     m_settings.m_fftSize = fftSize;
+    m_fftKey.store(((uint64_t) settings.m_fftWindow << 48) | ((uint64_t) m_overlapSize << 24) | (uint64_t) fftSize);
+    m_framesRead.store(m_framesWritten.load()); // discard frames queued with previous settings
 }
 
 void SpectrumVis::handleConfigureDSP(uint64_t centerFrequency, int sampleRate)
@@ -910,12 +647,22 @@ void SpectrumVis::handleConfigureDSP(uint64_t centerFrequency, int sampleRate)
     QMutexLocker mutexLocker(&m_mutex);
     m_centerFrequency = centerFrequency;
     m_sampleRate = sampleRate;
+
+    if (m_analyzers) {
+        m_analyzers->setCenterFrequencyAndSampleRate(this, centerFrequency, sampleRate);
+    }
 }
 
 void SpectrumVis::handleScalef(Real scalef)
 {
-    QMutexLocker mutexLocker(&m_mutex);
-    m_scalef = scalef;
+    {
+        QMutexLocker mutexLocker(&m_feedMutex);
+        m_scalef = scalef;
+    }
+
+    if (m_analyzers) {
+        m_analyzers->setScalef(this, scalef);
+    }
 }
 
 void SpectrumVis::handleWSOpenClose(bool openClose)
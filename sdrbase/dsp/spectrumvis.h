@@ -22,6 +22,10 @@
 #define INCLUDE_SPECTRUMVIS_H
 
 #include <QMutex>
+#include <QThread>
+#include <QSemaphore>
+
+#include <atomic>
 
 #include "dsp/basebandsamplesink.h"
 #include "dsp/fftengine.h"
@@ -36,6 +40,7 @@
 
 class GLSpectrumInterface;
 class MessageQueue;
+class SpectrumAnalyzers;
 
 namespace SWGSDRangel {
     class SWGGLSpectrum;
@@ -141,6 +146,7 @@ public:
 	virtual ~SpectrumVis();
 
     void setGLSpectrum(GLSpectrumInterface* glSpectrum) { m_glSpectrum = glSpectrum; }
+    void setAnalyzers(SpectrumAnalyzers *analyzers);
 
     void setScalef(Real scalef);
     void configureWSSpectrum(const QString& address, uint16_t port);
@@ -149,6 +155,9 @@ public:
     void getPowerSpectrumCopy(std::vector<Real>& copy) { copy.assign(m_powerSpectrum.begin(), m_powerSpectrum.end()); }
     void getPSDCopy(std::vector<Real>& copy) const { copy.assign(m_psd.begin(), m_psd.begin() + m_settings.m_fftSize); }
     void getZoomedPSDCopy(std::vector<Real>& copy) const;
+    bool isComputing() const { return m_running && (m_glSpectrum || m_wsSpectrum.socketOpened()); } //!< FFT is computed from fed samples
+    bool sameFFT(const SpectrumVis& other) const { return m_fftKey.load() == other.m_fftKey.load(); } //!< Same FFT size, window and overlap
+    void feedPowerBins(const Real *bins, unsigned int nbBins, bool positiveOnly); //!< Power bins of an FFT computed by another spectrum with the same FFT
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
     void feed(const ComplexVector::const_iterator& begin, const ComplexVector::const_iterator& end, bool positiveOnly);
@@ -207,6 +216,26 @@ private:
         uint16_t m_port;
     };
 
+    struct SpectrumFrame //!< Samples of one FFT handed over to the processing thread
+    {
+        std::vector<Complex> m_samples;
+        unsigned int m_length;  //!< Number of valid samples (direct feed may be shorter than FFT size)
+        bool m_positiveOnly;
+        bool m_direct;          //!< Samples are already transformed
+    };
+
+    class ProcessingThread : public QThread //!< Runs FFT, power and averaging out of the feeding thread
+    {
+    public:
+        ProcessingThread(SpectrumVis *spectrumVis) : m_spectrumVis(spectrumVis) {}
+
+    protected:
+        virtual void run() { m_spectrumVis->processFrames(); }
+
+    private:
+        SpectrumVis *m_spectrumVis;
+    };
+
     bool m_running;
 	FFTEngine* m_fft;
 	FFTWindow m_window;
@@ -215,6 +244,7 @@ private:
 	std::vector<Complex> m_fftBuffer;
 	std::vector<Real> m_powerSpectrum; //!< displayable power spectrum
     std::vector<Real> m_psd; //!< real PSD
+    std::vector<Real> m_powerBins; //!< power of FFT bins in display order before averaging and scaling
 
     SpectrumSettings m_settings;
 	int m_overlapSize;
@@ -227,6 +257,8 @@ private:
 
 	Real m_scalef;
 	GLSpectrumInterface* m_glSpectrum;
+    SpectrumAnalyzers *m_analyzers;
+    std::atomic<uint64_t> m_fftKey; //!< FFT size, window and overlap packed for lock free comparison
     WSSpectrum m_wsSpectrum;
 	MovingAverage2D<double> m_movingAverage;
 	FixedAverage2D<double> m_fixedAverage;
@@ -242,9 +274,21 @@ private:
 
     MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
 
-	QMutex m_mutex;
-
-    void processFFT(bool positiveOnly);
+	QMutex m_mutex;     //!< Processing and configuration
+    QMutex m_feedMutex; //!< Feeding and configuration
+
+    static const unsigned int m_nbFrames = 4;
+    SpectrumFrame m_frames[m_nbFrames];
+    std::atomic<uint32_t> m_framesWritten;
+    std::atomic<uint32_t> m_framesRead;
+    std::atomic<uint32_t> m_framesDropped;
+    QSemaphore m_framesReady;
+    ProcessingThread m_processingThread;
+
+    void pushFrame(const Complex *samples, unsigned int length, bool positiveOnly, bool direct);
+    void processFrames();
+    void processFFT(const SpectrumFrame& frame);
+    void processPowerBins(unsigned int nbBins, bool positiveOnly);
     void setRunning(bool running) { m_running = running; }
     void applySettings(const SpectrumSettings& settings, bool force = false);
     void handleConfigureDSP(uint64_t centerFrequency, int sampleRate);
@@ -67,14 +67,14 @@ void UpChannelizer::pullOne(Sample& sample)
         {
             if(stage == m_filterStages.end() - 1)
             {
-                if ((*stage)->work(&m_sampleIn, &(*stageSample)))
+                if (stage->work(&m_sampleIn, &(*stageSample)))
                 {
                     m_sampleSource->pullOne(m_sampleIn); // get new input sample
                 }
             }
             else
             {
-                if (!(*stage)->work(&(*(stageSample+1)), &(*stageSample)))
+                if (!stage->work(&(*(stageSample+1)), &(*stageSample)))
                 {
                     break;
                 }
@@ -101,13 +101,35 @@ void UpChannelizer::pull(SampleVector::iterator begin, unsigned int nbSamples)
     }
     else
     {
-        std::for_each(
-            begin,
-            begin + nbSamples,
-            [this](Sample& s) {
-                pullOne(s);
+        // samples needed at the input of each stage going up the chain
+        m_stageNbSamples.resize(log2Interp + 1);
+        m_stageBuffers.resize(log2Interp + 1);
+        m_stageNbSamples[0] = nbSamples;
+
+        for (unsigned int i = 0; i < log2Interp; i++)
+        {
+            m_stageNbSamples[i+1] = m_filterStages[i].getNbInputSamples(m_stageNbSamples[i]);
+
+            if (m_stageBuffers[i+1].size() < m_stageNbSamples[i+1]) {
+                m_stageBuffers[i+1].resize(m_stageNbSamples[i+1]);
             }
-        );
+        }
+
+        // one block from the source then each stage in turn down to the baseband
+        if (m_stageNbSamples[log2Interp] > 0) {
+            m_sampleSource->pull(m_stageBuffers[log2Interp].begin(), m_stageNbSamples[log2Interp]);
+        }
+
+        for (int i = log2Interp - 1; i >= 0; i--)
+        {
+            Sample& pending = (i == (int) log2Interp - 1) ? m_sampleIn : m_stageSamples[i+1];
+            Sample *out = i == 0 ? &(*begin) : m_stageBuffers[i].data();
+            m_filterStages[i].work(pending, m_stageBuffers[i+1].data(), out, m_stageNbSamples[i]);
+        }
+
+        if (nbSamples > 0) {
+            m_stageSamples[0] = begin[nbSamples-1];
+        }
     }
 }
 
@@ -192,49 +214,9 @@ void UpChannelizer::applyInterpolation()
 			<< " fc:" << m_channelFrequencyOffset;
 }
 
-#ifdef USE_SSE4_1
-UpChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf;
-            break;
-    }
-}
-#else
 UpChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf;
-            break;
-    }
-}
-#endif
-
-UpChannelizer::FilterStage::~FilterStage()
+    m_mode(mode)
 {
-    delete m_filter;
 }
 
 bool UpChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
@@ -265,7 +247,7 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
         qDebug() << "UpChannelizer::createFilterChain: take left half (rotate by +1/4 and decimate by 2):"
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigStart << ":" << sigStart + sigBw / 2.0 << "]";
-        m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+        m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
         m_stageSamples.push_back(s);
         return createFilterChain(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd);
     }
@@ -276,7 +258,7 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
         qDebug() << "UpChannelizer::createFilterChain: take right half (rotate by -1/4 and decimate by 2):"
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigEnd - sigBw / 2.0f << ":" << sigEnd << "]";
-        m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+        m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
         m_stageSamples.push_back(s);
         return createFilterChain(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd);
     }
@@ -288,7 +270,7 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
         qDebug() << "UpChannelizer::createFilterChain: take center half (decimate by 2):"
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigStart + rot << ":" << sigEnd - rot << "]";
-        m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+        m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
         m_stageSamples.push_back(s);
         // Was: return createFilterChain(sigStart + rot, sigStart + sigBw / 2.0f + rot, chanStart, chanEnd);
         return createFilterChain(sigStart + rot, sigEnd - rot, chanStart, chanEnd);
@@ -318,20 +300,20 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
     {
         if (*rit == 0)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
             m_stageSamples.push_back(s);
             ofs -= ofs_stage;
             qDebug("UpChannelizer::setFilterChain: lower half: ofs: %f", ofs);
         }
         else if (*rit == 1)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
             m_stageSamples.push_back(s);
             qDebug("UpChannelizer::setFilterChain: center: ofs: %f", ofs);
         }
         else if (*rit == 2)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
             m_stageSamples.push_back(s);
             ofs += ofs_stage;
             qDebug("UpChannelizer::setFilterChain: upper half: ofs: %f", ofs);
@@ -349,8 +331,6 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
 
 void UpChannelizer::freeFilterChain()
 {
-    for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
-        delete *it;
     m_filterStages.clear();
     m_stageSamples.clear();
 }
@@ -27,11 +27,7 @@
 
 #include "channelsamplesource.h"
 
-#ifdef USE_SSE4_1
-#include "dsp/inthalfbandfiltereo1.h"
-#else
-#include "dsp/inthalfbandfilterdb.h"
-#endif
+#include "dsp/inthalfbandfiltereo.h"
 
 #define UPCHANNELIZER_HB_FILTER_ORDER 96
 
@@ -58,27 +54,72 @@ protected:
             ModeUpperHalf
         };
 
-#ifdef USE_SSE4_1
-        typedef bool (IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
-        IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#else
-        typedef bool (IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
-        IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#endif
-        WorkFunction m_workFunction;
+        typedef IntHalfbandFilterEO<qint32, qint32, UPCHANNELIZER_HB_FILTER_ORDER, true> Filter;
+        Filter m_filter;
+        Mode m_mode;
 
         FilterStage(Mode mode);
-        ~FilterStage();
 
-        bool work(Sample* sampleIn, Sample *sampleOut) {
-            return (m_filter->*m_workFunction)(sampleIn, sampleOut);
+        bool work(Sample* sampleIn, Sample *sampleOut)
+        {
+            switch (m_mode)
+            {
+            case ModeLowerHalf:
+                return m_filter.workInterpolateLowerHalf(sampleIn, sampleOut);
+            case ModeUpperHalf:
+                return m_filter.workInterpolateUpperHalf(sampleIn, sampleOut);
+            case ModeCenter:
+            default:
+                return m_filter.workInterpolateCenter(sampleIn, sampleOut);
+            }
+        }
+
+        unsigned int getNbInputSamples(unsigned int nbOutputSamples) const {
+            return m_filter.getNbInterpolateInputs(nbOutputSamples);
+        }
+
+        /** Interpolate a block. The pending input sample is used first then the input block
+         *  in sequence. The last input sample is not consumed and becomes the pending sample. */
+        void work(Sample& pending, Sample *in, Sample *out, unsigned int nbOutputSamples)
+        {
+            switch (m_mode)
+            {
+            case ModeLowerHalf:
+                workBlock<&Filter::workInterpolateLowerHalf>(pending, in, out, nbOutputSamples);
+                break;
+            case ModeUpperHalf:
+                workBlock<&Filter::workInterpolateUpperHalf>(pending, in, out, nbOutputSamples);
+                break;
+            case ModeCenter:
+            default:
+                workBlock<&Filter::workInterpolateCenter>(pending, in, out, nbOutputSamples);
+                break;
+            }
+        }
+
+        template<bool (Filter::*WorkFunction)(Sample*, Sample*)>
+        void workBlock(Sample& pending, Sample *in, Sample *out, unsigned int nbOutputSamples)
+        {
+            Sample first(pending);
+            Sample *sampleIn = &first;
+
+            for (unsigned int i = 0; i < nbOutputSamples; i++)
+            {
+                if ((m_filter.*WorkFunction)(sampleIn, &out[i])) {
+                    sampleIn = in++;
+                }
+            }
+
+            pending = *sampleIn;
         }
     };
 
-    typedef std::vector<FilterStage*> FilterStages;
+    typedef std::vector<FilterStage> FilterStages; //!< stages are contiguous
     FilterStages m_filterStages;
     bool m_filterChainSetMode;
     std::vector<Sample> m_stageSamples;
+    std::vector<SampleVector> m_stageBuffers; //!< block output of each stage but the first and source samples
+    std::vector<unsigned int> m_stageNbSamples;
     ChannelSampleSource* m_sampleSource; //!< Modulator
     int m_basebandSampleRate;
     int m_requestedInputSampleRate;
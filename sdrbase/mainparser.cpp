@@ -34,12 +34,30 @@ MainParser::MainParser() :
     m_fftwfWisdomOption(QStringList() << "w" << "fftwf-wisdom",
         "FFTW Wisdom file.",
         "file",
-        "")
+        ""),
+    m_dispatchThreadsOption(QStringList() << "dispatch-threads",
+        "Number of threads used to feed the sinks of a device set in parallel (0 for sequential feed).",
+        "threads",
+        "0"),
+    m_polyphaseSubbandsOption(QStringList() << "polyphase-subbands",
+        "Log2 of the number of sub-bands of the polyphase channelizer feeding the channels of a device set (0 to disable).",
+        "log2",
+        "0"),
+    m_skipDeviceProbeOption(QStringList() << "skip-device-probe",
+        "Do not probe the hardware at startup and restore the devices found at the previous start instead."),
+    m_reportsPortOption(QStringList() << "reports-port",
+        "Port of the WebSocket server pushing reports on the Web API server address (0 to disable).",
+        "port",
+        "0")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
     m_mimoSupport = false;
     m_fftwfWindowFileName = "";
+    m_dispatchThreads = 0;
+    m_polyphaseLog2Subbands = 0;
+    m_skipDeviceProbe = false;
+    m_reportsPort = 0;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -48,6 +66,10 @@ MainParser::MainParser() :
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
     m_parser.addOption(m_fftwfWisdomOption);
+    m_parser.addOption(m_dispatchThreadsOption);
+    m_parser.addOption(m_polyphaseSubbandsOption);
+    m_parser.addOption(m_skipDeviceProbeOption);
+    m_parser.addOption(m_reportsPortOption);
 }
 
 MainParser::~MainParser()
@@ -92,6 +114,40 @@ void MainParser::parse(const QCoreApplication& app)
 
     m_fftwfWindowFileName = m_parser.value(m_fftwfWisdomOption);
 
+    // sinks parallel dispatch
+
+    int dispatchThreads = m_parser.value(m_dispatchThreadsOption).toInt(&ok);
+
+    if (ok && (dispatchThreads >= 0) && (dispatchThreads <= 256)) {
+        m_dispatchThreads = dispatchThreads;
+    } else {
+        qWarning() << "MainParser::parse: dispatch threads invalid. Defaulting to " << m_dispatchThreads;
+    }
+
+    // polyphase channelizer
+
+    int polyphaseLog2Subbands = m_parser.value(m_polyphaseSubbandsOption).toInt(&ok);
+
+    if (ok && (polyphaseLog2Subbands == 0 || ((polyphaseLog2Subbands >= 2) && (polyphaseLog2Subbands <= 10)))) {
+        m_polyphaseLog2Subbands = polyphaseLog2Subbands;
+    } else {
+        qWarning() << "MainParser::parse: polyphase sub-bands invalid. Defaulting to " << m_polyphaseLog2Subbands;
+    }
+
+    // device enumeration
+
+    m_skipDeviceProbe = m_parser.isSet(m_skipDeviceProbeOption);
+
+    // reports WebSocket server port
+
+    int reportsPort = m_parser.value(m_reportsPortOption).toInt(&ok);
+
+    if (ok && ((reportsPort == 0) || ((reportsPort > 1023) && (reportsPort < 65536)))) {
+        m_reportsPort = reportsPort;
+    } else {
+        qWarning() << "MainParser::parse: reports port invalid. Defaulting to " << m_reportsPort;
+    }
+
     // MIMO - from version
 
     QStringList versionParts = app.applicationVersion().split(".");
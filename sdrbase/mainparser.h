@@ -36,17 +36,29 @@ public:
     uint16_t getServerPort() const { return m_serverPort; }
     bool getMIMOSupport() const { return m_mimoSupport; }
     const QString& getFFTWFWisdomFileName() const { return m_fftwfWindowFileName; }
+    int getDispatchThreads() const { return m_dispatchThreads; }
+    int getPolyphaseLog2Subbands() const { return m_polyphaseLog2Subbands; }
+    bool getSkipDeviceProbe() const { return m_skipDeviceProbe; }
+    uint16_t getReportsPort() const { return m_reportsPort; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
     QString  m_fftwfWindowFileName;
     bool m_mimoSupport; //!< obtained from major version
+    int m_dispatchThreads;
+    int m_polyphaseLog2Subbands;
+    bool m_skipDeviceProbe;
+    uint16_t m_reportsPort; //!< 0 if the reports WebSocket server is not started
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
     QCommandLineOption m_fftwfWisdomOption;
+    QCommandLineOption m_dispatchThreadsOption;
+    QCommandLineOption m_polyphaseSubbandsOption;
+    QCommandLineOption m_skipDeviceProbeOption;
+    QCommandLineOption m_reportsPortOption;
 };
 
 
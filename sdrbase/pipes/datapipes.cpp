@@ -20,7 +20,8 @@
 #include "datapipesgcworker.h"
 #include "datapipes.h"
 
-DataPipes::DataPipes()
+DataPipes::DataPipes() :
+	m_registrations(&DataPipes::createDataFifo)
 {
 	m_gcWorker = new DataPipesGCWorker();
 	m_gcWorker->setC2FRegistrations(
@@ -56,6 +57,13 @@ QList<DataFifo*>* DataPipes::getFifos(const ChannelAPI *source, const QString& t
 	return m_registrations.getElements(source, type);
 }
 
+DataFifo *DataPipes::createDataFifo()
+{
+	DataFifo *dataFifo = new DataFifo();
+	dataFifo->setMode(DataFifo::ModeSPSC); // one channel sink writes and one feature worker reads each pipe
+	return dataFifo;
+}
+
 void DataPipes::startGC()
 {
 	qDebug("DataPipes::startGC");
@@ -54,6 +54,7 @@ private:
 
 	void startGC(); //!< Start garbage collector
 	void stopGC();  //!< Stop garbage collector
+	static DataFifo *createDataFifo();
 };
 
 #endif // SDRBASE_PIPES_DATAPIPES_H_
@@ -29,7 +29,10 @@ template<typename Producer, typename Consumer, typename Element>
 class ElementPipesRegistrations
 {
 public:
-    ElementPipesRegistrations() :
+    typedef Element *(*ElementFactory)();
+
+    ElementPipesRegistrations(ElementFactory elementFactory = &ElementPipesRegistrations::createElement) :
+        m_elementFactory(elementFactory),
         m_typeCount(0),
         m_mutex(QMutex::Recursive)
     {}
@@ -74,7 +77,7 @@ public:
         }
         else
         {
-            element = new Element();
+            element = m_elementFactory();
             m_elements[regKey].append(element);
             m_consumers[regKey].append(consumer);
         }
@@ -129,11 +132,14 @@ public:
 
 
 private:
+    ElementFactory m_elementFactory;
     QHash<QString, int> m_typeIds;
     int m_typeCount;
     QMap<ElementPipesCommon::RegistrationKey<Producer>, QList<Element*>> m_elements;
     QMap<ElementPipesCommon::RegistrationKey<Producer>, QList<Consumer*>> m_consumers;
     QMutex m_mutex;
+
+    static Element *createElement() { return new Element(); }
 };
 
 #endif // SDRBASE_PIPES_ELEMNTPIPESREGISTRATION_H_
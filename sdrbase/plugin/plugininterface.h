@@ -202,6 +202,10 @@ public:
         (void) originDevices;
     }
 
+    virtual bool canRestoreEnumeration() const { //!< False if opening a device depends on state built by enumOriginDevices
+        return true;
+    }
+
     virtual SamplingDevice::SamplingDeviceType getSamplingDeviceType() const {
         return SamplingDevice::SamplingDeviceType::PhysicalDevice;
     }
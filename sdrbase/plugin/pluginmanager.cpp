@@ -17,6 +17,10 @@
 
 #include <QCoreApplication>
 #include <QPluginLoader>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
+#include <QVector>
 #include <QDebug>
 
 #include <cstdio>
@@ -49,7 +53,8 @@ const QString PluginManager::m_testMIMODeviceTypeID = "sdrangel.samplemimo.testm
 
 PluginManager::PluginManager(QObject* parent) :
 	QObject(parent),
-    m_pluginAPI(this)
+    m_pluginAPI(this),
+    m_skipDeviceProbe(false)
 {
 }
 
@@ -96,7 +101,11 @@ void PluginManager::loadPluginsPart(const QString& pluginsSubDir)
         }
 
         found = true;
+        QElapsedTimer timer;
+        timer.start();
         loadPluginsDir(d);
+        qInfo("PluginManager::loadPluginsPart: %d plugins loaded from %s in %lld ms",
+            m_plugins.size(), qPrintable(dir), timer.elapsed());
         break;
     }
 
@@ -109,6 +118,8 @@ void PluginManager::loadPluginsPart(const QString& pluginsSubDir)
 
 void PluginManager::loadPluginsFinal()
 {
+    QElapsedTimer timer;
+    timer.start();
     std::sort(m_plugins.begin(), m_plugins.end());
 
     for (Plugins::const_iterator it = m_plugins.begin(); it != m_plugins.end(); ++it)
@@ -116,9 +127,19 @@ void PluginManager::loadPluginsFinal()
         it->pluginInterface->initPlugin(&m_pluginAPI);
     }
 
+    qInfo("PluginManager::loadPluginsFinal: plugins initialized in %lld ms", timer.restart());
+
+    if (m_skipDeviceProbe && DeviceEnumerator::instance()->restoreEnumeration(this))
+    {
+        qInfo("PluginManager::loadPluginsFinal: devices restored from saved enumeration in %lld ms", timer.elapsed());
+        return;
+    }
+
     DeviceEnumerator::instance()->enumerateRxDevices(this);
     DeviceEnumerator::instance()->enumerateTxDevices(this);
     DeviceEnumerator::instance()->enumerateMIMODevices(this);
+    DeviceEnumerator::instance()->saveEnumeration();
+    qInfo("PluginManager::loadPluginsFinal: devices enumerated in %lld ms", timer.elapsed());
 }
 
 void PluginManager::loadPluginsNonDiscoverable(const DeviceUserArgs& deviceUserArgs)
@@ -207,37 +228,60 @@ void PluginManager::registerFeature(const QString& featureIdURI, const QString&
 void PluginManager::loadPluginsDir(const QDir& dir)
 {
     QDir pluginsDir(dir);
+    QList<QString> fileNames;
+    QList<QPluginLoader*> pluginLoaders;
 
     foreach (QString fileName, pluginsDir.entryList(QDir::Files))
     {
         if (QLibrary::isLibrary(fileName))
         {
             qDebug("PluginManager::loadPluginsDir: fileName: %s", qPrintable(fileName));
+            fileNames.append(fileName);
+            pluginLoaders.append(new QPluginLoader(pluginsDir.absoluteFilePath(fileName)));
+        }
+    }
+
+    // Libraries are loaded in parallel. The plugin objects are created below in this thread.
+    QVector<bool> loaded(pluginLoaders.size());
+    QThreadPool threadPool;
+
+    for (int i = 0; i < pluginLoaders.size(); i++) {
+        threadPool.start(new LoadTask(pluginLoaders[i], &loaded[i]));
+    }
+
+    threadPool.waitForDone();
+
+    for (int i = 0; i < pluginLoaders.size(); i++)
+    {
+        QPluginLoader* pluginLoader = pluginLoaders[i];
 
-            QPluginLoader* pluginLoader = new QPluginLoader(pluginsDir.absoluteFilePath(fileName));
-            if (!pluginLoader->load())
-            {
-                qWarning("PluginManager::loadPluginsDir: %s", qPrintable(pluginLoader->errorString()));
-                delete pluginLoader;
-                continue;
-            }
-
-            PluginInterface* instance = qobject_cast<PluginInterface*>(pluginLoader->instance());
-            if (instance == nullptr)
-            {
-                qWarning("PluginManager::loadPluginsDir: Unable to get main instance of plugin: %s", qPrintable(fileName) );
-                delete pluginLoader;
-                continue;
-            }
-
-            delete(pluginLoader);
-
-            qInfo("PluginManager::loadPluginsDir: loaded plugin %s", qPrintable(fileName));
-            m_plugins.append(Plugin(fileName, instance));
-       }
+        if (!loaded[i])
+        {
+            qWarning("PluginManager::loadPluginsDir: %s", qPrintable(pluginLoader->errorString()));
+            delete pluginLoader;
+            continue;
+        }
+
+        PluginInterface* instance = qobject_cast<PluginInterface*>(pluginLoader->instance());
+        if (instance == nullptr)
+        {
+            qWarning("PluginManager::loadPluginsDir: Unable to get main instance of plugin: %s", qPrintable(fileNames[i]) );
+            delete pluginLoader;
+            continue;
+        }
+
+        delete(pluginLoader);
+
+        qInfo("PluginManager::loadPluginsDir: loaded plugin %s", qPrintable(fileNames[i]));
+        m_plugins.append(Plugin(fileNames[i], instance));
     }
 }
 
+void PluginManager::LoadTask::run()
+{
+    *m_loaded = m_pluginLoader->load();
+}
+
 void PluginManager::listTxChannels(QList<QString>& list)
 {
     list.clear();
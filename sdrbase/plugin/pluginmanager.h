@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include <QObject>
 #include <QDir>
+#include <QRunnable>
 #include <QList>
 #include <QString>
 
@@ -61,6 +62,7 @@ public:
 	void loadPluginsPart(const QString& pluginsSubDir);
 	void loadPluginsFinal();
     void loadPluginsNonDiscoverable(const DeviceUserArgs& deviceUserArgs);
+    void setSkipDeviceProbe(bool skipDeviceProbe) { m_skipDeviceProbe = skipDeviceProbe; }
 	const Plugins& getPlugins() const { return m_plugins; }
 
 	// Callbacks from the plugins
@@ -122,8 +124,23 @@ private:
 
 	typedef QList<SamplingDevice> SamplingDevices;
 
+	class LoadTask : public QRunnable //!< Loads a plugin library in the loading thread pool
+	{
+	public:
+		LoadTask(QPluginLoader *pluginLoader, bool *loaded) :
+			m_pluginLoader(pluginLoader),
+			m_loaded(loaded)
+		{ }
+		virtual void run();
+
+	private:
+		QPluginLoader *m_pluginLoader;
+		bool *m_loaded;
+	};
+
 	PluginAPI m_pluginAPI;
 	Plugins m_plugins;
+	bool m_skipDeviceProbe; //!< Restore the saved device enumeration instead of probing the hardware
 
 	PluginAPI::ChannelRegistrations m_rxChannelRegistrations;           //!< Channel plugins register here
 	PluginAPI::ChannelRegistrations m_txChannelRegistrations;           //!< Channel plugins register here
@@ -113,6 +113,11 @@ public:
         }
     }
 
+    // Direct access for vectorised processing of a whole row
+    T *getSums() { return m_sum; }
+    unsigned int getSize() const { return m_size; }
+    bool isLastFrame() const { return m_maxIndex == m_size - 1; } //!< Values of this frame complete the average
+
 private:
     T *m_sum;
     unsigned int m_maxSize;
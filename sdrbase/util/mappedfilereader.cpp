@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QtGlobal>
+#include <QDebug>
+
+#ifndef Q_OS_WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
+#include "mappedfilereader.h"
+
+const quint64 MappedFileReader::m_windowSize = 64<<20;
+const quint64 MappedFileReader::m_granularity = 64<<10;
+const quint64 MappedFileReader::m_readahead = 32<<20;
+
+MappedFileReader::MappedFileReader() :
+    m_size(0),
+    m_pos(0),
+    m_window(nullptr),
+    m_windowOffset(0),
+    m_windowLength(0),
+    m_readEnd(0),
+    m_advisedEnd(0)
+{
+}
+
+MappedFileReader::~MappedFileReader()
+{
+    close();
+}
+
+bool MappedFileReader::open(const QString& fileName)
+{
+    close();
+    m_file.setFileName(fileName);
+
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        qWarning("MappedFileReader::open: cannot open %s: %s", qPrintable(fileName), qPrintable(m_file.errorString()));
+        return false;
+    }
+
+    m_size = m_file.size();
+    m_pos = 0;
+    m_readEnd = 0;
+    m_advisedEnd = 0;
+    qDebug("MappedFileReader::open: %s size: %llu", qPrintable(fileName), m_size);
+    return true;
+}
+
+void MappedFileReader::close()
+{
+    unmapWindow();
+
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+
+    m_size = 0;
+    m_pos = 0;
+}
+
+const quint8 *MappedFileReader::read(quint64 maxSize, quint64& nbBytes)
+{
+    quint64 position = m_pos.load();
+
+    if (!m_file.isOpen() || (position >= m_size))
+    {
+        nbBytes = 0;
+        return nullptr;
+    }
+
+    nbBytes = std::min(maxSize, m_size - position);
+
+    if (!m_window || (position < m_windowOffset) || (position + nbBytes > m_windowOffset + m_windowLength))
+    {
+        if (!mapWindow(position, nbBytes))
+        {
+            nbBytes = 0;
+            return nullptr;
+        }
+    }
+
+    adviseReadahead(position, nbBytes);
+    m_pos.compare_exchange_strong(position, position + nbBytes); // a seek done meanwhile takes precedence
+    m_readEnd = position + nbBytes;
+
+    return m_window + (position - m_windowOffset);
+}
+
+bool MappedFileReader::mapWindow(quint64 position, quint64 length)
+{
+    unmapWindow();
+    quint64 offset = position - (position % m_granularity);
+    quint64 windowLength = std::max(m_windowSize, 2*(position + length - offset));
+    windowLength = std::min(windowLength, m_size - offset);
+    m_window = m_file.map(offset, windowLength);
+
+    if (!m_window)
+    {
+        qWarning("MappedFileReader::mapWindow: cannot map %llu bytes at %llu: %s",
+            windowLength, offset, qPrintable(m_file.errorString()));
+        return false;
+    }
+
+    m_windowOffset = offset;
+    m_windowLength = windowLength;
+#ifndef Q_OS_WIN
+    posix_madvise(m_window, m_windowLength, POSIX_MADV_SEQUENTIAL);
+#endif
+    return true;
+}
+
+void MappedFileReader::unmapWindow()
+{
+    if (m_window)
+    {
+        m_file.unmap(m_window);
+        m_window = nullptr;
+        m_windowOffset = 0;
+        m_windowLength = 0;
+    }
+}
+
+void MappedFileReader::adviseReadahead(quint64 position, quint64 length)
+{
+    if (position != m_readEnd) { // seek: what was announced is no longer relevant
+        m_advisedEnd = position;
+    }
+
+    quint64 readahead = std::max(m_readahead, 4*length);
+
+    if (position + length + readahead/2 <= m_advisedEnd) { // enough is on its way
+        return;
+    }
+
+    quint64 from = std::max(position, m_advisedEnd);
+    quint64 to = std::min(position + length + readahead, m_size);
+
+    if (to <= from) {
+        return;
+    }
+
+#ifdef Q_OS_LINUX
+    // works on the file so that it also covers the next window
+    posix_fadvise(m_file.handle(), from, to - from, POSIX_FADV_WILLNEED);
+#endif
+    m_advisedEnd = to;
+}
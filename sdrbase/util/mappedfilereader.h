@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MAPPEDFILEREADER_H
+#define INCLUDE_MAPPEDFILEREADER_H
+
+#include <atomic>
+
+#include <QFile>
+#include <QString>
+
+#include "export.h"
+
+/**
+ * Sequential reader of large files through a sliding memory mapped window. Reads return
+ * a pointer into the mapping so that the data can be converted straight to its destination
+ * without an intermediate copy. The region ahead of the read position is announced to the
+ * kernel so that replay does not stall on disk reads. Seeking only moves the read position
+ * and may be done from another thread than the one reading.
+ */
+class SDRBASE_API MappedFileReader
+{
+public:
+    MappedFileReader();
+    ~MappedFileReader();
+
+    bool open(const QString& fileName);
+    void close();
+    bool isOpen() const { return m_file.isOpen(); }
+    quint64 size() const { return m_size; }
+    quint64 pos() const { return m_pos.load(); }
+    void seek(quint64 position) { m_pos = position < m_size ? position : m_size; }
+    /** Pointer to the next maxSize bytes (less at end of file) valid until the next read */
+    const quint8 *read(quint64 maxSize, quint64& nbBytes);
+
+    static const quint64 m_windowSize;  //!< default size of the mapped window
+    static const quint64 m_granularity; //!< window offset alignment (Windows allocation granularity)
+    static const quint64 m_readahead;   //!< minimum data announced ahead of the read position
+
+private:
+    QFile m_file;
+    quint64 m_size;
+    std::atomic<quint64> m_pos;
+    uchar *m_window;
+    quint64 m_windowOffset;
+    quint64 m_windowLength;
+    quint64 m_readEnd;    //!< end of the last read to detect seeks
+    quint64 m_advisedEnd; //!< end of the region announced to the kernel
+
+    bool mapWindow(quint64 position, quint64 length);
+    void unmapWindow();
+    void adviseReadahead(quint64 position, quint64 length);
+};
+
+#endif // INCLUDE_MAPPEDFILEREADER_H
@@ -97,6 +97,11 @@ public:
         }
     }
 
+    // Direct access for vectorised processing of a whole row
+    T *getMax() { return m_max; }
+    unsigned int getSize() const { return m_size; }
+    unsigned int getIndex() const { return m_maxIndex; } //!< Index of the frame in the current period
+
 private:
     T *m_max;
     unsigned int m_maxSize;
@@ -24,7 +24,16 @@
 const char* Message::m_identifier = 0;
 
 Message::Message() :
-	m_destination(0)
+	m_destination(0),
+	m_queueNext(nullptr),
+	m_queued(false)
+{
+}
+
+Message::Message(const Message& other) :
+	m_destination(other.m_destination),
+	m_queueNext(nullptr),
+	m_queued(false)
 {
 }
 
@@ -32,6 +41,12 @@ Message::~Message()
 {
 }
 
+Message& Message::operator=(const Message& other)
+{
+	m_destination = other.m_destination; // queue link is not copied
+	return *this;
+}
+
 const char* Message::getIdentifier() const
 {
 	return m_identifier;
@@ -20,12 +20,16 @@
 #define INCLUDE_MESSAGE_H
 
 #include <stdlib.h>
+#include <atomic>
 #include "export.h"
+#include "util/messagepool.h"
 
 class SDRBASE_API Message {
 public:
 	Message();
+	Message(const Message& other);
 	virtual ~Message();
+	Message& operator=(const Message& other);
 
 	virtual const char* getIdentifier() const;
 	virtual bool matchIdentifier(const char* identifier) const;
@@ -34,10 +38,19 @@ public:
 	void* getDestination() const { return m_destination; }
 	void setDestination(void *destination) { m_destination = destination; }
 
+	// all messages are allocated from the message pool
+	static void* operator new(std::size_t size) { return MessagePool::allocate(size); }
+	static void operator delete(void *p, std::size_t size) { MessagePool::deallocate(p, size); }
+
 protected:
 	// addressing
 	static const char* m_identifier;
 	void* m_destination;
+
+private:
+	friend class MessageQueue;
+	std::atomic<Message*> m_queueNext; //!< link in the message queue the message is in
+	std::atomic<bool> m_queued;        //!< a message can be in one queue only as it is its own link
 };
 
 #define MESSAGE_CLASS_DECLARATION \
@@ -45,6 +58,7 @@ protected:
 		const char* getIdentifier() const; \
 		bool matchIdentifier(const char* identifier) const; \
 		static bool match(const Message& message); \
+		static const char* getClassIdentifier(); \
 	protected: \
 		static const char* m_identifier; \
 	private:
@@ -55,6 +69,7 @@ protected:
 	bool Name::matchIdentifier(const char* identifier) const {\
 		return (m_identifier == identifier) ? true : BaseClass::matchIdentifier(identifier); \
 	} \
-	bool Name::match(const Message& message) { return message.matchIdentifier(m_identifier); }
+	bool Name::match(const Message& message) { return message.matchIdentifier(m_identifier); } \
+	const char* Name::getClassIdentifier() { return m_identifier; }
 
 #endif // INCLUDE_MESSAGE_H
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MESSAGEDISPATCHER_H
+#define INCLUDE_MESSAGEDISPATCHER_H
+
+#include <vector>
+#include <utility>
+
+#include <QHash>
+
+#include "util/message.h"
+
+/**
+ * Table driven dispatch of messages to member functions of a handler class in place of
+ * if/else chains of match() calls. Lookup is on the message identifier pointer. A message
+ * of a class derived from a registered class is resolved once with matchIdentifier()
+ * and then cached under its own identifier. Not thread safe: use one dispatcher per
+ * consumer thread (usually a member of the handler object).
+ */
+template<typename Handler>
+class MessageDispatcher
+{
+public:
+    typedef bool (Handler::*HandlerFunction)(const Message& message);
+
+    template<typename MessageClass>
+    void add(HandlerFunction function)
+    {
+        m_registered.push_back(std::make_pair(MessageClass::getClassIdentifier(), function));
+        m_handlers.clear(); // invalidate resolutions of derived classes
+    }
+
+    /** Returns false if there is no handler for this message or the handler returned false */
+    bool dispatch(Handler *handler, const Message& message)
+    {
+        HandlerFunction function = resolve(message);
+        return function ? (handler->*function)(message) : false;
+    }
+
+    bool hasHandler(const Message& message) { return resolve(message) != nullptr; }
+
+private:
+    std::vector<std::pair<const char*, HandlerFunction>> m_registered;
+    QHash<const char*, HandlerFunction> m_handlers; //!< resolved handlers by identifier (nullptr if none)
+
+    HandlerFunction resolve(const Message& message)
+    {
+        const char *identifier = message.getIdentifier();
+        typename QHash<const char*, HandlerFunction>::const_iterator it = m_handlers.constFind(identifier);
+
+        if (it != m_handlers.constEnd()) {
+            return it.value();
+        }
+
+        HandlerFunction function = nullptr;
+
+        for (const auto& registered : m_registered)
+        {
+            if (registered.first == identifier) // exact class takes precedence
+            {
+                function = registered.second;
+                break;
+            }
+            else if (!function && message.matchIdentifier(registered.first))
+            {
+                function = registered.second;
+            }
+        }
+
+        m_handlers.insert(identifier, function);
+        return function;
+    }
+};
+
+#endif // INCLUDE_MESSAGEDISPATCHER_H
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <new>
+
+#include "util/spinlock.h"
+#include "messagepool.h"
+
+namespace {
+
+struct FreeBlock
+{
+    FreeBlock *m_next;
+};
+
+struct SharedList
+{
+    Spinlock m_lock;
+    FreeBlock *m_head;
+    unsigned int m_count;
+};
+
+struct ThreadCache
+{
+    FreeBlock *m_heads[MessagePool::m_nbClasses];
+    unsigned int m_counts[MessagePool::m_nbClasses];
+    bool m_released; //!< thread is exiting: do not cache anymore
+};
+
+SharedList sharedLists[MessagePool::m_nbClasses]; // constant initialized: usable until the very end of the program
+thread_local ThreadCache threadCacheInstance = {};
+
+void putShared(unsigned int sizeClass, FreeBlock *block)
+{
+    SharedList& list = sharedLists[sizeClass];
+
+    {
+        SpinlockHolder holder(&list.m_lock);
+
+        if (list.m_count < MessagePool::m_sharedListSize)
+        {
+            block->m_next = list.m_head;
+            list.m_head = block;
+            list.m_count++;
+            return;
+        }
+    }
+
+    ::operator delete(block);
+}
+
+// one block and refill of the thread cache
+FreeBlock *takeShared(unsigned int sizeClass, ThreadCache& cache)
+{
+    SharedList& list = sharedLists[sizeClass];
+    SpinlockHolder holder(&list.m_lock);
+    FreeBlock *block = list.m_head;
+
+    if (!block) {
+        return nullptr;
+    }
+
+    list.m_head = block->m_next;
+    list.m_count--;
+
+    if (cache.m_released) {
+        return block;
+    }
+
+    // move up to half a cache worth of blocks to this thread
+    while (list.m_head && (cache.m_counts[sizeClass] < MessagePool::m_threadCacheSize / 2))
+    {
+        FreeBlock *cached = list.m_head;
+        list.m_head = cached->m_next;
+        list.m_count--;
+        cached->m_next = cache.m_heads[sizeClass];
+        cache.m_heads[sizeClass] = cached;
+        cache.m_counts[sizeClass]++;
+    }
+
+    return block;
+}
+
+class ThreadCacheReleaser
+{
+public:
+    ~ThreadCacheReleaser() // returns the cached blocks when the thread exits
+    {
+        for (unsigned int sizeClass = 0; sizeClass < MessagePool::m_nbClasses; sizeClass++)
+        {
+            FreeBlock *block = threadCacheInstance.m_heads[sizeClass];
+
+            while (block)
+            {
+                FreeBlock *next = block->m_next;
+                putShared(sizeClass, block);
+                block = next;
+            }
+
+            threadCacheInstance.m_heads[sizeClass] = nullptr;
+            threadCacheInstance.m_counts[sizeClass] = 0;
+        }
+
+        threadCacheInstance.m_released = true;
+    }
+};
+
+ThreadCache& threadCache()
+{
+    static thread_local ThreadCacheReleaser releaser;
+    (void) releaser;
+    return threadCacheInstance;
+}
+
+}
+
+void *MessagePool::allocate(std::size_t size)
+{
+    unsigned int sizeClass = size == 0 ? 0 : (size - 1) / m_granularity;
+
+    if (sizeClass >= m_nbClasses) {
+        return ::operator new(size);
+    }
+
+    ThreadCache& cache = threadCache();
+    FreeBlock *block = cache.m_heads[sizeClass];
+
+    if (block)
+    {
+        cache.m_heads[sizeClass] = block->m_next;
+        cache.m_counts[sizeClass]--;
+        return block;
+    }
+
+    void *p = takeShared(sizeClass, cache);
+    return p ? p : ::operator new((sizeClass + 1) * m_granularity);
+}
+
+void MessagePool::deallocate(void *p, std::size_t size)
+{
+    if (!p) {
+        return;
+    }
+
+    unsigned int sizeClass = size == 0 ? 0 : (size - 1) / m_granularity;
+
+    if (sizeClass >= m_nbClasses)
+    {
+        ::operator delete(p);
+        return;
+    }
+
+    ThreadCache& cache = threadCache();
+    FreeBlock *block = static_cast<FreeBlock*>(p);
+
+    if (!cache.m_released && (cache.m_counts[sizeClass] < m_threadCacheSize))
+    {
+        block->m_next = cache.m_heads[sizeClass];
+        cache.m_heads[sizeClass] = block;
+        cache.m_counts[sizeClass]++;
+        return;
+    }
+
+    putShared(sizeClass, block);
+}
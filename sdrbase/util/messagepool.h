@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MESSAGEPOOL_H
+#define INCLUDE_MESSAGEPOOL_H
+
+#include <cstddef>
+
+#include "export.h"
+
+/**
+ * Memory pool backing the allocation of all Message objects (see Message::operator new).
+ * Blocks are sorted in size classes of 64 bytes up to 1 kB. Larger objects go to the
+ * global allocator. Each thread keeps a small cache of free blocks per class so that
+ * most allocations take no lock. Messages are usually created in one thread and deleted
+ * in another: blocks freed beyond the cache capacity go to a shared list per class from
+ * which the allocating thread refills.
+ */
+class SDRBASE_API MessagePool
+{
+public:
+    static void *allocate(std::size_t size);
+    static void deallocate(void *p, std::size_t size);
+
+    static const std::size_t m_granularity = 64;
+    static const unsigned int m_nbClasses = 16;
+    static const unsigned int m_threadCacheSize = 64;  //!< blocks per class kept by a thread
+    static const unsigned int m_sharedListSize = 1024; //!< blocks per class kept in the shared list
+};
+
+#endif // INCLUDE_MESSAGEPOOL_H
@@ -23,8 +23,9 @@
 
 MessageQueue::MessageQueue(QObject* parent) :
 	QObject(parent),
-	m_lock(QMutex::Recursive),
-	m_queue()
+	m_head(&m_stub),
+	m_tail(&m_stub),
+	m_size(0)
 {
 }
 
@@ -39,13 +40,28 @@ MessageQueue::~MessageQueue()
 	}
 }
 
+void MessageQueue::pushLink(Message* message)
+{
+	message->m_queueNext.store(nullptr, std::memory_order_relaxed);
+	Message* previous = m_head.exchange(message, std::memory_order_acq_rel);
+	previous->m_queueNext.store(message, std::memory_order_release); // publish
+}
+
 void MessageQueue::push(Message* message, bool emitSignal)
 {
 	if (message)
 	{
-		m_lock.lock();
-		m_queue.append(message);
-		m_lock.unlock();
+		bool queued = message->m_queued.exchange(true, std::memory_order_relaxed);
+		Q_ASSERT_X(!queued, "MessageQueue::push", "message is already in a queue");
+
+		if (queued)
+		{
+			qCritical("MessageQueue::push: %s is already in a queue: not pushed", message->getIdentifier());
+			return;
+		}
+
+		m_size.fetch_add(1, std::memory_order_relaxed);
+		pushLink(message);
 	}
 
 	if (emitSignal)
@@ -56,30 +72,51 @@ void MessageQueue::push(Message* message, bool emitSignal)
 
 Message* MessageQueue::pop()
 {
-	QMutexLocker locker(&m_lock);
+	QMutexLocker locker(&m_popLock);
+	Message* tail = m_tail;
+	Message* next = tail->m_queueNext.load(std::memory_order_acquire);
 
-	if (m_queue.isEmpty())
+	if (tail == &m_stub)
 	{
-		return 0;
+		if (!next) {
+			return 0;
+		}
+
+		m_tail = next;
+		tail = next;
+		next = next->m_queueNext.load(std::memory_order_acquire);
 	}
-	else
+
+	if (!next)
 	{
-		return m_queue.takeFirst();
+		if (tail != m_head.load(std::memory_order_acquire)) {
+			return 0; // a producer is linking a message: it will signal when done
+		}
+
+		pushLink(&m_stub); // tail is the last message: put stub behind to detach it
+		next = tail->m_queueNext.load(std::memory_order_acquire);
+
+		if (!next) {
+			return 0;
+		}
 	}
+
+	m_tail = next;
+	m_size.fetch_sub(1, std::memory_order_relaxed);
+	tail->m_queued.store(false, std::memory_order_relaxed);
+	return tail;
 }
 
 int MessageQueue::size()
 {
-	QMutexLocker locker(&m_lock);
-
-	return m_queue.size();
+	return m_size.load(std::memory_order_relaxed);
 }
 
 void MessageQueue::clear()
 {
-	QMutexLocker locker(&m_lock);
+	Message* message;
 
-    while (!m_queue.isEmpty()) {
-        delete m_queue.takeFirst();
-    }
+	while ((message = pop()) != 0) {
+		delete message;
+	}
 }
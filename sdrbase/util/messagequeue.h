@@ -19,13 +19,20 @@
 #ifndef INCLUDE_MESSAGEQUEUE_H
 #define INCLUDE_MESSAGEQUEUE_H
 
+#include <atomic>
+
 #include <QObject>
-#include <QQueue>
 #include <QMutex>
 #include "export.h"
-
-class Message;
-
+#include "util/message.h"
+
+/**
+ * Multiple producers single consumer queue of messages linked through the messages
+ * themselves (intrusive MPSC queue from D. Vyukov). Pushing never blocks. Popping is
+ * serialized by a consumer side lock that is uncontended in normal use (messages are
+ * popped by the thread owning the queue) so that occasional pops or clears from another
+ * thread remain safe.
+ */
 class SDRBASE_API MessageQueue : public QObject {
 	Q_OBJECT
 
@@ -33,7 +40,7 @@ public:
 	MessageQueue(QObject* parent = NULL);
 	~MessageQueue();
 
-	void push(Message* message, bool emitSignal = true);  //!< Push message onto queue
+	void push(Message* message, bool emitSignal = true);  //!< Push message onto queue. The message must not be in a queue already.
 	Message* pop(); //!< Pop message from queue
 
 	int size(); //!< Returns queue size
@@ -43,8 +50,13 @@ signals:
 	void messageEnqueued();
 
 private:
-	QMutex m_lock;
-	QQueue<Message*> m_queue;
+	std::atomic<Message*> m_head; //!< last pushed message
+	Message* m_tail;              //!< next message to pop (consumer side)
+	Message m_stub;               //!< keeps the list non empty
+	std::atomic<int> m_size;
+	QMutex m_popLock;
+
+	void pushLink(Message* message);
 };
 
 #endif // INCLUDE_MESSAGEQUEUE_H
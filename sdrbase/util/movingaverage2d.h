@@ -109,6 +109,11 @@ public:
         m_avgIndex = m_avgIndex == m_depth-1 ? 0 : m_avgIndex+1;
     }
 
+    // Direct access for vectorised processing of a whole row
+    T *getCurrentData() { return m_data + m_avgIndex*m_width; } //!< Oldest row replaced by the next values
+    T *getSums() { return m_sum; }
+    unsigned int getDepth() const { return m_depth; }
+
 private:
     T *m_data;
     T *m_sum;
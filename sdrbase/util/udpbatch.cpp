@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QUdpSocket>
+#include <QHostAddress>
+
+#ifdef Q_OS_LINUX
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#endif
+
+#include "udpbatch.h"
+
+#ifdef Q_OS_LINUX
+namespace {
+
+union SocketAddress
+{
+    sockaddr m_address;
+    sockaddr_in m_address4;
+    sockaddr_in6 m_address6;
+};
+
+// Destination address in the family of the socket (IPv4 mapped for dual stack sockets)
+bool makeSocketAddress(int fd, const QHostAddress& address, quint16 port, SocketAddress& socketAddress, socklen_t& length)
+{
+    SocketAddress local;
+    socklen_t localLength = sizeof(local);
+
+    if (getsockname(fd, &local.m_address, &localLength) < 0) {
+        return false;
+    }
+
+    std::memset(&socketAddress, 0, sizeof(socketAddress));
+    bool isIPv4;
+    quint32 address4 = address.toIPv4Address(&isIPv4);
+
+    if (local.m_address.sa_family == AF_INET)
+    {
+        if (!isIPv4) {
+            return false;
+        }
+
+        socketAddress.m_address4.sin_family = AF_INET;
+        socketAddress.m_address4.sin_port = htons(port);
+        socketAddress.m_address4.sin_addr.s_addr = htonl(address4);
+        length = sizeof(sockaddr_in);
+    }
+    else if (local.m_address.sa_family == AF_INET6)
+    {
+        socketAddress.m_address6.sin6_family = AF_INET6;
+        socketAddress.m_address6.sin6_port = htons(port);
+
+        if (isIPv4) // ::ffff:a.b.c.d
+        {
+            quint32 address4be = htonl(address4);
+            socketAddress.m_address6.sin6_addr.s6_addr[10] = 0xff;
+            socketAddress.m_address6.sin6_addr.s6_addr[11] = 0xff;
+            std::memcpy(&socketAddress.m_address6.sin6_addr.s6_addr[12], &address4be, 4);
+        }
+        else
+        {
+            Q_IPV6ADDR address6 = address.toIPv6Address();
+            std::memcpy(&socketAddress.m_address6.sin6_addr, &address6, sizeof(address6));
+        }
+        length = sizeof(sockaddr_in6);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+#endif
+
+int UDPBatch::send(QUdpSocket& socket, const Datagram *datagrams, int count, const QHostAddress& address, quint16 port)
+{
+    int sent = 0;
+
+#ifdef Q_OS_LINUX
+    int fd = (int) socket.socketDescriptor(); // the socket is only created by the first write of an unbound QUdpSocket
+    SocketAddress socketAddress;
+    socklen_t socketAddressLength;
+
+    if ((fd >= 0) && makeSocketAddress(fd, address, port, socketAddress, socketAddressLength))
+    {
+        mmsghdr messages[m_maxBatchSize];
+        iovec iovecs[m_maxBatchSize];
+
+        while (sent < count)
+        {
+            int batchSize = std::min(count - sent, m_maxBatchSize);
+
+            for (int i = 0; i < batchSize; i++)
+            {
+                iovecs[i].iov_base = (void *) datagrams[sent + i].m_data;
+                iovecs[i].iov_len = datagrams[sent + i].m_size;
+                std::memset(&messages[i], 0, sizeof(mmsghdr));
+                messages[i].msg_hdr.msg_name = &socketAddress;
+                messages[i].msg_hdr.msg_namelen = socketAddressLength;
+                messages[i].msg_hdr.msg_iov = &iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            int nbSent = sendmmsg(fd, messages, batchSize, 0);
+
+            if (nbSent > 0)
+            {
+                sent += nbSent;
+            }
+            else if ((nbSent < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == ENOBUFS)))
+            {
+                // the socket is non blocking: give the send buffer a chance to drain
+                pollfd pfd = {fd, POLLOUT, 0};
+
+                if (poll(&pfd, 1, 10) <= 0) {
+                    break;
+                }
+            }
+            else
+            {
+                qWarning("UDPBatch::send: sendmmsg failed: %s", strerror(errno));
+                break;
+            }
+        }
+
+        return sent;
+    }
+#endif
+
+    for (; sent < count; sent++)
+    {
+        if (socket.writeDatagram(datagrams[sent].m_data, datagrams[sent].m_size, address, port) < 0) {
+            break;
+        }
+    }
+
+    return sent;
+}
+
+int UDPBatch::receive(QUdpSocket& socket, char *buffer, qint64 slotSize, int count, qint64 *sizes, QHostAddress *sender)
+{
+#ifdef Q_OS_LINUX
+    int fd = (int) socket.socketDescriptor();
+
+    if (fd < 0) {
+        return 0;
+    }
+
+    count = std::min(count, m_maxBatchSize);
+    mmsghdr messages[m_maxBatchSize];
+    iovec iovecs[m_maxBatchSize];
+    SocketAddress senders[m_maxBatchSize];
+
+    for (int i = 0; i < count; i++)
+    {
+        iovecs[i].iov_base = &buffer[i*slotSize];
+        iovecs[i].iov_len = slotSize;
+        std::memset(&messages[i], 0, sizeof(mmsghdr));
+        messages[i].msg_hdr.msg_name = &senders[i];
+        messages[i].msg_hdr.msg_namelen = sizeof(SocketAddress);
+        messages[i].msg_hdr.msg_iov = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int nbReceived = recvmmsg(fd, messages, count, MSG_DONTWAIT, nullptr);
+
+    if (nbReceived <= 0) {
+        return 0;
+    }
+
+    for (int i = 0; i < nbReceived; i++) {
+        sizes[i] = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) ? -1 : (qint64) messages[i].msg_len;
+    }
+
+    if (sender) {
+        sender->setAddress(&senders[nbReceived-1].m_address);
+    }
+
+    return nbReceived;
+#else
+    (void) socket;
+    (void) buffer;
+    (void) slotSize;
+    (void) count;
+    (void) sizes;
+    (void) sender;
+    return 0;
+#endif
+}
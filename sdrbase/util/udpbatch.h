@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_UDPBATCH_H
+#define INCLUDE_UDPBATCH_H
+
+#include <QtGlobal>
+
+#include "export.h"
+
+class QUdpSocket;
+class QHostAddress;
+
+/**
+ * Sends or receives several UDP datagrams with a single system call (sendmmsg / recvmmsg)
+ * on a bound or already used QUdpSocket. Where these calls are not available sending falls
+ * back to one writeDatagram per datagram and receiving returns nothing so that the caller
+ * reads through the socket as usual.
+ *
+ * Receiving directly from the socket descriptor bypasses QUdpSocket that keeps its read
+ * notification disabled until readDatagram is called. Callers must therefore finish with
+ * a readDatagram that returns no data before going back to the event loop.
+ */
+class SDRBASE_API UDPBatch
+{
+public:
+    struct Datagram
+    {
+        const char *m_data;
+        qint64 m_size;
+    };
+
+    /** Returns the number of datagrams sent */
+    static int send(QUdpSocket& socket, const Datagram *datagrams, int count, const QHostAddress& address, quint16 port);
+    /**
+     * Reads at most count pending datagrams without waiting into consecutive slots of slotSize bytes.
+     * Sizes of the datagrams are returned in sizes (-1 for truncated datagrams). Returns the number
+     * of datagrams read.
+     */
+    static int receive(QUdpSocket& socket, char *buffer, qint64 slotSize, int count, qint64 *sizes, QHostAddress *sender);
+
+    static const int m_maxBatchSize = 64; //!< datagrams per system call
+};
+
+#endif // INCLUDE_UDPBATCH_H
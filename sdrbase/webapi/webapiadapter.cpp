@@ -62,6 +62,7 @@
 #include "SWGDeviceReport.h"
 #include "SWGDeviceActions.h"
 #include "SWGChannelsDetail.h"
+#include "SWGChannel.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelActions.h"
@@ -1489,6 +1490,141 @@ int WebAPIAdapter::instanceDeviceSetsGet(
     return 200;
 }
 
+int WebAPIAdapter::instanceDeviceSetsChannelsReportGet(
+        const QList<int>& deviceSetIndexes,
+        SWGSDRangel::SWGChannelsDetail& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    return getDeviceSetsChannels(deviceSetIndexes, true, response, error);
+}
+
+int WebAPIAdapter::instanceDeviceSetsChannelsSettingsGet(
+        const QList<int>& deviceSetIndexes,
+        SWGSDRangel::SWGChannelsDetail& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    return getDeviceSetsChannels(deviceSetIndexes, false, response, error);
+}
+
+int WebAPIAdapter::instanceDeviceSetsChannelsSettingsPatch(
+        const QList<QStringList>& channelSettingsKeys,
+        SWGSDRangel::SWGChannelsDetail& query,
+        SWGSDRangel::SWGChannelsDetail& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    QList<SWGSDRangel::SWGChannel*> *queryChannels = query.getChannels();
+    int nbQueryChannels = queryChannels ? queryChannels->size() : 0;
+    std::vector<ChannelAPI*> channelAPIs(nbQueryChannels);
+    int direction;
+
+    // check everything first so that settings are applied to all channels or none
+    for (int i = 0; i < nbQueryChannels; i++)
+    {
+        SWGSDRangel::SWGChannel *queryChannel = queryChannels->at(i);
+        int deviceSetIndex = queryChannel->getDeviceSetIndex();
+
+        if ((deviceSetIndex < 0) || (deviceSetIndex >= (int) m_mainCore->m_deviceSets.size()))
+        {
+            *error.getMessage() = QString("channels[%1]: There is no device set with index %2").arg(i).arg(deviceSetIndex);
+            return 404;
+        }
+
+        channelAPIs[i] = getChannelAPI(m_mainCore->m_deviceSets[deviceSetIndex], queryChannel->getIndex(), direction);
+
+        if (!channelAPIs[i])
+        {
+            *error.getMessage() = QString("channels[%1]: There is no channel with index %2 in device set %3")
+                .arg(i).arg(queryChannel->getIndex()).arg(deviceSetIndex);
+            return 404;
+        }
+
+        QString channelType;
+        channelAPIs[i]->getIdentifier(channelType);
+
+        if (!queryChannel->getSettings() || !queryChannel->getSettings()->getChannelType()
+         || (channelType != *queryChannel->getSettings()->getChannelType()))
+        {
+            *error.getMessage() = QString("channels[%1]: There is no channel type %2 at index %3 in device set %4. Found %5.")
+                .arg(i)
+                .arg(queryChannel->getSettings() && queryChannel->getSettings()->getChannelType() ? *queryChannel->getSettings()->getChannelType() : QString(""))
+                .arg(queryChannel->getIndex())
+                .arg(deviceSetIndex)
+                .arg(channelType);
+            return 404;
+        }
+    }
+
+    // snapshot the current settings so that the channels already changed can be restored if a later one fails
+    std::vector<SWGSDRangel::SWGChannelSettings*> snapshots(nbQueryChannels);
+
+    for (int i = 0; i < nbQueryChannels; i++)
+    {
+        SWGSDRangel::SWGChannelSettings *querySettings = queryChannels->at(i)->getSettings();
+        snapshots[i] = new SWGSDRangel::SWGChannelSettings();
+        snapshots[i]->setChannelType(new QString(*querySettings->getChannelType()));
+        snapshots[i]->setDirection(querySettings->getDirection());
+        QString errorMessage;
+
+        if (channelAPIs[i]->webapiSettingsGet(*snapshots[i], errorMessage)/100 != 2)
+        {
+            *error.getMessage() = QString("channels[%1]: cannot read the current settings: %2").arg(i).arg(errorMessage);
+
+            for (auto snapshot : snapshots) {
+                delete snapshot;
+            }
+
+            return 500;
+        }
+    }
+
+    response.init();
+    QList<SWGSDRangel::SWGChannel*> *channels = response.getChannels();
+    int status = 200;
+
+    for (int i = 0; i < nbQueryChannels; i++)
+    {
+        SWGSDRangel::SWGChannel *queryChannel = queryChannels->at(i);
+        status = channelAPIs[i]->webapiSettingsPutPatch(false, channelSettingsKeys.at(i), *queryChannel->getSettings(), *error.getMessage());
+
+        if (status/100 != 2)
+        {
+            // restore the same keys in reverse order so that a channel listed twice gets its original settings back
+            for (int j = i; j >= 0; j--)
+            {
+                QString errorMessage;
+
+                if (channelAPIs[j]->webapiSettingsPutPatch(false, channelSettingsKeys.at(j), *snapshots[j], errorMessage)/100 != 2) {
+                    qWarning("WebAPIAdapter::instanceDeviceSetsChannelsSettingsPatch: channels[%d]: cannot restore settings: %s", j, qPrintable(errorMessage));
+                }
+            }
+
+            *error.getMessage() = QString("channels[%1]: %2 (previous channels were restored)").arg(i).arg(*error.getMessage());
+            break;
+        }
+
+        channels->append(new SWGSDRangel::SWGChannel);
+        channels->back()->setDeviceSetIndex(queryChannel->getDeviceSetIndex());
+        channels->back()->setIndex(queryChannel->getIndex());
+        channels->back()->setSettings(new SWGSDRangel::SWGChannelSettings);
+        channels->back()->getSettings()->setChannelType(new QString(*queryChannel->getSettings()->getChannelType()));
+        channels->back()->getSettings()->setDirection(queryChannel->getSettings()->getDirection());
+        channelAPIs[i]->webapiSettingsGet(*channels->back()->getSettings(), *error.getMessage());
+    }
+
+    for (auto snapshot : snapshots) {
+        delete snapshot;
+    }
+
+    if (status/100 != 2) {
+        return status;
+    }
+
+    response.setChannelcount(channels->size());
+
+    return 200;
+}
+
 int WebAPIAdapter::instanceFeatureSetsGet(
         SWGSDRangel::SWGFeatureSetList& response,
         SWGSDRangel::SWGErrorResponse& error)
@@ -1725,6 +1861,176 @@ int WebAPIAdapter::devicesetSpectrumServerDelete(
     }
 }
 
+int WebAPIAdapter::devicesetSpectrumAnalyzersGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumAnalyzers& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        const DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzersGet(response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzersPost(
+        int deviceSetIndex,
+        const QStringList& spectrumSettingsKeys,
+        SWGSDRangel::SWGGLSpectrum& query,
+        SWGSDRangel::SWGSpectrumAnalyzers& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzersPost(spectrumSettingsKeys, query, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzerDelete(
+        int deviceSetIndex,
+        int analyzerIndex,
+        SWGSDRangel::SWGSuccessResponse& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzerDelete(analyzerIndex, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzerSettingsGet(
+        int deviceSetIndex,
+        int analyzerIndex,
+        SWGSDRangel::SWGGLSpectrum& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        const DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzerSettingsGet(analyzerIndex, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzerSettingsPutPatch(
+        int deviceSetIndex,
+        int analyzerIndex,
+        bool force, //!< true to force settings = put else patch
+        const QStringList& spectrumSettingsKeys,
+        SWGSDRangel::SWGGLSpectrum& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzerSettingsPutPatch(analyzerIndex, force, spectrumSettingsKeys, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzerServerGet(
+        int deviceSetIndex,
+        int analyzerIndex,
+        SWGSDRangel::SWGSpectrumServer& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        const DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzerServerGet(analyzerIndex, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzerServerPost(
+        int deviceSetIndex,
+        int analyzerIndex,
+        SWGSDRangel::SWGSuccessResponse& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzerServerPost(analyzerIndex, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumAnalyzerServerDelete(
+        int deviceSetIndex,
+        int analyzerIndex,
+        SWGSDRangel::SWGSuccessResponse& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        error.init();
+        return deviceSet->webapiSpectrumAnalyzerServerDelete(analyzerIndex, response, *error.getMessage());
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
 int WebAPIAdapter::devicesetDevicePut(
         int deviceSetIndex,
         SWGSDRangel::SWGDeviceListItem& query,
@@ -3746,6 +4052,137 @@ int WebAPIAdapter::featuresetGet(
     }
 }
 
+int WebAPIAdapter::getDeviceSetsChannels(
+        const QList<int>& deviceSetIndexes,
+        bool reportElseSettings,
+        SWGSDRangel::SWGChannelsDetail& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    QList<int> indexes = deviceSetIndexes;
+
+    if (indexes.isEmpty())
+    {
+        for (int i = 0; i < (int) m_mainCore->m_deviceSets.size(); i++) {
+            indexes.append(i);
+        }
+    }
+
+    for (int deviceSetIndex : indexes)
+    {
+        if ((deviceSetIndex < 0) || (deviceSetIndex >= (int) m_mainCore->m_deviceSets.size()))
+        {
+            *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+            return 404;
+        }
+    }
+
+    response.init();
+    QList<SWGSDRangel::SWGChannel*> *channels = response.getChannels();
+    QString errorMessage;
+
+    for (int deviceSetIndex : indexes)
+    {
+        const DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        int nbChannels = getNbChannels(deviceSet);
+
+        for (int i = 0; i < nbChannels; i++)
+        {
+            int direction;
+            ChannelAPI *channelAPI = getChannelAPI(deviceSet, i, direction);
+
+            if (!channelAPI) {
+                continue;
+            }
+
+            // only the fields needed here are allocated as there may be many channels
+            SWGSDRangel::SWGChannel *channel = new SWGSDRangel::SWGChannel;
+            channels->append(channel);
+            channel->setDeviceSetIndex(deviceSetIndex);
+            channel->setIndex(i);
+            channel->setDirection(direction);
+            channel->setUid(channelAPI->getUID());
+            channel->setDeltaFrequency(channelAPI->getCenterFrequency());
+            channel->setId(new QString);
+            channelAPI->getIdentifier(*channel->getId());
+            channel->setTitle(new QString);
+            channelAPI->getTitle(*channel->getTitle());
+
+            if (reportElseSettings)
+            {
+                channel->setReport(new SWGSDRangel::SWGChannelReport);
+                channelAPI->webapiReportGet(*channel->getReport(), errorMessage); // stays empty if not implemented
+            }
+            else
+            {
+                channel->setSettings(new SWGSDRangel::SWGChannelSettings);
+                channel->getSettings()->setChannelType(new QString(*channel->getId()));
+                channel->getSettings()->setDirection(direction);
+                channelAPI->webapiSettingsGet(*channel->getSettings(), errorMessage);
+            }
+        }
+    }
+
+    response.setChannelcount(channels->size());
+
+    return 200;
+}
+
+int WebAPIAdapter::getNbChannels(const DeviceSet *deviceSet)
+{
+    if (deviceSet->m_deviceSourceEngine) { // Single Rx
+        return deviceSet->m_deviceAPI->getNbSinkChannels();
+    } else if (deviceSet->m_deviceSinkEngine) { // Single Tx
+        return deviceSet->m_deviceAPI->getNbSourceChannels();
+    } else if (deviceSet->m_deviceMIMOEngine) { // MIMO
+        return deviceSet->m_deviceAPI->getNbSinkChannels() + deviceSet->m_deviceAPI->getNbSourceChannels() + deviceSet->m_deviceAPI->getNbMIMOChannels();
+    } else {
+        return 0;
+    }
+}
+
+ChannelAPI *WebAPIAdapter::getChannelAPI(const DeviceSet *deviceSet, int channelIndex, int& direction)
+{
+    if (channelIndex < 0) {
+        return nullptr;
+    }
+
+    if (deviceSet->m_deviceSourceEngine) // Single Rx
+    {
+        direction = 0;
+        return deviceSet->m_deviceAPI->getChanelSinkAPIAt(channelIndex);
+    }
+    else if (deviceSet->m_deviceSinkEngine) // Single Tx
+    {
+        direction = 1;
+        return deviceSet->m_deviceAPI->getChanelSourceAPIAt(channelIndex);
+    }
+    else if (deviceSet->m_deviceMIMOEngine) // MIMO
+    {
+        int nbSinkChannels = deviceSet->m_deviceAPI->getNbSinkChannels();
+        int nbSourceChannels = deviceSet->m_deviceAPI->getNbSourceChannels();
+        int nbMIMOChannels = deviceSet->m_deviceAPI->getNbMIMOChannels();
+
+        if (channelIndex < nbSinkChannels)
+        {
+            direction = 0;
+            return deviceSet->m_deviceAPI->getChanelSinkAPIAt(channelIndex);
+        }
+        else if (channelIndex < nbSinkChannels + nbSourceChannels)
+        {
+            direction = 1;
+            return deviceSet->m_deviceAPI->getChanelSourceAPIAt(channelIndex - nbSinkChannels);
+        }
+        else if (channelIndex < nbSinkChannels + nbSourceChannels + nbMIMOChannels)
+        {
+            direction = 2;
+            return deviceSet->m_deviceAPI->getMIMOChannelAPIAt(channelIndex - nbSinkChannels - nbSourceChannels);
+        }
+    }
+
+    return nullptr;
+}
+
 void WebAPIAdapter::getFeatureSetList(SWGSDRangel::SWGFeatureSetList* featureSetList)
 {
     featureSetList->init();
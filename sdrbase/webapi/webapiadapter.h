@@ -27,6 +27,7 @@
 
 class MainCore;
 class DeviceSet;
+class ChannelAPI;
 class FeatureSet;
 
 class SDRBASE_API WebAPIAdapter: public WebAPIAdapterInterface
@@ -207,6 +208,22 @@ public:
             SWGSDRangel::SWGDeviceSetList& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int instanceDeviceSetsChannelsReportGet(
+            const QList<int>& deviceSetIndexes,
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceDeviceSetsChannelsSettingsGet(
+            const QList<int>& deviceSetIndexes,
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceDeviceSetsChannelsSettingsPatch(
+            const QList<QStringList>& channelSettingsKeys,
+            SWGSDRangel::SWGChannelsDetail& query,
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int instanceFeatureSetsGet(
             SWGSDRangel::SWGFeatureSetList& response,
             SWGSDRangel::SWGErrorResponse& error);
@@ -265,6 +282,56 @@ public:
             SWGSDRangel::SWGSuccessResponse& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetSpectrumAnalyzersGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumAnalyzers& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzersPost(
+            int deviceSetIndex,
+            const QStringList& spectrumSettingsKeys,
+            SWGSDRangel::SWGGLSpectrum& query,
+            SWGSDRangel::SWGSpectrumAnalyzers& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzerDelete(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzerSettingsGet(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGGLSpectrum& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzerSettingsPutPatch(
+            int deviceSetIndex,
+            int analyzerIndex,
+            bool force, //!< true to force settings = put else patch
+            const QStringList& spectrumSettingsKeys,
+            SWGSDRangel::SWGGLSpectrum& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzerServerGet(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSpectrumServer& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzerServerPost(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumAnalyzerServerDelete(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetDevicePut(
             int deviceSetIndex,
             SWGSDRangel::SWGDeviceListItem& query,
@@ -457,6 +524,13 @@ private:
     void getDeviceSetList(SWGSDRangel::SWGDeviceSetList* deviceSetList);
     void getDeviceSet(SWGSDRangel::SWGDeviceSet *swgDeviceSet, const DeviceSet* deviceSet, int deviceSetIndex);
     void getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDetail, const DeviceSet* deviceSet);
+    int getDeviceSetsChannels(
+            const QList<int>& deviceSetIndexes,
+            bool reportElseSettings,
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error);
+    static int getNbChannels(const DeviceSet *deviceSet);
+    static ChannelAPI *getChannelAPI(const DeviceSet *deviceSet, int channelIndex, int& direction);
     void getFeatureSetList(SWGSDRangel::SWGFeatureSetList* featureSetList);
     void getFeatureSet(SWGSDRangel::SWGFeatureSet *swgFeatureSet, const FeatureSet* featureSet, int featureSetIndex);
     static QtMsgType getMsgTypeFromString(const QString& msgTypeString);
@@ -43,35 +43,41 @@ QString WebAPIAdapterInterface::instancePresetFileURL = "/sdrangel/preset/file";
 QString WebAPIAdapterInterface::instanceFeaturePresetsURL = "/sdrangel/featurepresets";
 QString WebAPIAdapterInterface::instanceFeaturePresetURL = "/sdrangel/featurepreset";
 QString WebAPIAdapterInterface::instanceDeviceSetsURL = "/sdrangel/devicesets";
+QString WebAPIAdapterInterface::instanceDeviceSetsChannelsReportURL = "/sdrangel/devicesets/channels/report";
+QString WebAPIAdapterInterface::instanceDeviceSetsChannelsSettingsURL = "/sdrangel/devicesets/channels/settings";
 QString WebAPIAdapterInterface::instanceDeviceSetURL = "/sdrangel/deviceset";
 QString WebAPIAdapterInterface::instanceFeatureSetsURL = "/sdrangel/featuresets";
 QString WebAPIAdapterInterface::instanceFeatureSetURL = "/sdrangel/featureset";
 
-std::regex WebAPIAdapterInterface::devicesetURLRe("^/sdrangel/deviceset/([0-9]{1,2})$");
-std::regex WebAPIAdapterInterface::devicesetFocusURLRe("^/sdrangel/deviceset/([0-9]{1,2})/focus$");
-std::regex WebAPIAdapterInterface::devicesetSpectrumSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/spectrum/settings$");
-std::regex WebAPIAdapterInterface::devicesetSpectrumServerURLRe("^/sdrangel/deviceset/([0-9]{1,2})/spectrum/server$");
-std::regex WebAPIAdapterInterface::devicesetDeviceURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device$");
-std::regex WebAPIAdapterInterface::devicesetDeviceSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings$");
-std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/run$");
-std::regex WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/subdevice/([0-9]{1,2})/run$");
-std::regex WebAPIAdapterInterface::devicesetDeviceReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/report$");
-std::regex WebAPIAdapterInterface::devicesetDeviceActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/actions$");
-std::regex WebAPIAdapterInterface::devicesetChannelsReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channels/report$");
-std::regex WebAPIAdapterInterface::devicesetChannelURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel$");
-std::regex WebAPIAdapterInterface::devicesetChannelIndexURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})$");
-std::regex WebAPIAdapterInterface::devicesetChannelSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings$");
-std::regex WebAPIAdapterInterface::devicesetChannelReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/report");
-std::regex WebAPIAdapterInterface::devicesetChannelActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/actions");
+QString WebAPIAdapterInterface::devicesetURL = "/sdrangel/deviceset/{deviceSetIndex}";
+QString WebAPIAdapterInterface::devicesetFocusURL = "/sdrangel/deviceset/{deviceSetIndex}/focus";
+QString WebAPIAdapterInterface::devicesetSpectrumSettingsURL = "/sdrangel/deviceset/{deviceSetIndex}/spectrum/settings";
+QString WebAPIAdapterInterface::devicesetSpectrumServerURL = "/sdrangel/deviceset/{deviceSetIndex}/spectrum/server";
+QString WebAPIAdapterInterface::devicesetSpectrumAnalyzersURL = "/sdrangel/deviceset/{deviceSetIndex}/spectrum/analyzers";
+QString WebAPIAdapterInterface::devicesetSpectrumAnalyzerURL = "/sdrangel/deviceset/{deviceSetIndex}/spectrum/analyzers/{analyzerIndex}";
+QString WebAPIAdapterInterface::devicesetSpectrumAnalyzerSettingsURL = "/sdrangel/deviceset/{deviceSetIndex}/spectrum/analyzers/{analyzerIndex}/settings";
+QString WebAPIAdapterInterface::devicesetSpectrumAnalyzerServerURL = "/sdrangel/deviceset/{deviceSetIndex}/spectrum/analyzers/{analyzerIndex}/server";
+QString WebAPIAdapterInterface::devicesetDeviceURL = "/sdrangel/deviceset/{deviceSetIndex}/device";
+QString WebAPIAdapterInterface::devicesetDeviceSettingsURL = "/sdrangel/deviceset/{deviceSetIndex}/device/settings";
+QString WebAPIAdapterInterface::devicesetDeviceRunURL = "/sdrangel/deviceset/{deviceSetIndex}/device/run";
+QString WebAPIAdapterInterface::devicesetDeviceSubsystemRunURL = "/sdrangel/deviceset/{deviceSetIndex}/subdevice/{subsystemIndex}/run";
+QString WebAPIAdapterInterface::devicesetDeviceReportURL = "/sdrangel/deviceset/{deviceSetIndex}/device/report";
+QString WebAPIAdapterInterface::devicesetDeviceActionsURL = "/sdrangel/deviceset/{deviceSetIndex}/device/actions";
+QString WebAPIAdapterInterface::devicesetChannelsReportURL = "/sdrangel/deviceset/{deviceSetIndex}/channels/report";
+QString WebAPIAdapterInterface::devicesetChannelURL = "/sdrangel/deviceset/{deviceSetIndex}/channel";
+QString WebAPIAdapterInterface::devicesetChannelIndexURL = "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}";
+QString WebAPIAdapterInterface::devicesetChannelSettingsURL = "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/settings";
+QString WebAPIAdapterInterface::devicesetChannelReportURL = "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/report";
+QString WebAPIAdapterInterface::devicesetChannelActionsURL = "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/actions";
 
-std::regex WebAPIAdapterInterface::featuresetURLRe("^/sdrangel/featureset/([0-9]{1,2})$");
-std::regex WebAPIAdapterInterface::featuresetFeatureURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature$");
-std::regex WebAPIAdapterInterface::featuresetPresetURLRe("^/sdrangel/featureset/([0-9]{1,2})/preset");
-std::regex WebAPIAdapterInterface::featuresetFeatureIndexURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})$");
-std::regex WebAPIAdapterInterface::featuresetFeatureRunURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})/run$");
-std::regex WebAPIAdapterInterface::featuresetFeatureSettingsURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})/settings$");
-std::regex WebAPIAdapterInterface::featuresetFeatureReportURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})/report");
-std::regex WebAPIAdapterInterface::featuresetFeatureActionsURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})/actions");
+QString WebAPIAdapterInterface::featuresetURL = "/sdrangel/featureset/{featureSetIndex}";
+QString WebAPIAdapterInterface::featuresetFeatureURL = "/sdrangel/featureset/{featureSetIndex}/feature";
+QString WebAPIAdapterInterface::featuresetPresetURL = "/sdrangel/featureset/{featureSetIndex}/preset";
+QString WebAPIAdapterInterface::featuresetFeatureIndexURL = "/sdrangel/featureset/{featureSetIndex}/feature/{featureIndex}";
+QString WebAPIAdapterInterface::featuresetFeatureRunURL = "/sdrangel/featureset/{featureSetIndex}/feature/{featureIndex}/run";
+QString WebAPIAdapterInterface::featuresetFeatureSettingsURL = "/sdrangel/featureset/{featureSetIndex}/feature/{featureIndex}/settings";
+QString WebAPIAdapterInterface::featuresetFeatureReportURL = "/sdrangel/featureset/{featureSetIndex}/feature/{featureIndex}/report";
+QString WebAPIAdapterInterface::featuresetFeatureActionsURL = "/sdrangel/featureset/{featureSetIndex}/feature/{featureIndex}/actions";
 
 void WebAPIAdapterInterface::ConfigKeys::debug() const
 {
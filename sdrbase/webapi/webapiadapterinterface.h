@@ -22,7 +22,6 @@
 
 #include <QString>
 #include <QStringList>
-#include <regex>
 
 #include "SWGErrorResponse.h"
 
@@ -73,6 +72,7 @@ namespace SWGSDRangel
     class SWGFeatureActions;
     class SWGGLSpectrum;
     class SWGSpectrumServer;
+    class SWGSpectrumAnalyzers;
 }
 
 class SDRBASE_API WebAPIAdapterInterface
@@ -694,6 +694,56 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/devicesets/channels/report (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceDeviceSetsChannelsReportGet(
+            const QList<int>& deviceSetIndexes, //!< all device sets if empty
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndexes;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/devicesets/channels/settings (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceDeviceSetsChannelsSettingsGet(
+            const QList<int>& deviceSetIndexes, //!< all device sets if empty
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndexes;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/devicesets/channels/settings (PATCH)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceDeviceSetsChannelsSettingsPatch(
+            const QList<QStringList>& channelSettingsKeys, //!< one list per channel of the query
+            SWGSDRangel::SWGChannelsDetail& query,
+            SWGSDRangel::SWGChannelsDetail& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) channelSettingsKeys;
+        (void) query;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset (POST) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -882,6 +932,154 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzersGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumAnalyzers& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers (POST)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzersPost(
+            int deviceSetIndex,
+            const QStringList& spectrumSettingsKeys,
+            SWGSDRangel::SWGGLSpectrum& query,
+            SWGSDRangel::SWGSpectrumAnalyzers& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) spectrumSettingsKeys;
+        (void) query;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers/{analyzerIndex} (DELETE)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzerDelete(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) analyzerIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers/{analyzerIndex}/settings (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzerSettingsGet(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGGLSpectrum& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) analyzerIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers/{analyzerIndex}/settings (PUT, PATCH)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzerSettingsPutPatch(
+            int deviceSetIndex,
+            int analyzerIndex,
+            bool force, //!< true to force settings = put else patch
+            const QStringList& spectrumSettingsKeys,
+            SWGSDRangel::SWGGLSpectrum& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) analyzerIndex;
+        (void) force;
+        (void) spectrumSettingsKeys;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers/{analyzerIndex}/server (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzerServerGet(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSpectrumServer& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) analyzerIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers/{analyzerIndex}/server (POST)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzerServerPost(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) analyzerIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/analyzers/{analyzerIndex}/server (DELETE)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumAnalyzerServerDelete(
+            int deviceSetIndex,
+            int analyzerIndex,
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) analyzerIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/device (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -1471,33 +1669,39 @@ public:
     static QString instanceFeaturePresetsURL;
     static QString instanceFeaturePresetURL;
     static QString instanceDeviceSetsURL;
+    static QString instanceDeviceSetsChannelsReportURL;
+    static QString instanceDeviceSetsChannelsSettingsURL;
     static QString instanceDeviceSetURL;
     static QString instanceFeatureSetsURL;
     static QString instanceFeatureSetURL;
-    static std::regex devicesetURLRe;
-    static std::regex devicesetFocusURLRe;
-    static std::regex devicesetSpectrumSettingsURLRe;
-    static std::regex devicesetSpectrumServerURLRe;
-    static std::regex devicesetDeviceURLRe;
-    static std::regex devicesetDeviceSettingsURLRe;
-    static std::regex devicesetDeviceRunURLRe;
-    static std::regex devicesetDeviceSubsystemRunURLRe;
-    static std::regex devicesetDeviceReportURLRe;
-    static std::regex devicesetDeviceActionsURLRe;
-    static std::regex devicesetChannelURLRe;
-    static std::regex devicesetChannelIndexURLRe;
-    static std::regex devicesetChannelSettingsURLRe;
-    static std::regex devicesetChannelReportURLRe;
-    static std::regex devicesetChannelActionsURLRe;
-    static std::regex devicesetChannelsReportURLRe;
-    static std::regex featuresetURLRe;
-    static std::regex featuresetFeatureURLRe;
-    static std::regex featuresetPresetURLRe;
-    static std::regex featuresetFeatureIndexURLRe;
-    static std::regex featuresetFeatureRunURLRe;
-    static std::regex featuresetFeatureSettingsURLRe;
-    static std::regex featuresetFeatureReportURLRe;
-    static std::regex featuresetFeatureActionsURLRe;
+    static QString devicesetURL;
+    static QString devicesetFocusURL;
+    static QString devicesetSpectrumSettingsURL;
+    static QString devicesetSpectrumServerURL;
+    static QString devicesetSpectrumAnalyzersURL;
+    static QString devicesetSpectrumAnalyzerURL;
+    static QString devicesetSpectrumAnalyzerSettingsURL;
+    static QString devicesetSpectrumAnalyzerServerURL;
+    static QString devicesetDeviceURL;
+    static QString devicesetDeviceSettingsURL;
+    static QString devicesetDeviceRunURL;
+    static QString devicesetDeviceSubsystemRunURL;
+    static QString devicesetDeviceReportURL;
+    static QString devicesetDeviceActionsURL;
+    static QString devicesetChannelURL;
+    static QString devicesetChannelIndexURL;
+    static QString devicesetChannelSettingsURL;
+    static QString devicesetChannelReportURL;
+    static QString devicesetChannelActionsURL;
+    static QString devicesetChannelsReportURL;
+    static QString featuresetURL;
+    static QString featuresetFeatureURL;
+    static QString featuresetPresetURL;
+    static QString featuresetFeatureIndexURL;
+    static QString featuresetFeatureRunURL;
+    static QString featuresetFeatureSettingsURL;
+    static QString featuresetFeatureReportURL;
+    static QString featuresetFeatureActionsURL;
 };
 
 
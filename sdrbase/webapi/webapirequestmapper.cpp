@@ -20,6 +20,9 @@
 #include <QDirIterator>
 #include <QJsonDocument>
 #include <QJsonArray>
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+#include <QCborValue>
+#endif
 
 #include <boost/lexical_cast.hpp>
 
@@ -48,6 +51,7 @@
 #include "SWGDeviceReport.h"
 #include "SWGDeviceActions.h"
 #include "SWGChannelsDetail.h"
+#include "SWGChannel.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelActions.h"
@@ -62,6 +66,7 @@
 #include "SWGFeatureActions.h"
 #include "SWGGLSpectrum.h"
 #include "SWGSpectrumServer.h"
+#include "SWGSpectrumAnalyzers.h"
 
 WebAPIRequestMapper::WebAPIRequestMapper(QObject* parent) :
     HttpRequestHandler(parent),
@@ -73,6 +78,7 @@ WebAPIRequestMapper::WebAPIRequestMapper(QObject* parent) :
     qtwebapp::HttpDocrootSettings docrootSettings;
     docrootSettings.path = ":/webapi";
     m_staticFileController = new qtwebapp::StaticFileController(docrootSettings, parent);
+    initRoutes();
 }
 
 WebAPIRequestMapper::~WebAPIRequestMapper()
@@ -111,127 +117,207 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
             return;
         }
 
-        if (path == WebAPIAdapterInterface::instanceSummaryURL) {
-            instanceSummaryService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceConfigURL) {
-            instanceConfigService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDevicesURL) {
-            instanceDevicesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceChannelsURL) {
-            instanceChannelsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceFeaturesURL) {
-            instanceFeaturesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLoggingURL) {
-            instanceLoggingService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioURL) {
-            instanceAudioService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputParametersURL) {
-            instanceAudioInputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputParametersURL) {
-            instanceAudioOutputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputCleanupURL) {
-            instanceAudioInputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputCleanupURL) {
-            instanceAudioOutputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLocationURL) {
-            instanceLocationService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAMBESerialURL) {
-            instanceAMBESerialService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAMBEDevicesURL) {
-            instanceAMBEDevicesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFESerialURL) {
-            instanceLimeRFESerialService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFEConfigURL) {
-            instanceLimeRFEConfigService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFERunURL) {
-            instanceLimeRFERunService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFEPowerURL) {
-            instanceLimeRFEPowerService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetsURL) {
-            instancePresetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetURL) {
-            instancePresetService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetFileURL) {
-            instancePresetFileService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceFeaturePresetsURL) {
-            instanceFeaturePresetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceFeaturePresetURL) {
-            instanceFeaturePresetService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetsURL) {
-            instanceDeviceSetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetURL) {
-            instanceDeviceSetService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceFeatureSetsURL) {
-            instanceFeatureSetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceFeatureSetURL) {
-            instanceFeatureSetService(request, response);
+        std::vector<std::string> params;
+        int routeId = m_router.match(path, params);
+
+        if (routeId < 0) // serve static documentation pages
+        {
+            m_staticFileController->service(request, response);
+            return;
+        }
+
+        const Route& route = m_routes[routeId];
+        bool readOnly = request.getMethod() == "GET";
+        QReadWriteLock *setLock = nullptr;
+
+        if (route.m_scope == RouteScopeDeviceSet) {
+            setLock = &m_deviceSetLocks[std::stoi(params[0])];
+        } else if (route.m_scope == RouteScopeFeatureSet) {
+            setLock = &m_featureSetLocks[std::stoi(params[0])];
         }
-        else
+
+        // Instance wide changes are exclusive of everything else. Otherwise GET requests run concurrently
+        // and the other methods are serialized with the requests on the same device set or feature set.
+        if (readOnly || setLock) {
+            m_instanceLock.lockForRead();
+        } else {
+            m_instanceLock.lockForWrite();
+        }
+
+        if (setLock)
         {
-            std::smatch desc_match;
-            std::string pathStr(path.constData(), path.length());
-
-            if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetURLRe)) {
-                devicesetService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceURLRe)) {
-                devicesetDeviceService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetFocusURLRe)) {
-                devicesetFocusService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetSpectrumSettingsURLRe)) {
-                devicesetSpectrumSettingsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetSpectrumServerURLRe)) {
-                devicesetSpectrumServerService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsURLRe)) {
-                devicesetDeviceSettingsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceRunURLRe)) {
-                devicesetDeviceRunService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe)) {
-                devicesetDeviceSubsystemRunService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceReportURLRe)) {
-                devicesetDeviceReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceActionsURLRe)) {
-                devicesetDeviceActionsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelsReportURLRe)) {
-                devicesetChannelsReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelURLRe)) {
-                devicesetChannelService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelIndexURLRe)) {
-                devicesetChannelIndexService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelSettingsURLRe)) {
-                devicesetChannelSettingsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelReportURLRe)) {
-                devicesetChannelReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelActionsURLRe)) {
-                devicesetChannelActionsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetURLRe)) {
-                featuresetService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetFeatureURLRe)) {
-                featuresetFeatureService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetPresetURLRe)) {
-                featuresetPresetService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetFeatureIndexURLRe)) {
-                featuresetFeatureIndexService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetFeatureRunURLRe)) {
-                featuresetFeatureRunService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetFeatureSettingsURLRe)) {
-                featuresetFeatureSettingsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetFeatureReportURLRe)) {
-                featuresetFeatureReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::featuresetFeatureActionsURLRe)) {
-                featuresetFeatureActionsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            }
-            else // serve static documentation pages
-            {
-                m_staticFileController->service(request, response);
+            if (readOnly) {
+                setLock->lockForRead();
+            } else {
+                setLock->lockForWrite();
+            }
+        }
+
+        try
+        {
+            if (params.size() == 0) {
+                (this->*route.m_instanceService)(request, response);
+            } else if (params.size() == 1) {
+                (this->*route.m_setService)(params[0], request, response);
+            } else {
+                (this->*route.m_setItemService)(params[0], params[1], request, response);
+            }
+        }
+        catch (...) // the connection handler recovers from it but the locks must be released
+        {
+            if (setLock) {
+                setLock->unlock();
             }
 
-//            QDirIterator it(":", QDirIterator::Subdirectories);
-//            while (it.hasNext()) {
-//                qDebug() << "WebAPIRequestMapper::service: " << it.next();
-//            }
+            m_instanceLock.unlock();
+            throw;
+        }
 
+        if (setLock) {
+            setLock->unlock();
         }
+
+        m_instanceLock.unlock();
+    }
+}
+
+bool WebAPIRequestMapper::tryLockSetForRead(QReadWriteLock *setLocks, int setIndex)
+{
+    if ((setIndex < 0) || (setIndex >= m_maxSetIndex)) {
+        return false;
     }
+
+    // same order as in service
+    if (!m_instanceLock.tryLockForRead()) {
+        return false;
+    }
+
+    if (!setLocks[setIndex].tryLockForRead())
+    {
+        m_instanceLock.unlock();
+        return false;
+    }
+
+    return true;
+}
+
+void WebAPIRequestMapper::unlockSet(QReadWriteLock *setLocks, int setIndex)
+{
+    setLocks[setIndex].unlock();
+    m_instanceLock.unlock();
+}
+
+QList<int> WebAPIRequestMapper::lockSetsForRead(QReadWriteLock *setLocks, const QList<int>& setIndexes)
+{
+    // Requests on several sets (all sets if no index is given) under the instance read lock taken in service.
+    // Set locks are taken in increasing index order so that two of them cannot wait on each other.
+    QList<int> lockedIndexes;
+
+    for (int setIndex = 0; setIndex < m_maxSetIndex; setIndex++)
+    {
+        if (setIndexes.isEmpty() || setIndexes.contains(setIndex))
+        {
+            setLocks[setIndex].lockForRead();
+            lockedIndexes.append(setIndex);
+        }
+    }
+
+    return lockedIndexes;
+}
+
+void WebAPIRequestMapper::unlockSets(QReadWriteLock *setLocks, const QList<int>& lockedIndexes)
+{
+    for (int setIndex : lockedIndexes) {
+        setLocks[setIndex].unlock();
+    }
+}
+
+void WebAPIRequestMapper::initRoutes()
+{
+    addRoute(WebAPIAdapterInterface::instanceSummaryURL, &WebAPIRequestMapper::instanceSummaryService);
+    addRoute(WebAPIAdapterInterface::instanceConfigURL, &WebAPIRequestMapper::instanceConfigService);
+    addRoute(WebAPIAdapterInterface::instanceDevicesURL, &WebAPIRequestMapper::instanceDevicesService);
+    addRoute(WebAPIAdapterInterface::instanceChannelsURL, &WebAPIRequestMapper::instanceChannelsService);
+    addRoute(WebAPIAdapterInterface::instanceFeaturesURL, &WebAPIRequestMapper::instanceFeaturesService);
+    addRoute(WebAPIAdapterInterface::instanceLoggingURL, &WebAPIRequestMapper::instanceLoggingService);
+    addRoute(WebAPIAdapterInterface::instanceAudioURL, &WebAPIRequestMapper::instanceAudioService);
+    addRoute(WebAPIAdapterInterface::instanceAudioInputParametersURL, &WebAPIRequestMapper::instanceAudioInputParametersService);
+    addRoute(WebAPIAdapterInterface::instanceAudioOutputParametersURL, &WebAPIRequestMapper::instanceAudioOutputParametersService);
+    addRoute(WebAPIAdapterInterface::instanceAudioInputCleanupURL, &WebAPIRequestMapper::instanceAudioInputCleanupService);
+    addRoute(WebAPIAdapterInterface::instanceAudioOutputCleanupURL, &WebAPIRequestMapper::instanceAudioOutputCleanupService);
+    addRoute(WebAPIAdapterInterface::instanceLocationURL, &WebAPIRequestMapper::instanceLocationService);
+    addRoute(WebAPIAdapterInterface::instanceAMBESerialURL, &WebAPIRequestMapper::instanceAMBESerialService);
+    addRoute(WebAPIAdapterInterface::instanceAMBEDevicesURL, &WebAPIRequestMapper::instanceAMBEDevicesService);
+    addRoute(WebAPIAdapterInterface::instanceLimeRFESerialURL, &WebAPIRequestMapper::instanceLimeRFESerialService);
+    addRoute(WebAPIAdapterInterface::instanceLimeRFEConfigURL, &WebAPIRequestMapper::instanceLimeRFEConfigService);
+    addRoute(WebAPIAdapterInterface::instanceLimeRFERunURL, &WebAPIRequestMapper::instanceLimeRFERunService);
+    addRoute(WebAPIAdapterInterface::instanceLimeRFEPowerURL, &WebAPIRequestMapper::instanceLimeRFEPowerService);
+    addRoute(WebAPIAdapterInterface::instancePresetsURL, &WebAPIRequestMapper::instancePresetsService);
+    addRoute(WebAPIAdapterInterface::instancePresetURL, &WebAPIRequestMapper::instancePresetService);
+    addRoute(WebAPIAdapterInterface::instancePresetFileURL, &WebAPIRequestMapper::instancePresetFileService);
+    addRoute(WebAPIAdapterInterface::instanceFeaturePresetsURL, &WebAPIRequestMapper::instanceFeaturePresetsService);
+    addRoute(WebAPIAdapterInterface::instanceFeaturePresetURL, &WebAPIRequestMapper::instanceFeaturePresetService);
+    addRoute(WebAPIAdapterInterface::instanceDeviceSetsURL, &WebAPIRequestMapper::instanceDeviceSetsService);
+    addRoute(WebAPIAdapterInterface::instanceDeviceSetsChannelsReportURL, &WebAPIRequestMapper::instanceDeviceSetsChannelsReportService);
+    addRoute(WebAPIAdapterInterface::instanceDeviceSetsChannelsSettingsURL, &WebAPIRequestMapper::instanceDeviceSetsChannelsSettingsService);
+    addRoute(WebAPIAdapterInterface::instanceDeviceSetURL, &WebAPIRequestMapper::instanceDeviceSetService);
+    addRoute(WebAPIAdapterInterface::instanceFeatureSetsURL, &WebAPIRequestMapper::instanceFeatureSetsService);
+    addRoute(WebAPIAdapterInterface::instanceFeatureSetURL, &WebAPIRequestMapper::instanceFeatureSetService);
+    addRoute(WebAPIAdapterInterface::devicesetURL, &WebAPIRequestMapper::devicesetService);
+    addRoute(WebAPIAdapterInterface::devicesetDeviceURL, &WebAPIRequestMapper::devicesetDeviceService);
+    addRoute(WebAPIAdapterInterface::devicesetFocusURL, &WebAPIRequestMapper::devicesetFocusService);
+    addRoute(WebAPIAdapterInterface::devicesetSpectrumSettingsURL, &WebAPIRequestMapper::devicesetSpectrumSettingsService);
+    addRoute(WebAPIAdapterInterface::devicesetSpectrumServerURL, &WebAPIRequestMapper::devicesetSpectrumServerService);
+    addRoute(WebAPIAdapterInterface::devicesetSpectrumAnalyzersURL, &WebAPIRequestMapper::devicesetSpectrumAnalyzersService);
+    addRoute(WebAPIAdapterInterface::devicesetSpectrumAnalyzerURL, &WebAPIRequestMapper::devicesetSpectrumAnalyzerService);
+    addRoute(WebAPIAdapterInterface::devicesetSpectrumAnalyzerSettingsURL, &WebAPIRequestMapper::devicesetSpectrumAnalyzerSettingsService);
+    addRoute(WebAPIAdapterInterface::devicesetSpectrumAnalyzerServerURL, &WebAPIRequestMapper::devicesetSpectrumAnalyzerServerService);
+    addRoute(WebAPIAdapterInterface::devicesetDeviceSettingsURL, &WebAPIRequestMapper::devicesetDeviceSettingsService);
+    addRoute(WebAPIAdapterInterface::devicesetDeviceRunURL, &WebAPIRequestMapper::devicesetDeviceRunService);
+    addRoute(WebAPIAdapterInterface::devicesetDeviceSubsystemRunURL, &WebAPIRequestMapper::devicesetDeviceSubsystemRunService);
+    addRoute(WebAPIAdapterInterface::devicesetDeviceReportURL, &WebAPIRequestMapper::devicesetDeviceReportService);
+    addRoute(WebAPIAdapterInterface::devicesetDeviceActionsURL, &WebAPIRequestMapper::devicesetDeviceActionsService);
+    addRoute(WebAPIAdapterInterface::devicesetChannelsReportURL, &WebAPIRequestMapper::devicesetChannelsReportService);
+    addRoute(WebAPIAdapterInterface::devicesetChannelURL, &WebAPIRequestMapper::devicesetChannelService);
+    addRoute(WebAPIAdapterInterface::devicesetChannelIndexURL, &WebAPIRequestMapper::devicesetChannelIndexService);
+    addRoute(WebAPIAdapterInterface::devicesetChannelSettingsURL, &WebAPIRequestMapper::devicesetChannelSettingsService);
+    addRoute(WebAPIAdapterInterface::devicesetChannelReportURL, &WebAPIRequestMapper::devicesetChannelReportService);
+    addRoute(WebAPIAdapterInterface::devicesetChannelActionsURL, &WebAPIRequestMapper::devicesetChannelActionsService);
+    addRoute(WebAPIAdapterInterface::featuresetURL, &WebAPIRequestMapper::featuresetService);
+    addRoute(WebAPIAdapterInterface::featuresetFeatureURL, &WebAPIRequestMapper::featuresetFeatureService);
+    addRoute(WebAPIAdapterInterface::featuresetPresetURL, &WebAPIRequestMapper::featuresetPresetService);
+    addRoute(WebAPIAdapterInterface::featuresetFeatureIndexURL, &WebAPIRequestMapper::featuresetFeatureIndexService);
+    addRoute(WebAPIAdapterInterface::featuresetFeatureRunURL, &WebAPIRequestMapper::featuresetFeatureRunService);
+    addRoute(WebAPIAdapterInterface::featuresetFeatureSettingsURL, &WebAPIRequestMapper::featuresetFeatureSettingsService);
+    addRoute(WebAPIAdapterInterface::featuresetFeatureReportURL, &WebAPIRequestMapper::featuresetFeatureReportService);
+    addRoute(WebAPIAdapterInterface::featuresetFeatureActionsURL, &WebAPIRequestMapper::featuresetFeatureActionsService);
+}
+
+void WebAPIRequestMapper::addRoute(const QString& pattern, InstanceService service)
+{
+    Route route;
+    route.m_scope = RouteScopeInstance;
+    route.m_instanceService = service;
+    m_router.addRoute(pattern, m_routes.size());
+    m_routes.push_back(route);
+}
+
+void WebAPIRequestMapper::addRoute(const QString& pattern, SetService service)
+{
+    Route route;
+    route.m_scope = pattern.startsWith(WebAPIAdapterInterface::instanceDeviceSetURL + "/") ? RouteScopeDeviceSet : RouteScopeFeatureSet;
+    route.m_setService = service;
+    m_router.addRoute(pattern, m_routes.size());
+    m_routes.push_back(route);
+}
+
+void WebAPIRequestMapper::addRoute(const QString& pattern, SetItemService service)
+{
+    Route route;
+    route.m_scope = pattern.startsWith(WebAPIAdapterInterface::instanceDeviceSetURL + "/") ? RouteScopeDeviceSet : RouteScopeFeatureSet;
+    route.m_setItemService = service;
+    m_router.addRoute(pattern, m_routes.size());
+    m_routes.push_back(route);
 }
 
 void WebAPIRequestMapper::instanceSummaryService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
@@ -1475,6 +1561,149 @@ void WebAPIRequestMapper::instanceDeviceSetsService(qtwebapp::HttpRequest& reque
     }
 }
 
+void WebAPIRequestMapper::instanceDeviceSetsChannelsReportService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        QList<int> deviceSetIndexes;
+
+        if (parseIndexList(request.getParameter("deviceSetIndexes"), deviceSetIndexes))
+        {
+            SWGSDRangel::SWGChannelsDetail normalResponse;
+            QList<int> lockedIndexes = lockSetsForRead(m_deviceSetLocks, deviceSetIndexes);
+            int status;
+
+            try
+            {
+                status = m_adapter->instanceDeviceSetsChannelsReportGet(deviceSetIndexes, normalResponse, errorResponse);
+            }
+            catch (...)
+            {
+                unlockSets(m_deviceSetLocks, lockedIndexes);
+                throw;
+            }
+
+            unlockSets(m_deviceSetLocks, lockedIndexes);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                writeChannelsDetail(request, response, normalResponse);
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(400,"Invalid query");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid device set indexes list";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::instanceDeviceSetsChannelsSettingsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        QList<int> deviceSetIndexes;
+
+        if (parseIndexList(request.getParameter("deviceSetIndexes"), deviceSetIndexes))
+        {
+            SWGSDRangel::SWGChannelsDetail normalResponse;
+            QList<int> lockedIndexes = lockSetsForRead(m_deviceSetLocks, deviceSetIndexes);
+            int status;
+
+            try
+            {
+                status = m_adapter->instanceDeviceSetsChannelsSettingsGet(deviceSetIndexes, normalResponse, errorResponse);
+            }
+            catch (...)
+            {
+                unlockSets(m_deviceSetLocks, lockedIndexes);
+                throw;
+            }
+
+            unlockSets(m_deviceSetLocks, lockedIndexes);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                writeChannelsDetail(request, response, normalResponse);
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(400,"Invalid query");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid device set indexes list";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else if (request.getMethod() == "PATCH")
+    {
+        QString jsonStr = request.getBody();
+        QJsonObject jsonObject;
+
+        if (parseJsonBody(jsonStr, jsonObject, response))
+        {
+            SWGSDRangel::SWGChannelsDetail query;
+            QList<QStringList> channelSettingsKeys;
+            int invalidIndex = validateChannelsSettings(query, jsonObject, channelSettingsKeys);
+
+            if (invalidIndex < 0)
+            {
+                SWGSDRangel::SWGChannelsDetail normalResponse;
+                int status = m_adapter->instanceDeviceSetsChannelsSettingsPatch(channelSettingsKeys, query, normalResponse, errorResponse);
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    writeChannelsDetail(request, response, normalResponse);
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON request");
+                errorResponse.init();
+                *errorResponse.getMessage() = QString("Invalid JSON request at channels[%1]").arg(invalidIndex);
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(400,"Invalid JSON format");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid JSON format";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::instanceFeatureSetsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -1820,6 +2049,290 @@ void WebAPIRequestMapper::devicesetSpectrumServerService(const std::string& inde
     }
 }
 
+void WebAPIRequestMapper::devicesetSpectrumAnalyzersService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "POST")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGGLSpectrum query;
+                resetSpectrumSettings(query);
+                QStringList spectrumSettingsKeys;
+
+                if (validateSpectrumSettings(query, jsonObject, spectrumSettingsKeys))
+                {
+                    SWGSDRangel::SWGSpectrumAnalyzers normalResponse;
+                    int status = m_adapter->devicesetSpectrumAnalyzersPost(
+                            deviceSetIndex,
+                            spectrumSettingsKeys,
+                            query,
+                            normalResponse,
+                            errorResponse);
+                    response.setStatus(status);
+
+                    if (status/100 == 2) {
+                        response.write(normalResponse.asJson().toUtf8());
+                    } else {
+                        response.write(errorResponse.asJson().toUtf8());
+                    }
+                }
+                else
+                {
+                    response.setStatus(400,"Invalid JSON request");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid JSON request";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGSpectrumAnalyzers normalResponse;
+            int status = m_adapter->devicesetSpectrumAnalyzersGet(deviceSetIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetSpectrumAnalyzerService(
+        const std::string& deviceSetIndexStr,
+        const std::string& analyzerIndexStr,
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(deviceSetIndexStr);
+        int analyzerIndex = boost::lexical_cast<int>(analyzerIndexStr);
+
+        if (request.getMethod() == "DELETE")
+        {
+            SWGSDRangel::SWGSuccessResponse normalResponse;
+            int status = m_adapter->devicesetSpectrumAnalyzerDelete(deviceSetIndex, analyzerIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetSpectrumAnalyzerSettingsService(
+        const std::string& deviceSetIndexStr,
+        const std::string& analyzerIndexStr,
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(deviceSetIndexStr);
+        int analyzerIndex = boost::lexical_cast<int>(analyzerIndexStr);
+
+        if ((request.getMethod() == "PUT") || (request.getMethod() == "PATCH"))
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGGLSpectrum normalResponse;
+                resetSpectrumSettings(normalResponse);
+                QStringList spectrumSettingsKeys;
+
+                if (validateSpectrumSettings(normalResponse, jsonObject, spectrumSettingsKeys))
+                {
+                    int status = m_adapter->devicesetSpectrumAnalyzerSettingsPutPatch(
+                            deviceSetIndex,
+                            analyzerIndex,
+                            (request.getMethod() == "PUT"), // force settings on PUT
+                            spectrumSettingsKeys,
+                            normalResponse,
+                            errorResponse);
+                    response.setStatus(status);
+
+                    if (status/100 == 2) {
+                        response.write(normalResponse.asJson().toUtf8());
+                    } else {
+                        response.write(errorResponse.asJson().toUtf8());
+                    }
+                }
+                else
+                {
+                    response.setStatus(400,"Invalid JSON request");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid JSON request";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGGLSpectrum normalResponse;
+            resetSpectrumSettings(normalResponse);
+            int status = m_adapter->devicesetSpectrumAnalyzerSettingsGet(deviceSetIndex, analyzerIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetSpectrumAnalyzerServerService(
+        const std::string& deviceSetIndexStr,
+        const std::string& analyzerIndexStr,
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(deviceSetIndexStr);
+        int analyzerIndex = boost::lexical_cast<int>(analyzerIndexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGSpectrumServer normalResponse;
+            int status = m_adapter->devicesetSpectrumAnalyzerServerGet(deviceSetIndex, analyzerIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "POST")
+        {
+            SWGSDRangel::SWGSuccessResponse normalResponse;
+            int status = m_adapter->devicesetSpectrumAnalyzerServerPost(deviceSetIndex, analyzerIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "DELETE")
+        {
+            SWGSDRangel::SWGSuccessResponse normalResponse;
+            int status = m_adapter->devicesetSpectrumAnalyzerServerDelete(deviceSetIndex, analyzerIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::devicesetDeviceService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -3403,6 +3916,138 @@ bool WebAPIRequestMapper::validateDeviceActions(
     return getDeviceActions(deviceActionsKey, &deviceActions, jsonObject, deviceActionsKeys);
 }
 
+bool WebAPIRequestMapper::parseIndexList(const QByteArray& indexList, QList<int>& indexes)
+{
+    if (indexList.isEmpty()) {
+        return true;
+    }
+
+    for (const QByteArray& item : indexList.split(','))
+    {
+        bool ok;
+        int index = item.trimmed().toInt(&ok);
+
+        if (!ok) {
+            return false;
+        }
+
+        indexes.append(index);
+    }
+
+    return true;
+}
+
+int WebAPIRequestMapper::validateChannelsSettings(
+        SWGSDRangel::SWGChannelsDetail& channelsDetail,
+        QJsonObject& jsonObject,
+        QList<QStringList>& channelsSettingsKeys)
+{
+    channelsDetail.init();
+
+    if (!jsonObject.contains("channels") || !jsonObject["channels"].isArray()) {
+        return 0;
+    }
+
+    QJsonArray channelsJson = jsonObject["channels"].toArray();
+
+    for (int i = 0; i < channelsJson.size(); i++)
+    {
+        QJsonObject channelJson = channelsJson.at(i).toObject();
+
+        if (!channelJson.contains("deviceSetIndex") || !channelJson.contains("index")
+         || !channelJson.contains("settings") || !channelJson["settings"].isObject()) {
+            return i;
+        }
+
+        SWGSDRangel::SWGChannel *channel = new SWGSDRangel::SWGChannel();
+        channelsDetail.getChannels()->append(channel);
+        channel->setDeviceSetIndex(channelJson["deviceSetIndex"].toInt(-1));
+        channel->setIndex(channelJson["index"].toInt(-1));
+        channel->setSettings(new SWGSDRangel::SWGChannelSettings());
+        resetChannelSettings(*channel->getSettings());
+        QJsonObject settingsJson = channelJson["settings"].toObject();
+        channelsSettingsKeys.append(QStringList());
+
+        if (!validateChannelSettings(*channel->getSettings(), settingsJson, channelsSettingsKeys.back())) {
+            return i;
+        }
+    }
+
+    channelsDetail.setChannelcount(channelsDetail.getChannels()->size());
+
+    return -1;
+}
+
+void WebAPIRequestMapper::writeChannelsDetail(
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response,
+        SWGSDRangel::SWGChannelsDetail& channelsDetail)
+{
+    QJsonObject *jsonObject = channelsDetail.asJsonObject();
+    QByteArray fieldsParameter = request.getParameter("fields");
+
+    if (!fieldsParameter.isEmpty() && jsonObject->contains("channels"))
+    {
+        QList<QStringList> fieldPaths;
+
+        for (const QString& field : QString(fieldsParameter).split(',', QString::SkipEmptyParts)) {
+            fieldPaths.append(field.trimmed().split('.'));
+        }
+
+        QJsonArray channels = (*jsonObject)["channels"].toArray();
+
+        for (int i = 0; i < channels.size(); i++)
+        {
+            QJsonObject channel = channels.at(i).toObject();
+            QJsonObject selection;
+
+            for (const QStringList& fieldPath : fieldPaths) {
+                selectJsonField(channel, selection, fieldPath, 0);
+            }
+
+            channels[i] = selection;
+        }
+
+        jsonObject->insert("channels", channels);
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    if (request.getHeader("Accept").contains("application/cbor"))
+    {
+        response.setHeader("Content-Type", "application/cbor");
+        response.write(QCborValue::fromJsonValue(*jsonObject).toCbor());
+        delete jsonObject;
+        return;
+    }
+#endif
+
+    response.write(QJsonDocument(*jsonObject).toJson(QJsonDocument::Compact));
+    delete jsonObject;
+}
+
+void WebAPIRequestMapper::selectJsonField(const QJsonObject& from, QJsonObject& to, const QStringList& fieldPath, int depth)
+{
+    const QString& key = fieldPath.at(depth);
+
+    if (!from.contains(key)) {
+        return;
+    }
+
+    if (depth == fieldPath.size() - 1)
+    {
+        to.insert(key, from.value(key));
+    }
+    else if (from.value(key).isObject())
+    {
+        QJsonObject child = to.value(key).toObject();
+        selectJsonField(from.value(key).toObject(), child, fieldPath, depth + 1);
+
+        if (!child.isEmpty()) {
+            to.insert(key, child);
+        }
+    }
+}
+
 bool WebAPIRequestMapper::validateChannelSettings(
         SWGSDRangel::SWGChannelSettings& channelSettings,
         QJsonObject& jsonObject,
@@ -3825,6 +4470,16 @@ bool WebAPIRequestMapper::validateSpectrumSettings(SWGSDRangel::SWGGLSpectrum& s
         spectrumSettings.setWsSpectrumPort(jsonObject["wsSpectrumPort"].toInt(8887));
         spectrumSettingsKeys.append("wsSpectrumPort");
     }
+    if (jsonObject.contains("zoomLog2"))
+    {
+        spectrumSettings.setZoomLog2(jsonObject["zoomLog2"].toInt(0));
+        spectrumSettingsKeys.append("zoomLog2");
+    }
+    if (jsonObject.contains("zoomPosition"))
+    {
+        spectrumSettings.setZoomPosition(jsonObject["zoomPosition"].toDouble(0.5));
+        spectrumSettingsKeys.append("zoomPosition");
+    }
 
     return true;
 }
@@ -21,12 +21,14 @@
 #define SDRBASE_WEBAPI_WEBAPIREQUESTMAPPER_H_
 
 #include <QJsonParseError>
+#include <QReadWriteLock>
 
 #include "httprequesthandler.h"
 #include "httprequest.h"
 #include "httpresponse.h"
 #include "staticfilecontroller.h"
 #include "webapiadapterinterface.h"
+#include "webapirouter.h"
 
 #include "export.h"
 
@@ -49,10 +51,58 @@ public:
     ~WebAPIRequestMapper();
     void service(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void setAdapter(WebAPIAdapterInterface *adapter) { m_adapter = adapter; }
+    WebAPIAdapterInterface *getAdapter() { return m_adapter; }
+    static int getMaxSetIndex() { return m_maxSetIndex; }
+
+    /**
+     * Locks of a GET request on a device set or feature set for the services calling the adapter
+     * outside of HTTP requests. They do not wait: false if a change is in progress or the index is out of range.
+     */
+    bool tryLockDeviceSetForRead(int deviceSetIndex) { return tryLockSetForRead(m_deviceSetLocks, deviceSetIndex); }
+    bool tryLockFeatureSetForRead(int featureSetIndex) { return tryLockSetForRead(m_featureSetLocks, featureSetIndex); }
+    void unlockDeviceSet(int deviceSetIndex) { unlockSet(m_deviceSetLocks, deviceSetIndex); }
+    void unlockFeatureSet(int featureSetIndex) { unlockSet(m_featureSetLocks, featureSetIndex); }
 
 private:
+    typedef void (WebAPIRequestMapper::*InstanceService)(qtwebapp::HttpRequest&, qtwebapp::HttpResponse&);
+    typedef void (WebAPIRequestMapper::*SetService)(const std::string&, qtwebapp::HttpRequest&, qtwebapp::HttpResponse&);
+    typedef void (WebAPIRequestMapper::*SetItemService)(const std::string&, const std::string&, qtwebapp::HttpRequest&, qtwebapp::HttpResponse&);
+
+    enum RouteScope
+    {
+        RouteScopeInstance,
+        RouteScopeDeviceSet,
+        RouteScopeFeatureSet
+    };
+
+    struct Route
+    {
+        RouteScope m_scope;
+        InstanceService m_instanceService;  //!< no path parameter
+        SetService m_setService;            //!< device set or feature set index
+        SetItemService m_setItemService;    //!< set index and item (channel, feature...) index
+
+        Route() : m_scope(RouteScopeInstance), m_instanceService(nullptr), m_setService(nullptr), m_setItemService(nullptr) {}
+    };
+
+    static const int m_maxSetIndex = 100; //!< set indexes have at most 2 digits
+
     WebAPIAdapterInterface *m_adapter;
     qtwebapp::StaticFileController *m_staticFileController;
+    WebAPIRouter m_router;
+    std::vector<Route> m_routes;           //!< indexed by router route identifier
+    QReadWriteLock m_instanceLock;
+    QReadWriteLock m_deviceSetLocks[m_maxSetIndex];
+    QReadWriteLock m_featureSetLocks[m_maxSetIndex];
+
+    bool tryLockSetForRead(QReadWriteLock *setLocks, int setIndex);
+    void unlockSet(QReadWriteLock *setLocks, int setIndex);
+    QList<int> lockSetsForRead(QReadWriteLock *setLocks, const QList<int>& setIndexes);
+    void unlockSets(QReadWriteLock *setLocks, const QList<int>& lockedIndexes);
+    void initRoutes();
+    void addRoute(const QString& pattern, InstanceService service);
+    void addRoute(const QString& pattern, SetService service);
+    void addRoute(const QString& pattern, SetItemService service);
 
     void instanceSummaryService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceConfigService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
@@ -79,6 +129,8 @@ private:
     void instanceFeaturePresetsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceFeaturePresetService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceDeviceSetsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void instanceDeviceSetsChannelsReportService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void instanceDeviceSetsChannelsSettingsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceDeviceSetService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceFeatureSetsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceFeatureSetService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
@@ -87,6 +139,10 @@ private:
     void devicesetFocusService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetSpectrumSettingsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetSpectrumServerService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumAnalyzersService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumAnalyzerService(const std::string& deviceSetIndexStr, const std::string& analyzerIndexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumAnalyzerSettingsService(const std::string& deviceSetIndexStr, const std::string& analyzerIndexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumAnalyzerServerService(const std::string& deviceSetIndexStr, const std::string& analyzerIndexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceSettingsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceRunService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
@@ -211,6 +267,18 @@ private:
     );
 
     bool parseJsonBody(QString& jsonStr, QJsonObject& jsonObject, qtwebapp::HttpResponse& response);
+    bool parseIndexList(const QByteArray& indexList, QList<int>& indexes);
+    /** Returns the index of the first invalid channel or -1 if all are valid */
+    int validateChannelsSettings(
+            SWGSDRangel::SWGChannelsDetail& channelsDetail,
+            QJsonObject& jsonObject,
+            QList<QStringList>& channelsSettingsKeys);
+    /** Writes in compact JSON or CBOR if accepted by the client keeping only the channel fields of the "fields" parameter if any */
+    void writeChannelsDetail(
+            qtwebapp::HttpRequest& request,
+            qtwebapp::HttpResponse& response,
+            SWGSDRangel::SWGChannelsDetail& channelsDetail);
+    void selectJsonField(const QJsonObject& from, QJsonObject& to, const QStringList& fieldPath, int depth);
 
     void resetSpectrumSettings(SWGSDRangel::SWGGLSpectrum& spectrumSettings);
     void resetDeviceSettings(SWGSDRangel::SWGDeviceSettings& deviceSettings);
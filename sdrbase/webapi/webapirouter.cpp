@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QStringList>
+
+#include "webapirouter.h"
+
+WebAPIRouter::Node::~Node()
+{
+    qDeleteAll(m_children);
+    delete m_paramChild;
+}
+
+WebAPIRouter::WebAPIRouter()
+{}
+
+WebAPIRouter::~WebAPIRouter()
+{}
+
+void WebAPIRouter::addRoute(const QString& pattern, int routeId)
+{
+    Node *node = &m_root;
+    const QStringList segments = pattern.split('/');
+
+    // first segment is empty as the pattern starts with a slash
+    for (int i = 1; i < segments.size(); i++)
+    {
+        const QString& segment = segments.at(i);
+
+        if (segment.startsWith('{'))
+        {
+            if (!node->m_paramChild) {
+                node->m_paramChild = new Node();
+            }
+
+            node = node->m_paramChild;
+        }
+        else
+        {
+            QByteArray key = segment.toLatin1();
+            Node *child = node->m_children.value(key, nullptr);
+
+            if (!child)
+            {
+                child = new Node();
+                node->m_children.insert(key, child);
+            }
+
+            node = child;
+        }
+    }
+
+    if (node->m_routeId >= 0) {
+        qWarning("WebAPIRouter::addRoute: %s: replaces route %d", qPrintable(pattern), node->m_routeId);
+    }
+
+    node->m_routeId = routeId;
+}
+
+int WebAPIRouter::match(const QByteArray& path, std::vector<std::string>& params) const
+{
+    if (!path.startsWith('/')) {
+        return -1;
+    }
+
+    return match(&m_root, path, 1, params);
+}
+
+int WebAPIRouter::match(const Node *node, const QByteArray& path, int pos, std::vector<std::string>& params) const
+{
+    if (pos > path.size()) { // all segments consumed
+        return node->m_routeId;
+    }
+
+    int end = path.indexOf('/', pos);
+
+    if (end < 0) {
+        end = path.size();
+    }
+
+    const char *segment = path.constData() + pos;
+    int segmentSize = end - pos;
+    const Node *child = node->m_children.value(QByteArray::fromRawData(segment, segmentSize), nullptr);
+
+    if (child)
+    {
+        int routeId = match(child, path, end + 1, params);
+
+        if (routeId >= 0) {
+            return routeId;
+        }
+    }
+
+    if (node->m_paramChild && isIndex(segment, segmentSize))
+    {
+        params.push_back(std::string(segment, segmentSize));
+        int routeId = match(node->m_paramChild, path, end + 1, params);
+
+        if (routeId >= 0) {
+            return routeId;
+        }
+
+        params.pop_back();
+    }
+
+    return -1;
+}
+
+bool WebAPIRouter::isIndex(const char *segment, int size)
+{
+    if ((size < 1) || (size > 2)) {
+        return false;
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        if ((segment[i] < '0') || (segment[i] > '9')) {
+            return false;
+        }
+    }
+
+    return true;
+}
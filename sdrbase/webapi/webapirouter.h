@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIROUTER_H_
+#define SDRBASE_WEBAPI_WEBAPIROUTER_H_
+
+#include <string>
+#include <vector>
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+
+#include "export.h"
+
+/**
+ * Precompiled routing table of the REST API. Routes are stored in a trie of path segments
+ * so that resolving a path costs one hash lookup per segment whatever the number of routes.
+ * A segment in braces like {deviceSetIndex} is a path parameter matching an index of 1 or 2
+ * digits. Literal segments take precedence over parameters.
+ */
+class SDRBASE_API WebAPIRouter
+{
+public:
+    WebAPIRouter();
+    ~WebAPIRouter();
+
+    void addRoute(const QString& pattern, int routeId);
+    /** Returns the route identifier or -1 if no route matches. Path parameters are appended to params in order */
+    int match(const QByteArray& path, std::vector<std::string>& params) const;
+
+private:
+    struct Node
+    {
+        QHash<QByteArray, Node*> m_children;
+        Node *m_paramChild;
+        int m_routeId;
+
+        Node() : m_paramChild(nullptr), m_routeId(-1) {}
+        ~Node();
+    };
+
+    Node m_root;
+
+    int match(const Node *node, const QByteArray& path, int pos, std::vector<std::string>& params) const;
+    static bool isIndex(const char *segment, int size);
+};
+
+#endif // SDRBASE_WEBAPI_WEBAPIROUTER_H_
@@ -18,6 +18,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QCoreApplication>
+#include <QThread>
 
 #include "httplistener.h"
 #include "webapirequestmapper.h"
@@ -30,6 +31,8 @@ WebAPIServer::WebAPIServer(const QString& host, uint16_t port, WebAPIRequestMapp
     m_settings.host = host;
     m_settings.port = port;
     m_settings.maxRequestSize = 1<<23; // 8M
+    // keep enough idle connection handlers (threads) for clients polling without keep-alive
+    m_settings.minThreads = QThread::idealThreadCount() < 4 ? 4 : QThread::idealThreadCount();
 }
 
 WebAPIServer::~WebAPIServer()
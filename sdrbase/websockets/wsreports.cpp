@@ -0,0 +1,531 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtWebSockets>
+#include <QHostAddress>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+#include <QCborValue>
+#endif
+#include <QDebug>
+
+#include <algorithm>
+
+#include "SWGDeviceReport.h"
+#include "SWGChannelReport.h"
+#include "SWGFeatureReport.h"
+#include "SWGErrorResponse.h"
+
+#include "webapi/webapiadapterinterface.h"
+#include "webapi/webapirequestmapper.h"
+#include "wsreports.h"
+
+WSReports::WSReports(WebAPIRequestMapper *requestMapper, QObject *parent) :
+    QObject(parent),
+    m_requestMapper(requestMapper),
+    m_listeningAddress(QHostAddress::LocalHost),
+    m_port(8093),
+    m_webSocketServer(nullptr)
+{
+    m_timer.setInterval(m_minIntervalMs);
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+}
+
+WSReports::~WSReports()
+{
+    m_timer.stop();
+    closeSocket();
+}
+
+void WSReports::openSocket()
+{
+    m_webSocketServer = new QWebSocketServer(
+        QStringLiteral("Reports Server"),
+        QWebSocketServer::NonSecureMode,
+        this);
+
+    if (m_webSocketServer->listen(m_listeningAddress, m_port))
+    {
+        qDebug() << "WSReports::openSocket: reports server listening at " << m_listeningAddress.toString() << " on port " << m_port;
+        connect(m_webSocketServer, &QWebSocketServer::newConnection, this, &WSReports::onNewConnection);
+    }
+    else
+    {
+        qInfo("WSReports::openSocket: cannot start reports server at %s on port %u", qPrintable(m_listeningAddress.toString()), m_port);
+    }
+}
+
+void WSReports::closeSocket()
+{
+    if (m_webSocketServer)
+    {
+        qDebug() << "WSReports::closeSocket: stopping reports server listening at " << m_listeningAddress.toString() << " on port " << m_port;
+        delete m_webSocketServer;
+        m_webSocketServer = nullptr;
+    }
+}
+
+bool WSReports::socketOpened() const
+{
+    return m_webSocketServer && m_webSocketServer->isListening();
+}
+
+void WSReports::setListeningAddress(const QString& address)
+{
+    if (address == "127.0.0.1") {
+        m_listeningAddress.setAddress(QHostAddress::LocalHost);
+    } else if (address == "0.0.0.0") {
+        m_listeningAddress.setAddress(QHostAddress::Any);
+    } else {
+        m_listeningAddress.setAddress(address);
+    }
+}
+
+QHostAddress WSReports::getListeningAddress() const
+{
+    if (m_webSocketServer) {
+        return m_webSocketServer->serverAddress();
+    } else {
+        return QHostAddress::Null;
+    }
+}
+
+uint16_t WSReports::getListeningPort() const
+{
+    if (m_webSocketServer) {
+        return m_webSocketServer->serverPort();
+    } else {
+        return 0;
+    }
+}
+
+QString WSReports::getWebSocketIdentifier(QWebSocket *peer)
+{
+    return QStringLiteral("%1:%2").arg(peer->peerAddress().toString(), QString::number(peer->peerPort()));
+}
+
+void WSReports::onNewConnection()
+{
+    auto pSocket = m_webSocketServer->nextPendingConnection();
+    qDebug() << "WSReports::onNewConnection: " << getWebSocketIdentifier(pSocket) << " connected";
+    pSocket->setParent(this);
+
+    connect(pSocket, &QWebSocket::textMessageReceived, this, &WSReports::processClientMessage);
+    connect(pSocket, &QWebSocket::disconnected, this, &WSReports::socketDisconnected);
+    connect(pSocket, &QWebSocket::bytesWritten, this, &WSReports::socketBytesWritten);
+
+    m_clients << pSocket;
+    m_clientSettings.insert(pSocket, ClientSettings());
+}
+
+void WSReports::processClientMessage(const QString &message)
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (!pClient || !m_clientSettings.contains(pClient)) {
+        return;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if (doc.isNull() || !doc.isObject())
+    {
+        qWarning("WSReports::processClientMessage: %s: invalid JSON message: %s",
+            qPrintable(getWebSocketIdentifier(pClient)), qPrintable(error.errorString()));
+        return;
+    }
+
+    QJsonObject jsonObject = doc.object();
+    ClientSettings& settings = m_clientSettings[pClient];
+
+    if (jsonObject.contains("format"))
+    {
+        QString format = jsonObject["format"].toString();
+
+        if (format == "json") {
+            settings.m_cbor = false;
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+        } else if (format == "cbor") {
+            settings.m_cbor = true;
+#endif
+        } else {
+            qWarning("WSReports::processClientMessage: unsupported format: %s", qPrintable(format));
+        }
+    }
+    if (jsonObject.contains("maxRate"))
+    {
+        double maxRate = jsonObject["maxRate"].toDouble();
+
+        if (maxRate > 0.0)
+        {
+            int intervalMs = 1000.0 / maxRate < m_maxIntervalMs ? (int) (1000.0 / maxRate) : m_maxIntervalMs;
+            settings.m_intervalMs = intervalMs < m_minIntervalMs ? m_minIntervalMs : intervalMs;
+        }
+        else
+        {
+            qWarning("WSReports::processClientMessage: invalid maxRate: %f", maxRate);
+        }
+    }
+    if (jsonObject.contains("unsubscribe"))
+    {
+        QJsonArray topics = jsonObject["unsubscribe"].toArray();
+
+        for (const QJsonValue& value : topics)
+        {
+            QString topic;
+
+            if (value.toString() == "*") {
+                settings.m_topics.clear();
+            } else if (parseTopic(value.toString(), topic)) {
+                settings.m_topics.remove(topic);
+            }
+        }
+    }
+    if (jsonObject.contains("subscribe"))
+    {
+        QJsonArray topics = jsonObject["subscribe"].toArray();
+
+        for (const QJsonValue& value : topics)
+        {
+            QString topic;
+
+            if (!parseTopic(value.toString(), topic))
+            {
+                QJsonObject errorMessage;
+                errorMessage.insert("type", "error");
+                errorMessage.insert("topic", value.toString());
+                errorMessage.insert("status", 400);
+                errorMessage.insert("message", "Invalid topic");
+                sendMessage(pClient, settings, errorMessage);
+            }
+            else if (!settings.m_topics.contains(topic))
+            {
+                if (settings.m_topics.size() < m_maxTopics) {
+                    settings.m_topics.insert(topic, TopicState());
+                } else {
+                    qWarning("WSReports::processClientMessage: %s: too many topics", qPrintable(getWebSocketIdentifier(pClient)));
+                }
+            }
+        }
+    }
+    if (jsonObject["resync"].toBool())
+    {
+        for (TopicState& state : settings.m_topics) {
+            state = TopicState();
+        }
+    }
+
+    settings.m_sentTimer.invalidate(); // new topics get their first update at the next tick
+    sendSubscriptions(pClient, settings);
+    updateTimer();
+}
+
+void WSReports::socketDisconnected()
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+    qDebug() << getWebSocketIdentifier(pClient) << " disconnected";
+
+    if (pClient)
+    {
+        m_clients.removeAll(pClient);
+        m_clientSettings.remove(pClient);
+        pClient->deleteLater();
+    }
+
+    updateTimer();
+}
+
+void WSReports::socketBytesWritten(qint64 bytes)
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+    QHash<QWebSocket*, ClientSettings>::iterator it = m_clientSettings.find(pClient);
+
+    if (it != m_clientSettings.end()) {
+        it->m_bytesPending = std::max((qint64) 0, it->m_bytesPending - bytes);
+    }
+}
+
+void WSReports::updateTimer()
+{
+    bool subscribed = false;
+
+    for (const ClientSettings& settings : qAsConst(m_clientSettings))
+    {
+        if (!settings.m_topics.isEmpty())
+        {
+            subscribed = true;
+            break;
+        }
+    }
+
+    if (subscribed && !m_timer.isActive()) {
+        m_timer.start();
+    } else if (!subscribed && m_timer.isActive()) {
+        m_timer.stop();
+    }
+}
+
+void WSReports::tick()
+{
+    QHash<QString, Report> reports; // each report is obtained once per tick whatever the number of subscribers
+    const QList<QWebSocket*> clients = m_clients;
+
+    for (QWebSocket *pClient : clients)
+    {
+        if (!m_clientSettings.contains(pClient)) {
+            continue;
+        }
+
+        ClientSettings& settings = m_clientSettings[pClient];
+
+        if (settings.m_topics.isEmpty()) {
+            continue;
+        }
+
+        // Tolerate half a tick of jitter so that the rate matches the one requested
+        if (settings.m_sentTimer.isValid() && (settings.m_sentTimer.elapsed() < settings.m_intervalMs - m_minIntervalMs/2)) {
+            continue;
+        }
+
+        // Slow client: changes accumulate against the last report sent until its socket has drained
+        if (settings.m_bytesPending > m_maxBytesPending) {
+            continue;
+        }
+
+        settings.m_sentTimer.start();
+
+        for (QMap<QString, TopicState>::iterator it = settings.m_topics.begin(); it != settings.m_topics.end(); ++it)
+        {
+            QHash<QString, Report>::iterator reportIt = reports.find(it.key());
+
+            if (reportIt == reports.end())
+            {
+                reportIt = reports.insert(it.key(), Report());
+                getReport(it.key(), *reportIt);
+            }
+
+            const Report& report = *reportIt;
+            TopicState& state = it.value();
+
+            if (report.m_status == 0) { // changes are sent at the next update
+                continue;
+            }
+
+            if (report.m_status/100 != 2)
+            {
+                if (report.m_status != state.m_status)
+                {
+                    QJsonObject errorMessage;
+                    errorMessage.insert("type", "error");
+                    errorMessage.insert("topic", it.key());
+                    errorMessage.insert("status", report.m_status);
+                    errorMessage.insert("message", report.m_message);
+                    sendMessage(pClient, settings, errorMessage);
+                    state.m_status = report.m_status;
+                    state.m_report = QJsonObject();
+                }
+
+                continue;
+            }
+
+            bool full = state.m_status/100 != 2;
+            QJsonObject changes;
+            QJsonArray removed;
+
+            if (full) {
+                changes = report.m_report;
+            } else if (!diffReports(state.m_report, report.m_report, changes, removed, QString())) {
+                continue;
+            }
+
+            state.m_status = report.m_status;
+            state.m_report = report.m_report;
+            state.m_seq++;
+
+            QJsonObject updateMessage;
+            updateMessage.insert("type", "report");
+            updateMessage.insert("topic", it.key());
+            updateMessage.insert("seq", (double) state.m_seq);
+            updateMessage.insert("full", full);
+            updateMessage.insert("report", changes);
+
+            if (!removed.isEmpty()) {
+                updateMessage.insert("removed", removed);
+            }
+
+            sendMessage(pClient, settings, updateMessage);
+        }
+    }
+}
+
+bool WSReports::parseTopic(const QString& topic, QString& normalized)
+{
+    QStringList parts = topic.split('/', QString::SkipEmptyParts);
+    bool ok0 = false, ok1 = true;
+    int setIndex = parts.size() > 1 ? parts.at(1).toInt(&ok0) : -1;
+    int itemIndex = parts.size() > 3 ? parts.at(3).toInt(&ok1) : 0;
+
+    if (!ok0 || !ok1 || (setIndex < 0) || (setIndex >= WebAPIRequestMapper::getMaxSetIndex()) || (itemIndex < 0)) {
+        return false;
+    }
+
+    if ((parts.size() == 3) && (parts.at(0) == "deviceset") && (parts.at(2) == "device"))
+    {
+        normalized = QString("deviceset/%1/device").arg(setIndex);
+        return true;
+    }
+    else if ((parts.size() == 4) && (parts.at(0) == "deviceset") && (parts.at(2) == "channel"))
+    {
+        normalized = QString("deviceset/%1/channel/%2").arg(setIndex).arg(itemIndex);
+        return true;
+    }
+    else if ((parts.size() == 4) && (parts.at(0) == "featureset") && (parts.at(2) == "feature"))
+    {
+        normalized = QString("featureset/%1/feature/%2").arg(setIndex).arg(itemIndex);
+        return true;
+    }
+
+    return false;
+}
+
+void WSReports::getReport(const QString& topic, Report& report)
+{
+    QStringList parts = topic.split('/');
+    int setIndex = parts.at(1).toInt();
+    bool featureSet = parts.at(0) == "featureset";
+    WebAPIAdapterInterface *adapter = m_requestMapper->getAdapter();
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    QJsonObject *jsonObject = nullptr;
+
+    // the main thread must not wait for a request changing the set
+    if (featureSet ? !m_requestMapper->tryLockFeatureSetForRead(setIndex) : !m_requestMapper->tryLockDeviceSetForRead(setIndex))
+    {
+        report.m_status = 0;
+        return;
+    }
+
+    if (parts.at(2) == "device")
+    {
+        SWGSDRangel::SWGDeviceReport response;
+        report.m_status = adapter->devicesetDeviceReportGet(setIndex, response, errorResponse);
+
+        if (report.m_status/100 == 2) {
+            jsonObject = response.asJsonObject();
+        }
+    }
+    else if (parts.at(2) == "channel")
+    {
+        SWGSDRangel::SWGChannelReport response;
+        report.m_status = adapter->devicesetChannelReportGet(setIndex, parts.at(3).toInt(), response, errorResponse);
+
+        if (report.m_status/100 == 2) {
+            jsonObject = response.asJsonObject();
+        }
+    }
+    else
+    {
+        SWGSDRangel::SWGFeatureReport response;
+        report.m_status = adapter->featuresetFeatureReportGet(setIndex, parts.at(3).toInt(), response, errorResponse);
+
+        if (report.m_status/100 == 2) {
+            jsonObject = response.asJsonObject();
+        }
+    }
+
+    if (featureSet) {
+        m_requestMapper->unlockFeatureSet(setIndex);
+    } else {
+        m_requestMapper->unlockDeviceSet(setIndex);
+    }
+
+    if (jsonObject)
+    {
+        report.m_report = *jsonObject;
+        delete jsonObject;
+    }
+    else if (errorResponse.getMessage())
+    {
+        report.m_message = *errorResponse.getMessage();
+    }
+}
+
+bool WSReports::diffReports(const QJsonObject& previous, const QJsonObject& current, QJsonObject& changes, QJsonArray& removed, const QString& path)
+{
+    bool changed = false;
+
+    for (QJsonObject::const_iterator it = current.begin(); it != current.end(); ++it)
+    {
+        QJsonValue previousValue = previous.value(it.key());
+
+        if (previousValue == it.value()) {
+            continue;
+        }
+
+        if (previousValue.isObject() && it.value().isObject())
+        {
+            QJsonObject objectChanges;
+            diffReports(previousValue.toObject(), it.value().toObject(), objectChanges, removed, path + it.key() + ".");
+
+            if (!objectChanges.isEmpty()) { // only deeper keys were removed
+                changes.insert(it.key(), objectChanges);
+            }
+        }
+        else
+        {
+            changes.insert(it.key(), it.value());
+        }
+
+        changed = true;
+    }
+
+    for (QJsonObject::const_iterator it = previous.begin(); it != previous.end(); ++it)
+    {
+        if (!current.contains(it.key()))
+        {
+            removed.append(path + it.key());
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void WSReports::sendSubscriptions(QWebSocket *client, ClientSettings& settings)
+{
+    QJsonObject message;
+    message.insert("type", "subscriptions");
+    message.insert("topics", QJsonArray::fromStringList(settings.m_topics.keys()));
+    message.insert("intervalMs", settings.m_intervalMs);
+    message.insert("format", settings.m_cbor ? "cbor" : "json");
+    sendMessage(client, settings, message);
+}
+
+void WSReports::sendMessage(QWebSocket *client, ClientSettings& settings, const QJsonObject& message)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 12, 0)
+    if (settings.m_cbor)
+    {
+        settings.m_bytesPending += client->sendBinaryMessage(QCborValue::fromJsonValue(message).toCbor());
+        return;
+    }
+#endif
+
+    settings.m_bytesPending += client->sendTextMessage(QString::fromUtf8(QJsonDocument(message).toJson(QJsonDocument::Compact)));
+}
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2026 agent <agent@local>                                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBSOCKETS_WSREPORTS_H_
+#define SDRBASE_WEBSOCKETS_WSREPORTS_H_
+
+#include <QObject>
+#include <QList>
+#include <QHash>
+#include <QMap>
+#include <QByteArray>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QTimer>
+
+#include "export.h"
+
+class QWebSocketServer;
+class QWebSocket;
+class WebAPIRequestMapper;
+
+/**
+ * Pushes device, channel and feature reports to WebSocket clients.
+ * Clients subscribe to topics named after the REST report paths
+ * (deviceset/{i}/device, deviceset/{i}/channel/{j}, featureset/{i}/feature/{j})
+ * and receive only the report values that changed since their last update.
+ * Reports are obtained through the Web API adapter in the main thread under the read
+ * locks of the request mapper as for a GET request.
+ */
+class SDRBASE_API WSReports : public QObject
+{
+    Q_OBJECT
+public:
+    explicit WSReports(WebAPIRequestMapper *requestMapper, QObject *parent = nullptr);
+    ~WSReports() override;
+
+    void openSocket();
+    void closeSocket();
+    bool socketOpened() const;
+    void setListeningAddress(const QString& address);
+    void setPort(quint16 port) { m_port = port; }
+    QHostAddress getListeningAddress() const;
+    uint16_t getListeningPort() const;
+
+private slots:
+    void onNewConnection();
+    void processClientMessage(const QString &message);
+    void socketDisconnected();
+    void socketBytesWritten(qint64 bytes);
+    void tick();
+
+private:
+    struct TopicState //!< What was last sent to a client for a topic
+    {
+        QJsonObject m_report; //!< Last report sent as reference for the changes
+        int m_status;         //!< Last HTTP like status: 0 before the first update
+        qint64 m_seq;         //!< Sequence number of the last update
+
+        TopicState() :
+            m_status(0),
+            m_seq(0)
+        {}
+    };
+
+    struct ClientSettings //!< Set by the client with a JSON text message
+    {
+        QMap<QString, TopicState> m_topics;
+        int m_intervalMs;     //!< Minimum time between updates
+        bool m_cbor;          //!< CBOR binary messages instead of JSON text messages
+        QElapsedTimer m_sentTimer;
+        qint64 m_bytesPending; //!< Sent but not yet written to the network
+
+        ClientSettings() :
+            m_intervalMs(m_defaultIntervalMs),
+            m_cbor(false),
+            m_bytesPending(0)
+        {}
+    };
+
+    struct Report //!< Report obtained for a topic in one tick
+    {
+        QJsonObject m_report;
+        QString m_message;
+        int m_status;         //!< 0 if the set is being changed by a request: try again at the next update
+    };
+
+    WebAPIRequestMapper *m_requestMapper;
+    QHostAddress m_listeningAddress;
+    quint16 m_port;
+    QWebSocketServer* m_webSocketServer;
+    QList<QWebSocket*> m_clients;
+    QHash<QWebSocket*, ClientSettings> m_clientSettings;
+    QTimer m_timer;
+
+    static const int m_defaultIntervalMs = 1000;
+    static const int m_minIntervalMs = 50;       //!< Fastest update rate is 20 per second
+    static const int m_maxIntervalMs = 60000;
+    static const int m_maxTopics = 1000;         //!< Per client
+    static const qint64 m_maxBytesPending = 1<<20; //!< Updates are held back for a client with more than this in its socket
+
+    static QString getWebSocketIdentifier(QWebSocket *peer);
+    static bool parseTopic(const QString& topic, QString& normalized);
+    static bool diffReports(const QJsonObject& previous, const QJsonObject& current, QJsonObject& changes, QJsonArray& removed, const QString& path);
+    void getReport(const QString& topic, Report& report);
+    void sendMessage(QWebSocket *client, ClientSettings& settings, const QJsonObject& message);
+    void sendSubscriptions(QWebSocket *client, ClientSettings& settings);
+    void updateTimer();
+};
+
+#endif // SDRBASE_WEBSOCKETS_WSREPORTS_H_
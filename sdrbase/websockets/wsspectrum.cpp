@@ -17,8 +17,13 @@
 
 #include <QtWebSockets>
 #include <QHostAddress>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QDebug>
 
+#include <cmath>
+#include <algorithm>
+
 #include "util/timeutil.h"
 #include "wsspectrum.h"
 
@@ -114,13 +119,76 @@ void WSSpectrum::onNewConnection()
 
     connect(pSocket, &QWebSocket::textMessageReceived, this, &WSSpectrum::processClientMessage);
     connect(pSocket, &QWebSocket::disconnected, this, &WSSpectrum::socketDisconnected);
+    connect(pSocket, &QWebSocket::bytesWritten, this, &WSSpectrum::socketBytesWritten);
 
     m_clients << pSocket;
+    m_clientSettings.insert(pSocket, ClientSettings());
 }
 
 void WSSpectrum::processClientMessage(const QString &message)
 {
-     qDebug() << "WSSpectrum::processClientMessage: " << message;
+    qDebug() << "WSSpectrum::processClientMessage: " << message;
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (!pClient || !m_clientSettings.contains(pClient)) {
+        return;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if (doc.isNull() || !doc.isObject())
+    {
+        qWarning("WSSpectrum::processClientMessage: %s: invalid JSON message: %s",
+            qPrintable(getWebSocketIdentifier(pClient)), qPrintable(error.errorString()));
+        return;
+    }
+
+    QJsonObject jsonObject = doc.object();
+    ClientSettings& settings = m_clientSettings[pClient];
+    settings.m_extended = true;
+
+    if (jsonObject.contains("format"))
+    {
+        QString format = jsonObject["format"].toString();
+
+        if (format == "float") {
+            settings.m_quantized = false;
+        } else if (format == "db8") {
+            settings.m_quantized = true;
+        } else {
+            qWarning("WSSpectrum::processClientMessage: unknown format: %s", qPrintable(format));
+        }
+    }
+    if (jsonObject.contains("delta")) {
+        settings.m_delta = jsonObject["delta"].toBool();
+    }
+    if (jsonObject.contains("compress")) {
+        settings.m_compress = jsonObject["compress"].toBool();
+    }
+    if (jsonObject.contains("maxFps"))
+    {
+        double maxFps = jsonObject["maxFps"].toDouble();
+        settings.m_minIntervalMs = maxFps > 0.0 ? (int) (1000.0 / maxFps) : 0;
+    }
+    if (jsonObject.contains("firstBin")) {
+        settings.m_firstBin = std::max(0, jsonObject["firstBin"].toInt());
+    }
+    if (jsonObject.contains("nbBins")) {
+        settings.m_nbBins = std::max(0, jsonObject["nbBins"].toInt());
+    }
+    if (jsonObject.contains("dbMin")) {
+        settings.m_dbMin = jsonObject["dbMin"].toDouble();
+    }
+    if (jsonObject.contains("dbMax")) {
+        settings.m_dbMax = jsonObject["dbMax"].toDouble();
+    }
+
+    if (settings.m_dbMax <= settings.m_dbMin) {
+        settings.m_dbMax = settings.m_dbMin + 1.0f;
+    }
+
+    settings.m_previous.clear(); // next frame is a full frame
 }
 
 void WSSpectrum::socketDisconnected()
@@ -131,10 +199,21 @@ void WSSpectrum::socketDisconnected()
     if (pClient)
     {
         m_clients.removeAll(pClient);
+        m_clientSettings.remove(pClient);
         pClient->deleteLater();
     }
 }
 
+void WSSpectrum::socketBytesWritten(qint64 bytes)
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+    QHash<QWebSocket*, ClientSettings>::iterator it = m_clientSettings.find(pClient);
+
+    if (it != m_clientSettings.end()) {
+        it->m_bytesPending = std::max((qint64) 0, it->m_bytesPending - bytes); // written bytes include the frame headers
+    }
+}
+
 QHostAddress WSSpectrum::getListeningAddress() const
 {
     if (m_webSocketServer) {
@@ -186,9 +265,122 @@ void WSSpectrum::newSpectrum(
 void WSSpectrum::sendPayload(const QByteArray& payload)
 {
     //qDebug() << "WSSpectrum::sendPayload: " << payload.size() << " bytes";
-    for (QWebSocket *pClient : qAsConst(m_clients)) {
-        pClient->sendBinaryMessage(payload);
+    for (QWebSocket *pClient : qAsConst(m_clients))
+    {
+        ClientSettings& settings = m_clientSettings[pClient];
+
+        // Slow client: drop frames until its socket has drained
+        if ((settings.m_lastFrameSize > 0) && (settings.m_bytesPending > m_maxFramesPending * settings.m_lastFrameSize)) {
+            continue;
+        }
+
+        if ((settings.m_minIntervalMs > 0) && settings.m_sentTimer.isValid() && (settings.m_sentTimer.elapsed() < settings.m_minIntervalMs)) {
+            continue;
+        }
+
+        QByteArray frame;
+
+        if (!settings.m_extended) {
+            frame = payload;
+        } else if (!encodeFrame(payload, settings, frame)) {
+            continue;
+        }
+
+        settings.m_sentTimer.start();
+        settings.m_lastFrameSize = frame.size();
+        settings.m_bytesPending += pClient->sendBinaryMessage(frame);
+    }
+}
+
+bool WSSpectrum::encodeFrame(const QByteArray& payload, ClientSettings& settings, QByteArray& frame)
+{
+    if (payload.size() < m_legacyHeaderSize) {
+        return false;
     }
+
+    const char *data = payload.constData();
+    int fftSize = *((const int*) (data + 24));
+    int indicators = *((const int*) (data + 32));
+    const Real *spectrum = (const Real*) (data + m_legacyHeaderSize);
+
+    if ((fftSize <= 0) || (payload.size() < m_legacyHeaderSize + fftSize * (int) sizeof(Real))) {
+        return false;
+    }
+
+    int firstBin = std::min(settings.m_firstBin, fftSize - 1);
+    int nbBins = fftSize - firstBin;
+
+    if (settings.m_nbBins > 0) {
+        nbBins = std::min(settings.m_nbBins, nbBins);
+    }
+
+    QByteArray values;
+    float dbStep = 0.0f;
+    bool delta = false;
+
+    if (settings.m_quantized)
+    {
+        bool linear = (indicators & 1) != 0;
+        dbStep = (settings.m_dbMax - settings.m_dbMin) / 255.0f;
+        QByteArray quantized(nbBins, 0);
+        unsigned char *q = (unsigned char*) quantized.data();
+
+        for (int i = 0; i < nbBins; i++)
+        {
+            float db = linear ? 10.0f * log10f(std::max(spectrum[firstBin + i], (Real) 1e-20)) : spectrum[firstBin + i];
+            int level = (int) std::round((db - settings.m_dbMin) / dbStep);
+            q[i] = level < 0 ? 0 : level > 255 ? 255 : level;
+        }
+
+        delta = settings.m_delta
+            && (settings.m_previous.size() == nbBins)
+            && (settings.m_framesSinceKey < m_keyFrameInterval);
+
+        if (delta)
+        {
+            values.resize(nbBins);
+            unsigned char *d = (unsigned char*) values.data();
+            const unsigned char *p = (const unsigned char*) settings.m_previous.constData();
+
+            for (int i = 0; i < nbBins; i++) {
+                d[i] = q[i] - p[i]; // modulo 256
+            }
+
+            settings.m_framesSinceKey++;
+        }
+        else
+        {
+            values = quantized;
+            settings.m_framesSinceKey = 0;
+        }
+
+        if (settings.m_delta) {
+            settings.m_previous = quantized;
+        }
+    }
+    else
+    {
+        values = QByteArray((const char*) &spectrum[firstBin], nbBins * sizeof(Real));
+    }
+
+    if (settings.m_compress) {
+        values = qCompress(values, 1); // fastest level as each client is compressed separately
+    }
+
+    indicators |= 8
+        + (settings.m_quantized ? 16 : 0)
+        + (delta ? 32 : 0)
+        + (settings.m_compress ? 64 : 0);
+
+    frame.reserve(m_extendedHeaderSize + values.size());
+    frame.append(data, 32);                                    // 0: same as legacy header up to indicators
+    frame.append((const char*) &indicators, sizeof(int));      // 32
+    frame.append((const char*) &firstBin, sizeof(int));        // 36
+    frame.append((const char*) &nbBins, sizeof(int));          // 40
+    frame.append((const char*) &settings.m_dbMin, sizeof(float)); // 44
+    frame.append((const char*) &dbStep, sizeof(float));        // 48
+    frame.append(values);                                      // 52
+    return true;
 }
 
 void WSSpectrum::buildPayload(
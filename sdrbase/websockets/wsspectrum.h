@@ -22,6 +22,8 @@
 
 #include <QObject>
 #include <QList>
+#include <QHash>
+#include <QByteArray>
 #include <QElapsedTimer>
 #include <QHostAddress>
 
@@ -64,16 +66,57 @@ private slots:
     void onNewConnection();
     void processClientMessage(const QString &message);
     void socketDisconnected();
+    void socketBytesWritten(qint64 bytes);
     void sendPayload(const QByteArray& payload);
 
 private:
+    struct ClientSettings //!< Set by the client with a JSON text message
+    {
+        bool m_extended;      //!< Extended header. False for legacy float frames of the whole spectrum
+        bool m_quantized;     //!< 8 bit dB values instead of floats
+        bool m_delta;         //!< Quantized values as difference with the previous frame sent
+        bool m_compress;      //!< zlib compressed values
+        int m_minIntervalMs;  //!< Minimum time between frames (0: no rate cap)
+        int m_firstBin;       //!< First FFT bin sent
+        int m_nbBins;         //!< Number of FFT bins sent (0: up to the last one)
+        float m_dbMin;        //!< dB value of quantized 0
+        float m_dbMax;        //!< dB value of quantized 255
+        QElapsedTimer m_sentTimer;
+        qint64 m_bytesPending;  //!< Sent but not yet written to the network
+        int m_lastFrameSize;
+        int m_framesSinceKey;   //!< Delta frames since the last full frame
+        QByteArray m_previous;  //!< Last quantized frame sent as reference for delta frames
+
+        ClientSettings() :
+            m_extended(false),
+            m_quantized(false),
+            m_delta(false),
+            m_compress(false),
+            m_minIntervalMs(0),
+            m_firstBin(0),
+            m_nbBins(0),
+            m_dbMin(-150.0f),
+            m_dbMax(0.0f),
+            m_bytesPending(0),
+            m_lastFrameSize(0),
+            m_framesSinceKey(0)
+        {}
+    };
+
     QHostAddress m_listeningAddress;
     quint16 m_port;
     QWebSocketServer* m_webSocketServer;
     QList<QWebSocket*> m_clients;
+    QHash<QWebSocket*, ClientSettings> m_clientSettings;
     QElapsedTimer m_timer;
 
+    static const int m_legacyHeaderSize = 36;
+    static const int m_extendedHeaderSize = 52;
+    static const int m_maxFramesPending = 2;  //!< Frames are dropped for a client with more than this number of frames in its socket
+    static const int m_keyFrameInterval = 100; //!< A full frame is sent after this number of delta frames
+
     static QString getWebSocketIdentifier(QWebSocket *peer);
+    static bool encodeFrame(const QByteArray& payload, ClientSettings& settings, QByteArray& frame);
     void buildPayload(
         QByteArray& bytes,
         const std::vector<Real>& spectrum,
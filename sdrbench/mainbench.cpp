@@ -87,30 +87,41 @@ void MainBench::testDecimateII(ParserBench::TestType testType)
 
     qDebug() << "MainBench::testDecimateII: run test";
 
-    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    std::vector<CPUFeatures::SIMDLevel> simdLevels;
+    getSIMDLevels(simdLevels);
+
+    for (auto simdLevel : simdLevels)
     {
-        switch (testType)
+        CPUFeatures::setSIMDLevel(simdLevel);
+        nsecs = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
         {
-        case ParserBench::TestDecimatorsInfII:
-            timer.start();
-            decimateInfII(buf, m_parser.getNbSamples()*2);
-            nsecs += timer.nsecsElapsed();
-            break;
-        case ParserBench::TestDecimatorsSupII:
-            timer.start();
-            decimateSupII(buf, m_parser.getNbSamples()*2);
-            nsecs += timer.nsecsElapsed();
-            break;
-        case ParserBench::TestDecimatorsII:
-        default:
-            timer.start();
-            decimateII(buf, m_parser.getNbSamples()*2);
-            nsecs += timer.nsecsElapsed();
-            break;
+            switch (testType)
+            {
+            case ParserBench::TestDecimatorsInfII:
+                timer.start();
+                decimateInfII(buf, m_parser.getNbSamples()*2);
+                nsecs += timer.nsecsElapsed();
+                break;
+            case ParserBench::TestDecimatorsSupII:
+                timer.start();
+                decimateSupII(buf, m_parser.getNbSamples()*2);
+                nsecs += timer.nsecsElapsed();
+                break;
+            case ParserBench::TestDecimatorsII:
+            default:
+                timer.start();
+                decimateII(buf, m_parser.getNbSamples()*2);
+                nsecs += timer.nsecsElapsed();
+                break;
+            }
         }
+
+        printResults(QString("MainBench::testDecimateII (%1)").arg(CPUFeatures::getSIMDLevelName(simdLevel)), nsecs);
     }
 
-    printResults("MainBench::testDecimateII", nsecs);
+    CPUFeatures::setSIMDLevel(CPUFeatures::getDetectedSIMDLevel());
 
     qDebug() << "MainBench::testDecimateII: cleanup test data";
     delete[] buf;
@@ -157,14 +168,25 @@ void MainBench::testDecimateFI()
 
     qDebug() << "MainBench::testDecimateFI: run test";
 
-    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    std::vector<CPUFeatures::SIMDLevel> simdLevels;
+    getSIMDLevels(simdLevels);
+
+    for (auto simdLevel : simdLevels)
     {
-        timer.start();
-        decimateFI(buf, m_parser.getNbSamples()*2);
-        nsecs += timer.nsecsElapsed();
+        CPUFeatures::setSIMDLevel(simdLevel);
+        nsecs = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+            decimateFI(buf, m_parser.getNbSamples()*2);
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("MainBench::testDecimateFI (%1)").arg(CPUFeatures::getSIMDLevelName(simdLevel)), nsecs);
     }
 
-    printResults("MainBench::testDecimateFI", nsecs);
+    CPUFeatures::setSIMDLevel(CPUFeatures::getDetectedSIMDLevel());
 
     qDebug() << "MainBench::testDecimateFI: cleanup test data";
     delete[] buf;
@@ -184,14 +206,25 @@ void MainBench::testDecimateFF()
 
     qDebug() << "MainBench::testDecimateFF: run test";
 
-    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    std::vector<CPUFeatures::SIMDLevel> simdLevels;
+    getSIMDLevels(simdLevels);
+
+    for (auto simdLevel : simdLevels)
     {
-        timer.start();
-        decimateFF(buf, m_parser.getNbSamples()*2);
-        nsecs += timer.nsecsElapsed();
+        CPUFeatures::setSIMDLevel(simdLevel);
+        nsecs = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+            decimateFF(buf, m_parser.getNbSamples()*2);
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("MainBench::testDecimateFF (%1)").arg(CPUFeatures::getSIMDLevelName(simdLevel)), nsecs);
     }
 
-    printResults("MainBench::testDecimateFF", nsecs);
+    CPUFeatures::setSIMDLevel(CPUFeatures::getDetectedSIMDLevel());
 
     qDebug() << "MainBench::testDecimateFF: cleanup test data";
     delete[] buf;
@@ -409,3 +442,17 @@ void MainBench::printResults(const QString& prefix, qint64 nsecs)
     info.noquote();
     info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s").arg(prefix).arg(nsecs).arg(ratekSs);
 }
+
+void MainBench::getSIMDLevels(std::vector<CPUFeatures::SIMDLevel>& levels)
+{
+    levels.clear();
+    levels.push_back(CPUFeatures::SIMDNone);
+
+    if (CPUFeatures::getDetectedSIMDLevel() == CPUFeatures::SIMDAVX2) {
+        levels.push_back(CPUFeatures::SIMDSSE2);
+    }
+
+    if (CPUFeatures::getDetectedSIMDLevel() != CPUFeatures::SIMDNone) {
+        levels.push_back(CPUFeatures::getDetectedSIMDLevel());
+    }
+}
@@ -28,6 +28,7 @@
 #include "dsp/decimatorsif.h"
 #include "dsp/decimatorsfi.h"
 #include "dsp/decimatorsff.h"
+#include "dsp/cpufeatures.h"
 #include "parserbench.h"
 #include "export.h"
 
@@ -62,6 +63,7 @@ private:
     void decimateFI(const float *buf, int len);
     void decimateFF(const float *buf, int len);
     void printResults(const QString& prefix, qint64 nsecs);
+    void getSIMDLevels(std::vector<CPUFeatures::SIMDLevel>& levels); //!< scalar then available SIMD levels
 
     static MainBench *m_instance;
     qtwebapp::LoggerWithFile *m_logger;
@@ -42,6 +42,7 @@ const GLfloat GLScope::m_q3RadiiConst[] = {
 GLScope::GLScope(QWidget *parent) : QGLWidget(parent),
     m_tracesData(nullptr),
     m_traces(nullptr),
+    m_displayTraces(nullptr),
     m_projectionTypes(nullptr),
     m_processingTraceIndex(-1),
     m_bufferIndex(0),
@@ -124,9 +125,15 @@ void GLScope::setTraces(std::vector<GLScopeSettings::TraceData> *tracesData, std
 {
     m_tracesData = tracesData;
     m_traces = traces;
+    m_displayTraces = nullptr;
 }
 
-void GLScope::newTraces(std::vector<float *> *traces, int traceIndex, std::vector<Projector::ProjectionType> *projectionTypes)
+void GLScope::newTraces(
+    std::vector<float *> *traces,
+    int traceIndex,
+    std::vector<Projector::ProjectionType> *projectionTypes,
+    GLScopeDisplayTraces *displayTraces
+)
 {
     if (traces->size() > 0)
     {
@@ -142,6 +149,7 @@ void GLScope::newTraces(std::vector<float *> *traces, int traceIndex, std::vecto
             m_processingTraceIndex.store(traceIndex);
 #endif
             m_traces = &traces[traceIndex];
+            m_displayTraces = displayTraces ? &displayTraces[traceIndex] : nullptr;
             m_projectionTypes = projectionTypes;
         }
 
@@ -149,6 +157,22 @@ void GLScope::newTraces(std::vector<float *> *traces, int traceIndex, std::vecto
     }
 }
 
+GLfloat *GLScope::getTraceVertices(unsigned int traceIndex, int start, int end, int& nbVertices) const
+{
+    if (m_displayTraces
+        && (traceIndex < m_displayTraces->m_sizes.size())
+        && (m_displayTraces->m_sizes[traceIndex] > 0)
+        && (m_displayTraces->m_start == start)
+        && (m_displayTraces->m_end == end))
+    {
+        nbVertices = m_displayTraces->m_sizes[traceIndex]; // min/max decimated trace
+        return m_displayTraces->m_traces[traceIndex];
+    }
+
+    nbVertices = end - start;
+    return &(*m_traces)[traceIndex][2 * start];
+}
+
 void GLScope::initializeGL()
 {
     QOpenGLContext *glCurrentContext = QOpenGLContext::currentContext();
@@ -344,7 +368,6 @@ void GLScope::paintGL()
         // paint trace #1
         if (m_traceSize > 0)
         {
-            const float *trace = (*m_traces)[0];
             const GLScopeSettings::TraceData &traceData = (*m_tracesData)[0];
 
             if (traceData.m_viewTrace)
@@ -368,7 +391,9 @@ void GLScope::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *)&trace[2 * start], end - start);
+                int nbVertices;
+                GLfloat *vertices = getTraceVertices(0, start, end, nbVertices);
+                m_glShaderSimple.drawPolyline(mat, color, vertices, nbVertices);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -437,7 +462,6 @@ void GLScope::paintGL()
 
             for (unsigned int i = 1; i < m_traces->size(); i++)
             {
-                const float *trace = (*m_traces)[i];
                 const GLScopeSettings::TraceData &traceData = (*m_tracesData)[i];
 
                 if (!traceData.m_viewTrace) {
@@ -456,7 +480,9 @@ void GLScope::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *)&trace[2 * start], end - start);
+                int nbVertices;
+                GLfloat *vertices = getTraceVertices(i, start, end, nbVertices);
+                m_glShaderSimple.drawPolyline(mat, color, vertices, nbVertices);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -678,8 +704,12 @@ void GLScope::paintGL()
 
                 if (i == 1) { // Y1 in rainbow color
                     m_glShaderColors.drawPolyline(mat, (GLfloat *)&trace[2 * start], m_q3Colors.m_array, m_displayTraceIntensity / 100.0f, end - start);
-                } else {
-                    m_glShaderSimple.drawPolyline(mat, color, (GLfloat *)&trace[2 * start], end - start);
+                }
+                else
+                {
+                    int nbVertices;
+                    GLfloat *vertices = getTraceVertices(i, start, end, nbVertices);
+                    m_glShaderSimple.drawPolyline(mat, color, vertices, nbVertices);
                 }
 
                 // Paint trigger level if any
@@ -60,7 +60,12 @@ public:
     void disconnectTimer();
 
     virtual void setTraces(std::vector<GLScopeSettings::TraceData>* tracesData, std::vector<float *>* traces);
-    virtual void newTraces(std::vector<float *>* traces, int traceIndex, std::vector<Projector::ProjectionType>* projectionTypes);
+    virtual void newTraces(
+        std::vector<float *>* traces,
+        int traceIndex,
+        std::vector<Projector::ProjectionType>* projectionTypes,
+        GLScopeDisplayTraces* displayTraces
+    );
 
     int getSampleRate() const { return m_sampleRate; }
     int getTraceSize() const { return m_traceSize; }
@@ -140,6 +145,7 @@ private:
 
     std::vector<GLScopeSettings::TraceData> *m_tracesData;
     std::vector<float *> *m_traces;
+    GLScopeDisplayTraces *m_displayTraces; //!< Traces decimated to display resolution if available
     std::vector<Projector::ProjectionType> *m_projectionTypes;
     QAtomicInt m_processingTraceIndex;
     GLScopeSettings::TriggerData m_focusedTriggerData;
@@ -252,6 +258,7 @@ private:
             || (projectionType == Projector::ProjectionMagSq);
     }
 
+    GLfloat *getTraceVertices(unsigned int traceIndex, int start, int end, int& nbVertices) const; //!< Vertices of trace in display window
     void drawRectGrid2();
     void drawPolarGrid2();
     QString displayScaled(float value, char type, int precision);
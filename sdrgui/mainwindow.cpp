@@ -73,6 +73,7 @@
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
 #include "webapi/webapiadapter.h"
+#include "websockets/wsreports.h"
 #include "commands/command.h"
 
 #include "mainwindow.h"
@@ -100,7 +101,8 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 	m_inputGUI(0),
 	m_sampleRate(0),
 	m_centerFrequency(0),
-	m_sampleFileName(std::string("./test.sdriq"))
+	m_sampleFileName(std::string("./test.sdriq")),
+	m_wsReports(nullptr)
 {
 	qDebug() << "MainWindow::MainWindow: start";
 
@@ -181,6 +183,8 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     splash->showStatusMessage("allocate FFTs...", Qt::white);
     splash->showStatusMessage("allocate FFTs...", Qt::white);
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
+    m_dspEngine->setDispatchThreads(parser.getDispatchThreads());
+    m_dspEngine->setPolyphaseLog2Subbands(parser.getPolyphaseLog2Subbands());
     m_dspEngine->preAllocateFFTs();
 
     splash->showStatusMessage("load settings...", Qt::white);
@@ -193,6 +197,7 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
     m_pluginManager = new PluginManager(this);
     m_mainCore->m_pluginManager = m_pluginManager;
+    m_pluginManager->setSkipDeviceProbe(parser.getSkipDeviceProbe());
     m_pluginManager->loadPlugins(QString("plugins"));
     m_pluginManager->loadPluginsNonDiscoverable(m_mainCore->m_settings.getDeviceUserArgs());
 
@@ -250,6 +255,14 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 	m_apiServer = new WebAPIServer(m_apiHost, m_apiPort, m_requestMapper);
 	m_apiServer->start();
 
+    if (parser.getReportsPort() != 0)
+    {
+        m_wsReports = new WSReports(m_requestMapper, this);
+        m_wsReports->setListeningAddress(m_apiHost);
+        m_wsReports->setPort(parser.getReportsPort());
+        m_wsReports->openSocket();
+    }
+
 	m_commandKeyReceiver = new CommandKeyReceiver();
 	m_commandKeyReceiver->setRelease(true);
 	this->installEventFilter(m_commandKeyReceiver);
@@ -279,6 +292,7 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
 MainWindow::~MainWindow()
 {
+    delete m_wsReports;
     m_apiServer->stop();
     delete m_apiServer;
     delete m_requestMapper;
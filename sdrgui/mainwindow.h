@@ -51,6 +51,7 @@ class QWidget;
 class WebAPIRequestMapper;
 class WebAPIServer;
 class WebAPIAdapter;
+class WSReports;
 class Preset;
 class Command;
 class FeatureSetPreset;
@@ -114,6 +115,7 @@ private:
 	WebAPIRequestMapper *m_requestMapper;
 	WebAPIServer *m_apiServer;
 	WebAPIAdapter *m_apiAdapter;
+	WSReports *m_wsReports;
 	QString m_apiHost;
 	int m_apiPort;
 
@@ -20,6 +20,7 @@
 #include <QDebug>
 #include <QSysInfo>
 #include <QResource>
+#include <QElapsedTimer>
 
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
@@ -34,6 +35,7 @@
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
 #include "webapi/webapiadapter.h"
+#include "websockets/wsreports.h"
 
 #include "mainparser.h"
 #include "mainserver.h"
@@ -43,9 +45,12 @@ MainServer *MainServer::m_instance = 0;
 MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parser, QObject *parent) :
     QObject(parent),
     m_mainCore(MainCore::instance()),
-    m_dspEngine(DSPEngine::instance())
+    m_dspEngine(DSPEngine::instance()),
+    m_wsReports(nullptr)
 {
     qDebug() << "MainServer::MainServer: start";
+    QElapsedTimer startupTimer;
+    startupTimer.start();
 
     m_instance = this;
     m_mainCore->m_logger = logger;
@@ -56,16 +61,22 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
     qDebug() << "MainServer::MainServer: create FFT factory...";
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
+    m_dspEngine->setDispatchThreads(parser.getDispatchThreads());
+    m_dspEngine->setPolyphaseLog2Subbands(parser.getPolyphaseLog2Subbands());
+    qInfo("MainServer::MainServer: FFT factory created at %lld ms", startupTimer.elapsed());
 
     qDebug() << "MainServer::MainServer: load plugins...";
     m_mainCore->m_pluginManager = new PluginManager(this);
+    m_mainCore->m_pluginManager->setSkipDeviceProbe(parser.getSkipDeviceProbe());
     m_mainCore->m_pluginManager->loadPlugins(QString("pluginssrv"));
+    qInfo("MainServer::MainServer: plugins loaded at %lld ms", startupTimer.elapsed());
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleMessages()), Qt::QueuedConnection);
     m_mainCore->m_masterTimer.start(50);
 
     qDebug() << "MainServer::MainServer: load setings...";
 	loadSettings();
+    qInfo("MainServer::MainServer: settings loaded at %lld ms", startupTimer.elapsed());
 
     qDebug() << "MainServer::MainServer: finishing...";
     QString applicationDirPath = QCoreApplication::instance()->applicationDirPath();
@@ -76,9 +87,17 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     m_apiServer = new WebAPIServer(parser.getServerAddress(), parser.getServerPort(), m_requestMapper);
     m_apiServer->start();
 
+    if (parser.getReportsPort() != 0)
+    {
+        m_wsReports = new WSReports(m_requestMapper, this);
+        m_wsReports->setListeningAddress(parser.getServerAddress());
+        m_wsReports->setPort(parser.getReportsPort());
+        m_wsReports->openSocket();
+    }
+
     m_dspEngine->setMIMOSupport(parser.getMIMOSupport());
 
-    qDebug() << "MainServer::MainServer: end";
+    qInfo("MainServer::MainServer: started in %lld ms", startupTimer.elapsed());
 }
 
 MainServer::~MainServer()
@@ -87,6 +106,7 @@ MainServer::~MainServer()
         removeLastDevice();
     }
 
+    delete m_wsReports;
 	m_apiServer->stop();
 	m_mainCore->m_settings.save();
     delete m_apiServer;
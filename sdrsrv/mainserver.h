@@ -40,6 +40,7 @@ class FeatureSet;
 class WebAPIRequestMapper;
 class WebAPIServer;
 class WebAPIAdapter;
+class WSReports;
 
 namespace qtwebapp {
     class LoggerWithFile;
@@ -86,6 +87,7 @@ private:
     WebAPIRequestMapper *m_requestMapper;
     WebAPIServer *m_apiServer;
     WebAPIAdapter *m_apiAdapter;
+    WSReports *m_wsReports;
 
 	void loadSettings();
     void applySettings();
@@ -30,6 +30,8 @@ SWGChannel::SWGChannel(QString* json) {
 SWGChannel::SWGChannel() {
     direction = 0;
     m_direction_isSet = false;
+    device_set_index = 0;
+    m_device_set_index_isSet = false;
     index = 0;
     m_index_isSet = false;
     id = nullptr;
@@ -42,6 +44,8 @@ SWGChannel::SWGChannel() {
     m_delta_frequency_isSet = false;
     report = nullptr;
     m_report_isSet = false;
+    settings = nullptr;
+    m_settings_isSet = false;
 }
 
 SWGChannel::~SWGChannel() {
@@ -52,6 +56,8 @@ void
 SWGChannel::init() {
     direction = 0;
     m_direction_isSet = false;
+    device_set_index = 0;
+    m_device_set_index_isSet = false;
     index = 0;
     m_index_isSet = false;
     id = new QString("");
@@ -64,6 +70,8 @@ SWGChannel::init() {
     m_delta_frequency_isSet = false;
     report = new SWGChannelReport();
     m_report_isSet = false;
+    settings = new SWGChannelSettings();
+    m_settings_isSet = false;
 }
 
 void
@@ -81,6 +89,9 @@ SWGChannel::cleanup() {
     if(report != nullptr) { 
         delete report;
     }
+    if(settings != nullptr) { 
+        delete settings;
+    }
 }
 
 SWGChannel*
@@ -96,6 +107,8 @@ void
 SWGChannel::fromJsonObject(QJsonObject &pJson) {
     ::SWGSDRangel::setValue(&direction, pJson["direction"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&device_set_index, pJson["deviceSetIndex"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&index, pJson["index"], "qint32", "");
     
     ::SWGSDRangel::setValue(&id, pJson["id"], "QString", "QString");
@@ -108,6 +121,8 @@ SWGChannel::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&report, pJson["report"], "SWGChannelReport", "SWGChannelReport");
     
+    ::SWGSDRangel::setValue(&settings, pJson["settings"], "SWGChannelSettings", "SWGChannelSettings");
+    
 }
 
 QString
@@ -127,6 +142,9 @@ SWGChannel::asJsonObject() {
     if(m_direction_isSet){
         obj->insert("direction", QJsonValue(direction));
     }
+    if(m_device_set_index_isSet){
+        obj->insert("deviceSetIndex", QJsonValue(device_set_index));
+    }
     if(m_index_isSet){
         obj->insert("index", QJsonValue(index));
     }
@@ -145,6 +163,9 @@ SWGChannel::asJsonObject() {
     if((report != nullptr) && (report->isSet())){
         toJsonValue(QString("report"), report, obj, QString("SWGChannelReport"));
     }
+    if((settings != nullptr) && (settings->isSet())){
+        toJsonValue(QString("settings"), settings, obj, QString("SWGChannelSettings"));
+    }
 
     return obj;
 }
@@ -159,6 +180,16 @@ SWGChannel::setDirection(qint32 direction) {
     this->m_direction_isSet = true;
 }
 
+qint32
+SWGChannel::getDeviceSetIndex() {
+    return device_set_index;
+}
+void
+SWGChannel::setDeviceSetIndex(qint32 device_set_index) {
+    this->device_set_index = device_set_index;
+    this->m_device_set_index_isSet = true;
+}
+
 qint32
 SWGChannel::getIndex() {
     return index;
@@ -219,6 +250,16 @@ SWGChannel::setReport(SWGChannelReport* report) {
     this->m_report_isSet = true;
 }
 
+SWGChannelSettings*
+SWGChannel::getSettings() {
+    return settings;
+}
+void
+SWGChannel::setSettings(SWGChannelSettings* settings) {
+    this->settings = settings;
+    this->m_settings_isSet = true;
+}
+
 
 bool
 SWGChannel::isSet(){
@@ -227,6 +268,9 @@ SWGChannel::isSet(){
         if(m_direction_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_device_set_index_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_index_isSet){
             isObjectUpdated = true; break;
         }
@@ -245,6 +289,9 @@ SWGChannel::isSet(){
         if(report && report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(settings && settings->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -23,6 +23,7 @@
 
 
 #include "SWGChannelReport.h"
+#include "SWGChannelSettings.h"
 #include <QString>
 
 #include "SWGObject.h"
@@ -46,6 +47,9 @@ public:
     qint32 getDirection();
     void setDirection(qint32 direction);
 
+    qint32 getDeviceSetIndex();
+    void setDeviceSetIndex(qint32 device_set_index);
+
     qint32 getIndex();
     void setIndex(qint32 index);
 
@@ -64,6 +68,9 @@ public:
     SWGChannelReport* getReport();
     void setReport(SWGChannelReport* report);
 
+    SWGChannelSettings* getSettings();
+    void setSettings(SWGChannelSettings* settings);
+
 
     virtual bool isSet() override;
 
@@ -71,6 +78,9 @@ private:
     qint32 direction;
     bool m_direction_isSet;
 
+    qint32 device_set_index;
+    bool m_device_set_index_isSet;
+
     qint32 index;
     bool m_index_isSet;
 
@@ -89,6 +99,9 @@ private:
     SWGChannelReport* report;
     bool m_report_isSet;
 
+    SWGChannelSettings* settings;
+    bool m_settings_isSet;
+
 };
 
 }
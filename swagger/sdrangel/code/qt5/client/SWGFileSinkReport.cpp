@@ -44,6 +44,12 @@ SWGFileSinkReport::SWGFileSinkReport() {
     m_record_size_isSet = false;
     record_captures = 0;
     m_record_captures_isSet = false;
+    record_dropped_bytes = 0L;
+    m_record_dropped_bytes_isSet = false;
+    record_write_latency_avg_us = 0;
+    m_record_write_latency_avg_us_isSet = false;
+    record_write_latency_max_us = 0;
+    m_record_write_latency_max_us_isSet = false;
 }
 
 SWGFileSinkReport::~SWGFileSinkReport() {
@@ -68,6 +74,12 @@ SWGFileSinkReport::init() {
     m_record_size_isSet = false;
     record_captures = 0;
     m_record_captures_isSet = false;
+    record_dropped_bytes = 0L;
+    m_record_dropped_bytes_isSet = false;
+    record_write_latency_avg_us = 0;
+    m_record_write_latency_avg_us_isSet = false;
+    record_write_latency_max_us = 0;
+    m_record_write_latency_max_us_isSet = false;
 }
 
 void
@@ -80,6 +92,9 @@ SWGFileSinkReport::cleanup() {
 
 
 
+
+
+
 }
 
 SWGFileSinkReport*
@@ -109,6 +124,12 @@ SWGFileSinkReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&record_captures, pJson["recordCaptures"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&record_dropped_bytes, pJson["recordDroppedBytes"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&record_write_latency_avg_us, pJson["recordWriteLatencyAvgUs"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&record_write_latency_max_us, pJson["recordWriteLatencyMaxUs"], "qint32", "");
+    
 }
 
 QString
@@ -149,6 +170,15 @@ SWGFileSinkReport::asJsonObject() {
     if(m_record_captures_isSet){
         obj->insert("recordCaptures", QJsonValue(record_captures));
     }
+    if(m_record_dropped_bytes_isSet){
+        obj->insert("recordDroppedBytes", QJsonValue(record_dropped_bytes));
+    }
+    if(m_record_write_latency_avg_us_isSet){
+        obj->insert("recordWriteLatencyAvgUs", QJsonValue(record_write_latency_avg_us));
+    }
+    if(m_record_write_latency_max_us_isSet){
+        obj->insert("recordWriteLatencyMaxUs", QJsonValue(record_write_latency_max_us));
+    }
 
     return obj;
 }
@@ -233,6 +263,36 @@ SWGFileSinkReport::setRecordCaptures(qint32 record_captures) {
     this->m_record_captures_isSet = true;
 }
 
+qint64
+SWGFileSinkReport::getRecordDroppedBytes() {
+    return record_dropped_bytes;
+}
+void
+SWGFileSinkReport::setRecordDroppedBytes(qint64 record_dropped_bytes) {
+    this->record_dropped_bytes = record_dropped_bytes;
+    this->m_record_dropped_bytes_isSet = true;
+}
+
+qint32
+SWGFileSinkReport::getRecordWriteLatencyAvgUs() {
+    return record_write_latency_avg_us;
+}
+void
+SWGFileSinkReport::setRecordWriteLatencyAvgUs(qint32 record_write_latency_avg_us) {
+    this->record_write_latency_avg_us = record_write_latency_avg_us;
+    this->m_record_write_latency_avg_us_isSet = true;
+}
+
+qint32
+SWGFileSinkReport::getRecordWriteLatencyMaxUs() {
+    return record_write_latency_max_us;
+}
+void
+SWGFileSinkReport::setRecordWriteLatencyMaxUs(qint32 record_write_latency_max_us) {
+    this->record_write_latency_max_us = record_write_latency_max_us;
+    this->m_record_write_latency_max_us_isSet = true;
+}
+
 
 bool
 SWGFileSinkReport::isSet(){
@@ -262,6 +322,15 @@ SWGFileSinkReport::isSet(){
         if(m_record_captures_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_record_dropped_bytes_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_record_write_latency_avg_us_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_record_write_latency_max_us_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -78,6 +78,10 @@ SWGGLSpectrum::SWGGLSpectrum() {
     m_ws_spectrum_address_isSet = false;
     ws_spectrum_port = 0;
     m_ws_spectrum_port_isSet = false;
+    zoom_log2 = 0;
+    m_zoom_log2_isSet = false;
+    zoom_position = 0.0f;
+    m_zoom_position_isSet = false;
 }
 
 SWGGLSpectrum::~SWGGLSpectrum() {
@@ -136,6 +140,10 @@ SWGGLSpectrum::init() {
     m_ws_spectrum_address_isSet = false;
     ws_spectrum_port = 0;
     m_ws_spectrum_port_isSet = false;
+    zoom_log2 = 0;
+    m_zoom_log2_isSet = false;
+    zoom_position = 0.0f;
+    m_zoom_position_isSet = false;
 }
 
 void
@@ -230,6 +238,10 @@ SWGGLSpectrum::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&ws_spectrum_port, pJson["wsSpectrumPort"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&zoom_log2, pJson["zoomLog2"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&zoom_position, pJson["zoomPosition"], "float", "");
+    
 }
 
 QString
@@ -321,6 +333,12 @@ SWGGLSpectrum::asJsonObject() {
     if(m_ws_spectrum_port_isSet){
         obj->insert("wsSpectrumPort", QJsonValue(ws_spectrum_port));
     }
+    if(m_zoom_log2_isSet){
+        obj->insert("zoomLog2", QJsonValue(zoom_log2));
+    }
+    if(m_zoom_position_isSet){
+        obj->insert("zoomPosition", QJsonValue(zoom_position));
+    }
 
     return obj;
 }
@@ -575,6 +593,26 @@ SWGGLSpectrum::setWsSpectrumPort(qint32 ws_spectrum_port) {
     this->m_ws_spectrum_port_isSet = true;
 }
 
+qint32
+SWGGLSpectrum::getZoomLog2() {
+    return zoom_log2;
+}
+void
+SWGGLSpectrum::setZoomLog2(qint32 zoom_log2) {
+    this->zoom_log2 = zoom_log2;
+    this->m_zoom_log2_isSet = true;
+}
+
+float
+SWGGLSpectrum::getZoomPosition() {
+    return zoom_position;
+}
+void
+SWGGLSpectrum::setZoomPosition(float zoom_position) {
+    this->zoom_position = zoom_position;
+    this->m_zoom_position_isSet = true;
+}
+
 
 bool
 SWGGLSpectrum::isSet(){
@@ -655,6 +693,12 @@ SWGGLSpectrum::isSet(){
         if(m_ws_spectrum_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_zoom_log2_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_zoom_position_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
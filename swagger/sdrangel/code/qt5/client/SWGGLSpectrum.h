@@ -117,6 +117,12 @@ public:
     qint32 getWsSpectrumPort();
     void setWsSpectrumPort(qint32 ws_spectrum_port);
 
+    qint32 getZoomLog2();
+    void setZoomLog2(qint32 zoom_log2);
+
+    float getZoomPosition();
+    void setZoomPosition(float zoom_position);
+
 
     virtual bool isSet() override;
 
@@ -196,6 +202,12 @@ private:
     qint32 ws_spectrum_port;
     bool m_ws_spectrum_port_isSet;
 
+    qint32 zoom_log2;
+    bool m_zoom_log2_isSet;
+
+    float zoom_position;
+    bool m_zoom_position_isSet;
+
 };
 
 }
@@ -254,6 +254,7 @@
 #include "SWGSoapySDRInputSettings.h"
 #include "SWGSoapySDROutputSettings.h"
 #include "SWGSoapySDRReport.h"
+#include "SWGSpectrumAnalyzers.h"
 #include "SWGSpectrumServer.h"
 #include "SWGSpectrumServer_clients.h"
 #include "SWGStarTrackerDisplayLoSSettings.h"
@@ -1498,6 +1499,11 @@ namespace SWGSDRangel {
       obj->init();
       return obj;
     }
+    if(QString("SWGSpectrumAnalyzers").compare(type) == 0) {
+      SWGSpectrumAnalyzers *obj = new SWGSpectrumAnalyzers();
+      obj->init();
+      return obj;
+    }
     if(QString("SWGSpectrumServer").compare(type) == 0) {
       SWGSpectrumServer *obj = new SWGSpectrumServer();
       obj->init();
@@ -36,6 +36,12 @@ SWGRemoteSinkSettings::SWGRemoteSinkSettings() {
     m_data_port_isSet = false;
     tx_delay = 0;
     m_tx_delay_isSet = false;
+    nb_blocks_per_datagram = 0;
+    m_nb_blocks_per_datagram_isSet = false;
+    compression = 0;
+    m_compression_isSet = false;
+    compression_loss_bits = 0;
+    m_compression_loss_bits_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = nullptr;
@@ -72,6 +78,12 @@ SWGRemoteSinkSettings::init() {
     m_data_port_isSet = false;
     tx_delay = 0;
     m_tx_delay_isSet = false;
+    nb_blocks_per_datagram = 0;
+    m_nb_blocks_per_datagram_isSet = false;
+    compression = 0;
+    m_compression_isSet = false;
+    compression_loss_bits = 0;
+    m_compression_loss_bits_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = new QString("");
@@ -137,6 +149,12 @@ SWGRemoteSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&tx_delay, pJson["txDelay"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&nb_blocks_per_datagram, pJson["nbBlocksPerDatagram"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&compression, pJson["compression"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&compression_loss_bits, pJson["compressionLossBits"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
     
     ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
@@ -185,6 +203,15 @@ SWGRemoteSinkSettings::asJsonObject() {
     if(m_tx_delay_isSet){
         obj->insert("txDelay", QJsonValue(tx_delay));
     }
+    if(m_nb_blocks_per_datagram_isSet){
+        obj->insert("nbBlocksPerDatagram", QJsonValue(nb_blocks_per_datagram));
+    }
+    if(m_compression_isSet){
+        obj->insert("compression", QJsonValue(compression));
+    }
+    if(m_compression_loss_bits_isSet){
+        obj->insert("compressionLossBits", QJsonValue(compression_loss_bits));
+    }
     if(m_rgb_color_isSet){
         obj->insert("rgbColor", QJsonValue(rgb_color));
     }
@@ -259,6 +286,36 @@ SWGRemoteSinkSettings::setTxDelay(qint32 tx_delay) {
     this->m_tx_delay_isSet = true;
 }
 
+qint32
+SWGRemoteSinkSettings::getNbBlocksPerDatagram() {
+    return nb_blocks_per_datagram;
+}
+void
+SWGRemoteSinkSettings::setNbBlocksPerDatagram(qint32 nb_blocks_per_datagram) {
+    this->nb_blocks_per_datagram = nb_blocks_per_datagram;
+    this->m_nb_blocks_per_datagram_isSet = true;
+}
+
+qint32
+SWGRemoteSinkSettings::getCompression() {
+    return compression;
+}
+void
+SWGRemoteSinkSettings::setCompression(qint32 compression) {
+    this->compression = compression;
+    this->m_compression_isSet = true;
+}
+
+qint32
+SWGRemoteSinkSettings::getCompressionLossBits() {
+    return compression_loss_bits;
+}
+void
+SWGRemoteSinkSettings::setCompressionLossBits(qint32 compression_loss_bits) {
+    this->compression_loss_bits = compression_loss_bits;
+    this->m_compression_loss_bits_isSet = true;
+}
+
 qint32
 SWGRemoteSinkSettings::getRgbColor() {
     return rgb_color;
@@ -376,6 +433,15 @@ SWGRemoteSinkSettings::isSet(){
         if(m_tx_delay_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_nb_blocks_per_datagram_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_compression_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_compression_loss_bits_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_rgb_color_isSet){
             isObjectUpdated = true; break;
         }
@@ -54,6 +54,15 @@ public:
     qint32 getTxDelay();
     void setTxDelay(qint32 tx_delay);
 
+    qint32 getNbBlocksPerDatagram();
+    void setNbBlocksPerDatagram(qint32 nb_blocks_per_datagram);
+
+    qint32 getCompression();
+    void setCompression(qint32 compression);
+
+    qint32 getCompressionLossBits();
+    void setCompressionLossBits(qint32 compression_loss_bits);
+
     qint32 getRgbColor();
     void setRgbColor(qint32 rgb_color);
 
@@ -100,6 +109,15 @@ private:
     qint32 tx_delay;
     bool m_tx_delay_isSet;
 
+    qint32 nb_blocks_per_datagram;
+    bool m_nb_blocks_per_datagram_isSet;
+
+    qint32 compression;
+    bool m_compression_isSet;
+
+    qint32 compression_loss_bits;
+    bool m_compression_loss_bits_isSet;
+
     qint32 rgb_color;
     bool m_rgb_color_isSet;
 
@@ -65,6 +65,15 @@ public:
     qint32 getRecordCaptures();
     void setRecordCaptures(qint32 record_captures);
 
+    qint64 getRecordDroppedBytes();
+    void setRecordDroppedBytes(qint64 record_dropped_bytes);
+
+    qint32 getRecordWriteLatencyAvgUs();
+    void setRecordWriteLatencyAvgUs(qint32 record_write_latency_avg_us);
+
+    qint32 getRecordWriteLatencyMaxUs();
+    void setRecordWriteLatencyMaxUs(qint32 record_write_latency_max_us);
+
 
     virtual bool isSet() override;
 
@@ -93,6 +102,15 @@ private:
     qint32 record_captures;
     bool m_record_captures_isSet;
 
+    qint64 record_dropped_bytes;
+    bool m_record_dropped_bytes_isSet;
+
+    qint32 record_write_latency_avg_us;
+    bool m_record_write_latency_avg_us_isSet;
+
+    qint32 record_write_latency_max_us;
+    bool m_record_write_latency_max_us_isSet;
+
 };
 
 }
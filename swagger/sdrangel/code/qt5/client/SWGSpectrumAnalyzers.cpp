@@ -0,0 +1,137 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 6.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumAnalyzers.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumAnalyzers::SWGSpectrumAnalyzers(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumAnalyzers::SWGSpectrumAnalyzers() {
+    count = 0;
+    m_count_isSet = false;
+    analyzers = nullptr;
+    m_analyzers_isSet = false;
+}
+
+SWGSpectrumAnalyzers::~SWGSpectrumAnalyzers() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumAnalyzers::init() {
+    count = 0;
+    m_count_isSet = false;
+    analyzers = new QList<SWGGLSpectrum*>();
+    m_analyzers_isSet = false;
+}
+
+void
+SWGSpectrumAnalyzers::cleanup() {
+
+    if(analyzers != nullptr) { 
+        auto arr = analyzers;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete analyzers;
+    }
+}
+
+SWGSpectrumAnalyzers*
+SWGSpectrumAnalyzers::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumAnalyzers::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&count, pJson["count"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&analyzers, pJson["analyzers"], "QList", "SWGGLSpectrum");
+}
+
+QString
+SWGSpectrumAnalyzers::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumAnalyzers::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_count_isSet){
+        obj->insert("count", QJsonValue(count));
+    }
+    if(analyzers && analyzers->size() > 0){
+        toJsonArray((QList<void*>*)analyzers, obj, "analyzers", "SWGGLSpectrum");
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumAnalyzers::getCount() {
+    return count;
+}
+void
+SWGSpectrumAnalyzers::setCount(qint32 count) {
+    this->count = count;
+    this->m_count_isSet = true;
+}
+
+QList<SWGGLSpectrum*>*
+SWGSpectrumAnalyzers::getAnalyzers() {
+    return analyzers;
+}
+void
+SWGSpectrumAnalyzers::setAnalyzers(QList<SWGGLSpectrum*>* analyzers) {
+    this->analyzers = analyzers;
+    this->m_analyzers_isSet = true;
+}
+
+
+bool
+SWGSpectrumAnalyzers::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(analyzers && (analyzers->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+